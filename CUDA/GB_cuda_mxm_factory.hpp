@@ -110,6 +110,7 @@ class GB_cuda_mxm_factory: public jit::File_Desc
 	    // input:
             C_iso,          // true if C is iso-valued
             C_in_iso,
+            false,          // C is not computed in place
 	    C_sparsity,     // sparsity structure of C
 	    ctype,          // the type of C
             // M matrix:
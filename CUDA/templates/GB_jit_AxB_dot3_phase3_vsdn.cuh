@@ -100,8 +100,6 @@ __global__ void AxB_dot3_phase3_vsdn
     #if GB_A_IS_HYPER
     const int64_t anvec = A->nvec ;
     const int64_t *__restrict__ Ah = A->h ;
-    const int64_t *__restrict__ A_Yp = (A->Y == NULL) ? NULL : A->Y->p ;
-    const int64_t *__restrict__ A_Yi = (A->Y == NULL) ? NULL : A->Y->i ;
     const int64_t *__restrict__ A_Yx = (int64_t *)
         ((A->Y == NULL) ? NULL : A->Y->x) ;
     const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
@@ -110,8 +108,6 @@ __global__ void AxB_dot3_phase3_vsdn
     #if GB_B_IS_HYPER
     const int64_t bnvec = B->nvec ;
     const int64_t *__restrict__ Bh = B->h ;
-    const int64_t *__restrict__ B_Yp = (B->Y == NULL) ? NULL : B->Y->p ;
-    const int64_t *__restrict__ B_Yi = (B->Y == NULL) ? NULL : B->Y->i ;
     const int64_t *__restrict__ B_Yx = (int64_t *)
         ((B->Y == NULL) ? NULL : B->Y->x) ;
     const int64_t B_hash_bits = (B->Y == NULL) ? 0 : (B->Y->vdim - 1) ;
@@ -153,8 +149,8 @@ __global__ void AxB_dot3_phase3_vsdn
         // find A(:,i)
         int64_t pA, pA_end ;
         #if GB_A_IS_HYPER
-        GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yp, A_Yi, A_Yx, A_hash_bits,
-            i, &pA, &pA_end) ;
+        GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yx, A_hash_bits, i, &pA,
+            &pA_end) ;
         #elif GB_A_IS_SPARSE
         pA     = Ap[i] ;
         pA_end = Ap[i+1] ;
@@ -167,8 +163,8 @@ __global__ void AxB_dot3_phase3_vsdn
         // find B(:,j)
         int64_t pB, pB_end ;
         #if GB_B_IS_HYPER
-        GB_hyper_hash_lookup (Bh, bnvec, Bp, B_Yp, B_Yi, B_Yx, B_hash_bits,
-            j, &pB, &pB_end) ;
+        GB_hyper_hash_lookup (Bh, bnvec, Bp, B_Yx, B_hash_bits, j, &pB,
+            &pB_end) ;
         #elif GB_B_IS_SPARSE
         pB       = Bp[j];   // col of C
         pB_end   = Bp[j+1];
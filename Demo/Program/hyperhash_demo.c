@@ -0,0 +1,172 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/hyperhash_demo: lookup throughput of the hyper_hash
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Usage:  hyperhash_demo [nvec [nlookups]]
+
+// A hypersparse matrix A is constructed with nvec non-empty vectors, scattered
+// at random in a huge matrix.  The vectors of A are then found by lookups into
+// its hyperlist, both with a binary search (no hyper_hash) and with the A->Y
+// hyper_hash.  The lookups are done by two methods:  GrB_extractElement for
+// nlookups entries of A (half of them present in A), and C=A*B where B has one
+// entry per column, so that saxpy3 finds one vector of A for each column of B.
+
+#include "GraphBLAS.h"
+#include "simple_rand.h"
+#include "simple_rand.c"
+#ifdef _OPENMP
+#include <omp.h>
+#define TIMER omp_get_wtime ( )
+#else
+#define TIMER 0
+#endif
+
+#undef  OK
+#define OK(method)                                                      \
+{                                                                       \
+    GrB_Info info = (method) ;                                          \
+    if (info != GrB_SUCCESS && info != GrB_NO_VALUE)                    \
+    {                                                                   \
+        printf ("abort at line: %d, info: %d\n", __LINE__, info) ;      \
+        abort ( ) ;                                                     \
+    }                                                                   \
+}
+
+int main (int argc, char **argv)
+{
+
+    // start GraphBLAS
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int nthreads_max = 0 ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &nthreads_max, GxB_NTHREADS)) ;
+    printf ("hyperhash demo: nthreads_max %d\n", nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // construct the tuples
+    //--------------------------------------------------------------------------
+
+    GrB_Index nvec = (argc > 1) ? (GrB_Index) atoll (argv [1]) : 4000000 ;
+    GrB_Index nlookups = (argc > 2) ? (GrB_Index) atoll (argv [2]) : 10000000;
+    GrB_Index n = ((GrB_Index) 1) << 40 ;
+    printf ("nvec: %g nlookups: %g\n", (double) nvec, (double) nlookups) ;
+    simple_rand_seed (1) ;
+
+    // A(I[k],J[k]) for nvec random vectors J[k], and B(J[k],k)
+    GrB_Index *I = malloc (nvec * sizeof (GrB_Index)) ;
+    GrB_Index *J = malloc (nvec * sizeof (GrB_Index)) ;
+    GrB_Index *K = malloc (nvec * sizeof (GrB_Index)) ;
+    double    *X = malloc (nvec * sizeof (double)) ;
+    // the entries to find in A
+    GrB_Index *Ilook = malloc (nlookups * sizeof (GrB_Index)) ;
+    GrB_Index *Jlook = malloc (nlookups * sizeof (GrB_Index)) ;
+    if (I == NULL || J == NULL || K == NULL || X == NULL || Ilook == NULL
+        || Jlook == NULL)
+    {
+        printf ("out of memory\n") ;
+        abort ( ) ;
+    }
+    for (int64_t k = 0 ; k < nvec ; k++)
+    {
+        I [k] = simple_rand_i ( ) % 1000 ;
+        J [k] = simple_rand_i ( ) % n ;
+        K [k] = k ;
+        X [k] = 1 ;
+    }
+    for (int64_t k = 0 ; k < nlookups ; k++)
+    {
+        // half of the lookups are for entries present in A
+        int64_t t = simple_rand_i ( ) % nvec ;
+        Ilook [k] = I [t] ;
+        Jlook [k] = (k % 2 == 0) ? J [t] : (simple_rand_i ( ) % n) ;
+    }
+
+    // B is n-by-nvec, with B(J[k],k) = 1, so each column of C=A*B is one
+    // vector of A
+    GrB_Matrix A = NULL, B = NULL, C = NULL ;
+    GrB_Scalar hyper_hash = NULL ;
+    OK (GrB_Scalar_new (&hyper_hash, GrB_INT64)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, n, nvec)) ;
+    OK (GrB_set (B, GrB_COLMAJOR, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_build (B, J, K, X, nvec, GrB_PLUS_FP64)) ;
+    OK (GrB_wait (B, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // lookups without and with the hyper_hash
+    //--------------------------------------------------------------------------
+
+    double tlook [2], tmxm [2] ;
+    int64_t nfound [2] ;
+    for (int with_hash = 0 ; with_hash <= 1 ; with_hash++)
+    {
+        // the hyper_hash is built only if A has more than hyper_hash vectors
+        OK (GrB_Scalar_setElement_INT64 (hyper_hash,
+            with_hash ? 0 : INT64_MAX)) ;
+        OK (GrB_Global_set_Scalar (GrB_GLOBAL, hyper_hash, GxB_HYPER_HASH)) ;
+
+        // build A
+        OK (GrB_Matrix_new (&A, GrB_FP64, 1000, n)) ;
+        OK (GrB_set (A, GrB_COLMAJOR, GrB_STORAGE_ORIENTATION_HINT)) ;
+        OK (GrB_set (A, GxB_HYPERSPARSE, GxB_SPARSITY_CONTROL)) ;
+        double t = TIMER ;
+        OK (GrB_Matrix_build (A, I, J, X, nvec, GrB_PLUS_FP64)) ;
+        OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+        t = TIMER - t ;
+        printf ("\n%s hyper_hash: build A %g sec\n",
+            with_hash ? "with" : "without", t) ;
+
+        // find entries of A with GrB_extractElement
+        t = TIMER ;
+        int64_t found = 0 ;
+        for (int64_t k = 0 ; k < nlookups ; k++)
+        {
+            double x ;
+            GrB_Info info = GrB_Matrix_extractElement_FP64 (&x, A,
+                Ilook [k], Jlook [k]) ;
+            OK (info) ;
+            found += (info == GrB_SUCCESS) ;
+        }
+        tlook [with_hash] = TIMER - t ;
+        nfound [with_hash] = found ;
+        printf ("   extractElement: %g sec, %g million lookups/sec"
+            " (%g found)\n", tlook [with_hash],
+            1e-6 * nlookups / tlook [with_hash], (double) found) ;
+
+        // C = A*B with the saxpy3 method
+        t = TIMER ;
+        OK (GrB_Matrix_new (&C, GrB_FP64, 1000, nvec)) ;
+        OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            NULL)) ;
+        OK (GrB_wait (C, GrB_MATERIALIZE)) ;
+        tmxm [with_hash] = TIMER - t ;
+        GrB_Index cnvals ;
+        OK (GrB_Matrix_nvals (&cnvals, C)) ;
+        printf ("   C=A*B:          %g sec (nvals(C) %g)\n", tmxm [with_hash],
+            (double) cnvals) ;
+        OK (GrB_Matrix_free (&C)) ;
+        OK (GrB_Matrix_free (&A)) ;
+    }
+
+    printf ("\nspeedup of the hyper_hash: extractElement %g, C=A*B %g\n",
+        tlook [0] / tlook [1], tmxm [0] / tmxm [1]) ;
+    if (nfound [0] != nfound [1])
+    {
+        printf ("results differ!\n") ;
+        abort ( ) ;
+    }
+
+    free (I) ;
+    free (J) ;
+    free (X) ;
+    free (K) ;
+    free (Ilook) ;
+    free (Jlook) ;
+    OK (GrB_Matrix_free (&B)) ;
+    OK (GrB_Scalar_free (&hyper_hash)) ;
+    OK (GrB_finalize ( )) ;
+}
+
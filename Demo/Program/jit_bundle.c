@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/jit_bundle: bundle kernels in the JIT cache
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Usage:
+//
+//      jit_bundle              bundle all kernels in the index of the cache
+//      jit_bundle trace.txt    bundle the kernels listed in trace.txt
+//
+// Compiles the kernels in the JIT cache into a single library, which is
+// loaded by GrB_init in any process that uses the same cache (see
+// GxB_JIT_BUNDLE in the User Guide).  The trace file lists one kernel per
+// line: its name, optionally followed by its hash in hex.  The cache folder
+// can be selected with the GRAPHBLAS_CACHE_PATH environment variable.
+
+#include "GraphBLAS.h"
+#undef I
+
+int main (int argc, char **argv)
+{
+
+    char *trace = (argc > 1) ? argv [1] : "" ;
+
+    GrB_Info info = GrB_init (GrB_NONBLOCKING) ;
+    if (info != GrB_SUCCESS)
+    {
+        fprintf (stderr, "jit_bundle: unable to start GraphBLAS\n") ;
+        return (1) ;
+    }
+
+    size_t len = 0 ;
+    GrB_Global_get_SIZE (GrB_GLOBAL, &len, GxB_JIT_CACHE_PATH) ;
+    char *cache = malloc (len + 1) ;
+    if (cache != NULL)
+    {
+        GrB_Global_get_String (GrB_GLOBAL, cache, GxB_JIT_CACHE_PATH) ;
+        printf ("JIT cache: %s\n", cache) ;
+        free (cache) ;
+    }
+    printf ("trace:     %s\n",
+        (strlen (trace) == 0) ? "(index of the JIT cache)" : trace) ;
+
+    info = GrB_Global_set_String (GrB_GLOBAL, trace, GxB_JIT_BUNDLE) ;
+    switch (info)
+    {
+        case GrB_SUCCESS :
+            printf ("bundle created\n") ;
+            break ;
+        case GrB_INVALID_VALUE :
+            printf ("unable to read the trace\n") ;
+            break ;
+        case GrB_NO_VALUE :
+            printf ("bundle not created (no kernels, or JIT disabled)\n") ;
+            break ;
+        default :
+            printf ("bundle not created (error %d)\n", info) ;
+            break ;
+    }
+
+    GrB_finalize ( ) ;
+    return ((info == GrB_SUCCESS) ? 0 : 1) ;
+}
+
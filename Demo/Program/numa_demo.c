@@ -0,0 +1,154 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/numa_demo: NUMA policies and thread scaling
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Usage:  numa_demo [n [nvals]]
+
+// For each GxB_NUMA_POLICY, and for 1, 2, 4, ... threads up to the maximum,
+// a random n-by-n matrix A is built, and then C=A*A (saxpy3) and C<A>=A*A'
+// (dot3) are computed, all inside a GxB_Context with the given policy and
+// number of threads.  To scale the computation from one socket to all
+// sockets, pin the OpenMP threads with (for example):
+//
+//      OMP_PROC_BIND=close OMP_PLACES=cores ./numa_demo
+//
+// so that the first threads fill one socket before using the next.
+
+#include "GraphBLAS.h"
+#include "simple_rand.h"
+#include "simple_rand.c"
+#define MIN(x,y) ((x) < (y)) ? (x) : (y)
+#ifdef _OPENMP
+#include <omp.h>
+#define TIMER omp_get_wtime ( )
+#else
+#define TIMER 0
+#endif
+
+#undef  OK
+#define OK(method)                                                      \
+{                                                                       \
+    GrB_Info info = (method) ;                                          \
+    if (info != GrB_SUCCESS)                                            \
+    {                                                                   \
+        printf ("abort at line: %d, info: %d\n", __LINE__, info) ;      \
+        abort ( ) ;                                                     \
+    }                                                                   \
+}
+
+int main (int argc, char **argv)
+{
+
+    // start GraphBLAS
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+
+    int nthreads_max = 0 ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &nthreads_max, GxB_NTHREADS)) ;
+    nthreads_max = MIN (nthreads_max, 1024) ;
+    printf ("numa demo: nthreads_max %d\n", nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // construct tuples for a random matrix
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = (argc > 1) ? (GrB_Index) atoll (argv [1]) : 200000 ;
+    GrB_Index nvals = (argc > 2) ? (GrB_Index) atoll (argv [2]) : 4000000 ;
+    printf ("n: %g nvals: %g\n", (double) n, (double) nvals) ;
+    simple_rand_seed (1) ;
+    GrB_Index *I = malloc (nvals * sizeof (GrB_Index)) ;
+    GrB_Index *J = malloc (nvals * sizeof (GrB_Index)) ;
+    double    *X = malloc (nvals * sizeof (double)) ;
+    if (I == NULL || J == NULL || X == NULL)
+    {
+        printf ("out of memory\n") ;
+        abort ( ) ;
+    }
+    for (int64_t k = 0 ; k < nvals ; k++)
+    {
+        I [k] = simple_rand_i ( ) % n ;
+        J [k] = simple_rand_i ( ) % n ;
+        X [k] = simple_rand_x ( ) ;
+    }
+
+    GrB_Descriptor desc = NULL ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GrB_TRAN, GrB_INP1)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_AxB_DOT, GxB_AxB_METHOD)) ;
+
+    //--------------------------------------------------------------------------
+    // try each policy with an increasing number of threads
+    //--------------------------------------------------------------------------
+
+    const char *policy_name [4] =
+        { "default", "first touch", "interleave", "local" } ;
+    int policies [4] = { GxB_NUMA_DEFAULT, GxB_NUMA_FIRST_TOUCH,
+        GxB_NUMA_INTERLEAVE, GxB_NUMA_LOCAL } ;
+
+    for (int p = 0 ; p < 4 ; p++)
+    {
+        printf ("\nNUMA policy: %s\n", policy_name [p]) ;
+        double t1 [3] = { 0, 0, 0 } ;
+
+        for (int nthreads = 1 ; nthreads <= nthreads_max ; nthreads *= 2)
+        {
+            GxB_Context Context = NULL ;
+            OK (GxB_Context_new (&Context)) ;
+            OK (GrB_set (Context, nthreads, GxB_NTHREADS)) ;
+            OK (GrB_set (Context, policies [p], GxB_NUMA_POLICY)) ;
+            OK (GxB_Context_engage (Context)) ;
+
+            double t [3] ;
+            GrB_Matrix A = NULL, C = NULL ;
+
+            // build A
+            t [0] = TIMER ;
+            OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+            OK (GrB_Matrix_build (A, I, J, X, nvals, GrB_PLUS_FP64)) ;
+            OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+            t [0] = TIMER - t [0] ;
+
+            // C = A*A with the saxpy method
+            t [1] = TIMER ;
+            OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+            OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+                NULL)) ;
+            OK (GrB_wait (C, GrB_MATERIALIZE)) ;
+            OK (GrB_Matrix_free (&C)) ;
+            t [1] = TIMER - t [1] ;
+
+            // C<A> = A*A' with the dot product method
+            t [2] = TIMER ;
+            OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+            OK (GrB_mxm (C, A, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+                desc)) ;
+            OK (GrB_wait (C, GrB_MATERIALIZE)) ;
+            OK (GrB_Matrix_free (&C)) ;
+            t [2] = TIMER - t [2] ;
+
+            OK (GrB_Matrix_free (&A)) ;
+            OK (GxB_Context_disengage (Context)) ;
+            OK (GxB_Context_free (&Context)) ;
+
+            if (nthreads == 1)
+            {
+                for (int k = 0 ; k < 3 ; k++) t1 [k] = t [k] ;
+            }
+            printf ("   threads %4d: build %8.4f (%6.2f) saxpy3 %8.4f (%6.2f)"
+                " dot3 %8.4f (%6.2f)\n", nthreads,
+                t [0], t1 [0] / t [0], t [1], t1 [1] / t [1],
+                t [2], t1 [2] / t [2]) ;
+        }
+    }
+
+    free (I) ;
+    free (J) ;
+    free (X) ;
+    OK (GrB_free (&desc)) ;
+    OK (GrB_finalize ( )) ;
+}
+
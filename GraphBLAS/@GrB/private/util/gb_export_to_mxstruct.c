@@ -21,7 +21,10 @@
 // but always false for GraphBLASv5.
 
 // GraphBLASv7_3 is identical to GraphBLASv5_1, except that it adds the Y
-// hyper_hash with 3 components: Yp, Yi, and Yx.
+// hyper_hash with 3 components: Yp, Yi, and Yx.  As of GraphBLAS v9.1, the
+// hyper_hash is a full matrix, so Yp and Yi are empty and Yx holds the
+// entire hash table.  The sparse Yp, Yi, and Yx components of v9.0 and
+// earlier are ignored by gb_get_shallow.
 
 // mxGetData and mxSetData are used instead of the MATLAB-recommended
 // mxGetDoubles, etc, because mxGetData and mxSetData work best for Octave, and
@@ -44,9 +47,9 @@ static const char *MatrixFields [9] =
     "i",                // 4: array of int64_t, size nzmax
     "h",                // 5: array of int64_t, size plen if hypersparse
     // added for v7.2: for hypersparse matrices only:
-    "Yp",               // 6: Y->p, a uint64_t array of size Y->vdim+1
-    "Yi",               // 7: Y->i, a uint64_t array of size nvec (s[3])
-    "Yx"                // 8: Y->x, an int64_t array of size nvec
+    "Yp",               // 6: empty (Y->p for v9.0 and earlier)
+    "Yi",               // 7: empty (Y->i for v9.0 and earlier)
+    "Yx"                // 8: Y->x, a uint64_t array of size Y->vlen*Y->vdim
 } ;
 
 // for bitmap matrices only
@@ -126,8 +129,6 @@ mxArray *gb_export_to_mxstruct  // return exported built-in struct G
     bool iso = false ;
 
     GrB_Type ytype = NULL ;
-    uint64_t *Yp = NULL ; GrB_Index Yp_size = 0 ;
-    uint64_t *Yi = NULL ; GrB_Index Yi_size = 0 ;
     void     *Yx = NULL ; GrB_Index Yx_size = 0 ;
     uint64_t yvdim, ynrows ;
 
@@ -163,14 +164,13 @@ mxArray *gb_export_to_mxstruct  // return exported built-in struct G
 
         case GxB_HYPERSPARSE :
 
-            // export and free the A->Y hyper_hash.  It is always sparse,
+            // export and free the A->Y hyper_hash.  It is always full,
             // GrB_UINT64, held by column, and non-iso
             OK (GxB_unpack_HyperHash (A, &Y, NULL)) ;
             if (Y != NULL)
             {
-                OK (GxB_Matrix_export_CSC (&Y, &ytype, &ynrows, &yvdim,
-                    &Yp, &Yi, &Yx, &Yp_size, &Yi_size, &Yx_size,
-                    NULL, NULL, NULL)) ;
+                OK (GxB_Matrix_export_FullC (&Y, &ytype, &ynrows, &yvdim,
+                    &Yx, &Yx_size, NULL, NULL)) ;
             }
 
             // export and free the rest of the hypersparse matrix
@@ -228,7 +228,7 @@ mxArray *gb_export_to_mxstruct  // return exported built-in struct G
         case GxB_HYPERSPARSE :
             // A is hypersparse, with 6 or 9 fields: GraphBLAS*, s, x, p, i, h,
             // Yp, Yi, Yx
-            G = mxCreateStructMatrix (1, 1, (Yp == NULL) ? 6 : 9,
+            G = mxCreateStructMatrix (1, 1, (Yx == NULL) ? 6 : 9,
                 MatrixFields) ;
             break ;
 
@@ -312,30 +312,22 @@ mxArray *gb_export_to_mxstruct  // return exported built-in struct G
         }
         mxSetFieldByNumber (G, 0, 5, Ah_mx) ;
 
-        if (Yp != NULL)
+        if (Yx != NULL)
         {
 
-            // export Yp, of size yvdim+1
+            // Yp and Yi are empty
             mxArray *Yp_mx = mxCreateNumericMatrix (1, 0, mxUINT64_CLASS,
                 mxREAL) ;
-            mxSetN (Yp_mx, yvdim+1) ;
-            void *p = (void *) mxGetData (Yp_mx) ; gb_mxfree (&p) ;
-            mxSetData (Yp_mx, Yp) ;
             mxSetFieldByNumber (G, 0, 6, Yp_mx) ;
-
-            // export Yi, of size nvec
             mxArray *Yi_mx = mxCreateNumericMatrix (1, 0, mxUINT64_CLASS,
                 mxREAL) ;
-            mxSetN (Yi_mx, nvec) ;
-            p = (void *) mxGetData (Yi_mx) ; gb_mxfree (&p) ;
-            mxSetData (Yi_mx, Yi) ;
             mxSetFieldByNumber (G, 0, 7, Yi_mx) ;
 
-            // export Yx, of size nvec
+            // export Yx, of size ynrows*yvdim
             mxArray *Yx_mx = mxCreateNumericMatrix (1, 0, mxUINT64_CLASS,
                 mxREAL) ;
-            mxSetN (Yx_mx, nvec) ;
-            p = (void *) mxGetData (Yx_mx) ; gb_mxfree (&p) ;
+            mxSetN (Yx_mx, ynrows * yvdim) ;
+            void *p = (void *) mxGetData (Yx_mx) ; gb_mxfree (&p) ;
             mxSetData (Yx_mx, Yx) ;
             mxSetFieldByNumber (G, 0, 8, Yx_mx) ;
         }
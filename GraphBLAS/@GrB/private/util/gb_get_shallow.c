@@ -20,6 +20,9 @@
 // For v5, iso is present but false, and the s component has length 10.
 // For v5_1, iso is true/false, and the s component has length 10.
 // For v7_3: the same content as v5_1, except that Yp, Yi, and Yx are added.
+// If Yp is empty, Yx holds the full A->Y hyper_hash of GraphBLAS v9.1 and
+// later.  Otherwise, Yp, Yi, and Yx hold the sparse A->Y hyper_hash of v9.0
+// and earlier, which is ignored (the hyper_hash is rebuilt when needed).
 
 // mxGetData is used instead of the MATLAB-recommended mxGetDoubles, etc,
 // because mxGetData works best for Octave, and it works fine for MATLAB
@@ -188,8 +191,6 @@ GrB_Matrix gb_get_shallow   // return a shallow copy of built-in sparse matrix
         int8_t   *Ab = NULL ; size_t Ab_size = 0 ;
         uint64_t *Ai = NULL ; size_t Ai_size = 0 ;
         void     *Ax = NULL ; size_t Ax_size = 0 ; 
-        uint64_t *Yp = NULL ; size_t Yp_size = 0 ;
-        uint64_t *Yi = NULL ; size_t Yi_size = 0 ;
         void     *Yx = NULL ; size_t Yx_size = 0 ;
         int64_t yvdim = 0 ; 
 
@@ -233,31 +234,22 @@ GrB_Matrix gb_get_shallow   // return a shallow copy of built-in sparse matrix
 
             if (nfields == 9)
             {
-                // get Yp, Yi, and Yx
-
-                // Yp must be 1-by-(yvdim+1)
+                // get Yp and Yx; a non-empty Yp is the sparse hyper_hash of
+                // v9.0 and earlier, which is ignored
                 mxArray *Yp_mx = mxGetField (X, 0, "Yp") ;
                 IF (Yp_mx == NULL, ".Yp missing") ;
-                IF (mxGetM (Yp_mx) != 1, ".Yp wrong size") ;
-                yvdim = mxGetN (Yp_mx) - 1 ;
-                Yp_size = mxGetN (Yp_mx) * sizeof (uint64_t) ;
-                Yp = (Yp_size == 0) ? NULL : ((uint64_t *) mxGetData (Yp_mx)) ;
-
-                // Yi must be 1-by-nvec
-                mxArray *Yi_mx = mxGetField (X, 0, "Yi") ;
-                IF (Yi_mx == NULL, ".Yi missing") ;
-                IF (mxGetM (Yi_mx) != 1, ".Yi wrong size") ;
-                IF (mxGetN (Yi_mx) != nvec, ".Yi wrong size") ;
-                Yi_size = mxGetN (Yi_mx) * sizeof (uint64_t) ;
-                Yi = (Yi_size == 0) ? NULL : ((uint64_t *) mxGetData (Yi_mx)) ;
-
-                // Yx must be 1-by-nvec
-                mxArray *Yx_mx = mxGetField (X, 0, "Yx") ;
-                IF (Yx_mx == NULL, ".Yx missing") ;
-                IF (mxGetM (Yx_mx) != 1, ".Yx wrong size") ;
-                IF (mxGetN (Yx_mx) != nvec, ".Yx wrong size") ;
-                Yx_size = mxGetN (Yx_mx) * sizeof (int64_t) ;
-                Yx = (Yx_size == 0) ? NULL : ((void *) mxGetData (Yx_mx)) ;
+                if (mxGetNumberOfElements (Yp_mx) == 0)
+                {
+                    // Yx must be 1-by-(16*yvdim)
+                    int64_t yvlen = 2 * GB_HYPER_HASH_GROUP ;
+                    mxArray *Yx_mx = mxGetField (X, 0, "Yx") ;
+                    IF (Yx_mx == NULL, ".Yx missing") ;
+                    IF (mxGetM (Yx_mx) != 1, ".Yx wrong size") ;
+                    IF (mxGetN (Yx_mx) % yvlen != 0, ".Yx wrong size") ;
+                    yvdim = mxGetN (Yx_mx) / yvlen ;
+                    Yx_size = mxGetN (Yx_mx) * sizeof (uint64_t) ;
+                    Yx = (Yx_size == 0) ? NULL : ((void *) mxGetData (Yx_mx)) ;
+                }
             }
         }
 
@@ -347,15 +339,14 @@ GrB_Matrix gb_get_shallow   // return a shallow copy of built-in sparse matrix
         // import the A->Y hyper_hash, if it exists
         //----------------------------------------------------------------------
 
-        if (nfields == 9)
+        if (Yx != NULL)
         {
-            // A->Y is sparse, uint64, (A->vdim)-by-yvdim, held by column
-            OK (GrB_Matrix_new (&Y, GrB_UINT64, vdim, yvdim)) ;
+            // A->Y is full, uint64, 16-by-yvdim, held by column
+            OK (GrB_Matrix_new (&Y, GrB_UINT64, 2 * GB_HYPER_HASH_GROUP,
+                yvdim)) ;
             OK (GxB_Matrix_Option_set (Y, GxB_FORMAT, GxB_BY_COL)) ;
-            OK (GxB_Matrix_pack_CSC (Y,
-                &Yp, &Yi, &Yx, Yp_size, Yi_size, Yx_size, false,
-                false, NULL)) ;
-            OK (GxB_Matrix_Option_set (Y, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+            OK (GxB_Matrix_pack_FullC (Y, &Yx, Yx_size, false, NULL)) ;
+            OK (GxB_Matrix_Option_set (Y, GxB_SPARSITY_CONTROL, GxB_FULL)) ;
             OK (GxB_pack_HyperHash (A, &Y, NULL)) ;
         }
 
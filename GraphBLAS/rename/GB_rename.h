@@ -2,6 +2,7 @@
 #define GB_add GM_add
 #define GB_add_iso GM_add_iso
 #define GB_add_jit GM_add_jit
+#define GB_add_n GM_add_n
 #define GB_add_phase0 GM_add_phase0
 #define GB_add_phase1 GM_add_phase1
 #define GB_add_phase2 GM_add_phase2
@@ -36,6 +37,7 @@
 #define GB_AxB_dot GM_AxB_dot
 #define GB_AxB_iso GM_AxB_iso
 #define GB_AxB_meta_adotb_control GM_AxB_meta_adotb_control
+#define GB_AxB_meta_direction GM_AxB_meta_direction
 #define GB_AxB_meta GM_AxB_meta
 #define GB_AxB_saxbit_generic_first GM_AxB_saxbit_generic_first
 #define GB_AxB_saxbit_generic_firsti32 GM_AxB_saxbit_generic_firsti32
@@ -63,6 +65,12 @@
 #define GB_AxB_saxpy3_generic_unflipped GM_AxB_saxpy3_generic_unflipped
 #define GB_AxB_saxpy3 GM_AxB_saxpy3
 #define GB_AxB_saxpy3_jit GM_AxB_saxpy3_jit
+#define GB_AxB_saxpy3_plan_free GM_AxB_saxpy3_plan_free
+#define GB_AxB_saxpy3_plan_match GM_AxB_saxpy3_plan_match
+#define GB_AxB_saxpy3_plan_restore_Cp GM_AxB_saxpy3_plan_restore_Cp
+#define GB_AxB_saxpy3_plan_save GM_AxB_saxpy3_plan_save
+#define GB_AxB_saxpy3_plan_save_Cp GM_AxB_saxpy3_plan_save_Cp
+#define GB_AxB_saxpy3_plan_tasks GM_AxB_saxpy3_plan_tasks
 #define GB_AxB_saxpy3_slice_balanced GM_AxB_saxpy3_slice_balanced
 #define GB_AxB_saxpy3_slice_quick GM_AxB_saxpy3_slice_quick
 #define GB_AxB_saxpy3_sym_bh GM_AxB_saxpy3_sym_bh
@@ -285,6 +293,8 @@
 #define GB_Descriptor_get GM_Descriptor_get
 #define GB_deserialize_from_blob GM_deserialize_from_blob
 #define GB_deserialize GM_deserialize
+#define GB_deserialize_delta GM_deserialize_delta
+#define GB_deserialize_delta_header GM_deserialize_delta_header
 #define GB_dup GM_dup
 #define GB_dup_worker GM_dup_worker
 #define GB_ek_slice GM_ek_slice
@@ -302,6 +312,7 @@
 #define GB_emult_08_phase1 GM_emult_08_phase1
 #define GB_emult_08_phase2 GM_emult_08_phase2
 #define GB_emult_bitmap GM_emult_bitmap
+#define GB_emult_bitmap_accum GM_emult_bitmap_accum
 #define GB_emult_bitmap_jit GM_emult_bitmap_jit
 #define GB_emult_generic GM_emult_generic
 #define GB_emult GM_emult
@@ -343,6 +354,7 @@
 #define GB_expand_iso GM_expand_iso
 #define GB_export GM_export
 #define GB_extract GM_extract
+#define GB_extractElements GM_extractElements
 #define GB_extractTuples GM_extractTuples
 #define GB_extract_vector_list GM_extract_vector_list
 #define GB_factory_kernels_enabled GM_factory_kernels_enabled
@@ -356,6 +368,7 @@
 #define GB_file_mkdir GM_file_mkdir
 #define GB_file_open_and_lock GM_file_open_and_lock
 #define GB_file_unlock_and_close GM_file_unlock_and_close
+#define GB_find_elements GM_find_elements
 #define GB_flip_binop GM_flip_binop
 #define GB_free_memory GM_free_memory
 #define GB_frexpef GM_frexpef
@@ -935,6 +948,8 @@
 #define GB_msort_3_create_merge_tasks GM_msort_3_create_merge_tasks
 #define GB_msort_3 GM_msort_3
 #define GB_mxm GM_mxm
+#define GB_mxm_reduce GM_mxm_reduce
+#define GB_mxv_batch GM_mxv_batch
 #define GB_new_bix GM_new_bix
 #define GB_new GM_new
 #define GB_nnz_full GM_nnz_full
@@ -1032,11 +1047,17 @@
 #define GB_serialize_array GM_serialize_array
 #define GB_serialize_free_blocks GM_serialize_free_blocks
 #define GB_serialize GM_serialize
+#define GB_serialize_delta GM_serialize_delta
 #define GB_serialize_method GM_serialize_method
 #define GB_serialize_to_blob GM_serialize_to_blob
 #define GB_setElement GM_setElement
+#define GB_setElements GM_setElements
 #define GB_shallow_copy GM_shallow_copy
 #define GB_shallow_op GM_shallow_op
+#define GB_shm_attach GM_shm_attach
+#define GB_shm_free GM_shm_free
+#define GB_shm_publish GM_shm_publish
+#define GB_shm_unshare GM_shm_unshare
 #define GB_signumf GM_signumf
 #define GB_signum GM_signum
 #define GB_slice_vector GM_slice_vector
@@ -1096,6 +1117,11 @@
 #define GB_transpose_bind1st_jit GM_transpose_bind1st_jit
 #define GB_transpose_bind2nd_jit GM_transpose_bind2nd_jit
 #define GB_transpose_bucket GM_transpose_bucket
+#define GB_transpose_cache_build GM_transpose_cache_build
+#define GB_transpose_cache_cast GM_transpose_cache_cast
+#define GB_transpose_cache_free GM_transpose_cache_free
+#define GB_transpose_cache_need GM_transpose_cache_need
+#define GB_transpose_cache_swap GM_transpose_cache_swap
 #define GB_transpose_cast GM_transpose_cast
 #define GB_transpose GM_transpose
 #define GB_transpose_in_place GM_transpose_in_place
@@ -3019,6 +3045,36 @@
 #define GxB_Desc_set_FP64 GxM_Desc_set_FP64
 #define GxB_Desc_set GxM_Desc_set
 #define GxB_Desc_set_INT32 GxM_Desc_set_INT32
+#define GxB_Matrix_extractElements_BOOL GxM_Matrix_extractElements_BOOL
+#define GxB_Matrix_extractElements_FC32 GxM_Matrix_extractElements_FC32
+#define GxB_Matrix_extractElements_FC64 GxM_Matrix_extractElements_FC64
+#define GxB_Matrix_extractElements_FP32 GxM_Matrix_extractElements_FP32
+#define GxB_Matrix_extractElements_FP64 GxM_Matrix_extractElements_FP64
+#define GxB_Matrix_extractElements_INT16 GxM_Matrix_extractElements_INT16
+#define GxB_Matrix_extractElements_INT32 GxM_Matrix_extractElements_INT32
+#define GxB_Matrix_extractElements_INT64 GxM_Matrix_extractElements_INT64
+#define GxB_Matrix_extractElements_INT8 GxM_Matrix_extractElements_INT8
+#define GxB_Matrix_extractElements_UDT GxM_Matrix_extractElements_UDT
+#define GxB_Matrix_extractElements_UINT16 GxM_Matrix_extractElements_UINT16
+#define GxB_Matrix_extractElements_UINT32 GxM_Matrix_extractElements_UINT32
+#define GxB_Matrix_extractElements_UINT64 GxM_Matrix_extractElements_UINT64
+#define GxB_Matrix_extractElements_UINT8 GxM_Matrix_extractElements_UINT8
+#define GxB_Matrix_isStoredElements GxM_Matrix_isStoredElements
+#define GxB_Matrix_removeElements GxM_Matrix_removeElements
+#define GxB_Matrix_setElements_BOOL GxM_Matrix_setElements_BOOL
+#define GxB_Matrix_setElements_FC32 GxM_Matrix_setElements_FC32
+#define GxB_Matrix_setElements_FC64 GxM_Matrix_setElements_FC64
+#define GxB_Matrix_setElements_FP32 GxM_Matrix_setElements_FP32
+#define GxB_Matrix_setElements_FP64 GxM_Matrix_setElements_FP64
+#define GxB_Matrix_setElements_INT16 GxM_Matrix_setElements_INT16
+#define GxB_Matrix_setElements_INT32 GxM_Matrix_setElements_INT32
+#define GxB_Matrix_setElements_INT64 GxM_Matrix_setElements_INT64
+#define GxB_Matrix_setElements_INT8 GxM_Matrix_setElements_INT8
+#define GxB_Matrix_setElements_UDT GxM_Matrix_setElements_UDT
+#define GxB_Matrix_setElements_UINT16 GxM_Matrix_setElements_UINT16
+#define GxB_Matrix_setElements_UINT32 GxM_Matrix_setElements_UINT32
+#define GxB_Matrix_setElements_UINT64 GxM_Matrix_setElements_UINT64
+#define GxB_Matrix_setElements_UINT8 GxM_Matrix_setElements_UINT8
 #define GxB_deserialize_type_name GxM_deserialize_type_name
 #define GxB_DIAG GxM_DIAG
 #define GxB_DIV_FC32 GxM_DIV_FC32
@@ -3547,12 +3603,15 @@
 #define GxB_Matrix_apply_IndexOp_FC64 GxM_Matrix_apply_IndexOp_FC64
 #define GxB_Matrix_assign_FC32 GxM_Matrix_assign_FC32
 #define GxB_Matrix_assign_FC64 GxM_Matrix_assign_FC64
+#define GxB_Matrix_attach GxM_Matrix_attach
 #define GxB_Matrix_build_FC32 GxM_Matrix_build_FC32
 #define GxB_Matrix_build_FC64 GxM_Matrix_build_FC64
 #define GxB_Matrix_build_Scalar GxM_Matrix_build_Scalar
 #define GxB_Matrix_concat GxM_Matrix_concat
 #define GxB_Matrix_deserialize GxM_Matrix_deserialize
+#define GxB_Matrix_deserialize_delta GxM_Matrix_deserialize_delta
 #define GxB_Matrix_diag GxM_Matrix_diag
+#define GxB_Matrix_eWiseAdd_n GxM_Matrix_eWiseAdd_n
 #define GxB_Matrix_eWiseUnion GxM_Matrix_eWiseUnion
 #define GxB_Matrix_export_BitmapC GxM_Matrix_export_BitmapC
 #define GxB_Matrix_export_BitmapR GxM_Matrix_export_BitmapR
@@ -3596,6 +3655,7 @@
 #define GxB_Matrix_pack_FullR GxM_Matrix_pack_FullR
 #define GxB_Matrix_pack_HyperCSC GxM_Matrix_pack_HyperCSC
 #define GxB_Matrix_pack_HyperCSR GxM_Matrix_pack_HyperCSR
+#define GxB_Matrix_publish GxM_Matrix_publish
 #define GxB_Matrix_reduce_FC32 GxM_Matrix_reduce_FC32
 #define GxB_Matrix_reduce_FC64 GxM_Matrix_reduce_FC64
 #define GxB_Matrix_reshapeDup GxM_Matrix_reshapeDup
@@ -3605,6 +3665,7 @@
 #define GxB_Matrix_select_FC64 GxM_Matrix_select_FC64
 #define GxB_Matrix_select GxM_Matrix_select
 #define GxB_Matrix_serialize GxM_Matrix_serialize
+#define GxB_Matrix_serialize_delta GxM_Matrix_serialize_delta
 #define GxB_Matrix_setElement_FC32 GxM_Matrix_setElement_FC32
 #define GxB_Matrix_setElement_FC64 GxM_Matrix_setElement_FC64
 #define GxB_Matrix_sort GxM_Matrix_sort
@@ -4111,6 +4172,9 @@
 #define GxB_Monoid_terminal_new_UINT32 GxM_Monoid_terminal_new_UINT32
 #define GxB_Monoid_terminal_new_UINT64 GxM_Monoid_terminal_new_UINT64
 #define GxB_Monoid_terminal_new_UINT8 GxM_Monoid_terminal_new_UINT8
+#define GxB_mxm_reduce GxM_mxm_reduce
+#define GxB_mxm_reduce_Scalar GxM_mxm_reduce_Scalar
+#define GxB_mxv_batch GxM_mxv_batch
 #define GxB_NE_FC32 GxM_NE_FC32
 #define GxB_NE_FC64 GxM_NE_FC64
 #define GxB_NE_THUNK GxM_NE_THUNK
@@ -494,6 +494,16 @@ GrB_Info GrB_getVersion         // runtime access to C API version number
 // GPU control (DRAFT: in progress, do not use)
 #define GxB_GPU_ID 7088
 
+// NUMA memory placement policy (for GrB_GLOBAL and GxB_Context)
+#define GxB_NUMA_POLICY 7094
+
+// online tuner (for GxB_Context)
+#define GxB_TUNER 7095
+#define GxB_TUNER_PROFILE 7096
+
+// deferred execution of chains of GrB_apply (for GxB_Context)
+#define GxB_DEFER 7100
+
 typedef enum
 {
     GrB_OUTP = 0,   // descriptor for output of a method
@@ -504,6 +514,7 @@ typedef enum
     GxB_SORT = 7091,          // control sort in GrB_mxm
     GxB_COMPRESSION = 7092,   // select compression for serialize
     GxB_IMPORT = 7093,        // secure vs fast import
+    GxB_AxB_PLAN = 7102,      // reuse the saxpy3 analysis in GrB_mxm
 }
 GrB_Desc_Field ;
 
@@ -3577,6 +3588,382 @@ GrB_Info GrB_Matrix_extractTuples           // [I,J,X] = find (A)
     (I, J, X, nvals, A)
 #endif
 
+//------------------------------------------------------------------------------
+// GxB_Matrix_extractElements and GxB_Matrix_isStoredElements
+//------------------------------------------------------------------------------
+
+// Extracts n entries from a matrix: X [k] = A (I [k], J [k]) for each k in the
+// range 0 to n-1, typecasting from the type of A to the type of X, as needed.
+// If A(I[k],J[k]) is present, found [k] is set true and X [k] is set to its
+// value.  Otherwise, found [k] is set false and X [k] is not modified.  Either
+// X or found may be NULL.  The result is the same as n calls to
+// GrB_Matrix_extractElement, but the entries are found in parallel, and the
+// overhead of each call is done just once for the whole batch.
+// GxB_Matrix_isStoredElements computes just the found array.
+
+GrB_Info GxB_Matrix_extractElements_BOOL         // X(k) = A(I(k),J(k))
+(
+    bool *X,                    // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+
+GrB_Info GxB_Matrix_extractElements_INT8         // X(k) = A(I(k),J(k))
+(
+    int8_t *X,                  // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+
+GrB_Info GxB_Matrix_extractElements_UINT8        // X(k) = A(I(k),J(k))
+(
+    uint8_t *X,                 // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+
+GrB_Info GxB_Matrix_extractElements_INT16        // X(k) = A(I(k),J(k))
+(
+    int16_t *X,                 // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+
+GrB_Info GxB_Matrix_extractElements_UINT16       // X(k) = A(I(k),J(k))
+(
+    uint16_t *X,                // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+
+GrB_Info GxB_Matrix_extractElements_INT32        // X(k) = A(I(k),J(k))
+(
+    int32_t *X,                 // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+
+GrB_Info GxB_Matrix_extractElements_UINT32       // X(k) = A(I(k),J(k))
+(
+    uint32_t *X,                // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+
+GrB_Info GxB_Matrix_extractElements_INT64        // X(k) = A(I(k),J(k))
+(
+    int64_t *X,                 // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+
+GrB_Info GxB_Matrix_extractElements_UINT64       // X(k) = A(I(k),J(k))
+(
+    uint64_t *X,                // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+
+GrB_Info GxB_Matrix_extractElements_FP32         // X(k) = A(I(k),J(k))
+(
+    float *X,                   // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+
+GrB_Info GxB_Matrix_extractElements_FP64         // X(k) = A(I(k),J(k))
+(
+    double *X,                  // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+
+GrB_Info GxB_Matrix_extractElements_FC32         // X(k) = A(I(k),J(k))
+(
+    GxB_FC32_t *X,              // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+
+GrB_Info GxB_Matrix_extractElements_FC64         // X(k) = A(I(k),J(k))
+(
+    GxB_FC64_t *X,              // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+
+GrB_Info GxB_Matrix_extractElements_UDT          // X(k) = A(I(k),J(k))
+(
+    void *X,                    // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+
+// Type-generic version:  X can be a pointer to any supported C type or void *
+// for a user-defined type.
+
+/*
+GrB_Info GxB_Matrix_extractElements         // X(k) = A(I(k),J(k))
+(
+    <type> *X,                  // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I,         // row indices of the entries to extract
+    const GrB_Index *J,         // column indices of the entries to extract
+    GrB_Index n                 // size of I, J, X, and found
+) ;
+*/
+
+#if GxB_STDC_VERSION >= 201112L
+#define GxB_Matrix_extractElements(X,found,A,I,J,n)     \
+    _Generic                                            \
+    (                                                   \
+        (X),                                            \
+            GB_PCASES (GxB, Matrix_extractElements)     \
+    )                                                   \
+    (X, found, A, I, J, n)
+#endif
+
+GrB_Info GxB_Matrix_isStoredElements    // found(k) true if A(I(k),J(k)) present
+(
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to check
+    const GrB_Index *I,         // row indices of the entries to check
+    const GrB_Index *J,         // column indices of the entries to check
+    GrB_Index n                 // size of I, J, and found
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_setElements and GxB_Matrix_removeElements
+//------------------------------------------------------------------------------
+
+// Sets n entries in a matrix: C (I [k], J [k]) = X [k] for each k in the range
+// 0 to n-1, typecasting from the type of X to the type of C, as needed.  If
+// dup is not NULL, an entry already present is instead updated with
+// C (I [k], J [k]) = dup (C (I [k], J [k]), X [k]).  The tuples may appear in
+// any order and may include duplicates; the result is the same as n calls to
+// GrB_Matrix_setElement (if dup is NULL), in order.  Entries not already in C
+// become pending tuples, which are assembled by GrB_Matrix_wait.
+
+// GxB_Matrix_removeElements removes the entries C (I [k], J [k]) for each k in
+// the range 0 to n-1, if present.  The result is the same as n calls to
+// GrB_Matrix_removeElement.
+
+GrB_Info GxB_Matrix_setElements_BOOL              // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const bool *X,              // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+
+GrB_Info GxB_Matrix_setElements_INT8              // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const int8_t *X,            // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+
+GrB_Info GxB_Matrix_setElements_UINT8             // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const uint8_t *X,           // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+
+GrB_Info GxB_Matrix_setElements_INT16             // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const int16_t *X,           // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+
+GrB_Info GxB_Matrix_setElements_UINT16            // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const uint16_t *X,          // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+
+GrB_Info GxB_Matrix_setElements_INT32             // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const int32_t *X,           // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+
+GrB_Info GxB_Matrix_setElements_UINT32            // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const uint32_t *X,          // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+
+GrB_Info GxB_Matrix_setElements_INT64             // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const int64_t *X,           // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+
+GrB_Info GxB_Matrix_setElements_UINT64            // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const uint64_t *X,          // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+
+GrB_Info GxB_Matrix_setElements_FP32              // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const float *X,             // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+
+GrB_Info GxB_Matrix_setElements_FP64              // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const double *X,            // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+
+GrB_Info GxB_Matrix_setElements_FC32              // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const GxB_FC32_t *X,        // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+
+GrB_Info GxB_Matrix_setElements_FC64              // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const GxB_FC64_t *X,        // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+
+GrB_Info GxB_Matrix_setElements_UDT               // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const void *X,              // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+
+// Type-generic version:  X can be a pointer to any supported C type or void *
+// for a user-defined type.
+
+/*
+GrB_Info GxB_Matrix_setElements              // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const <type> *X,            // values of the tuples
+    GrB_Index n,                // size of I, J, and X
+    const GrB_BinaryOp dup      // if NULL: C(i,j) = x, else C(i,j) += x
+) ;
+*/
+
+#if GxB_STDC_VERSION >= 201112L
+#define GxB_Matrix_setElements(C,I,J,X,n,dup)           \
+    _Generic                                            \
+    (                                                   \
+        (X),                                            \
+            GB_PCASES (GxB, Matrix_setElements)         \
+    )                                                   \
+    (C, I, J, X, n, dup)
+#endif
+
+GrB_Info GxB_Matrix_removeElements  // remove C(I(k),J(k)) for k = 0:n-1
+(
+    GrB_Matrix C,               // matrix to remove entries from
+    const GrB_Index *I,         // row indices of the entries to remove
+    const GrB_Index *J,         // column indices of the entries to remove
+    GrB_Index n                 // size of I and J
+) ;
+
 //------------------------------------------------------------------------------
 // GxB_Matrix_concat and GxB_Matrix_split
 //------------------------------------------------------------------------------
@@ -3752,6 +4139,7 @@ typedef enum            // for global options or matrix options
     GxB_GLOBAL_NTHREADS = GxB_NTHREADS,  // max number of threads to use
     GxB_GLOBAL_CHUNK = GxB_CHUNK,        // chunk size for small problems.
     GxB_GLOBAL_GPU_ID = GxB_GPU_ID,      // which GPU to use (DRAFT)
+    GxB_GLOBAL_NUMA_POLICY = GxB_NUMA_POLICY, // NUMA placement of memory
 
     GxB_BURBLE = 7019,               // diagnostic output
     GxB_PRINTF = 7020,               // printf function diagnostic output
@@ -3769,6 +4157,9 @@ typedef enum            // for global options or matrix options
     GxB_JIT_C_CMAKE_LIBS = 7031,     // CPU JIT C libraries when using cmake
     GxB_JIT_USE_CMAKE = 7032,        // CPU JIT: use cmake or direct compile
     GxB_JIT_ERROR_LOG = 7033,        // CPU JIT: error log file
+    GxB_JIT_BUNDLE = 7097,           // CPU JIT: bundle cached kernels
+    GxB_JIT_MANIFEST = 7098,         // CPU JIT: record kernels used
+    GxB_JIT_C_EMBEDDED = 7099,       // CPU JIT: embedded C compiler library
 
     //------------------------------------------------------------
     // GrB_get for GrB_Matrix:
@@ -3782,6 +4173,7 @@ typedef enum            // for global options or matrix options
     //------------------------------------------------------------
 
     GxB_SPARSITY_CONTROL = 7036,    // sparsity control: 0 to 15; see below
+    GxB_TRANSPOSE_CACHE = 7101,     // if true, keep a cached transpose of A
 
 } GxB_Option_Field ;
 
@@ -3906,9 +4298,110 @@ typedef enum
 
     // GPU control (DRAFT: in progress, do not use)
     GxB_CONTEXT_GPU_ID      = GxB_GPU_ID,
+
+    GxB_CONTEXT_NUMA_POLICY = GxB_NUMA_POLICY,  // NUMA placement of memory
+                    // (a GxB_NUMA_Policy value)
+
+    GxB_CONTEXT_TUNER = GxB_TUNER,  // if true, tune chunk, hyper_switch,
+                    // and bitmap_switch online (default false)
+
+    GxB_CONTEXT_TUNER_PROFILE = GxB_TUNER_PROFILE,  // the state of the
+                    // tuner, as a string
+
+    GxB_CONTEXT_DEFER = GxB_DEFER,  // if true, defer and fuse chains of
+                    // GrB_apply on the same matrix (default false)
 }
 GxB_Context_Field ;
 
+// GxB_TUNER: if enabled, the Context times each call to the matrix multiply
+// methods, eWiseAdd, eWiseMult, apply, select, and reduce-to-scalar.  For each
+// method and size of problem, a few multiples of the chunk of the Context are
+// tried, and the fastest one is then used for later calls of the same method
+// and size.  The hyper_switch and bitmap_switch of new matrices created in the
+// Context are also adjusted, toward the format that has been found to be
+// faster for matrices whose density allows either format.  The tuner is off
+// by default, and disabling it discards its state.  It may be used in
+// GxB_CONTEXT_WORLD, or in a user Context.  The tuner of a Context may not be
+// disabled while any other user thread is using the same Context.
+//
+// GxB_TUNER_PROFILE: the state of the tuner, as a string that can be saved
+// by the application and imported into another Context, or into the same
+// Context in a later run of the application.  The profile should be exported
+// while no other user thread is using the Context, so that its size does not
+// change between the two calls to GrB_get.  The size must be queried first,
+// and no more than that many characters are written to the profile string.
+// GrB_INSUFFICIENT_SPACE is returned if the size has not been queried, or if
+// the profile has grown since then:
+//
+//      size_t len ;
+//      GrB_get (Context, &len, GxB_TUNER_PROFILE) ;    // size of profile
+//      char *profile = malloc (len) ;
+//      GrB_get (Context, profile, GxB_TUNER_PROFILE) ;
+//      ...
+//      GrB_set (Context2, profile, GxB_TUNER_PROFILE) ;
+//
+// Setting the profile enables the tuner of the Context.  GrB_INVALID_VALUE is
+// returned if the profile is not valid, and the tuner is left unchanged (or
+// left disabled, if it was not enabled before).
+
+// GxB_DEFER: if enabled, a call to GrB_apply that computes C = op (C) in
+// place, with no mask, no accumulator, and no transpose, using a built-in
+// unary operator or a built-in binary operator bound to a scalar, is not
+// computed when it is called.  Instead, the operator is recorded, and a chain
+// of such calls on the same matrix C is computed later in a single fused pass
+// over the values of C, one cache-sized block at a time, rather than one full
+// pass over C per operator.  The chain is computed when the user thread makes
+// any other call to GraphBLAS (including GrB_wait, GrB_extractElement, and
+// GrB_apply on any other matrix), or when C is freed.  Deferred operators are
+// recorded for each user thread.  As required by the GraphBLAS
+// specification, C must be completed with GrB_wait (C, GrB_COMPLETE) before
+// it is used by another user thread.  If the chain cannot be computed (out
+// of memory, or a JIT failure), the method that computes it returns the
+// error, C is cleared, and the error is logged in C (see GrB_error).  This
+// option has no effect in blocking mode, and deferral is off by default.
+
+// GxB_NUMA_POLICY: controls where the pages of large blocks of memory
+// allocated by GraphBLAS (the Ap, Ai, Ax, Ab arrays of a matrix, and large
+// workspaces) are placed on a machine with multiple NUMA nodes (sockets).
+// The policy is a hint; it has no effect on the result.  On systems without
+// NUMA support, all policies are the same as GxB_NUMA_DEFAULT.
+//
+//      GxB_NUMA_DEFAULT:  GraphBLAS does nothing special; pages are placed by
+//          the operating system default policy, and blocks cleared by
+//          GraphBLAS (calloc) are cleared by threads in a dynamic schedule.
+//
+//      GxB_NUMA_FIRST_TOUCH:  blocks cleared by GraphBLAS are cleared with
+//          one contiguous part per thread, of equal size and split at page
+//          boundaries, with a static schedule.  Each page is thus first
+//          touched, and placed, on the socket of the same thread each time.
+//          This matches the parallel kernels only where they also split an
+//          array into equal parts; most kernels balance their work instead
+//          (GB_ek_slice and related methods), so the match is approximate.
+//          OpenMP threads should be pinned (for example with
+//          OMP_PROC_BIND=spread and OMP_PLACES=cores) for this to be useful.
+//
+//      GxB_NUMA_INTERLEAVE:  the pages of large blocks are interleaved
+//          round-robin across all NUMA nodes, spreading the memory bandwidth
+//          over all sockets.  Best when the access pattern of a matrix is not
+//          known in advance, or when it is used with many different numbers
+//          of threads.
+//
+//      GxB_NUMA_LOCAL:  the pages of large blocks are bound with the
+//          "local allocation" policy (MPOL_PREFERRED with an empty node
+//          mask): each page is placed on the node of the thread that first
+//          touches it, or on another node if that node has no free memory.
+//          This overrides any process-wide policy (numactl --interleave, for
+//          example) for the blocks allocated by GraphBLAS.
+
+typedef enum
+{
+    GxB_NUMA_DEFAULT = 0,       // operating system default
+    GxB_NUMA_FIRST_TOUCH = 1,   // clear in equal parts, one per thread
+    GxB_NUMA_INTERLEAVE = 2,    // interleave pages across all NUMA nodes
+    GxB_NUMA_LOCAL = 3,         // place pages on the node of first touch
+}
+GxB_NUMA_Policy ;
+
 GrB_Info GxB_Context_new            // create a new Context
 (
     GxB_Context *Context            // handle of Context to create
@@ -4929,6 +5422,29 @@ GrB_Info GxB_Matrix_eWiseUnion      // C<M> = accum (C, A+B)
     (C, Mask, accum, op, A, alpha, B, beta, desc)
 #endif
 
+//==============================================================================
+// GxB_Matrix_eWiseAdd_n: sum k matrices with a monoid
+//==============================================================================
+
+// GxB_Matrix_eWiseAdd_n computes C<Mask> = accum (C, A[0]+A[1]+...+A[k-1]),
+// where "+" is the monoid, with the same result as k-1 calls to
+// GrB_Matrix_eWiseAdd_Monoid (except for floating-point roundoff).  The
+// matrices are summed in a balanced binary tree, ((A[0]+A[1])+(A[2]+A[3]))+...
+// which takes O(log(k)) passes over the data instead of k-1.  The descriptor
+// can transpose all of the matrices A[0:k-1] (GrB_INP0); the GrB_INP1 setting
+// is ignored.  The matrix C may be aliased with any of the inputs.
+
+GrB_Info GxB_Matrix_eWiseAdd_n      // C<M> = accum (C, A[0]+...+A[k-1])
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Monoid monoid,        // defines '+' for T=A[0]+...+A[k-1]
+    const GrB_Matrix *A,            // array of k input matrices
+    GrB_Index k,                    // number of input matrices
+    const GrB_Descriptor desc       // descriptor for C, M, and A[0:k-1]
+) ;
+
 //==============================================================================
 // GrB_extract: extract a submatrix or subvector
 //==============================================================================
@@ -7980,6 +8496,64 @@ GrB_Info GrB_Matrix_reduce_BinaryOp_Scalar
     (arg1, arg2, arg3, arg4, __VA_ARGS__)
 #endif
 
+//==============================================================================
+// GxB_mxm_reduce: reduce a matrix-matrix product to a vector or scalar
+//==============================================================================
+
+// GxB_mxm_reduce computes w<M> = accum (w, reduce (A*B)), where each row of
+// T=A*B is reduced to a single entry with the monoid, as if computed by
+// GrB_mxm (T, NULL, NULL, semiring, A, B, desc) followed by GrB_reduce (w, M,
+// accum, monoid, T, desc).  GxB_mxm_reduce_Scalar reduces all of A*B to the
+// GrB_Scalar s.  The product T is computed in panels of its columns, each
+// reduced and freed before the next one is computed, so T is never held in
+// memory all at once.  The descriptor transposes A and/or B as in GrB_mxm.
+
+GrB_Info GxB_mxm_reduce             // w<M> = accum (w, reduce (A*B))
+(
+    GrB_Vector w,                   // input/output vector for results
+    const GrB_Vector M,             // optional mask for w, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Monoid monoid,        // reduce monoid for t=reduce(A*B)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for w, M, A, and B
+) ;
+
+GrB_Info GxB_mxm_reduce_Scalar      // s = accum (s, reduce (A*B))
+(
+    GrB_Scalar s,                   // input/output scalar for results
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Monoid monoid,        // reduce monoid for t=reduce(A*B)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for A and B
+) ;
+
+//==============================================================================
+// GxB_mxv_batch: multiply a matrix by many vectors
+//==============================================================================
+
+// GxB_mxv_batch computes W[j] = accum (W[j], A*U[j]) for j = 0 to k-1, with
+// the same result as k calls to GrB_mxv (W[j], NULL, accum, semiring, A, U[j],
+// desc).  The k vectors U[0:k-1] are gathered into a single n-by-k matrix, so
+// that A is traversed only once for all k products.  No mask can be used.  The
+// descriptor can transpose A (GrB_INP0) and clear each W[j] (GrB_OUTP), and
+// it selects the method for the product (GxB_AxB_METHOD).  The vectors
+// W[0:k-1] must be distinct.
+
+GrB_Info GxB_mxv_batch              // W[j] = accum (W[j], A*U[j]) for all j
+(
+    GrB_Vector *W,                  // array of k input/output vectors
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*U[j]
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Vector *U,            // second input: array of k vectors
+    GrB_Index k,                    // number of vectors in W and U
+    const GrB_Descriptor desc       // descriptor for W and A
+) ;
+
 //==============================================================================
 // GrB_transpose: matrix transpose
 //==============================================================================
@@ -10803,6 +11377,16 @@ GrB_Info GrB_Matrix_exportHint  // suggest the best export format
 #define GxB_COMPRESSION_LZ4HC 2000  // LZ4HC, with default level 9
 #define GxB_COMPRESSION_ZSTD  3000  // ZSTD, with default level 1
 
+// GxB_COMPRESSION_DELTA can be added to any of the LZ4, LZ4HC, or ZSTD methods
+// above.  The integer arrays of a sparse or hypersparse matrix (A->p, A->h,
+// and A->i) are then delta-encoded, and the bytes of the deltas are grouped
+// together, before they are compressed.  This typically gives a much more
+// compact blob for sorted indices, with faster compression and decompression.
+// Blobs that use GxB_COMPRESSION_DELTA cannot be read by v9.0.0 or earlier
+// versions of SuiteSparse:GraphBLAS; do not use it for blobs that must be
+// read by those versions.
+#define GxB_COMPRESSION_DELTA 10000 // delta-encode the integer arrays
+
 // Most of the above methods have a level parameter that controls the tradeoff
 // between run time and the amount of compression obtained.  Higher levels
 // result in a more compact result, at the cost of higher run time:
@@ -10813,7 +11397,8 @@ GrB_Info GrB_Matrix_exportHint  // suggest the best export format
 
 // For all methods, a level of zero results in the default level setting.
 // These settings can be added, so to use LZ4HC at level 5, use method =
-// GxB_COMPRESSION_LZ4HC + 5.
+// GxB_COMPRESSION_LZ4HC + 5.  To use ZSTD at level 3 with delta encoding of
+// the integer arrays, use GxB_COMPRESSION_ZSTD + GxB_COMPRESSION_DELTA + 3.
 
 // If the level setting is out of range, the default is used for that method.
 // If the method is negative, no compression is performed.  If the method is
@@ -10907,9 +11492,81 @@ GrB_Info GxB_Vector_deserialize     // deserialize blob into a GrB_Vector
     const GrB_Descriptor desc       // to control # of threads used
 ) ;
 
+// GxB_Matrix_serialize_delta creates an incremental checkpoint of a matrix.
+// If prior_blob is NULL, the whole matrix is serialized, and the blob is the
+// base of a chain of checkpoints.  Otherwise, prior_blob must be the last blob
+// in the chain, and only the parts of the matrix that have changed since the
+// prior blob are held in the new blob.  GxB_Matrix_deserialize_delta
+// constructs the matrix from the whole chain, blobs [0:nblobs-1].  These blobs
+// cannot be used by GxB_Matrix_deserialize, and vice versa.
+
+GrB_Info GxB_Matrix_serialize_delta // serialize the changes to a matrix
+(
+    // output:
+    void **blob_handle,             // the blob, allocated on output
+    GrB_Index *blob_size_handle,    // size of the blob on output
+    // input:
+    GrB_Matrix A,                   // matrix to serialize
+    const void *prior_blob,         // prior blob in the chain, or NULL
+    GrB_Index prior_blob_size,      // size of the prior blob
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+) ;
+
+GrB_Info GxB_Matrix_deserialize_delta   // deserialize a chain of blobs
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blobs
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blobs hold a
+                        // matrix of user-defined type.  May be NULL if the
+                        // blobs hold a built-in type; otherwise must match the
+                        // type of C.
+    const void **blobs,             // blobs [0:nblobs-1]
+    const GrB_Index *blob_sizes,    // blob_sizes [0:nblobs-1]
+    GrB_Index nblobs,               // # of blobs in the chain
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
 // historical; use GrB_get with GxB_JIT_C_NAME instead.
 GrB_Info GxB_deserialize_type_name (char *, const void *, GrB_Index) ;
 
+//==============================================================================
+// GxB_Matrix_publish and GxB_Matrix_attach: shared-memory matrices
+//==============================================================================
+
+// GxB_Matrix_publish writes a matrix to a file, typically in /dev/shm, and
+// GxB_Matrix_attach maps that file into memory as a new matrix C, without
+// copying its content.  Any number of processes on the same host can attach
+// to the same file and share a single copy of the matrix.  The file is never
+// modified by GxB_Matrix_attach.  If C is modified, it is first given its own
+// copy of its content, and is then detached from the file.  C can be used in
+// any other way as an ordinary GrB_Matrix, and freed with GrB_free.  The file
+// can be removed once all processes have attached to it, and can be replaced
+// by a later GxB_Matrix_publish without affecting the matrices already
+// attached to it.  The file is not portable to other hosts.
+// GxB_Matrix_attach returns GrB_NOT_IMPLEMENTED on Windows.
+
+GrB_Info GxB_Matrix_publish     // write a matrix to a shared-memory file
+(
+    const char *filename,       // file to create, or replace
+    GrB_Matrix A,               // matrix to publish
+    const GrB_Descriptor desc   // currently unused
+) ;
+
+GrB_Info GxB_Matrix_attach      // attach to a shared-memory file
+(
+    // output:
+    GrB_Matrix *C,              // output matrix attached to the file
+    // input:
+    GrB_Type type,              // type of the matrix C.  Required if the file
+                                // holds a matrix of user-defined type.  May be
+                                // NULL if the file holds a built-in type;
+                                // otherwise must match the type of C.
+    const char *filename,       // file created by GxB_Matrix_publish
+    const GrB_Descriptor desc   // currently unused
+) ;
+
 //==============================================================================
 // GxB_Vector_sort and GxB_Matrix_sort: sort a matrix or vector
 //==============================================================================
@@ -98,6 +98,18 @@
         // Cx [p] = cij
         #define GB_PUTC(cij,Cx,p) Cx [p] = cij
 
+        // Cx [p] = Hx [i], for the ultra-fine tasks of dot3
+        #undef  GB_CIJ_GATHER
+        #define GB_CIJ_GATHER(p,i) Cx [p] = Hx [i]
+
+        // Cx [p] += Hx [i], for the ultra-fine tasks of dot3
+        #undef  GB_CIJ_GATHER_UPDATE
+        #define GB_CIJ_GATHER_UPDATE(p,i) fadd (&(Cx [p]), &(Cx [p]), &(Hx [i]))
+
+        // Cx [p] += t, for dot2 when C+=A'*B is computed in-place
+        #undef  GB_CIJ_UPDATE
+        #define GB_CIJ_UPDATE(p,t) fadd (&(Cx [p]), &(Cx [p]), &(t))
+
         // break if cij reaches the terminal value.  The terminal condition
         // 'is_terminal' is checked even if the monoid is not terminal.
         #undef  GB_MONOID_IS_TERMINAL
@@ -255,6 +267,21 @@
         #undef  GB_PUTC
         #define GB_PUTC(cij,Cx,p) memcpy (Cx +((p)*csize), cij, csize)
 
+        // Cx [p] = Hx [i], for the ultra-fine tasks of dot3
+        #undef  GB_CIJ_GATHER
+        #define GB_CIJ_GATHER(p,i)                                      \
+            memcpy (Cx +((p)*csize), Hx +((i)*csize), csize)
+
+        // Cx [p] += Hx [i], for the ultra-fine tasks of dot3
+        #undef  GB_CIJ_GATHER_UPDATE
+        #define GB_CIJ_GATHER_UPDATE(p,i)                               \
+            fadd (Cx +((p)*csize), Cx +((p)*csize), Hx +((i)*csize))
+
+        // Cx [p] += t, for dot2 when C+=A'*B is computed in-place
+        #undef  GB_CIJ_UPDATE
+        #define GB_CIJ_UPDATE(p,t)                                      \
+            fadd (Cx +((p)*csize), Cx +((p)*csize), t)
+
         // instead of GB_DECLARE_TERMINAL_CONST (zterminal):
         GB_void *restrict zterminal = (GB_void *) add->terminal ;
 
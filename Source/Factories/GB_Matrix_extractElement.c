@@ -45,8 +45,10 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
     // If found (live or zombie), no need to wait.  If not found and pending
     // tuples exist, wait and then extractElement again.
 
-    // delete any lingering zombies, assemble any pending tuples, and unjumble
-    if (A->Pending != NULL || A->nzombies > 0 || A->jumbled)
+    // delete any lingering zombies, assemble any pending tuples, unjumble,
+    // and compute any deferred operators (in GB_WHERE1)
+    if (A->Pending != NULL || A->nzombies > 0 || A->jumbled
+        || A == GB_defer_matrix ( ))
     { 
         GrB_Info info ;
         GB_WHERE1 (GB_WHERE_STRING) ;
@@ -102,12 +104,9 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
             //------------------------------------------------------------------
             // A is hypersparse: look for j in hyperlist A->h [0 ... A->nvec-1]
             //------------------------------------------------------------------
-
-            const int64_t *restrict A_Yp = (A->Y == NULL) ? NULL : A->Y->p ;
-            const int64_t *restrict A_Yi = (A->Y == NULL) ? NULL : A->Y->i ;
             const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
             const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
-            int64_t k = GB_hyper_hash_lookup (Ah, A->nvec, Ap, A_Yp, A_Yi, A_Yx,
+            int64_t k = GB_hyper_hash_lookup (Ah, A->nvec, Ap, A_Yx,
                 A_hash_bits, j, &pA_start, &pA_end) ;
             found = (k >= 0) ;
             if (!found)
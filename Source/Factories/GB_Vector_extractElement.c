@@ -40,8 +40,9 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
     GB_RETURN_IF_NULL (x) ;
     #endif
 
-    // delete any lingering zombies, assemble any pending tuples, and unjumble
-    if (GB_ANY_PENDING_WORK (V))
+    // delete any lingering zombies, assemble any pending tuples, unjumble,
+    // and compute any deferred operators (in GB_WHERE1)
+    if (GB_ANY_PENDING_WORK (V) || (GrB_Matrix) V == GB_defer_matrix ( ))
     { 
         GrB_Info info ;
         GB_WHERE1 (GB_WHERE_STRING) ;
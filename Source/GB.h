@@ -56,6 +56,7 @@
 #include "GB_ops.h"
 #include "GB_where.h"
 #include "GB_Context.h"
+#include "GB_defer.h"
 #include "GB_cuda_gateway.h"
 #include "GB_saxpy3task_struct.h"
 #include "GB_callbacks.h"
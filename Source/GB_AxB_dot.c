@@ -30,7 +30,8 @@
 
 // If the result is computed in-place, then the C parameter is ignored, and the
 // result is computed in C_in instead.  This case requires the accum operator
-// to match the monoid of the semiring.
+// to match the monoid of the semiring.  C_in must be full (for dot4) or bitmap
+// (for dot2).
 
 // The semiring defines C=A*B.  flipxy modifies how the semiring multiply
 // operator is applied.  If false, then fmult(aik,bkj) is computed.  If true,
@@ -42,6 +43,7 @@
 
 #include "GB_mxm.h"
 #include "GB_stringify.h"
+#include "GB_tuner.h"
 #define GB_FREE_ALL ;
 
 GrB_Info GB_AxB_dot                 // dot product (multiple methods)
@@ -137,7 +139,10 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
         // output), but C_in might be iso on input.
 
         (*mask_applied) = false ;    // no mask to apply
+        GB_tuner_state tune ;
+        GB_tuner_begin (&tune, GB_TUNER_DOT4, A, B) ;
         info = GB_AxB_dot4 (C_in, A, B, semiring, flipxy, done_in_place, Werk) ;
+        GB_tuner_end (&tune, info) ;
         if (info != GrB_NO_VALUE)
         { 
             // return if dot4 has handled this case, otherwise fall through
@@ -154,7 +159,12 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
     { 
         // no work to do; C is an empty matrix, normally hypersparse
         GBURBLE ("(empty dot) ") ;
-        if (C_in != NULL) return (GrB_SUCCESS) ;
+        if (C_in != NULL)
+        { 
+            // C_in += A'*B where A'*B is empty: C_in is unchanged
+            (*done_in_place) = true ;
+            return (GrB_SUCCESS) ;
+        }
         return (GB_new (&C, // auto sparsity, existing header
             ztype, A->vdim, B->vdim, GB_Ap_calloc, true, GxB_AUTO_SPARSITY,
             GB_Global_hyper_switch_get ( ), 1)) ;
@@ -197,20 +207,33 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
         #endif
         { 
             // use the CPU
+            GB_tuner_state tune ;
+            GB_tuner_begin (&tune, GB_TUNER_DOT3, A, B) ;
             info = (GB_AxB_dot3 (C, C_iso, cscalar, M, Mask_struct, A, B,
                 semiring, flipxy, Werk)) ;
+            GB_tuner_end (&tune, info) ;
         }
         return (info) ;
     }
 
     //--------------------------------------------------------------------------
-    // general case: C<M>=A'*B, C<!M>=A'*B, or C=A'*B, not in-place
+    // general case: C<M>=A'*B, C<!M>=A'*B, or C=A'*B; or C+=A'*B in-place
     //--------------------------------------------------------------------------
 
+    // If C_in is bitmap, no mask is present, and the accum matches the
+    // monoid, then dot2 can compute C_in += A'*B in-place.
+
     GBURBLE ("(%sdot2) ", iso_kind) ;
     (*mask_applied) = (M != NULL) ; // mask applied if present
-    (*done_in_place) = false ;      // TODO: allow dot2 to work in-place
-    return (GB_AxB_dot2 (C, C_iso, cscalar, M, Mask_comp, Mask_struct,
-        false, A, B, semiring, flipxy, Werk)) ;
+    (*done_in_place) = false ;
+    bool C_bitmap_in_place = GB_AxB_bitmap_in_place_control (C_iso, C_in, M,
+        Mask_comp, accum, semiring) ;
+    GB_tuner_state tune ;
+    GB_tuner_begin (&tune, GB_TUNER_DOT2, A, B) ;
+    info = GB_AxB_dot2 (C, C_bitmap_in_place ? C_in : NULL, C_iso, cscalar,
+        M, Mask_comp, Mask_struct, false, A, B, semiring, flipxy,
+        done_in_place, Werk) ;
+    GB_tuner_end (&tune, info) ;
+    return (info) ;
 }
 
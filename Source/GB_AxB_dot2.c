@@ -16,11 +16,25 @@
 // is bitmap or full, and the dot product method accesses A with a different
 // stride than when computing C<#M>=A'*B.
 
-// TODO:  this is slower than it could be if A and B are both bitmap/full, when
-// A->vlen is large.  This is because the inner loop is a simple full/bitmap
-// dot product, across the entire input vectors.  No tiling is used, so cache
-// performance is not as good as it could be.  For large problems, C=(A')*B is
-// faster with the saxpy3 method, as compared to this method with C=A'*B.
+// If C_in is not NULL, then C_in += A'*B (or C_in += A*B) is computed in-place,
+// and the C parameter is ignored.  The caller has checked the conditions with
+// GB_AxB_bitmap_in_place_control: C_in is bitmap, no mask is present, and the
+// accum operator matches the monoid of the semiring.  The dot2 kernels treat
+// C->b as input: an entry C(i,j) present on input is updated with the monoid,
+// C(i,j) += A(:,i)'*B(:,j).  C_in cannot be computed in-place if A or B are
+// hypersparse, since C is then computed with smaller dimensions.  In that
+// case, done_in_place is returned as false and C is computed as usual.
+
+// If A, B, and C are all full and no mask is present, C=A'*B is computed in
+// register tiles of C, with the k dimension split into chunks so that a panel
+// of B stays in cache (see Template/GB_AxB_dot2_tile_template.c).
+
+// TODO:  this is slower than it could be if A or B are bitmap, when A->vlen
+// is large.  This is because the inner loop is a simple full/bitmap dot
+// product, across the entire input vectors.  No tiling is used in this case,
+// so cache performance is not as good as it could be.  For large problems,
+// C=(A')*B is faster with the saxpy3 method, as compared to this method with
+// C=A'*B.
 
 // JIT: done.
 
@@ -53,6 +67,7 @@
 GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
 (
     GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C_in,                // input/output matrix, if done in-place
     const bool C_iso,               // true if C is iso
     const GB_void *cscalar,         // iso value of C
     const GrB_Matrix M_in,          // mask matrix for C<#M>=A'*B, may be NULL
@@ -63,6 +78,7 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
     const GrB_Matrix B_in,          // input matrix
     const GrB_Semiring semiring,    // semiring that defines C=A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    bool *done_in_place,            // if true, C_in was computed in-place
     GB_Werk Werk
 )
 {
@@ -126,6 +142,8 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
     bool A_is_hyper = GB_IS_HYPERSPARSE (A_in) ;
     bool B_is_hyper = GB_IS_HYPERSPARSE (B_in) ;
     bool A_or_B_hyper = A_is_hyper || B_is_hyper ;
+    bool C_in_place = (C_in != NULL) && !A_or_B_hyper ;
+    ASSERT (GB_IMPLIES (C_in_place, M_in == NULL && !C_iso)) ;
     GrB_Index *restrict Ah = (GrB_Index *) A_in->h ;
     GrB_Index *restrict Bh = (GrB_Index *) B_in->h ;
 
@@ -304,7 +322,10 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
     // allocate C
     //--------------------------------------------------------------------------
 
-    // if M is sparse/hyper, then calloc C->b; otherwise use malloc
+    // If M is sparse/hyper, then calloc C->b so that M can be scattered into
+    // it.  If M is not present, C->b is also calloc'd, since the dot2 kernels
+    // treat an entry Cb [p] = 1 as an entry of C present on input.  Otherwise
+    // C->b is malloc'd.
     bool M_is_sparse_or_hyper = (M != NULL) &&
         (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) ;
     GrB_Type ctype = add->op->ztype ;
@@ -312,7 +333,7 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
     // determine the sparsity of C.  If M is present, C is always bitmap.
     // otherwise, C can be bitmap or full
     int C_sparsity = GxB_BITMAP ;
-    if (M == NULL)
+    if (M == NULL && !C_in_place)
     {
         // no mask is present so C can be bitmap or full
         if (A_is_full && B_is_full)
@@ -347,8 +368,9 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
 
     if (M_in == NULL)
     { 
-        GBURBLE ("(dot %s = %s%s*%s) ",
+        GBURBLE ("(dot %s %s= %s%s*%s) ",
             GB_sparsity_char (C_sparsity),
+            C_in_place ? "+" : "",
             GB_sparsity_char_matrix (A_in),
             A_not_transposed ? "" : "'",
             GB_sparsity_char_matrix (B_in)) ;
@@ -366,10 +388,28 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
             GB_sparsity_char_matrix (B_in)) ;
     }
 
-    // set C->iso = C_iso
-    GB_OK (GB_new_bix (&C, // bitmap/full, existing header
-        ctype, cvlen, cvdim, GB_Ap_malloc, true, C_sparsity,
-        M_is_sparse_or_hyper, B->hyper_switch, cnvec, cnz, true, C_iso)) ;
+    if (C_in_place)
+    { 
+        // C_in += A'*B is computed in-place
+        ASSERT_MATRIX_OK (C_in, "C_in for dot2 C+=A'*B", GB0) ;
+        ASSERT (GB_IS_BITMAP (C_in)) ;
+        ASSERT (C_in->type == ctype) ;
+        ASSERT (C_in->vlen == cvlen && C_in->vdim == cvdim) ;
+        C = C_in ;
+        if (C->iso)
+        { 
+            // expand C to non-iso
+            GB_OK (GB_convert_any_to_non_iso (C, true)) ;
+        }
+    }
+    else
+    { 
+        // set C->iso = C_iso
+        GB_OK (GB_new_bix (&C, // bitmap/full, existing header
+            ctype, cvlen, cvdim, GB_Ap_malloc, true, C_sparsity,
+            (M == NULL) || M_is_sparse_or_hyper, B->hyper_switch, cnvec, cnz,
+            true, C_iso)) ;
+    }
 
     //--------------------------------------------------------------------------
     // if M is sparse/hyper, scatter it into the C bitmap
@@ -470,14 +510,14 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
             if (A_not_transposed)
             { 
                 // C<#M> = A*B, C is bitmap/full
-                info = GB_AxB_dot2n_jit (C, M, Mask_comp,
+                info = GB_AxB_dot2n_jit (C, C_in_place, M, Mask_comp,
                     Mask_struct, A, A_slice, B, B_slice, semiring, flipxy,
                     nthreads, naslice, nbslice) ;
             }
             else
             { 
                 // C<#M> = A'*B, C is bitmap
-                info = GB_AxB_dot2_jit (C, M, Mask_comp,
+                info = GB_AxB_dot2_jit (C, C_in_place, M, Mask_comp,
                     Mask_struct, A, A_slice, B, B_slice, semiring, flipxy,
                     nthreads, naslice, nbslice) ;
             }
@@ -534,6 +574,7 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
     ASSERT (!GB_JUMBLED (C)) ;
     ASSERT (!GB_PENDING (C)) ;
     ASSERT (C->nvec_nonempty >= 0) ;
+    (*done_in_place) = C_in_place ;
     return (GrB_SUCCESS) ;
 }
 
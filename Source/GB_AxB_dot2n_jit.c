@@ -17,6 +17,7 @@ GrB_Info GB_AxB_dot2n_jit        // C<M>=A*B, dot2n method, via the JIT
     // input/output:
     GrB_Matrix C,
     // input:
+    const bool C_in_place,          // if true, C+=A*B is computed in place
     const GrB_Matrix M,
     const bool Mask_comp,
     const bool Mask_struct,
@@ -40,7 +41,7 @@ GrB_Info GB_AxB_dot2n_jit        // C<M>=A*B, dot2n method, via the JIT
     char *suffix ;
     uint64_t hash = GB_encodify_mxm (&encoding, &suffix,
         GB_JIT_KERNEL_AXB_DOT2N,
-        C->iso, false, GB_sparsity (C), C->type,
+        C->iso, false, C_in_place, GB_sparsity (C), C->type,
         M, Mask_struct, Mask_comp, semiring, flipxy, A, B) ;
 
     //--------------------------------------------------------------------------
@@ -145,14 +145,8 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     const bool B_is_bitmap = GB_IS_BITMAP (B) ;
     ASSERT (A->vlen == B->vlen) ;
     ASSERT (vlen > 0) ;
-
-    const int64_t *restrict A_Yp = (A->Y == NULL) ? NULL : A->Y->p ;
-    const int64_t *restrict A_Yi = (A->Y == NULL) ? NULL : A->Y->i ;
     const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
     const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
-
-    const int64_t *restrict B_Yp = (B->Y == NULL) ? NULL : B->Y->p ;
-    const int64_t *restrict B_Yi = (B->Y == NULL) ? NULL : B->Y->i ;
     const int64_t *restrict B_Yx = (B->Y == NULL) ? NULL : B->Y->x ;
     const int64_t B_hash_bits = (B->Y == NULL) ? 0 : (B->Y->vdim - 1) ;
 
@@ -246,7 +240,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
 
     GB_FREE_WORK (&TaskList, TaskList_size) ;
     GB_OK (GB_AxB_dot3_slice (&TaskList, &TaskList_size, &ntasks, &nthreads,
-        C, Werk)) ;
+        C, M, A, B, Werk)) ;
 
     GBURBLE ("nthreads %d ntasks %d ", nthreads, ntasks) ;
 
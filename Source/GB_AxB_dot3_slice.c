@@ -15,16 +15,23 @@
 
 // The strategy for slicing of C and M is like GB_ek_slice, for coarse tasks.
 // These coarse tasks differ from the tasks generated by GB_ewise_slice,
-// since they may start in the middle of a vector.  If a single entry C(i,j)
-// is costly to compute, it is possible that it is placed by itself in a
-// single coarse task.
-
-// FUTURE:: Ultra-fine tasks could also be constructed, so that the computation
-// of a single entry C(i,j) can be broken into multiple tasks.  The slice of
-// A(:,i) and B(:,j) would use GB_slice_vector, where no mask would be used.
+// since they may start in the middle of a vector.
+
+// If a single entry C(i,j) is costly to compute (at least twice the target
+// task size), and A and B are both sparse or hypersparse, the computation of
+// C(i,j) = A(:,i)'*B(:,j) is split into multiple ultra-fine tasks.  Each
+// ultra-fine task computes A(k1:k2,i)'*B(k1:k2,j) for a range of indices
+// k1:k2 found by GB_slice_vector, and the partial results are summed by the
+// monoid when all tasks are done (see Template/GB_AxB_dot3_meta.c).  The
+// ultra-fine tasks appear first in the TaskList, with klast = -1, and pC the
+// position of C(i,j).  The coarse tasks skip these entries.  On graphs with
+// a power-law degree distribution, a few dot products between two hub
+// vertices can otherwise take more time than all of the rest of C.
 
 #define GB_FREE_WORKSPACE                       \
 {                                               \
+    GB_WERK_POP (Heavy, int64_t) ;              \
+    GB_WERK_POP (Heavy_count, int64_t) ;        \
     GB_WERK_POP (Coarse, int64_t) ;             \
 }
 
@@ -50,6 +57,9 @@ GrB_Info GB_AxB_dot3_slice
     int *p_nthreads,                // # of threads to use
     // input:
     const GrB_Matrix C,             // matrix to slice
+    const GrB_Matrix M,             // mask matrix, with the same pattern as C
+    const GrB_Matrix A,             // input matrix A, for C<M>=A'*B
+    const GrB_Matrix B,             // input matrix B
     GB_Werk Werk
 )
 {
@@ -69,6 +79,8 @@ GrB_Info GB_AxB_dot3_slice
     // must accomodate zombies
     ASSERT (!GB_IS_FULL (C)) ;
     ASSERT (!GB_IS_BITMAP (C)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (!GB_JUMBLED (B)) ;
 
     (*p_TaskList  ) = NULL ;
     (*p_TaskList_size) = 0 ;
@@ -107,6 +119,8 @@ GrB_Info GB_AxB_dot3_slice
     //--------------------------------------------------------------------------
 
     GB_WERK_DECLARE (Coarse, int64_t) ;
+    GB_WERK_DECLARE (Heavy_count, int64_t) ;
+    GB_WERK_DECLARE (Heavy, int64_t) ;
     int ntasks1 = 0 ;
     nthreads = GB_nthreads (total_work, chunk, nthreads_max) ;
     GB_task_struct *restrict TaskList = NULL ; size_t TaskList_size = 0 ;
@@ -157,56 +171,230 @@ GrB_Info GB_AxB_dot3_slice
     GB_pslice (Coarse, Cwork, cnz, ntasks1, false) ;
 
     //--------------------------------------------------------------------------
-    // construct all tasks, both coarse and fine
+    // find the heavy entries of C
     //--------------------------------------------------------------------------
 
-    for (int t = 0 ; t < ntasks1 ; t++)
+    // C(i,j) is heavy if its work is at least twice the target task size.
+    // Its dot product is split into ultra-fine tasks, but only if A and B are
+    // both sparse or hypersparse, since the ultra-fine tasks slice A(:,i) and
+    // B(:,j) by their row indices.  The chunk may be less than one, but an
+    // entry with a work of 1 (an empty dot product, or one excluded by the
+    // mask) is never heavy.
+
+    const bool A_is_sparse_or_hyper = GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A);
+    const bool B_is_sparse_or_hyper = GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B);
+    const int64_t heavy_work = GB_IMAX ((int64_t) (2 * target_task_size), 2) ;
+    int64_t nheavy = 0 ;
+
+    if (A_is_sparse_or_hyper && B_is_sparse_or_hyper)
+    {
+        // count the heavy entries in each coarse slice
+        GB_WERK_PUSH (Heavy_count, ntasks1 + 1, int64_t) ;
+        if (Heavy_count == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        int t ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (t = 0 ; t < ntasks1 ; t++)
+        {
+            int64_t count = 0 ;
+            for (int64_t p = Coarse [t] ; p < Coarse [t+1] ; p++)
+            { 
+                count += ((Cwork [p+1] - Cwork [p]) >= heavy_work) ;
+            }
+            Heavy_count [t] = count ;
+        }
+        GB_cumsum (Heavy_count, ntasks1, NULL, 1, NULL) ;
+        nheavy = Heavy_count [ntasks1] ;
+    }
+
+    if (nheavy > 0)
+    {
+        // gather the positions of the heavy entries, in ascending order
+        GB_WERK_PUSH (Heavy, nheavy, int64_t) ;
+        if (Heavy == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        int t ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (t = 0 ; t < ntasks1 ; t++)
+        {
+            int64_t h = Heavy_count [t] ;
+            for (int64_t p = Coarse [t] ; p < Coarse [t+1] ; p++)
+            {
+                if ((Cwork [p+1] - Cwork [p]) >= heavy_work)
+                { 
+                    Heavy [h++] = p ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the ultra-fine tasks for each heavy entry
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ch = C->h ;
+    const int64_t *restrict Mi = M->i ;
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const int64_t anvec = A->nvec ;
+    const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
+    const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
+
+    const int64_t *restrict Bp = B->p ;
+    const int64_t *restrict Bh = B->h ;
+    const int64_t *restrict Bi = B->i ;
+    const int64_t bnvec = B->nvec ;
+    const int64_t *restrict B_Yx = (B->Y == NULL) ? NULL : B->Y->x ;
+    const int64_t B_hash_bits = (B->Y == NULL) ? 0 : (B->Y->vdim - 1) ;
+    const int64_t vlen = A->vlen ;
+
+    for (int64_t h = 0 ; h < nheavy ; h++)
     {
 
         //----------------------------------------------------------------------
-        // coarse task operates on A (:, k:klast)
+        // get C(i,j), A(:,i), and B(:,j)
         //----------------------------------------------------------------------
 
-        int64_t pfirst = Coarse [t] ;
-        int64_t plast  = Coarse [t+1] - 1 ;
+        const int64_t pC = Heavy [h] ;
+        const int64_t k = GB_search_for_vector (pC, Cp, 0, cnvec, cvlen) ;
+        const int64_t j = GBH (Ch, k) ;
+        const int64_t i = Mi [pC] ;
 
-        if (pfirst <= plast)
+        int64_t pA_start, pA_end, pB_start, pB_end ;
+        if (Ah != NULL)
         { 
-            // find the first vector of the slice for task taskid: the
-            // vector that owns the entry Ci [pfirst] and Cx [pfirst].
-            int64_t kfirst = GB_search_for_vector (pfirst, Cp, 0, cnvec,
-                cvlen) ;
-
-            // find the last vector of the slice for task taskid: the
-            // vector that owns the entry Ci [plast] and Cx [plast].
-            int64_t klast = GB_search_for_vector (plast, Cp, kfirst, cnvec,
-                cvlen) ;
-
-            // construct a coarse task that computes Ci,Cx [pfirst:plast].
-            // These entries appear in C(:,kfirst:klast), but this task does
-            // not compute all of C(:,kfirst), but just the subset starting at
-            // Ci,Cx [pstart].  The task computes all of the vectors
-            // C(:,kfirst+1:klast-1).  The task computes only part of the last
-            // vector, ending at Ci,Cx [pC_end-1] or Ci,Cx [plast].  This
-            // slice strategy is the same as GB_ek_slice.
-
-            GB_REALLOC_TASK_WORK (TaskList, ntasks + 1, max_ntasks) ;
-            TaskList [ntasks].kfirst = kfirst ;
-            TaskList [ntasks].klast  = klast ;
-            ASSERT (kfirst <= klast) ;
-            TaskList [ntasks].pC     = pfirst ;
-            TaskList [ntasks].pC_end = plast + 1 ;
-            ntasks++ ;
-
+            GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yx, A_hash_bits, i,
+                &pA_start, &pA_end) ;
         }
         else
         { 
-            // This task is empty, which means the coarse task that computes
-            // C(i,j) is doing too much work.
-            // FUTURE:: Use ultra-fine tasks here instead, and split the work
-            // for computing the single dot product C(i,j) amongst several
-            // ultra-fine tasks.
-            ;
+            pA_start = Ap [i] ;
+            pA_end   = Ap [i+1] ;
+        }
+        if (Bh != NULL)
+        { 
+            GB_hyper_hash_lookup (Bh, bnvec, Bp, B_Yx, B_hash_bits, j,
+                &pB_start, &pB_end) ;
+        }
+        else
+        { 
+            pB_start = Bp [j] ;
+            pB_end   = Bp [j+1] ;
+        }
+
+        //----------------------------------------------------------------------
+        // split A(:,i)'*B(:,j) into nfine ultra-fine tasks
+        //----------------------------------------------------------------------
+
+        double cij_work = (double) (Cwork [pC+1] - Cwork [pC]) ;
+        int nfine = (int) GB_IMIN (nthreads, cij_work / target_task_size) ;
+        nfine = GB_IMAX (nfine, 1) ;
+        double ckwork = (double) ((pA_end - pA_start) + (pB_end - pB_start)) ;
+
+        // first ultra-fine task starts at A(0,i) and B(0,j)
+        GB_REALLOC_TASK_WORK (TaskList, ntasks + nfine, max_ntasks) ;
+        TaskList [ntasks].kfirst = k ;
+        TaskList [ntasks].klast  = -1 ;     // this is an ultra-fine task
+        TaskList [ntasks].pC     = pC ;
+        TaskList [ntasks].pC_end = pC + 1 ;
+        TaskList [ntasks].pA     = pA_start ;
+        TaskList [ntasks].pB     = pB_start ;
+        ntasks++ ;
+
+        for (int tfine = 1 ; tfine < nfine ; tfine++)
+        { 
+            double target_work = ((nfine-tfine) * ckwork) / nfine ;
+            int64_t ifirst, pM, pA, pB ;
+            GB_slice_vector (&ifirst, &pM, &pA, &pB,
+                0, 0, NULL,
+                pA_start, pA_end, Ai,
+                pB_start, pB_end, Bi,
+                vlen, target_work) ;
+
+            // prior task ends at pA-1 and pB-1
+            TaskList [ntasks-1].pA_end = pA ;
+            TaskList [ntasks-1].pB_end = pB ;
+
+            // this task starts at pA and pB
+            TaskList [ntasks].kfirst = k ;
+            TaskList [ntasks].klast  = -1 ;
+            TaskList [ntasks].pC     = pC ;
+            TaskList [ntasks].pC_end = pC + 1 ;
+            TaskList [ntasks].pA     = pA ;
+            TaskList [ntasks].pB     = pB ;
+            ntasks++ ;
+        }
+
+        // last ultra-fine task ends at the end of A(:,i) and B(:,j)
+        TaskList [ntasks-1].pA_end = pA_end ;
+        TaskList [ntasks-1].pB_end = pB_end ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the coarse tasks, skipping the heavy entries
+    //--------------------------------------------------------------------------
+
+    for (int t = 0 ; t < ntasks1 ; t++)
+    {
+
+        //----------------------------------------------------------------------
+        // coarse task operates on A (:, k:klast)
+        //----------------------------------------------------------------------
+
+        int64_t pfirst = Coarse [t] ;
+        int64_t plast  = Coarse [t+1] - 1 ;
+
+        // the heavy entries in this slice are Heavy [hfirst:hlast-1]
+        int64_t hfirst = (nheavy == 0) ? 0 : Heavy_count [t] ;
+        int64_t hlast  = (nheavy == 0) ? 0 : Heavy_count [t+1] ;
+
+        for (int64_t h = hfirst ; h <= hlast ; h++)
+        {
+            // the next piece of this slice ends just before Heavy [h], or at
+            // the end of the slice
+            int64_t pend = (h < hlast) ? (Heavy [h] - 1) : plast ;
+
+            if (pfirst <= pend)
+            { 
+                // find the first vector of the slice for task taskid: the
+                // vector that owns the entry Ci [pfirst] and Cx [pfirst].
+                int64_t kfirst = GB_search_for_vector (pfirst, Cp, 0, cnvec,
+                    cvlen) ;
+
+                // find the last vector of the slice for task taskid: the
+                // vector that owns the entry Ci [pend] and Cx [pend].
+                int64_t klast = GB_search_for_vector (pend, Cp, kfirst, cnvec,
+                    cvlen) ;
+
+                // construct a coarse task that computes Ci,Cx [pfirst:pend].
+                // These entries appear in C(:,kfirst:klast), but this task
+                // does not compute all of C(:,kfirst), but just the subset
+                // starting at Ci,Cx [pstart].  The task computes all of the
+                // vectors C(:,kfirst+1:klast-1).  The task computes only part
+                // of the last vector, ending at Ci,Cx [pC_end-1] or Ci,Cx
+                // [pend].  This slice strategy is the same as GB_ek_slice.
+
+                GB_REALLOC_TASK_WORK (TaskList, ntasks + 1, max_ntasks) ;
+                TaskList [ntasks].kfirst = kfirst ;
+                TaskList [ntasks].klast  = klast ;
+                ASSERT (kfirst <= klast) ;
+                TaskList [ntasks].pC     = pfirst ;
+                TaskList [ntasks].pC_end = pend + 1 ;
+                ntasks++ ;
+            }
+
+            // the next piece starts just after the heavy entry
+            if (h < hlast) pfirst = Heavy [h] + 1 ;
         }
     }
 
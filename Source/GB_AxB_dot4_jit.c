@@ -39,7 +39,7 @@ GrB_Info GB_AxB_dot4_jit            // C+=A'*B, dot4 method, via the JIT
     char *suffix ;
     uint64_t hash = GB_encodify_mxm (&encoding, &suffix,
         GB_JIT_KERNEL_AXB_DOT4,
-        false, C_in_iso, GxB_FULL, C->type,
+        false, C_in_iso, false, GxB_FULL, C->type,
         NULL, true, false, semiring, flipxy, A, B) ;
 
     //--------------------------------------------------------------------------
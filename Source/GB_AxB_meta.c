@@ -26,6 +26,7 @@
 {                               \
     GB_Matrix_free (&AT) ;      \
     GB_Matrix_free (&BT) ;      \
+    GB_Matrix_free (&B_bitmap) ; \
 }
 
 #define GB_FREE_ALL             \
@@ -50,8 +51,8 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     const bool Mask_comp,           // if true, use !M
     const bool Mask_struct,         // if true, use the only structure of M
     const GrB_BinaryOp accum,       // accum operator for C_in += A*B
-    const GrB_Matrix A_in,          // input matrix
-    const GrB_Matrix B_in,          // input matrix
+    const GrB_Matrix A_input,       // input matrix
+    const GrB_Matrix B_input,       // input matrix
     const GrB_Semiring semiring_in, // semiring that defines C=A*B
     bool A_transpose,               // if true, use A', else A
     bool B_transpose,               // if true, use B', else B
@@ -71,20 +72,20 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     ASSERT_MATRIX_OK_OR_NULL (C_in, "C_in for meta A*B", GB0) ;
     ASSERT_MATRIX_OK_OR_NULL (M_in, "M for meta A*B", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for meta A*B", GB0) ;
-    ASSERT_MATRIX_OK (A_in, "A_in for meta A*B", GB0) ;
-    ASSERT_MATRIX_OK (B_in, "B_in for meta A*B", GB0) ;
+    ASSERT_MATRIX_OK (A_input, "A_input for meta A*B", GB0) ;
+    ASSERT_MATRIX_OK (B_input, "B_input for meta A*B", GB0) ;
 
     ASSERT (!GB_ZOMBIES (M_in)) ;
     ASSERT (GB_JUMBLED_OK (M_in)) ;
     ASSERT (!GB_PENDING (M_in)) ;
 
-    ASSERT (!GB_ZOMBIES (A_in)) ;
-    ASSERT (GB_JUMBLED_OK (A_in)) ;
-    ASSERT (!GB_PENDING (A_in)) ;
+    ASSERT (!GB_ZOMBIES (A_input)) ;
+    ASSERT (GB_JUMBLED_OK (A_input)) ;
+    ASSERT (!GB_PENDING (A_input)) ;
 
-    ASSERT (!GB_ZOMBIES (B_in)) ;
-    ASSERT (GB_JUMBLED_OK (B_in)) ;
-    ASSERT (!GB_PENDING (B_in)) ;
+    ASSERT (!GB_ZOMBIES (B_input)) ;
+    ASSERT (GB_JUMBLED_OK (B_input)) ;
+    ASSERT (!GB_PENDING (B_input)) ;
 
     ASSERT_SEMIRING_OK (semiring_in, "semiring_in for numeric A*B", GB0) ;
     ASSERT (mask_applied != NULL) ;
@@ -96,8 +97,13 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
-    struct GB_Matrix_opaque AT_header, BT_header ;
-    GrB_Matrix AT = NULL, BT = NULL ;
+    struct GB_Matrix_opaque AT_header, BT_header, B_bitmap_header ;
+    GrB_Matrix AT = NULL, BT = NULL, B_bitmap = NULL ;
+
+    // A_in may be replaced with its cached transpose, and B_in with a bitmap
+    // copy, if the direction of C=A*B is changed (see below)
+    GrB_Matrix A_in = A_input ;
+    GrB_Matrix B_in = B_input ;
 
     (*mask_applied) = false ;
     (*done_in_place) = false ;
@@ -125,8 +131,12 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     // estimate the work to transpose A, B, and C
     //--------------------------------------------------------------------------
 
-    double A_work = GB_nnz_held (A_in) ;    // work to transpose A
-    double B_work = GB_nnz_held (B_in) ;    // work to transpose B
+    // If A or B has a cached transpose (or will have one; see
+    // GxB_TRANSPOSE_CACHE), no work is needed to transpose it.
+    double A_work = (A_in->T != NULL || GB_transpose_cache_need (A_in)) ? 0 :
+        GB_nnz_held (A_in) ;                // work to transpose A
+    double B_work = (B_in->T != NULL || GB_transpose_cache_need (B_in)) ? 0 :
+        GB_nnz_held (B_in) ;                // work to transpose B
     // work to transpose C cannot be determined; assume it is full
     double C_work =
         (double) (A_transpose ? GB_NCOLS (A_in) : GB_NROWS (A_in)) *
@@ -149,13 +159,15 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     //
     // If C is bitmap:
     //
-    //      C can be computed in-place if its type is the same as the semiring
-    //      monoid.  The accum must not be present, or if present it must match
-    //      the semiring monoid.  C_replace can be true or false.
+    //      C += A*B can be computed in-place if its type is the same as the
+    //      semiring monoid, and the accum is present and matches the semiring
+    //      monoid (but is not the ANY monoid).  No mask can be present.  The
+    //      C_replace option has no effect since no mask is present.  C is
+    //      computed in-place by GB_AxB_saxbit or GB_AxB_dot2; the other
+    //      methods ignore C_in.  See GB_AxB_bitmap_in_place_control.
     //
-    //      todo: modify GB_AxB_dot2 so it can compute C in-place,
-    //      or add a bitmap dot product method.  Also modify GB_AxB_saxpy
-    //      so it can compute a C bitmap in-place.
+    //      todo: handle C<M>+=A*B and C=A*B (with no accum) in-place when
+    //      C is bitmap.
     //
     // In both cases, C must not be transposed, nor can it be aliased with any
     // input matrix.
@@ -164,20 +176,17 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
 
     if (C_in != NULL)
     {
-        #if 0
-        // disabled: this will work for most methods in the future is too
-        // aggressive for dot4
         if (GB_IS_BITMAP (C_in))
-        {
-            // C is bitmap
+        { 
+            // C is bitmap: C += A*B with no mask
             ASSERT (!GB_PENDING (C_in)) ; // no pending tuples in bitmap
             ASSERT (!GB_ZOMBIES (C_in)) ; // bitmap never has zombies
-            can_do_in_place = (C_in->type == semiring_in->add->op->ztype)
-                && ((accum == NULL) || (accum == semiring_in->add->op)) ;
+            can_do_in_place = (M_in == NULL) && (accum != NULL)
+                && (accum == semiring_in->add->op)
+                && (accum->opcode != GB_ANY_binop_code)
+                && (C_in->type == accum->ztype) ;
         }
-        else
-        #endif
-        if (accum != NULL)
+        else if (accum != NULL)
         { 
             // accum is present; check if C_in is full.
             bool C_is_full = GB_IS_FULL (C_in) ;
@@ -236,6 +245,47 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         B_transpose = !B_transpose ;
     }
 
+    //--------------------------------------------------------------------------
+    // select the direction of C=A*B when B is a single vector
+    //--------------------------------------------------------------------------
+
+    // If A has a cached transpose (see GxB_TRANSPOSE_CACHE), then C=A*B and
+    // C=A'*B, where B is a single column vector (as in GrB_mxv and GrB_vxm),
+    // can be computed with either A or A', with no explicit transpose.  Using
+    // A (push), the saxpy method scatters the columns of A selected by the
+    // entries of B.  Using A' (pull), each entry of C permitted by the mask is
+    // computed with a dot product.  GB_AxB_meta_direction selects the method
+    // with the least work, on each call, based on the number of entries in B
+    // and the mask.  The transpose of A is computed here if it does not yet
+    // exist; it is kept in A->T until A is modified.
+
+    if (B_in->vdim == 1 && !B_transpose && !C_transpose
+        && AxB_method == GxB_DEFAULT && A_in->T_cache)
+    {
+        bool pull = GB_AxB_meta_direction (M_in, Mask_comp, A_in, A_transpose,
+            B_in, semiring_in) ;
+        GBURBLE ("(%s) ", pull ? "pull" : "push") ;
+        if (pull != A_transpose)
+        { 
+            // use A->T in place of A, computing it if needed
+            GB_OK (GB_transpose_cache_build (A_in, Werk)) ;
+            if (A_in->T != NULL)
+            { 
+                A_in = A_in->T ;
+                A_transpose = !A_transpose ;
+            }
+        }
+        if (pull && A_transpose && (M_in == NULL || Mask_comp)
+            && (GB_IS_SPARSE (B_in) || GB_IS_HYPERSPARSE (B_in)))
+        { 
+            // pull uses the dot2 method with B as bitmap
+            GB_CLEAR_STATIC_HEADER (B_bitmap, &B_bitmap_header) ;
+            GB_OK (GB_shallow_copy (B_bitmap, B_in->is_csc, B_in, Werk)) ;
+            GB_OK (GB_convert_any_to_bitmap (B_bitmap, Werk)) ;
+            B_in = B_bitmap ;
+        }
+    }
+
         // Now all matrices C, M_in, A_in, and B_in, can be treated as if they
         // were all in CSC format, except any of them can be transposed.  There
         // are now 16 cases to handle, where M, A, and B are M_in, A_in, and
@@ -582,8 +632,8 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // converted to C=(B*A)' and C=B*A, respectively.  It is left here
             // in case the swap_rule changes.
             GB_CLEAR_STATIC_HEADER (BT, &BT_header) ;
-            GB_OK (GB_transpose_cast (BT, btype_cast, true, B, B_is_pattern,
-                Werk)) ;
+            GB_OK (GB_transpose_cache_cast (BT, btype_cast, true, B,
+                B_is_pattern, B != C_in, Werk)) ;
             B = BT ;
         }
 
@@ -603,8 +653,8 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         {
             // AT = A', or AT=one(A') if only the pattern is needed.
             GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
-            GB_OK (GB_transpose_cast (AT, atype_cast, true, A, A_is_pattern,
-                Werk)) ;
+            GB_OK (GB_transpose_cache_cast (AT, atype_cast, true, A,
+                A_is_pattern, A != C_in, Werk)) ;
             // do not use colscale if AT is now bitmap
             if (GB_IS_BITMAP (AT))
             { 
@@ -684,8 +734,8 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         {
             // BT = B', or BT=one(B') if only the pattern of B is needed
             GB_CLEAR_STATIC_HEADER (BT, &BT_header) ;
-            GB_OK (GB_transpose_cast (BT, btype_cast, true, B, B_is_pattern,
-                Werk)) ;
+            GB_OK (GB_transpose_cache_cast (BT, btype_cast, true, B,
+                B_is_pattern, B != C_in, Werk)) ;
             // do not use rowscale if BT is now bitmap
             if (axb_method == GB_USE_ROWSCALE && GB_IS_BITMAP (BT))
             { 
@@ -716,8 +766,8 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GBURBLE ("C%s=A*B', dot_product (transposed %s) "
                     "(transposed %s) ", M_str, A_str, B_str) ;
                 GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
-                GB_OK (GB_transpose_cast (AT, atype_cast, true, A, A_is_pattern,
-                    Werk)) ;
+                GB_OK (GB_transpose_cache_cast (AT, atype_cast, true, A,
+                    A_is_pattern, A != C_in, Werk)) ;
                 GB_OK (GB_AxB_dot (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, AT, BT, semiring, flipxy,
                     mask_applied, done_in_place, Werk)) ;
@@ -820,8 +870,8 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GBURBLE ("C%s=A*B', dot_product (transposed %s) ",
                     M_str, A_str) ;
                 GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
-                GB_OK (GB_transpose_cast (AT, atype_cast, true, A, A_is_pattern,
-                    Werk)) ;
+                GB_OK (GB_transpose_cache_cast (AT, atype_cast, true, A,
+                    A_is_pattern, A != C_in, Werk)) ;
                 GB_OK (GB_AxB_dot (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, AT, B, semiring, flipxy,
                     mask_applied, done_in_place, Werk)) ;
@@ -0,0 +1,92 @@
+//------------------------------------------------------------------------------
+// GB_AxB_meta_direction: select push or pull for C<M>=A*B, B a single vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M>=op(A)*B, where B is a single column vector, and where op(A) is m-by-n,
+// and all matrices are held by column (CSC).  This can be computed in two
+// ways, if both A and its transpose are available:
+
+//  push: C = A*B, where A is not transposed.  Each entry B(k) scatters the
+//      column A(:,k) into C, with the saxpy method.  The work is about
+//      nnz(B)*nnz(A)/n, independent of the mask.
+
+//  pull: C = (A')'*B, where A' is held explicitly.  Each entry C(i) is
+//      computed as the dot product of B with the ith column of A', with the
+//      dot2 or dot3 method.  Only entries C(i) permitted by the mask are
+//      computed, and the dot product can terminate early if the monoid has a
+//      terminal value.  The work is about nnz(A)/m for each entry C(i).
+
+// Push is faster when B is very sparse, and pull is faster when B has many
+// entries or when the mask is sparse, which is common in a breadth-first
+// search: see S. Beamer, K. Asanovic, and D. Patterson, "Direction-Optimizing
+// Breadth-First Search", SC'12.  This heuristic compares the work of the two
+// methods, and returns true if pull should be used.
+
+#include "GB_mxm.h"
+
+// expected reduction in the work of the pull method when the monoid is
+// terminal (Beamer et al. use a similar ratio to switch from push to pull)
+#define GB_PULL_ALPHA 14
+
+bool GB_AxB_meta_direction      // true: pull, false: push
+(
+    const GrB_Matrix M,         // mask for C<M>, or NULL
+    const bool Mask_comp,       // if true, use !M
+    const GrB_Matrix A,         // input matrix
+    const bool A_transpose,     // if true, op(A) is A', else A
+    const GrB_Matrix B,         // input vector
+    const GrB_Semiring semiring // semiring that defines C=A*B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the dimensions of op(A), and the number of entries
+    //--------------------------------------------------------------------------
+
+    ASSERT (B->vdim == 1) ;
+    double m = (double) (A_transpose ? A->vdim : A->vlen) ;
+    double n = (double) (A_transpose ? A->vlen : A->vdim) ;
+    double anz = (double) GB_nnz (A) ;
+    double bnz = (double) GB_nnz (B) ;
+
+    //--------------------------------------------------------------------------
+    // estimate the work for push
+    //--------------------------------------------------------------------------
+
+    double push = bnz * (anz / GB_IMAX (n, 1)) ;
+
+    //--------------------------------------------------------------------------
+    // estimate the work for pull
+    //--------------------------------------------------------------------------
+
+    // number of entries C(i) to compute, as permitted by the mask
+    double rows = m ;
+    if (M != NULL)
+    {
+        double mnz = (double) GB_nnz (M) ;
+        rows = Mask_comp ? GB_IMAX (m - mnz, 0) : mnz ;
+    }
+
+    double pull = rows * (anz / GB_IMAX (m, 1)) ;
+    GB_Opcode add_opcode = semiring->add->op->opcode ;
+    if (semiring->add->terminal != NULL || add_opcode == GB_ANY_binop_code)
+    {
+        // each dot product can terminate early
+        pull = pull / GB_PULL_ALPHA ;
+    }
+
+    // B may be converted to bitmap, and C is computed as bitmap
+    pull += m + ((GB_IS_BITMAP (B) || GB_IS_FULL (B)) ? 0 : n) ;
+
+    //--------------------------------------------------------------------------
+    // select the method with the least work
+    //--------------------------------------------------------------------------
+
+    return (pull < push) ;
+}
+
@@ -40,12 +40,16 @@
 // GB_AxB_saxbit: compute C=A*B, C<M>=A*B, or C<!M>=A*B
 //------------------------------------------------------------------------------
 
-// TODO: also pass in the user's C and the accum operator, and done_in_place,
-// like GB_AxB_dot4.
+// If C_in is not NULL, then C_in += A*B is computed in-place instead, and the
+// C parameter is ignored.  The caller has checked the conditions with
+// GB_AxB_bitmap_in_place_control: C_in is bitmap and not iso on output, no
+// mask is present, and the accum operator matches the monoid of the semiring.
+// C_in is not iso on output, but may be iso on input.
 
 GrB_Info GB_AxB_saxbit        // C = A*B where C is bitmap
 (
     GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C_in,                // input/output matrix, if done in-place
     const bool C_iso,               // true if C is iso
     const GB_void *cscalar,         // iso value of C
     const GrB_Matrix M,             // optional mask matrix
@@ -55,6 +59,7 @@ GrB_Info GB_AxB_saxbit        // C = A*B where C is bitmap
     const GrB_Matrix B,             // input matrix B
     const GrB_Semiring semiring,    // semiring that defines C=A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    bool *done_in_place,            // if true, C_in was computed in-place
     GB_Werk Werk
 )
 {
@@ -108,23 +113,53 @@ GrB_Info GB_AxB_saxbit        // C = A*B where C is bitmap
     double chunk = GB_Context_chunk ( ) ;
 
     //--------------------------------------------------------------------------
-    // construct C
+    // construct C, or use C_in if computed in-place
     //--------------------------------------------------------------------------
 
-    // TODO: If C is the right type on input, and accum is the same as the
-    // monoid, then do not create C, but compute in-place instead.
+    GrB_Type ctype = semiring->add->op->ztype ;
+    if (C_in != NULL)
+    { 
 
-    // Cb is set to all zero.  C->x is malloc'd unless C is iso, in which case
-    // it is calloc'ed.
+        //----------------------------------------------------------------------
+        // C_in += A*B, computed in-place
+        //----------------------------------------------------------------------
 
-    GrB_Type ctype = semiring->add->op->ztype ;
-    int64_t cnzmax = 1 ;
-    (void) GB_int64_multiply ((GrB_Index *) (&cnzmax), A->vlen, B->vdim) ;
-    // set C->iso = C_iso   OK
-    GB_OK (GB_new_bix (&C, // existing header
-        ctype, A->vlen, B->vdim, GB_Ap_null, true, GxB_BITMAP, true,
-        GB_HYPER_SWITCH_DEFAULT, -1, cnzmax, true, C_iso)) ;
-    C->magic = GB_MAGIC ;
+        // The entries already in C_in are treated just like entries computed
+        // by an earlier part of the product, so each C(i,j) present in both
+        // C_in and A*B is summed with the monoid.
+
+        ASSERT_MATRIX_OK (C_in, "C_in for bitmap saxpy C+=A*B", GB0) ;
+        ASSERT (GB_IS_BITMAP (C_in)) ;
+        ASSERT (C_in->type == ctype) ;
+        ASSERT (C_in->vlen == A->vlen && C_in->vdim == B->vdim) ;
+        ASSERT (M == NULL && !C_iso) ;
+        GBURBLE ("(C+=A*B in-place) ") ;
+        C = C_in ;
+        if (C->iso)
+        { 
+            // expand C to non-iso
+            GB_OK (GB_convert_any_to_non_iso (C, true)) ;
+        }
+
+    }
+    else
+    { 
+
+        //----------------------------------------------------------------------
+        // allocate a new C
+        //----------------------------------------------------------------------
+
+        // Cb is set to all zero.  C->x is malloc'd unless C is iso, in which
+        // case it is calloc'ed.
+
+        int64_t cnzmax = 1 ;
+        (void) GB_int64_multiply ((GrB_Index *) (&cnzmax), A->vlen, B->vdim) ;
+        // set C->iso = C_iso   OK
+        GB_OK (GB_new_bix (&C, // existing header
+            ctype, A->vlen, B->vdim, GB_Ap_null, true, GxB_BITMAP, true,
+            GB_HYPER_SWITCH_DEFAULT, -1, cnzmax, true, C_iso)) ;
+        C->magic = GB_MAGIC ;
+    }
 
     //--------------------------------------------------------------------------
     // get the semiring operators
@@ -313,7 +348,7 @@ GrB_Info GB_AxB_saxbit        // C = A*B where C is bitmap
 
         if (info == GrB_NO_VALUE)
         { 
-            info = GB_AxB_saxbit_jit (C, M, Mask_comp,
+            info = GB_AxB_saxbit_jit (C, C_in != NULL, M, Mask_comp,
                 Mask_struct, A, B, semiring, flipxy, ntasks, nthreads,
                 nfine_tasks_per_vector, use_coarse_tasks, use_atomics,
                 M_ek_slicing, M_nthreads, M_ntasks, A_slice, H_slice, Wcx, Wf) ;
@@ -348,6 +383,7 @@ GrB_Info GB_AxB_saxbit        // C = A*B where C is bitmap
 
     GB_FREE_WORKSPACE ;
     ASSERT_MATRIX_OK (C, "C bitmap saxpy output", GB0) ;
+    (*done_in_place) = (C_in != NULL) ;
     return (GrB_SUCCESS) ;
 }
 
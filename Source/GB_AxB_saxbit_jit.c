@@ -17,6 +17,7 @@ GrB_Info GB_AxB_saxbit_jit      // C<M>=A*B, saxbit, via the JIT
     // input/output:
     GrB_Matrix C,
     // input:
+    const bool C_in_place,          // if true, C+=A*B is computed in place
     const GrB_Matrix M,
     const bool Mask_comp,
     const bool Mask_struct,
@@ -47,7 +48,7 @@ GrB_Info GB_AxB_saxbit_jit      // C<M>=A*B, saxbit, via the JIT
     char *suffix ;
     uint64_t hash = GB_encodify_mxm (&encoding, &suffix,
         GB_JIT_KERNEL_AXB_SAXBIT,
-        false, false, GxB_BITMAP, C->type,
+        false, false, C_in_place, GxB_BITMAP, C->type,
         M, Mask_struct, Mask_comp, semiring, flipxy, A, B) ;
 
     //--------------------------------------------------------------------------
@@ -10,8 +10,11 @@
 #include "GB_mxm.h"
 #include "GB_AxB_saxpy.h"
 #include "GB_stringify.h"
+#include "GB_tuner.h"
 
-// TODO: allow bitmap multiply to work in-place as well
+// C+=A*B can be computed in-place if C is full (with saxpy4 or saxpy5), or if
+// C is bitmap (with saxbit or dot2).  In both cases, no mask can be present,
+// and the accum must match the monoid.
 
 GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
 (
@@ -109,8 +112,11 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
             // match the ztype of the monoid, but the JIT may do any
             // typecasting with A and B.
 
+            GB_tuner_state tune ;
+            GB_tuner_begin (&tune, GB_TUNER_SAXPY4, A, B) ;
             info = GB_AxB_saxpy4 (C_in, A, B, semiring, flipxy, done_in_place,
                 Werk) ;
+            GB_tuner_end (&tune, info) ;
             if (info != GrB_NO_VALUE)
             { 
                 // return if saxpy4 has handled this case, otherwise fall
@@ -130,8 +136,11 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
             // false, ytype if true).  The type of C must match the ztype of
             // the monoid.  The JIT may do any typecasting with B.
 
+            GB_tuner_state tune ;
+            GB_tuner_begin (&tune, GB_TUNER_SAXPY5, A, B) ;
             info = GB_AxB_saxpy5 (C_in, A, B, semiring, flipxy, done_in_place,
                 Werk) ;
+            GB_tuner_end (&tune, info) ;
             if (info != GrB_NO_VALUE)
             { 
                 // return if saxpy5 has handled this case, otherwise fall
@@ -205,9 +214,12 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
         // or hypersparse.
 
         ASSERT (C_sparsity == GxB_HYPERSPARSE || C_sparsity == GxB_SPARSE) ;
+        GB_tuner_state tune ;
+        GB_tuner_begin (&tune, GB_TUNER_SAXPY3, A, B) ;
         info = GB_AxB_saxpy3 (C, C_iso, cscalar, C_sparsity, M, Mask_comp,
             Mask_struct, A, B, semiring, flipxy, mask_applied, AxB_method,
             do_sort, Werk) ;
+        GB_tuner_end (&tune, info) ;
 
         if (info == GrB_NO_VALUE)
         { 
@@ -233,6 +245,15 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
         //----------------------------------------------------------------------
 
         ASSERT (C_sparsity == GxB_BITMAP) ;
+        GB_tuner_state tune ;
+
+        // C+=A*B can be done in-place if C_in is bitmap, no mask is present,
+        // and the accum matches the monoid
+        if (!GB_AxB_bitmap_in_place_control (C_iso, C_in, M, Mask_comp,
+            accum, semiring))
+        { 
+            C_in = NULL ;
+        }
 
         if ((GB_IS_BITMAP (A) || GB_IS_FULL (A)) &&
             (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)))
@@ -240,15 +261,21 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
             // C<#M> = A*B via dot products, where A is bitmap or full and B is
             // sparse or hypersparse, using the dot2 method with A not
             // explicitly transposed.
-            info = GB_AxB_dot2 (C, C_iso, cscalar, M, Mask_comp, Mask_struct,
-                true, A, B, semiring, flipxy, Werk) ;
+            GB_tuner_begin (&tune, GB_TUNER_DOT2, A, B) ;
+            info = GB_AxB_dot2 (C, C_in, C_iso, cscalar, M, Mask_comp,
+                Mask_struct, true, A, B, semiring, flipxy, done_in_place,
+                Werk) ;
+            GB_tuner_end (&tune, info) ;
         }
         else
         { 
 
             // C<#M> = A*B via bitmap saxpy method
-            info = GB_AxB_saxbit (C, C_iso, cscalar, M,
-                Mask_comp, Mask_struct, A, B, semiring, flipxy, Werk) ;
+            GB_tuner_begin (&tune, GB_TUNER_SAXBIT, A, B) ;
+            info = GB_AxB_saxbit (C, C_in, C_iso, cscalar, M,
+                Mask_comp, Mask_struct, A, B, semiring, flipxy, done_in_place,
+                Werk) ;
+            GB_tuner_end (&tune, info) ;
         }
 
         // the mask is always applied if present
@@ -103,6 +103,7 @@ GrB_Info GB_AxB_saxpy5              // C += A*B
 GrB_Info GB_AxB_saxbit        // C = A*B where C is bitmap
 (
     GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C_in,                // input/output matrix, if done in-place
     const bool C_iso,               // true if C is iso
     const GB_void *cscalar,         // iso value of C
     const GrB_Matrix M,             // optional mask matrix
@@ -112,6 +113,7 @@ GrB_Info GB_AxB_saxbit        // C = A*B where C is bitmap
     const GrB_Matrix B,             // input matrix B
     const GrB_Semiring semiring,    // semiring that defines C=A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    bool *done_in_place,            // if true, C_in was computed in-place
     GB_Werk Werk
 ) ;
 
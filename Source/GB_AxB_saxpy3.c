@@ -12,7 +12,12 @@
 // GB_AxB_saxpy3 computes C=A*B, C<M>=A*B, or C<!M>=A*B in parallel.  If the
 // mask matrix M has too many entries compared to the work to compute A*B, then
 // it is not applied.  Instead, M is ignored and C=A*B is computed.  The mask
-// is applied later, in GB_mxm.
+// is applied later, in GB_mxm.  If the complemented mask !M is sparse and
+// large compared with the work to compute A*B, a bitmap copy of M is
+// constructed once, and then used in-place by all tasks, instead of
+// scattering each M(:,j) into the workspace of each task that needs it.
+// The analysis of the patterns of M, A, and B can be saved in a plan and
+// reused by the next call (see GB_AxB_saxpy3_plan.c).
 
 // C is sparse or hypersparse.  M, A, and B can have any format.
 // The accum operator is not handled, and C is not modified in-place.  Instead,
@@ -92,6 +97,7 @@
 #include "GB_mxm.h"
 #include "GB_stringify.h"
 #include "GB_AxB_saxpy_generic.h"
+#include "GB_transpose.h"
 #include "GB_control.h"
 #include "GB_AxB__include1.h"
 #ifndef GBCOMPACT
@@ -105,6 +111,7 @@
     GB_FREE_WORK (&Hi_all, Hi_all_size) ;           \
     GB_FREE_WORK (&Hf_all, Hf_all_size) ;           \
     GB_FREE_WORK (&Hx_all, Hx_all_size) ;           \
+    GB_Matrix_free (&M_bitmap) ;                    \
 }
 
 #define GB_FREE_ALL             \
@@ -148,6 +155,8 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 
     (*mask_applied) = false ;
     bool apply_mask = false ;
+    struct GB_Matrix_opaque M_bitmap_header ;
+    GrB_Matrix M_bitmap = NULL ;
 
     ASSERT (C != NULL && (C->static_header || GBNSTATIC)) ;
 
@@ -274,8 +283,27 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 
     int nthreads, ntasks, nfine ;
     bool M_in_place = false ;
+    bool M_to_bitmap = false ;
 
-    if (nthreads_max == 1 && M == NULL && (AxB_method != GxB_AxB_HASH) &&
+    // reuse the plan of the descriptor, if the patterns have not changed
+    GB_saxpy3_plan Plan = NULL, New_Plan = NULL ;
+    if (Werk->plan_handle != NULL && GB_AxB_saxpy3_plan_match (
+        (*(Werk->plan_handle)), M, Mask_comp, A, B, AxB_method,
+        builtin_semiring, nthreads_max, chunk))
+    { 
+        Plan = (*(Werk->plan_handle)) ;
+    }
+
+    if (Plan != NULL)
+    { 
+        // The patterns of A, B, and M are the same as when the plan was
+        // created, so the tasks it holds can be used as-is.
+        GBURBLE ("(saxpy3 plan) ") ;
+        info = GB_AxB_saxpy3_plan_tasks (Plan,
+            &SaxpyTasks, &SaxpyTasks_size, &apply_mask, &M_in_place,
+            &M_to_bitmap, &ntasks, &nfine, &nthreads) ;
+    }
+    else if (nthreads_max == 1 && M == NULL && (AxB_method != GxB_AxB_HASH) &&
         GB_IMIN (GB_nnz (A), GB_nnz (B)) > cvlen/16)
     { 
         // Skip the flopcount analysis if only a single thread is being used,
@@ -296,7 +324,34 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         info = GB_AxB_saxpy3_slice_balanced (C, M, Mask_comp, A, B, AxB_method,
             builtin_semiring,
             &SaxpyTasks, &SaxpyTasks_size, &apply_mask, &M_in_place,
-            &ntasks, &nfine, &nthreads, Werk) ;
+            &M_to_bitmap, &ntasks, &nfine, &nthreads, Werk) ;
+    }
+
+    if (info == GrB_SUCCESS && M_to_bitmap)
+    { 
+        // The complemented mask !M is sparse, and scattering M(:,j) into the
+        // workspace of each task is too costly.  Construct M_bitmap as a
+        // shallow copy of M, convert it to bitmap in parallel, and redo the
+        // analysis.  The bitmap M is then used in-place by all tasks.
+        GB_CLEAR_STATIC_HEADER (M_bitmap, &M_bitmap_header) ;
+        GB_OK (GB_shallow_copy (M_bitmap, M->is_csc, M, Werk)) ;
+        if (Mask_struct)
+        { 
+            // the values of M are not accessed, so do not copy them
+            M_bitmap->iso = true ;      // OK: values of M_bitmap not used
+        }
+        GB_OK (GB_convert_any_to_bitmap (M_bitmap, Werk)) ;
+        M = M_bitmap ;
+        if (Plan == NULL)
+        { 
+            // redo the analysis with the bitmap M
+            info = GB_AxB_saxpy3_slice_balanced (C, M, Mask_comp, A, B,
+                AxB_method, builtin_semiring,
+                &SaxpyTasks, &SaxpyTasks_size, &apply_mask, &M_in_place,
+                &M_to_bitmap, &ntasks, &nfine, &nthreads, Werk) ;
+            ASSERT (!M_to_bitmap) ;
+            M_to_bitmap = true ;
+        }
     }
 
     if (info == GrB_NO_VALUE)
@@ -315,6 +370,15 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         return (info) ;
     }
 
+    if (Werk->plan_handle != NULL && Plan == NULL)
+    { 
+        // save the analysis in a new plan, for the next call
+        New_Plan = GB_AxB_saxpy3_plan_save (Werk->plan_handle,
+            Werk->plan_size_handle, M_input, Mask_comp_input, A, B,
+            AxB_method, builtin_semiring, nthreads_max, chunk, SaxpyTasks,
+            ntasks, nfine, nthreads, apply_mask, M_in_place, M_to_bitmap) ;
+    }
+
     if (!apply_mask)
     { 
         // disable the mask, if present.
@@ -589,8 +653,24 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     // a total of 5.9 second for phase 7 (the numerical work below).
     // Figure out a faster method.
 
-    GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
-        A, B, SaxpyTasks, ntasks, nfine, nthreads) ;
+    if (Plan != NULL && Plan->Cp != NULL)
+    { 
+        // the plan holds the results of the symbolic phase
+        GB_AxB_saxpy3_plan_restore_Cp (Plan, C) ;
+    }
+    else
+    { 
+        GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
+            A, B, SaxpyTasks, ntasks, nfine, nthreads) ;
+        if (New_Plan != NULL && M == NULL)
+        { 
+            // With no mask, the symbolic phase depends only on the patterns
+            // of A and B, so it can be saved in the plan.  With a mask, the
+            // fine tasks scatter M into their hash tables, and the result may
+            // depend on the values of M.
+            GB_AxB_saxpy3_plan_save_Cp (New_Plan, C) ;
+        }
+    }
 
     //==========================================================================
     // C = A*B, via saxpy3 method, phases 2 to 5
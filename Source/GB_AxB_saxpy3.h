@@ -101,6 +101,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     size_t *SaxpyTasks_size_handle,
     bool *apply_mask,               // if true, apply M during sapxy3
     bool *M_in_place,               // if true, use M in-place
+    bool *M_to_bitmap,              // if true, convert M to bitmap and redo
     int *ntasks,                    // # of tasks created (coarse and fine)
     int *nfine,                     // # of fine tasks created
     int *nthreads,                  // # of threads to use
@@ -669,5 +670,118 @@ void GB_AxB_saxpy3_sym_nss      // C<!M> = A*B, A is sparse, B is sparse
     const int nthreads          // number of threads
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_saxpy3_plan: symbolic analysis of saxpy3, reused across calls
+//------------------------------------------------------------------------------
+
+// A copy of the pattern of A, B, or M, used to check if the plan is valid.
+
+typedef struct
+{
+    int sparsity ;          // hypersparse, sparse, bitmap, or full
+    int64_t vlen ;
+    int64_t vdim ;
+    int64_t nvec ;
+    int64_t *p ; size_t p_size ; int64_t np ;   // copy of X->p [0:np-1]
+    int64_t *h ; size_t h_size ; int64_t nh ;   // copy of X->h [0:nh-1]
+    int64_t *i ; size_t i_size ; int64_t ni ;   // copy of X->i [0:ni-1]
+    int8_t  *b ; size_t b_size ; int64_t nb ;   // copy of X->b [0:nb-1]
+}
+GB_saxpy3_pattern ;
+
+struct GB_saxpy3_plan_struct
+{
+    // patterns of the inputs when the plan was created
+    GB_saxpy3_pattern A_pattern ;
+    GB_saxpy3_pattern B_pattern ;
+    GB_saxpy3_pattern M_pattern ;
+    bool M_present ;        // true if M was present
+    bool Mask_comp ;        // true if !M was used
+    // settings that affect the analysis
+    GrB_Desc_Value AxB_method ;
+    bool builtin_semiring ;
+    int nthreads_max ;
+    double chunk ;
+    // results of phase0
+    GB_saxpy3task_struct *SaxpyTasks ; size_t SaxpyTasks_size ;
+    int ntasks ;
+    int nfine ;
+    int nthreads ;
+    bool apply_mask ;       // true if the mask is applied by saxpy3
+    bool M_in_place ;       // true if the mask is used in-place
+    bool M_to_bitmap ;      // true if a bitmap copy of M is used
+    // results of phase1, for C=A*B with no mask applied
+    int64_t *Cp ; size_t Cp_size ;  // Cp [0:cnvec-1] from the symbolic phase
+    int64_t cnvec ;
+} ;
+
+typedef struct GB_saxpy3_plan_struct *GB_saxpy3_plan ;
+
+void GB_AxB_saxpy3_plan_free
+(
+    GB_saxpy3_plan *Plan_handle,    // plan to free
+    size_t Plan_size                // size of the plan struct
+) ;
+
+bool GB_AxB_saxpy3_plan_match       // true if the plan is valid for A*B
+(
+    const GB_saxpy3_plan Plan,      // plan to check; may be NULL
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const GrB_Desc_Value AxB_method,
+    const bool builtin_semiring,
+    const int nthreads_max,
+    const double chunk
+) ;
+
+GrB_Info GB_AxB_saxpy3_plan_tasks   // get a copy of the tasks of a plan
+(
+    const GB_saxpy3_plan Plan,
+    // outputs
+    GB_saxpy3task_struct **SaxpyTasks_handle,
+    size_t *SaxpyTasks_size_handle,
+    bool *apply_mask,               // if true, apply M during sapxy3
+    bool *M_in_place,               // if true, use M in-place
+    bool *M_to_bitmap,              // if true, convert M to bitmap
+    int *ntasks,                    // # of tasks created (coarse and fine)
+    int *nfine,                     // # of fine tasks created
+    int *nthreads                   // # of threads to use
+) ;
+
+GB_saxpy3_plan GB_AxB_saxpy3_plan_save  // save the analysis in a new plan
+(
+    GB_saxpy3_plan *Plan_handle,    // plan to replace
+    size_t *Plan_size_handle,
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const GrB_Desc_Value AxB_method,
+    const bool builtin_semiring,
+    const int nthreads_max,
+    const double chunk,
+    const GB_saxpy3task_struct *SaxpyTasks,
+    const int ntasks,
+    const int nfine,
+    const int nthreads,
+    const bool apply_mask,
+    const bool M_in_place,
+    const bool M_to_bitmap
+) ;
+
+void GB_AxB_saxpy3_plan_save_Cp    // save the symbolic phase in the plan
+(
+    GB_saxpy3_plan Plan,
+    const GrB_Matrix C              // Cp computed by the symbolic phase
+) ;
+
+void GB_AxB_saxpy3_plan_restore_Cp // restore the symbolic phase from the plan
+(
+    const GB_saxpy3_plan Plan,
+    GrB_Matrix C                    // Cp for coarse tasks restored from Plan
+) ;
+
 #endif
 
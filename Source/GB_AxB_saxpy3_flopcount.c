@@ -132,8 +132,6 @@ GrB_Info GB_AxB_saxpy3_flopcount
     bool mask_is_M = (M != NULL && !Mask_comp) ;
     const int64_t *restrict Mp = NULL ;
     const int64_t *restrict Mh = NULL ;
-    const int64_t *restrict M_Yp = NULL ;
-    const int64_t *restrict M_Yi = NULL ;
     const int64_t *restrict M_Yx = NULL ;
     int64_t mnvec = 0 ;
     int64_t mvlen = 0 ;
@@ -151,8 +149,6 @@ GrB_Info GB_AxB_saxpy3_flopcount
         { 
             // mask is present, and hypersparse
             ASSERT_MATRIX_OK (M->Y, "M->Y hyper_hash", GB0) ;
-            M_Yp = M->Y->p ;
-            M_Yi = M->Y->i ;
             M_Yx = M->Y->x ;
             M_hash_bits = M->Y->vdim - 1 ;
         }
@@ -167,8 +163,6 @@ GrB_Info GB_AxB_saxpy3_flopcount
     const int64_t anvec = A->nvec ;
     const int64_t avlen = A->vlen ;
     const bool A_is_hyper = GB_IS_HYPERSPARSE (A) ;
-    const int64_t *restrict A_Yp = (A->Y == NULL) ? NULL : A->Y->p ;
-    const int64_t *restrict A_Yi = (A->Y == NULL) ? NULL : A->Y->i ;
     const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
     const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
 
@@ -270,8 +264,8 @@ GrB_Info GB_AxB_saxpy3_flopcount
                 if (M_is_hyper)
                 { 
                     // M is hypersparse: find M(:,j) in the M->Y hyper_hash
-                    GB_hyper_hash_lookup (Mh, mnvec, Mp, M_Yp, M_Yi, M_Yx,
-                        M_hash_bits, j, &pM, &pM_end) ;
+                    GB_hyper_hash_lookup (Mh, mnvec, Mp, M_Yx, M_hash_bits, j,
+                        &pM, &pM_end) ;
                 }
                 else
                 { 
@@ -320,8 +314,8 @@ GrB_Info GB_AxB_saxpy3_flopcount
                 if (A_is_hyper)
                 { 
                     // A is hypersparse: find A(:,k) in the A->Y hyper_hash
-                    GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yp, A_Yi, A_Yx,
-                        A_hash_bits, k, &pA, &pA_end) ;
+                    GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yx, A_hash_bits, k,
+                        &pA, &pA_end) ;
                 }
                 else
                 { 
@@ -0,0 +1,399 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan: reuse the symbolic analysis of saxpy3 across calls
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Before it computes any numerical values, GB_AxB_saxpy3 does a flop count
+// analysis, constructs a set of parallel tasks and sizes their hash tables
+// (phase0), and then counts the entries in each vector of C for its coarse
+// tasks (phase1).  None of this work depends on the values of A or B, and it
+// can take a significant fraction of the total time.  Iterative methods often
+// compute many products A*B where only the values of A and B change, not their
+// patterns.
+
+// If the GxB_AxB_PLAN option of the descriptor is enabled, GrB_mxm, GrB_mxv,
+// and GrB_vxm save the results of phase0 in a plan held in the descriptor,
+// along with the results of phase1 if the mask is not applied by saxpy3.  The
+// plan also holds a copy of the patterns of A, B, and M, and the settings that
+// affect the analysis.  On the next call to saxpy3 with the same descriptor,
+// the plan is reused if all of these match; otherwise it is replaced with a
+// new plan.  Checking the patterns takes O(nnz(A)+nnz(B)+nnz(M)) time, which
+// is typically much less than the work of phase0 and phase1.
+
+// A descriptor that holds a plan is modified by GrB_mxm, GrB_mxv, and GrB_vxm,
+// so it must not be used by multiple user threads at the same time.
+
+#include "GB_AxB_saxpy3.h"
+
+//------------------------------------------------------------------------------
+// GB_pattern_free: free the copy of a pattern
+//------------------------------------------------------------------------------
+
+static void GB_pattern_free (GB_saxpy3_pattern *P)
+{
+    GB_FREE (&(P->p), P->p_size) ;
+    GB_FREE (&(P->h), P->h_size) ;
+    GB_FREE (&(P->i), P->i_size) ;
+    GB_FREE (&(P->b), P->b_size) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_pattern_size: determine the size of each array in the pattern of X
+//------------------------------------------------------------------------------
+
+static void GB_pattern_size
+(
+    int64_t *np,
+    int64_t *nh,
+    int64_t *ni,
+    int64_t *nb,
+    const GrB_Matrix X
+)
+{
+    (*np) = (X->p == NULL) ? 0 : (X->nvec + 1) ;
+    (*nh) = (X->h == NULL) ? 0 : X->nvec ;
+    (*ni) = (X->i == NULL) ? 0 : GB_nnz_held (X) ;
+    (*nb) = (X->b == NULL) ? 0 : GB_nnz_held (X) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_array_equal: check if two arrays are equal, in parallel
+//------------------------------------------------------------------------------
+
+static bool GB_array_equal
+(
+    const void *X,
+    const void *Y,
+    size_t n,           // size of X and Y, in bytes
+    int nthreads_max,
+    double chunk
+)
+{
+    if (n == 0) return (true) ;
+    int nthreads = GB_nthreads (n / sizeof (int64_t), chunk, nthreads_max) ;
+    const GB_void *Xb = (const GB_void *) X ;
+    const GB_void *Yb = (const GB_void *) Y ;
+    bool equal = true ;
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:equal)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        size_t pstart = (size_t) GB_PART (tid,   n, nthreads) ;
+        size_t pend   = (size_t) GB_PART (tid+1, n, nthreads) ;
+        equal = equal && (memcmp (Xb + pstart, Yb + pstart, pend - pstart) == 0);
+    }
+    return (equal) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_pattern_match: check if the pattern of X matches its copy P
+//------------------------------------------------------------------------------
+
+static bool GB_pattern_match
+(
+    const GB_saxpy3_pattern *P,
+    const GrB_Matrix X,
+    int nthreads_max,
+    double chunk
+)
+{
+    int64_t np, nh, ni, nb ;
+    GB_pattern_size (&np, &nh, &ni, &nb, X) ;
+    if (P->sparsity != GB_sparsity (X) || P->vlen != X->vlen ||
+        P->vdim != X->vdim || P->nvec != X->nvec || P->np != np ||
+        P->nh != nh || P->ni != ni || P->nb != nb)
+    {
+        return (false) ;
+    }
+    return (GB_array_equal (P->p, X->p, np * sizeof (int64_t),
+                nthreads_max, chunk)
+        &&  GB_array_equal (P->h, X->h, nh * sizeof (int64_t),
+                nthreads_max, chunk)
+        &&  GB_array_equal (P->i, X->i, ni * sizeof (int64_t),
+                nthreads_max, chunk)
+        &&  GB_array_equal (P->b, X->b, nb * sizeof (int8_t),
+                nthreads_max, chunk)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_pattern_save: save a copy of the pattern of X
+//------------------------------------------------------------------------------
+
+static bool GB_pattern_save     // return false if out of memory
+(
+    GB_saxpy3_pattern *P,       // all zero on input
+    const GrB_Matrix X,
+    int nthreads_max,
+    double chunk
+)
+{
+    GB_pattern_size (&(P->np), &(P->nh), &(P->ni), &(P->nb), X) ;
+    P->sparsity = GB_sparsity (X) ;
+    P->vlen = X->vlen ;
+    P->vdim = X->vdim ;
+    P->nvec = X->nvec ;
+    if (P->np > 0) P->p = GB_MALLOC (P->np, int64_t, &(P->p_size)) ;
+    if (P->nh > 0) P->h = GB_MALLOC (P->nh, int64_t, &(P->h_size)) ;
+    if (P->ni > 0) P->i = GB_MALLOC (P->ni, int64_t, &(P->i_size)) ;
+    if (P->nb > 0) P->b = GB_MALLOC (P->nb, int8_t,  &(P->b_size)) ;
+    if ((P->np > 0 && P->p == NULL) || (P->nh > 0 && P->h == NULL) ||
+        (P->ni > 0 && P->i == NULL) || (P->nb > 0 && P->b == NULL))
+    {
+        // out of memory
+        return (false) ;
+    }
+    int nthreads = GB_nthreads (P->ni + P->nb, chunk, nthreads_max) ;
+    if (P->np > 0) GB_memcpy (P->p, X->p, P->np * sizeof (int64_t), nthreads) ;
+    if (P->nh > 0) GB_memcpy (P->h, X->h, P->nh * sizeof (int64_t), nthreads) ;
+    if (P->ni > 0) GB_memcpy (P->i, X->i, P->ni * sizeof (int64_t), nthreads) ;
+    if (P->nb > 0) GB_memcpy (P->b, X->b, P->nb * sizeof (int8_t),  nthreads) ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_free: free a plan
+//------------------------------------------------------------------------------
+
+void GB_AxB_saxpy3_plan_free
+(
+    GB_saxpy3_plan *Plan_handle,    // plan to free
+    size_t Plan_size                // size of the plan struct
+)
+{
+    if (Plan_handle != NULL && (*Plan_handle) != NULL)
+    {
+        GB_saxpy3_plan Plan = (*Plan_handle) ;
+        GB_pattern_free (&(Plan->A_pattern)) ;
+        GB_pattern_free (&(Plan->B_pattern)) ;
+        GB_pattern_free (&(Plan->M_pattern)) ;
+        GB_FREE (&(Plan->SaxpyTasks), Plan->SaxpyTasks_size) ;
+        GB_FREE (&(Plan->Cp), Plan->Cp_size) ;
+        GB_FREE (Plan_handle, Plan_size) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_match: check if a plan can be reused
+//------------------------------------------------------------------------------
+
+bool GB_AxB_saxpy3_plan_match       // true if the plan is valid for A*B
+(
+    const GB_saxpy3_plan Plan,      // plan to check; may be NULL
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const GrB_Desc_Value AxB_method,
+    const bool builtin_semiring,
+    const int nthreads_max,
+    const double chunk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check the settings
+    //--------------------------------------------------------------------------
+
+    if (Plan == NULL || Plan->M_present != (M != NULL)
+        || Plan->Mask_comp != Mask_comp || Plan->AxB_method != AxB_method
+        || Plan->builtin_semiring != builtin_semiring
+        || Plan->nthreads_max != nthreads_max || Plan->chunk != chunk)
+    {
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the patterns of A, B, and M
+    //--------------------------------------------------------------------------
+
+    return (GB_pattern_match (&(Plan->B_pattern), B, nthreads_max, chunk)
+        &&  GB_pattern_match (&(Plan->A_pattern), A, nthreads_max, chunk)
+        && (M == NULL ||
+            GB_pattern_match (&(Plan->M_pattern), M, nthreads_max, chunk))) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_tasks: get a copy of the tasks of a plan
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_saxpy3_plan_tasks   // get a copy of the tasks of a plan
+(
+    const GB_saxpy3_plan Plan,
+    // outputs
+    GB_saxpy3task_struct **SaxpyTasks_handle,
+    size_t *SaxpyTasks_size_handle,
+    bool *apply_mask,               // if true, apply M during sapxy3
+    bool *M_in_place,               // if true, use M in-place
+    bool *M_to_bitmap,              // if true, convert M to bitmap
+    int *ntasks,                    // # of tasks created (coarse and fine)
+    int *nfine,                     // # of fine tasks created
+    int *nthreads                   // # of threads to use
+)
+{
+
+    // the hash tables are assigned to the tasks by GB_AxB_saxpy3, so the
+    // task list is modified and a copy is required
+    size_t SaxpyTasks_size = 0 ;
+    GB_saxpy3task_struct *SaxpyTasks = GB_MALLOC_WORK (Plan->ntasks,
+        GB_saxpy3task_struct, &SaxpyTasks_size) ;
+    if (SaxpyTasks == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    memcpy (SaxpyTasks, Plan->SaxpyTasks,
+        Plan->ntasks * sizeof (GB_saxpy3task_struct)) ;
+
+    (*SaxpyTasks_handle) = SaxpyTasks ;
+    (*SaxpyTasks_size_handle) = SaxpyTasks_size ;
+    (*apply_mask) = Plan->apply_mask ;
+    (*M_in_place) = Plan->M_in_place ;
+    (*M_to_bitmap) = Plan->M_to_bitmap ;
+    (*ntasks) = Plan->ntasks ;
+    (*nfine) = Plan->nfine ;
+    (*nthreads) = Plan->nthreads ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_save: save the analysis in a new plan
+//------------------------------------------------------------------------------
+
+// Any prior plan is freed.  If out of memory, no plan is saved and NULL is
+// returned; this is not an error since the plan is optional.
+
+GB_saxpy3_plan GB_AxB_saxpy3_plan_save  // save the analysis in a new plan
+(
+    GB_saxpy3_plan *Plan_handle,    // plan to replace
+    size_t *Plan_size_handle,
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const GrB_Desc_Value AxB_method,
+    const bool builtin_semiring,
+    const int nthreads_max,
+    const double chunk,
+    const GB_saxpy3task_struct *SaxpyTasks,
+    const int ntasks,
+    const int nfine,
+    const int nthreads,
+    const bool apply_mask,
+    const bool M_in_place,
+    const bool M_to_bitmap
+)
+{
+
+    //--------------------------------------------------------------------------
+    // free any prior plan and allocate the new one
+    //--------------------------------------------------------------------------
+
+    GB_AxB_saxpy3_plan_free (Plan_handle, (*Plan_size_handle)) ;
+    (*Plan_size_handle) = 0 ;
+    size_t Plan_size = 0 ;
+    GB_saxpy3_plan Plan = GB_MALLOC (1, struct GB_saxpy3_plan_struct,
+        &Plan_size) ;
+    if (Plan == NULL)
+    {
+        // out of memory
+        return (NULL) ;
+    }
+    memset (Plan, 0, sizeof (struct GB_saxpy3_plan_struct)) ;
+
+    //--------------------------------------------------------------------------
+    // save the settings and the results of phase0
+    //--------------------------------------------------------------------------
+
+    Plan->M_present = (M != NULL) ;
+    Plan->Mask_comp = Mask_comp ;
+    Plan->AxB_method = AxB_method ;
+    Plan->builtin_semiring = builtin_semiring ;
+    Plan->nthreads_max = nthreads_max ;
+    Plan->chunk = chunk ;
+    Plan->ntasks = ntasks ;
+    Plan->nfine = nfine ;
+    Plan->nthreads = nthreads ;
+    Plan->apply_mask = apply_mask ;
+    Plan->M_in_place = M_in_place ;
+    Plan->M_to_bitmap = M_to_bitmap ;
+    Plan->cnvec = -1 ;
+
+    Plan->SaxpyTasks = GB_MALLOC (ntasks, GB_saxpy3task_struct,
+        &(Plan->SaxpyTasks_size)) ;
+    bool ok = (Plan->SaxpyTasks != NULL)
+        && GB_pattern_save (&(Plan->A_pattern), A, nthreads_max, chunk)
+        && GB_pattern_save (&(Plan->B_pattern), B, nthreads_max, chunk)
+        && (M == NULL ||
+            GB_pattern_save (&(Plan->M_pattern), M, nthreads_max, chunk)) ;
+    if (!ok)
+    {
+        // out of memory
+        GB_AxB_saxpy3_plan_free (&Plan, Plan_size) ;
+        return (NULL) ;
+    }
+
+    // the hash tables are not part of the plan
+    memcpy (Plan->SaxpyTasks, SaxpyTasks,
+        ntasks * sizeof (GB_saxpy3task_struct)) ;
+    for (int taskid = 0 ; taskid < ntasks ; taskid++)
+    {
+        Plan->SaxpyTasks [taskid].Hi = NULL ;
+        Plan->SaxpyTasks [taskid].Hf = NULL ;
+        Plan->SaxpyTasks [taskid].Hx = NULL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return the new plan
+    //--------------------------------------------------------------------------
+
+    (*Plan_handle) = Plan ;
+    (*Plan_size_handle) = Plan_size ;
+    return (Plan) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_save_Cp: save the symbolic phase in the plan
+//------------------------------------------------------------------------------
+
+// Only the counts Cp [0:cnvec-1] computed by the coarse tasks are used.  The
+// entries for vectors computed by fine tasks are computed by the numerical
+// phase.  If out of memory, the symbolic phase is not saved.
+
+void GB_AxB_saxpy3_plan_save_Cp    // save the symbolic phase in the plan
+(
+    GB_saxpy3_plan Plan,
+    const GrB_Matrix C              // Cp computed by the symbolic phase
+)
+{
+    int64_t cnvec = C->nvec ;
+    Plan->Cp = GB_MALLOC (GB_IMAX (cnvec, 1), int64_t, &(Plan->Cp_size)) ;
+    if (Plan->Cp != NULL)
+    {
+        int nthreads = GB_nthreads (cnvec, GB_Context_chunk ( ),
+            GB_Context_nthreads_max ( )) ;
+        GB_memcpy (Plan->Cp, C->p, cnvec * sizeof (int64_t), nthreads) ;
+        Plan->cnvec = cnvec ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_restore_Cp: restore the symbolic phase from the plan
+//------------------------------------------------------------------------------
+
+void GB_AxB_saxpy3_plan_restore_Cp // restore the symbolic phase from the plan
+(
+    const GB_saxpy3_plan Plan,
+    GrB_Matrix C                    // Cp for coarse tasks restored from Plan
+)
+{
+    int64_t cnvec = C->nvec ;
+    ASSERT (Plan->Cp != NULL && Plan->cnvec == cnvec) ;
+    int nthreads = GB_nthreads (cnvec, GB_Context_chunk ( ),
+        GB_Context_nthreads_max ( )) ;
+    GB_memcpy (C->p, Plan->Cp, cnvec * sizeof (int64_t), nthreads) ;
+}
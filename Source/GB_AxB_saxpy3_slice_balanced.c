@@ -10,7 +10,9 @@
 // JIT: not needed, but some varants possible (matrix sparsity formats)
 
 // If the mask is present but must be discarded, this function returns
-// GrB_NO_VALUE, to indicate that the analysis was terminated early.
+// GrB_NO_VALUE, to indicate that the analysis was terminated early.  If the
+// complemented mask is sparse and should first be converted to bitmap, this
+// function returns GrB_SUCCESS with M_to_bitmap true and no tasks created.
 
 #include "GB_AxB_saxpy3.h"
 #include "GB_unused.h"
@@ -21,6 +23,8 @@
 #define GB_FINE_WORK 2
 #define GB_MWORK_ALPHA 0.01
 #define GB_MWORK_BETA 0.10
+#define GB_MWORK_GAMMA 1.0
+#define GB_MBITMAP_RATIO 8
 
 #define GB_FREE_WORKSPACE                   \
 {                                           \
@@ -204,6 +208,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     size_t *SaxpyTasks_size_handle,
     bool *apply_mask,               // if true, apply M during sapxy3
     bool *M_in_place,               // if true, use M in-place
+    bool *M_to_bitmap,              // if true, convert M to bitmap and redo
     int *ntasks,                    // # of tasks created (coarse and fine)
     int *nfine,                     // # of fine tasks created
     int *nthreads,                  // # of threads to use
@@ -219,6 +224,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
 
     (*apply_mask) = false ;
     (*M_in_place) = false ;
+    (*M_to_bitmap) = false ;
     (*ntasks) = 0 ;
     (*nfine) = 0 ;
     (*nthreads) = 0 ;
@@ -272,8 +278,6 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     const int64_t avlen = A->vlen ;
     const int64_t anvec = A->nvec ;
     const bool A_is_hyper = GB_IS_HYPERSPARSE (A) ;
-    const int64_t *restrict A_Yp = (A->Y == NULL) ? NULL : A->Y->p ;
-    const int64_t *restrict A_Yi = (A->Y == NULL) ? NULL : A->Y->i ;
     const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
     const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
 
@@ -373,6 +377,31 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
             GBURBLE ("(use mask) ") ;
         }
 
+    }
+    else if (Mask_comp && axbflops < ((double) Mwork * GB_MWORK_GAMMA) &&
+        ((double) cvlen * (double) cvdim) <=
+        ((double) GB_nnz (M) * GB_MBITMAP_RATIO) &&
+        GB_Global_hack_get (2) == 0)    // modified for testing
+    { 
+
+        //----------------------------------------------------------------------
+        // !M is costly to scatter, but a bitmap of M is not too large
+        //----------------------------------------------------------------------
+
+        // The work to scatter M(:,j) into the workspace of each task, and
+        // the extra space in each hash table to hold M(:,j), exceeds the
+        // work to compute A*B.  This is typical for a BFS, where M is the
+        // large set of visited nodes.  Instead, tell the caller to convert M
+        // to bitmap, once and in parallel, and to redo the analysis.  All
+        // tasks then read M in-place, with hash tables sized only for A*B.
+        // This conversion is disabled by GB_Global_hack_set (2,1), so the
+        // tests can compare both methods.
+
+        GBURBLE ("(notM to bitmap) ") ;
+        (*M_to_bitmap) = true ;
+        GB_FREE_ALL ;
+        return (GrB_SUCCESS) ;
+
     }
     else if (axbflops < ((double) Mwork * GB_MWORK_ALPHA))
     { 
@@ -678,8 +707,8 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                             if (A_is_hyper)
                             { 
                                 // A is hypersparse: find A(:,k) in hyper_hash
-                                GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yp,
-                                    A_Yi, A_Yx, A_hash_bits, k, &pA, &pA_end) ;
+                                GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yx,
+                                    A_hash_bits, k, &pA, &pA_end) ;
                             }
                             else
                             { 
@@ -23,37 +23,58 @@
 // thread-local-stoage, then GB_CONTEXT_THREAD is always NULL and cannot be
 // modified; in this case, GxB_Context_engage can return GrB_NOT_IMPLEMENTED.
 
+// GB_CHUNK_THREAD: if positive, this is the chunk selected by the tuner of
+// the Context (see GB_tuner.c) for the method currently being computed by
+// this user thread, and it overrides the chunk of the Context.
+
+// GB_DEFER_THREAD: the chain of deferred GrB_apply operators of this user
+// thread, if the Context has GxB_DEFER enabled (see GB_defer.c).
+
 #include "GB.h"
+#include "GB_tuner.h"
+#include "GB_defer.h"
 
 #if defined ( _OPENMP )
 
     // OpenMP threadprivate is preferred
     GxB_Context GB_CONTEXT_THREAD = NULL ;
     #pragma omp threadprivate (GB_CONTEXT_THREAD)
+    double GB_CHUNK_THREAD = 0 ;
+    #pragma omp threadprivate (GB_CHUNK_THREAD)
+    struct GB_Defer_struct GB_DEFER_THREAD ;
+    #pragma omp threadprivate (GB_DEFER_THREAD)
 
 #elif defined ( HAVE_KEYWORD__THREAD )
 
     // gcc and many other compilers support the __thread keyword
     __thread GxB_Context GB_CONTEXT_THREAD = NULL ;
+    __thread double GB_CHUNK_THREAD = 0 ;
+    __thread struct GB_Defer_struct GB_DEFER_THREAD ;
 
 #elif defined ( HAVE_KEYWORD__DECLSPEC_THREAD )
 
     // Windows: __declspec (thread)
     __declspec ( thread ) GxB_Context GB_CONTEXT_THREAD = NULL ;
+    __declspec ( thread ) double GB_CHUNK_THREAD = 0 ;
+    __declspec ( thread ) struct GB_Defer_struct GB_DEFER_THREAD ;
 
 #elif defined ( HAVE_KEYWORD__THREAD_LOCAL )
 
     // ANSI C11 threads
     #include <threads.h>
     _Thread_local GxB_Context GB_CONTEXT_THREAD = NULL ;
+    _Thread_local double GB_CHUNK_THREAD = 0 ;
+    _Thread_local struct GB_Defer_struct GB_DEFER_THREAD ;
 
 #else
 
     // GraphBLAS will not be thread-safe when using a GxB_Context other than
     // GxB_CONTEXT_WORLD, so GxB_Context_engage returns GrB_NOT_IMPLEMENTED
-    // if passed a Context other than GxB_CONTEXT_WORLD or NULL.
+    // if passed a Context other than GxB_CONTEXT_WORLD or NULL.  The tuner
+    // cannot select the chunk, and GrB_apply is never deferred.
     #define NO_THREAD_LOCAL_STORAGE
     #define GB_CONTEXT_THREAD NULL
+    #define GB_CHUNK_THREAD 0
 
 #endif
 
@@ -175,9 +196,34 @@ double GB_Context_chunk_get (GxB_Context Context)
 //     GB_Context_chunk: get chunk from the Context of this user thread
 double GB_Context_chunk (void)
 { 
+    if (GB_CHUNK_THREAD > 0)
+    { 
+        // the tuner has selected the chunk for the current method
+        return (GB_CHUNK_THREAD) ;
+    }
     return (GB_Context_chunk_get (GB_CONTEXT_THREAD)) ;
 }
 
+//     GB_Context_chunk_tune: set or clear the chunk selected by the tuner
+bool GB_Context_chunk_tune      // return false if the chunk cannot be tuned
+(
+    double chunk                // chunk to use, or zero to clear it
+)
+{
+    #if defined ( NO_THREAD_LOCAL_STORAGE )
+    return (false) ;
+    #else
+    GB_CHUNK_THREAD = chunk ;
+    return (true) ;
+    #endif
+}
+
+//     GB_Context_chunk_tuned: true if the tuner has selected the chunk
+bool GB_Context_chunk_tuned (void)
+{ 
+    return (GB_CHUNK_THREAD > 0) ;
+}
+
 //   GB_Context_chunk_set: set max # of threads in a Context
 void GB_Context_chunk_set
 (
@@ -247,3 +293,171 @@ void GB_Context_gpu_id_set
     }
 }
 
+//------------------------------------------------------------------------------
+// Context->numa_policy: placement of large blocks of memory
+//------------------------------------------------------------------------------
+
+//  GB_Context_numa_policy_get: get the NUMA policy from a Context
+int GB_Context_numa_policy_get (GxB_Context Context)
+{
+    int numa_policy ;
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        GB_ATOMIC_READ
+        numa_policy = GxB_CONTEXT_WORLD->numa_policy ;
+    }
+    else
+    { 
+        numa_policy = Context->numa_policy ;
+    }
+    return (numa_policy) ;
+}
+
+//  GB_Context_numa_policy: get the NUMA policy from the current Context
+int GB_Context_numa_policy (void)
+{ 
+    return (GB_Context_numa_policy_get (GB_CONTEXT_THREAD)) ;
+}
+
+//   GB_Context_numa_policy_set: set the NUMA policy in a Context
+void GB_Context_numa_policy_set
+(
+    GxB_Context Context,
+    int numa_policy
+)
+{
+    // any unrecognized policy is treated as the default
+    if (numa_policy < GxB_NUMA_DEFAULT || numa_policy > GxB_NUMA_LOCAL)
+    { 
+        numa_policy = GxB_NUMA_DEFAULT ;
+    }
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        GB_ATOMIC_WRITE
+        GxB_CONTEXT_WORLD->numa_policy = numa_policy ;
+    }
+    else
+    { 
+        Context->numa_policy = numa_policy ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Context->defer: deferred execution of chains of GrB_apply
+//------------------------------------------------------------------------------
+
+//  GB_Context_defer_get: true if GxB_DEFER is enabled in a Context
+bool GB_Context_defer_get (GxB_Context Context)
+{
+    bool defer ;
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        GB_ATOMIC_READ
+        defer = GxB_CONTEXT_WORLD->defer ;
+    }
+    else
+    { 
+        defer = Context->defer ;
+    }
+    return (defer) ;
+}
+
+//  GB_Context_defer: true if GxB_DEFER is enabled in the current Context
+bool GB_Context_defer (void)
+{ 
+    #if defined ( NO_THREAD_LOCAL_STORAGE )
+    return (false) ;
+    #else
+    return (GB_Context_defer_get (GB_CONTEXT_THREAD)) ;
+    #endif
+}
+
+//  GB_Context_defer_set: enable or disable GxB_DEFER in a Context
+void GB_Context_defer_set
+(
+    GxB_Context Context,
+    bool defer
+)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        GB_ATOMIC_WRITE
+        GxB_CONTEXT_WORLD->defer = defer ;
+    }
+    else
+    { 
+        Context->defer = defer ;
+    }
+}
+
+//  GB_Context_defer_queue: deferred GrB_apply operators of this user thread
+struct GB_Defer_struct *GB_Context_defer_queue (void)
+{ 
+    #if defined ( NO_THREAD_LOCAL_STORAGE )
+    return (NULL) ;
+    #else
+    return (&GB_DEFER_THREAD) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Context->tuner: online tuner for chunk, hyper_switch, and bitmap_switch
+//------------------------------------------------------------------------------
+
+//  GB_Context_tuner_get: get the tuner of a Context (NULL if none)
+GB_Tuner GB_Context_tuner_get (GxB_Context Context)
+{
+    GB_Tuner tuner ;
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        GB_ATOMIC_READ
+        tuner = GxB_CONTEXT_WORLD->tuner ;
+    }
+    else
+    { 
+        tuner = Context->tuner ;
+    }
+    return (tuner) ;
+}
+
+//  GB_Context_tuner: get the tuner of the current Context
+GB_Tuner GB_Context_tuner (void)
+{ 
+    return (GB_Context_tuner_get (GB_CONTEXT_THREAD)) ;
+}
+
+//  GB_Context_tuner_set: enable or disable the tuner of a Context
+GrB_Info GB_Context_tuner_set
+(
+    GxB_Context Context,
+    bool enable
+)
+{
+    if (Context == NULL) Context = GxB_CONTEXT_WORLD ;
+    GB_Tuner tuner = GB_Context_tuner_get (Context) ;
+    if (enable && tuner == NULL)
+    { 
+        GrB_Info info = GB_tuner_new (&tuner) ;
+        if (info != GrB_SUCCESS) return (info) ;
+    }
+    else if (!enable && tuner != NULL)
+    { 
+        GB_tuner_free (&tuner) ;
+    }
+    else
+    { 
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    if (Context == GxB_CONTEXT_WORLD)
+    { 
+        GB_ATOMIC_WRITE
+        GxB_CONTEXT_WORLD->tuner = tuner ;
+    }
+    else
+    { 
+        Context->tuner = tuner ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
@@ -20,9 +20,24 @@ void   GB_Context_nthreads_max_set (GxB_Context Context, int nthreads_max) ;
 double GB_Context_chunk (void) ;
 double GB_Context_chunk_get (GxB_Context Context) ;
 void   GB_Context_chunk_set (GxB_Context Context, double chunk) ;
+bool   GB_Context_chunk_tune (double chunk) ;
+bool   GB_Context_chunk_tuned (void) ;
 
 int    GB_Context_gpu_id (void) ;
 int    GB_Context_gpu_id_get (GxB_Context Context) ;
 void   GB_Context_gpu_id_set (GxB_Context Context, int gpu_id) ;
 
+int    GB_Context_numa_policy (void) ;
+int    GB_Context_numa_policy_get (GxB_Context Context) ;
+void   GB_Context_numa_policy_set (GxB_Context Context, int numa_policy) ;
+
+bool   GB_Context_defer (void) ;
+bool   GB_Context_defer_get (GxB_Context Context) ;
+void   GB_Context_defer_set (GxB_Context Context, bool defer) ;
+struct GB_Defer_struct *GB_Context_defer_queue (void) ;
+
+struct GB_Tuner_struct *GB_Context_tuner (void) ;
+struct GB_Tuner_struct *GB_Context_tuner_get (GxB_Context Context) ;
+GrB_Info GB_Context_tuner_set (GxB_Context Context, bool enable) ;
+
 #endif
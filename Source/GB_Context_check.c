@@ -8,6 +8,7 @@
 //------------------------------------------------------------------------------
 
 #include "GB.h"
+#include "GB_tuner.h"
 
 GrB_Info GB_Context_check       // check a GraphBLAS Context
 (
@@ -47,6 +48,27 @@ GrB_Info GB_Context_check       // check a GraphBLAS Context
     int gpu_id = GB_Context_gpu_id_get (Context) ;
     if (gpu_id >= 0) GBPR0 ("    Context.gpu_id:   %d\n", gpu_id) ;
 
+    int numa_policy = GB_Context_numa_policy_get (Context) ;
+    if (numa_policy != GxB_NUMA_DEFAULT)
+    { 
+        GBPR0 ("    Context.numa:     %s\n",
+            (numa_policy == GxB_NUMA_FIRST_TOUCH) ? "first touch" :
+            (numa_policy == GxB_NUMA_INTERLEAVE ) ? "interleave" : "local") ;
+    }
+
+    if (GB_Context_defer_get (Context))
+    { 
+        GBPR0 ("    Context.defer:    true\n") ;
+    }
+
+    GB_Tuner tuner = GB_Context_tuner_get (Context) ;
+    if (tuner != NULL)
+    { 
+        GBPR0 ("    Context.tuner:    hyper_switch %g, bitmap_switch %g ..."
+            " %g\n", tuner->hyper_switch, tuner->bitmap_switch [0],
+            tuner->bitmap_switch [GxB_NBITMAP_SWITCH-1]) ;
+    }
+
     return (GrB_SUCCESS) ;
 }
 
@@ -147,6 +147,12 @@ GrB_Info GB_Descriptor_check    // check a GraphBLAS descriptor
         GBPR0 ("    d.import   = secure\n") ;
     }
 
+    if (D->axb_plan)
+    { 
+        GBPR0 ("    d.plan     = %s\n", (D->Plan == NULL) ? "true" :
+            "true (saxpy3 plan saved)") ;
+    }
+
     if (D->compression != GxB_DEFAULT)
     { 
         GBPR0 ("    d.compression = %d\n", D->compression) ;
@@ -22,6 +22,30 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_setElements             // C(I(k),J(k)) = X(k) or += X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I_in,          // row indices of the tuples
+    const GrB_Index *J_in,          // column indices of the tuples
+    const void *X,                  // values of the tuples
+    const GrB_Index n,              // # of tuples
+    const GrB_BinaryOp dup,         // if NULL: C(i,j) = x, else C(i,j) += x
+    const GB_Type_code xcode,       // type of X
+    GB_Werk Werk
+) ;
+
+int64_t GB_find_elements        // find C(I(k),J(k)), return # not found
+(
+    // output:
+    int64_t *restrict P,        // P [k]: position of C(I(k),J(k)), or -1
+    // input:
+    const GrB_Matrix C,         // matrix to search
+    const int64_t *restrict Ilist,  // indices within each vector
+    const int64_t *restrict Jlist,  // vector indices
+    const int64_t n,            // size of P, Ilist, and Jlist
+    const int nthreads          // # of threads to use
+) ;
+
 GrB_Info GB_Vector_removeElement
 (
     GrB_Vector V,               // vector to remove entry from
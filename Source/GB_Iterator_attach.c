@@ -35,13 +35,14 @@ GrB_Info GB_Iterator_attach
     }
 
     //--------------------------------------------------------------------------
-    // finish any pending work on the matrix
+    // finish any pending work and deferred operators on the matrix
     //--------------------------------------------------------------------------
 
-    if (GB_ANY_PENDING_WORK (A))
+    if (GB_ANY_PENDING_WORK (A) || A == GB_defer_matrix ( ))
     { 
         GrB_Info info ;
         GB_WERK ("GxB_Iterator_attach") ;
+        GB_DEFER_FINISH ;
         GB_OK (GB_wait (A, "A", Werk)) ;
     }
 
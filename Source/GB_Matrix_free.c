@@ -27,6 +27,7 @@ void GB_Matrix_free             // free a matrix
             GB_FREE (&(A->user_name), A->user_name_size) ;
             size_t header_size = A->header_size ;
             GB_phybix_free (A) ;
+            GB_shm_free (A) ;           // unmap any shared-memory file
             if (!(A->static_header))
             { 
                 // free the header of A itself, unless it is static
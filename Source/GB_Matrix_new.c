@@ -13,6 +13,7 @@
 // fails, *A is set to NULL.
 
 #include "GB.h"
+#include "GB_tuner.h"
 
 GrB_Info GB_Matrix_new          // create a new matrix with no entries
 (
@@ -72,6 +73,6 @@ GrB_Info GB_Matrix_new          // create a new matrix with no entries
 
     return (GB_new (A, // auto sparsity, new header
         type, vlen, vdim, GB_Ap_calloc, A_is_csc, GxB_AUTO_SPARSITY,
-        GB_Global_hyper_switch_get ( ), 1)) ;
+        GB_tuner_hyper_switch ( ), 1)) ;
 }
 
@@ -57,6 +57,8 @@ GrB_Scalar GB_Scalar_wrap   // create a new GrB_Scalar with one entry
 
     s->Y = NULL ;
     s->Y_shallow = false ;
+    s->T = NULL ;
+    s->T_cache = false ;
 
     s->nvals = 0 ;
 
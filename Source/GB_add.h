@@ -138,5 +138,20 @@ bool GB_add_iso             // c = op(a,b), return true if C is iso
     const bool is_eWiseUnion
 ) ;
 
+GrB_Info GB_add_n                   // C<M> = accum (C, A[0]+...+A[k-1])
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const bool C_replace,           // if true, clear C before writing to it
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Monoid monoid,        // defines '+' for T=A[0]+...+A[k-1]
+    const GrB_Matrix *A,            // array of k input matrices
+    const bool A_transpose,         // if true, use A[i]' instead of A[i]
+    const int64_t k,                // number of input matrices
+    GB_Werk Werk
+) ;
+
 #endif
 
@@ -51,7 +51,7 @@ GrB_Info GB_add_jit      // C=A+B, C<#M>=A+B, add, via the JIT
     char *suffix ;
     uint64_t hash = GB_encodify_ewise (&encoding, &suffix,
         GB_JIT_KERNEL_ADD, false,
-        false, false, C_sparsity, C->type, M, Mask_struct, Mask_comp,
+        false, false, false, C_sparsity, C->type, M, Mask_struct, Mask_comp,
         binaryop, false, A, B) ;
 
     //--------------------------------------------------------------------------
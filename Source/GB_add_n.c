@@ -0,0 +1,391 @@
+//------------------------------------------------------------------------------
+// GB_add_n: sum k matrices with a monoid
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M> = accum (C, T) where T = op(A[0]) + op(A[1]) + ... + op(A[k-1]), and
+// "+" is the monoid.  This function is not user-callable.  It does the work
+// for GxB_Matrix_eWiseAdd_n.
+
+// Summing k matrices with k-1 calls to GrB_eWiseAdd, as T = ((A[0]+A[1]) +
+// A[2]) + ..., reads the growing intermediate result once for each matrix,
+// taking O(k*nnz(T)) time in the worst case.  Instead, the k matrices are
+// summed in a balanced binary tree, T = ((A[0]+A[1]) + (A[2]+A[3])) + ...,
+// with GB_add at each node.  Each of the ceil(log2(k)) levels of the tree
+// reads each entry at most once, and the intermediate results are freed as
+// soon as they are used.  The monoid need only be associative, since the
+// order of the operands is preserved.  The mask is exploited only by the
+// final GB_add at the root of the tree, if it is worth doing so.  If T will
+// be dense enough to be held as a bitmap, the matrices are instead summed
+// left-to-right, as GrB_eWiseAdd would, since the partial sums are bitmap.
+
+// All of the input matrices and the intermediate results are held in the same
+// orientation, T_is_csc, which is the format of C unless most of the inputs
+// would then need to be transposed.  Any input held in the other orientation
+// is transposed first, and T is transposed when it is accumulated into C.
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    if (X != NULL)                                  \
+    {                                               \
+        for (int64_t i = 0 ; i < k ; i++)           \
+        {                                           \
+            if (X_owned [i])                        \
+            {                                       \
+                GB_Matrix_free (&(X [i])) ;         \
+            }                                       \
+        }                                           \
+    }                                               \
+    GB_FREE_WORK (&X, X_size) ;                     \
+    GB_FREE_WORK (&X_owned, X_owned_size) ;         \
+    GB_FREE_WORK (&Headers, Headers_size) ;         \
+    GB_Matrix_free (&T) ;                           \
+    GB_Matrix_free (&MT) ;                          \
+}
+
+#include "GB_add.h"
+#include "GB_transpose.h"
+#include "GB_accum_mask.h"
+#include "GB_transplant.h"
+
+GrB_Info GB_add_n                   // C<M> = accum (C, A[0]+...+A[k-1])
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const bool C_replace,           // if true, clear C before writing to it
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Monoid monoid,        // defines '+' for T=A[0]+...+A[k-1]
+    const GrB_Matrix *A,            // array of k input matrices
+    const bool A_transpose,         // if true, use A[i]' instead of A[i]
+    const int64_t k,                // number of input matrices
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    // C may be aliased with M and/or any A[i]
+
+    GrB_Info info ;
+    struct GB_Matrix_opaque T_header, MT_header, Z_header ;
+    GrB_Matrix T = NULL, MT = NULL ;
+    GrB_Matrix *X = NULL ; size_t X_size = 0 ;
+    bool *X_owned = NULL ; size_t X_owned_size = 0 ;
+    struct GB_Matrix_opaque *Headers = NULL ; size_t Headers_size = 0 ;
+
+    GB_RETURN_IF_NULL (A) ;
+    GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (monoid) ;
+    if (k <= 0)
+    {
+        GB_ERROR (GrB_INVALID_VALUE,
+            "Number of input matrices k = " GBd " must be positive", k) ;
+    }
+    for (int64_t i = 0 ; i < k ; i++)
+    {
+        GB_RETURN_IF_NULL_OR_FAULTY (A [i]) ;
+    }
+
+    ASSERT_MATRIX_OK (C, "C input for GB_add_n", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_add_n", GB0) ;
+    ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_add_n", GB0) ;
+    ASSERT_MONOID_OK (monoid, "monoid for GB_add_n", GB0) ;
+
+    // check domains and dimensions for C<M> = accum (C,T)
+    GrB_BinaryOp op = monoid->op ;
+    GrB_Type T_type = op->ztype ;
+    GB_OK (GB_compatible (C->type, C, M, Mask_struct, accum, T_type, Werk)) ;
+
+    // all matrices A[i] must have the same dimensions as A[0], and their
+    // types must be compatible with the monoid
+    int64_t anrows = GB_NROWS (A [0]) ;
+    int64_t ancols = GB_NCOLS (A [0]) ;
+    for (int64_t i = 0 ; i < k ; i++)
+    {
+        ASSERT_MATRIX_OK (A [i], "A[i] input for GB_add_n", GB0) ;
+        if (!GB_Type_compatible (A [i]->type, T_type))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Incompatible type for monoid z=%s(x,y):\n"
+                "input matrix A[" GBd "] of type [%s]\n"
+                "cannot be typecast to monoid of type [%s]",
+                op->name, i, A [i]->type->name, T_type->name) ;
+        }
+        if (GB_NROWS (A [i]) != anrows || GB_NCOLS (A [i]) != ancols)
+        {
+            GB_ERROR (GrB_DIMENSION_MISMATCH,
+                "Dimensions not compatible:\n"
+                "input A[0] is " GBd "-by-" GBd "\n"
+                "input A[" GBd "] is " GBd "-by-" GBd,
+                anrows, ancols, i, GB_NROWS (A [i]), GB_NCOLS (A [i])) ;
+        }
+    }
+
+    // check the dimensions of C
+    int64_t cnrows = (A_transpose) ? ancols : anrows ;
+    int64_t cncols = (A_transpose) ? anrows : ancols ;
+    if (GB_NROWS (C) != cnrows || GB_NCOLS (C) != cncols)
+    {
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "Dimensions not compatible:\n"
+            "output is " GBd "-by-" GBd "\n"
+            "inputs are " GBd "-by-" GBd "%s",
+            GB_NROWS (C), GB_NCOLS (C), anrows, ancols,
+            A_transpose ? " (transposed)" : "") ;
+    }
+
+    // quick return if an empty mask is complemented
+    GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
+
+    // delete any lingering zombies, assemble any pending tuples, and sort
+    // any jumbled vectors in M and all A[i].  The matrices are summed in a
+    // tree of calls to GB_add, and A[0] alone may be copied into T below, so
+    // no input may have any pending work.
+    GB_MATRIX_WAIT (M) ;
+    for (int64_t i = 0 ; i < k ; i++)
+    {
+        GB_MATRIX_WAIT (A [i]) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the CSR/CSC format of T
+    //--------------------------------------------------------------------------
+
+    // A[i] must be transposed if its format differs from T, or if A_transpose
+    // is true, but not both.  If most of the A[i] would need to be
+    // transposed, then T = A[0]+...+A[k-1] is computed instead, in the
+    // opposite format as C, and T is transposed into C by GB_accum_mask.
+
+    bool T_is_csc = C->is_csc ;
+    int64_t ntrans = 0 ;
+    for (int64_t i = 0 ; i < k ; i++)
+    {
+        ntrans += ((T_is_csc != A [i]->is_csc) != A_transpose) ;
+    }
+    if (ntrans > k/2)
+    {
+        T_is_csc = !T_is_csc ;
+        ntrans = k - ntrans ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the shape of the tree
+    //--------------------------------------------------------------------------
+
+    // If any A[i] is bitmap or full, or if T is expected to be dense enough
+    // to be held as a bitmap, the matrices are summed left-to-right instead.
+    // Once the partial sum is bitmap, adding each sparse A[i] to it takes
+    // little more than O(nnz(A[i])) time, and the tree would only add extra
+    // sparse additions at its lower levels.
+
+    int64_t anz = 0 ;
+    bool chain = false ;
+    for (int64_t i = 0 ; i < k ; i++)
+    {
+        anz += GB_nnz (A [i]) ;
+        chain = chain || GB_IS_BITMAP (A [i]) || GB_IS_FULL (A [i]) ;
+    }
+    int64_t vlen = (T_is_csc) ? cnrows : cncols ;
+    int64_t vdim = (T_is_csc) ? cncols : cnrows ;
+    chain = chain || GB_convert_s2b_test (
+        GB_Global_bitmap_switch_matrix_get (vlen, vdim), anz, vlen, vdim) ;
+    GBURBLE ("(eWiseAdd_n: " GBd " matrices, %s) ", k,
+        chain ? "left-to-right" : "tree") ;
+
+    //--------------------------------------------------------------------------
+    // transpose M if needed
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix M1 = M ;
+    if (M != NULL && M->is_csc != T_is_csc)
+    {
+        // MT = (bool) M'
+        GBURBLE ("(M transpose) ") ;
+        GB_CLEAR_STATIC_HEADER (MT, &MT_header) ;
+        GB_OK (GB_transpose_cast (MT, GrB_BOOL, T_is_csc, M, Mask_struct,
+            Werk)) ;
+        M1 = MT ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    // X [0:k-1] holds the operands of the current level of the tree.  X [i] is
+    // either a user input matrix A [i], or a transposed copy or intermediate
+    // result held in one of the headers, owned by this method.  The tree has
+    // k-1 internal nodes, plus one header for each transposed input.
+
+    int64_t nheaders = ntrans + k ;
+    X = GB_MALLOC_WORK (k, GrB_Matrix, &X_size) ;
+    X_owned = GB_CALLOC_WORK (k, bool, &X_owned_size) ;
+    Headers = GB_MALLOC_WORK (nheaders, struct GB_Matrix_opaque,
+        &Headers_size) ;
+    if (X == NULL || X_owned == NULL || Headers == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    int64_t nh = 0 ;
+
+    //--------------------------------------------------------------------------
+    // transpose each A[i] if needed
+    //--------------------------------------------------------------------------
+
+    for (int64_t i = 0 ; i < k ; i++)
+    {
+        if ((T_is_csc != A [i]->is_csc) != A_transpose)
+        {
+            // X [i] = (ztype) A [i]'
+            GBURBLE ("(A transpose) ") ;
+            GB_CLEAR_STATIC_HEADER (X [i], &(Headers [nh++])) ;
+            X_owned [i] = true ;
+            GB_OK (GB_transpose_cast (X [i], T_type, T_is_csc, A [i], false,
+                Werk)) ;
+            ASSERT_MATRIX_OK (X [i], "X[i] = A[i]' for GB_add_n", GB0) ;
+        }
+        else
+        {
+            // X [i] = A [i], held in the same orientation as T
+            X [i] = A [i] ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // T = X [0] + ... + X [k-1]
+    //--------------------------------------------------------------------------
+
+    // Each level of the tree sums groups of g adjacent operands, left to
+    // right, and X [i] becomes the sum of the ith group.  The mask is
+    // exploited only by the last GB_add, at the root of the tree.
+
+    bool mask_applied = false ;
+    for (int64_t n = k ; n > 1 ; )
+    {
+        int64_t g = (chain) ? n : 2 ;
+        int64_t ngroups = (n + g - 1) / g ;
+        for (int64_t i = 0 ; i < ngroups ; i++)
+        {
+            // X [first] = X [first] + ... + X [last]
+            int64_t first = i * g ;
+            int64_t last = GB_IMIN (first + g, n) - 1 ;
+            for (int64_t p = first + 1 ; p <= last ; p++)
+            {
+                // Z = X [first] + X [p]
+                bool root = (ngroups == 1 && p == last) ;
+                bool applied = false ;
+                GrB_Matrix Z = NULL ;
+                GB_CLEAR_STATIC_HEADER (Z, &(Headers [nh++])) ;
+                info = GB_add (Z, T_type, T_is_csc, root ? M1 : NULL,
+                    Mask_struct, Mask_comp, &applied, X [first], X [p],
+                    false, NULL, NULL, op, false, Werk) ;
+                if (info == GrB_SUCCESS && !root)
+                { 
+                    // conform Z to its desired sparsity, as GrB_eWiseAdd
+                    // would do, so that a dense partial sum becomes bitmap
+                    info = GB_conform (Z, Werk) ;
+                }
+                if (info != GrB_SUCCESS)
+                { 
+                    // out of memory
+                    GB_Matrix_free (&Z) ;
+                    GB_FREE_ALL ;
+                    return (info) ;
+                }
+                mask_applied = applied ;
+                // free the two operands if owned, and replace them with Z
+                if (X_owned [first])
+                { 
+                    GB_Matrix_free (&(X [first])) ;
+                }
+                if (X_owned [p])
+                { 
+                    GB_Matrix_free (&(X [p])) ;
+                    X_owned [p] = false ;
+                }
+                X [first] = Z ;
+                X_owned [first] = true ;
+            }
+            // move the sum of the ith group to X [i]
+            if (i < first)
+            { 
+                X [i] = X [first] ;
+                X_owned [i] = X_owned [first] ;
+                X_owned [first] = false ;
+            }
+        }
+        n = ngroups ;
+    }
+
+    //--------------------------------------------------------------------------
+    // T = X [0], or a typecasted copy of A [0] if k is 1
+    //--------------------------------------------------------------------------
+
+    GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+    if (X_owned [0])
+    {
+        // transplant X [0] into T
+        (*T) = (*(X [0])) ;
+        T->header_size = 0 ;
+        X_owned [0] = false ;
+    }
+    else
+    {
+        // T = (ztype) A [0], which is already in the orientation of T.  This
+        // is a deep copy, since C may be aliased with A [0].  A [0] is
+        // typecast to the type of the monoid, just as each GB_add would do
+        // for k > 1.
+        GrB_Matrix Z = NULL ;
+        GB_CLEAR_STATIC_HEADER (Z, &Z_header) ;
+        GB_OK (GB_shallow_copy (Z, T_is_csc, X [0], Werk)) ;
+        info = GB_new (&T, // sparse or hyper, existing header
+            T_type, Z->vlen, Z->vdim, GB_Ap_null, T_is_csc,
+            GB_sparsity (Z), Z->hyper_switch, Z->plen) ;
+        if (info == GrB_SUCCESS)
+        { 
+            // T = (ztype) Z, and free Z
+            info = GB_transplant (T, T_type, &Z, Werk) ;
+        }
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            GB_Matrix_free (&Z) ;
+            GB_FREE_ALL ;
+            return (info) ;
+        }
+    }
+    ASSERT_MATRIX_OK (T, "T for GB_add_n", GB0) ;
+
+    GB_FREE_WORK (&X, X_size) ;
+    GB_FREE_WORK (&X_owned, X_owned_size) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C,T): accumulate the results into C via the mask
+    //--------------------------------------------------------------------------
+
+    if ((accum == NULL) && (C->is_csc == T->is_csc)
+        && (M == NULL || (M != NULL && mask_applied))
+        && (C_replace || GB_NNZ_UPPER_BOUND (C) == 0))
+    {
+        // C = (ctype) T, with the mask already applied
+        GB_OK (GB_transplant_conform (C, C->type, &T, Werk)) ;
+        info = GB_block (C, Werk) ;
+    }
+    else
+    {
+        // C<M> = accum (C,T)
+        info = GB_accum_mask (C, M, MT, accum, &T, C_replace, Mask_comp,
+            Mask_struct, Werk) ;
+    }
+    GB_FREE_ALL ;
+    return (info) ;
+}
@@ -18,6 +18,7 @@
 #include "GB_transpose.h"
 #include "GB_accum_mask.h"
 #include "GB_scalar_wrap.h"
+#include "GB_tuner.h"
 
 GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
 (
@@ -184,7 +185,28 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
             tnrows, tncols, A_transpose ? " (transposed)" : "") ;
     }
 
+    //--------------------------------------------------------------------------
+    // defer C = op (C), or compute any deferred operators
+    //--------------------------------------------------------------------------
+
+    if (M == NULL && !Mask_comp && accum == NULL && C == A && !A_transpose)
+    {
+        // C = op (C) may be deferred if GxB_DEFER is enabled (see GB_defer.c)
+        GB_Operator op_renamed = op ;
+        GB_binop_rename (&op_renamed, binop_bind1st) ;
+        if (GB_defer_apply (C, op_renamed, scalar, binop_bind1st))
+        { 
+            GBURBLE ("(deferred-op) ") ;
+            return (GrB_SUCCESS) ;
+        }
+    }
+
+    GB_OK (GB_defer_finish (Werk)) ;
+
+    //--------------------------------------------------------------------------
     // quick return if an empty mask is complemented
+    //--------------------------------------------------------------------------
+
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
 
     // delete any lingering zombies and assemble any pending tuples
@@ -293,8 +315,11 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
             if (info == GrB_SUCCESS)
             { 
                 // C->x = op (C->x) in place
+                GB_tuner_state tune ;
+                GB_tuner_begin (&tune, GB_TUNER_APPLY, C, NULL) ;
                 info = GB_apply_op ((GB_void *) C->x, C->type, C_code_iso,
                     op, scalar, binop_bind1st, flipij, C, Werk) ;
+                GB_tuner_end (&tune, info) ;
             }
             if (info == GrB_SUCCESS && C_code_iso != GB_NON_ISO)
             { 
@@ -310,8 +335,11 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
         // T = op (A), pattern is a shallow copy of A, type is op->ztype.
         GBURBLE ("(shallow-op) ") ;
         GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+        GB_tuner_state tune ;
+        GB_tuner_begin (&tune, GB_TUNER_APPLY, A, NULL) ;
         info = GB_shallow_op (T, T_is_csc, op, scalar, binop_bind1st, flipij,
             A, Werk) ;
+        GB_tuner_end (&tune, info) ;
     }
 
     if (info != GrB_SUCCESS)
@@ -69,12 +69,10 @@ GrB_Info GB_assign_zombie3
     if (Ch != NULL)
     { 
         // C is hypersparse
-        const int64_t *restrict C_Yp = (C->Y == NULL) ? NULL : C->Y->p ;
-        const int64_t *restrict C_Yi = (C->Y == NULL) ? NULL : C->Y->i ;
         const int64_t *restrict C_Yx = (C->Y == NULL) ? NULL : C->Y->x ;
         const int64_t C_hash_bits = (C->Y == NULL) ? 0 : (C->Y->vdim - 1) ;
-        GB_hyper_hash_lookup (Ch, cnvec, Cp, C_Yp, C_Yi, C_Yx, C_hash_bits,
-            j, &pC_start, &pC_end) ;
+        GB_hyper_hash_lookup (Ch, cnvec, Cp, C_Yx, C_hash_bits, j, &pC_start,
+            &pC_end) ;
     }
     else
     { 
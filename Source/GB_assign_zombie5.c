@@ -92,8 +92,6 @@ GrB_Info GB_assign_zombie5
     const bool M_is_hyper = GB_IS_HYPERSPARSE (M) ;
     const bool M_is_bitmap = GB_IS_BITMAP (M) ;
     const bool M_is_full = GB_IS_FULL (M) ;
-    const int64_t *restrict M_Yp = (M->Y == NULL) ? NULL : M->Y->p ;
-    const int64_t *restrict M_Yi = (M->Y == NULL) ? NULL : M->Y->i ;
     const int64_t *restrict M_Yx = (M->Y == NULL) ? NULL : M->Y->x ;
     const int64_t M_hash_bits = (M->Y == NULL) ? 0 : (M->Y->vdim - 1) ;
 
@@ -157,8 +155,8 @@ GrB_Info GB_assign_zombie5
             if (M_is_hyper)
             { 
                 // M is hypersparse
-                GB_hyper_hash_lookup (Mh, Mnvec, Mp, M_Yp, M_Yi, M_Yx,
-                    M_hash_bits, j, &pM_start, &pM_end) ;
+                GB_hyper_hash_lookup (Mh, Mnvec, Mp, M_Yx, M_hash_bits, j,
+                    &pM_start, &pM_end) ;
             }
             else
             { 
@@ -27,6 +27,8 @@ GB_callback_struct GB_callback =
     .GB_memset_func                 = GB_memset,
     .GB_qsort_1_func                = GB_qsort_1,
     .GB_werk_pop_func               = GB_werk_pop,
-    .GB_werk_push_func              = GB_werk_push
+    .GB_werk_push_func              = GB_werk_push,
+    .GB_intersect_count_func        = GB_intersect_count,
+    .GB_intersect_chunk_func        = GB_intersect_chunk
 } ;
 
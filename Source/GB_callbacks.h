@@ -22,6 +22,8 @@ GB_CALLBACK_WERK_PUSH_PROTO (GB_werk_push) ;
 GB_CALLBACK_WERK_POP_PROTO (GB_werk_pop) ;
 GB_CALLBACK_BITMAP_M_SCATTER_PROTO (GB_bitmap_M_scatter) ;
 GB_CALLBACK_BITMAP_M_SCATTER_WHOLE_PROTO (GB_bitmap_M_scatter_whole) ;
+GB_CALLBACK_INTERSECT_COUNT_PROTO (GB_intersect_count) ;
+GB_CALLBACK_INTERSECT_CHUNK_PROTO (GB_intersect_chunk) ;
 
 #endif
 
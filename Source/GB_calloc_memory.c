@@ -36,7 +36,9 @@ static inline void *GB_calloc_helper
 
     if (p != NULL)
     { 
-        // clear the block of memory with a parallel memset
+        // apply the NUMA policy of the Context, if any, before the block is
+        // first touched, and then clear it with a parallel memset
+        GB_numa_bind (p, *size) ;
         int nthreads_max = GB_Context_nthreads_max ( ) ;
         GB_memset (p, 0, (*size), nthreads_max) ;
     }
@@ -35,7 +35,7 @@ GrB_Info GB_colscale_jit      // C=A*D, colscale, via the JIT
     char *suffix ;
     uint64_t hash = GB_encodify_ewise (&encoding, &suffix,
         GB_JIT_KERNEL_COLSCALE, false,
-        false, false, GB_sparsity (C), C->type, NULL, false, false,
+        false, false, false, GB_sparsity (C), C->type, NULL, false, false,
         binaryop, flipxy, A, D) ;
 
     //--------------------------------------------------------------------------
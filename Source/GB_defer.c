@@ -0,0 +1,270 @@
+//------------------------------------------------------------------------------
+// GB_defer: deferred execution of chains of GrB_apply
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A sequence of calls to GrB_apply of the form C = op (C), such as C = C*2,
+// then C = C+1, then C = sqrt (C), takes one full pass over C->x for each
+// operator.  If C->x is larger than the cache, each pass reads and writes all
+// of C->x from main memory.  With GxB_DEFER enabled in the Context, the
+// operators are instead recorded, and computed later by GB_defer_finish, one
+// block of C->x at a time.  Each block is small enough to remain in cache
+// while all of the operators are applied to it, so C->x is read and written
+// from main memory just once for the whole chain.
+
+// Only C = op (C) with no mask, no accumulator, and no transpose is deferred,
+// where op is a built-in unary operator, or a built-in binary operator bound
+// to a scalar (including the VALUE* index-unary operators, which have been
+// renamed to binary operators by GB_binop_rename).  Positional and
+// user-defined operators are computed immediately, as are any operators whose
+// result is iso.  Since the operators are built-in, they remain valid until
+// the chain is computed; the bound scalars are copied.
+
+// The deferred operators are held in the GB_Defer_struct of the user thread.
+// GB_WHERE computes them on entry to any user-callable method other than
+// GrB_apply, and GB_apply computes them if C = op (C) cannot be added to the
+// chain.  GrB_free discards them if C is freed.  If the chain cannot be
+// computed (out of memory, or a JIT failure), C is cleared and the error is
+// logged in C, since C->x may then hold a mix of partial results.
+
+#include "GB_apply.h"
+#include "GB_scalar_wrap.h"
+
+//------------------------------------------------------------------------------
+// GB_defer_apply: defer C = op (C), if possible
+//------------------------------------------------------------------------------
+
+bool GB_defer_apply             // true if C = op (C) has been deferred
+(
+    GrB_Matrix C,               // input/output matrix, computed in place
+    const GB_Operator op,       // unary op or binop to apply
+    const GrB_Scalar scalar,    // scalar to bind to binary operator
+    const bool binop_bind1st    // if true, C=binop(s,C), else C=binop(C,s)
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check if deferred execution is enabled
+    //--------------------------------------------------------------------------
+
+    struct GB_Defer_struct *Defer = GB_Context_defer_queue ( ) ;
+    if (Defer == NULL || !GB_Context_defer ( ))
+    {
+        return (false) ;
+    }
+
+    GrB_Mode mode = GB_Global_mode_get ( ) ;
+    if (mode == GrB_BLOCKING || mode == GxB_BLOCKING_GPU)
+    {
+        // each method must be finished when it returns, in blocking mode
+        return (false) ;
+    }
+
+    if (Defer->C != NULL && (Defer->C != C || Defer->nops >= GB_DEFER_MAX))
+    {
+        // another matrix has deferred operators, or the chain is full
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the operator
+    //--------------------------------------------------------------------------
+
+    GB_Opcode opcode = op->opcode ;
+    bool op_is_unop = GB_IS_UNARYOP_CODE (opcode) ;
+    bool op_is_binop = GB_IS_BINARYOP_CODE (opcode) ;
+    if (!(op_is_unop || op_is_binop) || GB_OPCODE_IS_POSITIONAL (opcode)
+        || opcode == GB_USER_unop_code || opcode == GB_USER_binop_code
+        || op->ztype != C->type)
+    {
+        // only built-in non-positional unary and binary operators are
+        // deferred, with no typecasting of the result
+        return (false) ;
+    }
+
+    if (op_is_binop && (scalar == NULL || GB_nnz ((GrB_Matrix) scalar) != 1
+        || GB_ANY_PENDING_WORK (scalar)
+        || scalar->type->size > GB_DEFER_XSIZE))
+    {
+        // the bound scalar must have a single built-in entry
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the matrix C
+    //--------------------------------------------------------------------------
+
+    if (C->iso || GB_ANY_PENDING_WORK (C) || GB_nnz_held (C) == 0
+        || GB_unop_code_iso (C, op, binop_bind1st) != GB_NON_ISO)
+    {
+        // C must be non-iso, with no pending work, and remain non-iso
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // add the operator to the chain for C
+    //--------------------------------------------------------------------------
+
+    if (opcode == GB_IDENTITY_unop_code)
+    { 
+        // C = identity (C) has no effect, since op->ztype is C->type
+        return (true) ;
+    }
+
+    int k = (Defer->C == NULL) ? 0 : Defer->nops ;
+    Defer->op [k] = op ;
+    Defer->binop_bind1st [k] = binop_bind1st ;
+    Defer->stype [k] = NULL ;
+    if (op_is_binop)
+    {
+        Defer->stype [k] = scalar->type ;
+        memcpy (Defer->sx [k], scalar->x, scalar->type->size) ;
+    }
+    Defer->nops = k + 1 ;
+    Defer->C = C ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_defer_finish: compute all deferred operators
+//------------------------------------------------------------------------------
+
+GrB_Info GB_defer_finish        // compute all deferred operators
+(
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the chain of deferred operators, and clear it
+    //--------------------------------------------------------------------------
+
+    struct GB_Defer_struct *Defer = GB_Context_defer_queue ( ) ;
+    if (Defer == NULL || Defer->C == NULL)
+    {
+        // no deferred operators
+        return (GrB_SUCCESS) ;
+    }
+
+    GrB_Matrix C = Defer->C ;
+    int nops = Defer->nops ;
+    Defer->C = NULL ;
+    Defer->nops = 0 ;
+    ASSERT_MATRIX_OK (C, "C for GB_defer_finish", GB0) ;
+    ASSERT (!C->iso) ;
+    ASSERT (!GB_ANY_PENDING_WORK (C)) ;
+    GBURBLE ("(deferred: %d op%s) ", nops, (nops == 1) ? "" : "s") ;
+
+    //--------------------------------------------------------------------------
+    // determine the block size
+    //--------------------------------------------------------------------------
+
+    // Each thread applies all of the operators to its part of a block, of
+    // size at least GB_DEFER_BLOCK bytes or chunk entries.  GB_apply_op uses
+    // a static partition of the block, so each part stays in the cache of
+    // the same thread for all of the operators.
+
+    GrB_Type ctype = C->type ;
+    size_t csize = ctype->size ;
+    int64_t cnz = GB_nnz_held (C) ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (cnz, chunk, nthreads_max) ;
+    int64_t bsize = GB_DEFER_BLOCK / csize ;
+    bsize = nthreads * GB_IMAX (bsize, (int64_t) chunk) ;
+
+    //--------------------------------------------------------------------------
+    // wrap each bound scalar
+    //--------------------------------------------------------------------------
+
+    struct GB_Scalar_opaque S_header [GB_DEFER_MAX] ;
+    GrB_Scalar S [GB_DEFER_MAX] ;
+    for (int k = 0 ; k < nops ; k++)
+    {
+        S [k] = (Defer->stype [k] == NULL) ? NULL :
+            GB_Scalar_wrap (&S_header [k], Defer->stype [k], Defer->sx [k]) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // apply all operators to each block of C->x
+    //--------------------------------------------------------------------------
+
+    GB_void *Cx = (GB_void *) C->x ;
+    for (int64_t pstart = 0 ; pstart < cnz ; pstart += bsize)
+    {
+
+        //----------------------------------------------------------------------
+        // create T as a full vector for the block Cx [pstart:pend-1]
+        //----------------------------------------------------------------------
+
+        int64_t bnz = GB_IMIN (bsize, cnz - pstart) ;
+        struct GB_Matrix_opaque T_header ;
+        GrB_Matrix T = GB_clear_static_header (&T_header) ;
+        T->magic = GB_MAGIC ;
+        T->type = ctype ;
+        T->plen = -1 ;
+        T->vlen = bnz ;
+        T->vdim = 1 ;
+        T->nvec = 1 ;
+        T->nvec_nonempty = (bnz > 0) ? 1 : 0 ;
+        T->x = Cx + pstart * csize ;
+        T->x_size = bnz * csize ;
+        T->x_shallow = true ;
+        T->sparsity_control = GxB_FULL ;
+        T->is_csc = true ;
+        ASSERT_MATRIX_OK (T, "T block for GB_defer_finish", GB0) ;
+
+        //----------------------------------------------------------------------
+        // T = op (T) for each operator in the chain, in place
+        //----------------------------------------------------------------------
+
+        for (int k = 0 ; k < nops ; k++)
+        {
+            GrB_Info info = GB_apply_op ((GB_void *) T->x, ctype, GB_NON_ISO,
+                Defer->op [k], S [k], Defer->binop_bind1st [k], false, T,
+                Werk) ;
+            if (info != GrB_SUCCESS)
+            { 
+                // out of memory, or the JIT failed.  Some blocks of C->x now
+                // hold the result of all of the operators, and others only
+                // some or none of them, and the chain has been discarded.  C
+                // is cleared so that it is left in a well-defined state, and
+                // the error is logged in C.
+                GB_clear (C, Werk) ;
+                GB_FREE (&(C->logger), C->logger_size) ;
+                Werk->logger_handle = &(C->logger) ;
+                Werk->logger_size_handle = &(C->logger_size) ;
+                GB_ERROR (info, "%d deferred operator%s could not be applied;"
+                    " the matrix has been cleared", nops,
+                    (nops == 1) ? "" : "s") ;
+            }
+        }
+    }
+
+    ASSERT_MATRIX_OK (C, "C result for GB_defer_finish", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_defer_drop: discard deferred operators of a matrix
+//------------------------------------------------------------------------------
+
+// If A is NULL, any deferred operators of this user thread are discarded.
+
+void GB_defer_drop              // discard deferred operators of a matrix
+(
+    GrB_Matrix A                // matrix about to be freed
+)
+{
+    struct GB_Defer_struct *Defer = GB_Context_defer_queue ( ) ;
+    if (Defer != NULL && Defer->C != NULL && (A == NULL || Defer->C == A))
+    {
+        Defer->C = NULL ;
+        Defer->nops = 0 ;
+    }
+}
+
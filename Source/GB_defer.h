@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+// GB_defer.h: deferred execution of chains of GrB_apply
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If GxB_DEFER is enabled in the Context of a user thread, an in-place
+// C = op (C) computed by GrB_apply is recorded in the GB_Defer_struct of the
+// user thread instead of being computed.  A chain of such operators on the
+// same matrix C is then computed by GB_defer_finish in a single pass over
+// C->x, one cache-sized block at a time.  GB_defer_finish is called by
+// GB_WHERE on entry to any other user-callable method.
+
+#ifndef GB_DEFER_H
+#define GB_DEFER_H
+
+#define GB_DEFER_MAX 16             // max # of operators in a chain
+#define GB_DEFER_XSIZE 16           // max size of a bound scalar
+#define GB_DEFER_BLOCK (256*1024)   // bytes of C->x per thread, per block
+
+struct GB_Defer_struct
+{
+    GrB_Matrix C ;                  // matrix with deferred ops, or NULL
+    int nops ;                      // # of deferred operators
+    GB_Operator op [GB_DEFER_MAX] ; // built-in unary or binary operators
+    bool binop_bind1st [GB_DEFER_MAX] ; // if true, C=op(s,C), else op(C,s)
+    GrB_Type stype [GB_DEFER_MAX] ; // type of each bound scalar, or NULL
+    GB_void sx [GB_DEFER_MAX][GB_DEFER_XSIZE] ; // value of each scalar
+} ;
+
+// GB_defer_matrix: return the matrix with deferred operators, or NULL
+static inline GrB_Matrix GB_defer_matrix (void)
+{
+    struct GB_Defer_struct *Defer = GB_Context_defer_queue ( ) ;
+    return ((Defer == NULL) ? NULL : Defer->C) ;
+}
+
+bool GB_defer_apply             // true if C = op (C) has been deferred
+(
+    GrB_Matrix C,               // input/output matrix, computed in place
+    const GB_Operator op,       // unary op or binop to apply
+    const GrB_Scalar scalar,    // scalar to bind to binary operator
+    const bool binop_bind1st    // if true, C=binop(s,C), else C=binop(C,s)
+) ;
+
+GrB_Info GB_defer_finish        // compute all deferred operators
+(
+    GB_Werk Werk
+) ;
+
+void GB_defer_drop              // discard deferred operators of a matrix
+(
+    GrB_Matrix A                // matrix about to be freed
+) ;
+
+// finish all deferred operators on entry to a user-callable method
+#define GB_DEFER_FINISH                                                 \
+    if (GB_defer_matrix ( ) != NULL)                                    \
+    {                                                                   \
+        GrB_Info defer_info = GB_defer_finish (Werk) ;                  \
+        if (defer_info != GrB_SUCCESS) return (defer_info) ;            \
+    }
+
+#endif
+
@@ -0,0 +1,346 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_delta: deserialize a chain of blobs from GB_serialize_delta
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// The matrix is reconstructed from a base blob (blobs [0]), which must hold
+// all of its chunks, followed by a chain of incremental blobs, blobs [1] to
+// blobs [nblobs-1].  Each blob in the chain must have been created by
+// GB_serialize_delta with the prior blob in the chain.  The arrays Ap, Ah, Ab,
+// Ai, and Ax are updated with the chunks held in each blob in turn.  A chunk
+// not held in a blob is taken from the matrix constructed so far, and its
+// hash and size must match the manifest of the prior blob.  An array is
+// modified in place if its size does not change.
+
+// As in GB_deserialize, the blobs are checked so that no out-of-bounds access
+// occurs, but the contents of the output matrix are not checked.
+
+#include "GB.h"
+#include "GB_serialize.h"
+#include "GB_lz4.h"
+#include "GB_zstd.h"
+
+#define GB_FREE_WORKSPACE                           \
+{                                                   \
+    GB_FREE_WORK (&Offset, Offset_size) ;           \
+    for (int a = 0 ; a < 5 ; a++)                   \
+    {                                               \
+        GB_FREE (&(Y [a]), Y_size [a]) ;            \
+    }                                               \
+}
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_FREE_WORKSPACE ;                             \
+    for (int a = 0 ; a < 5 ; a++)                   \
+    {                                               \
+        GB_FREE (&(X [a]), X_size [a]) ;            \
+    }                                               \
+    GB_Matrix_free (&C) ;                           \
+}
+
+GrB_Info GB_deserialize_delta       // deserialize a chain of blobs
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the blobs
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const GB_void **blobs,          // blobs [0:nblobs-1]
+    const GrB_Index *blob_sizes,    // blob_sizes [0:nblobs-1]
+    int64_t nblobs                  // # of blobs in the chain
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Chandle != NULL && blobs != NULL && blob_sizes != NULL) ;
+    ASSERT (nblobs > 0) ;
+    (*Chandle) = NULL ;
+    GrB_Matrix C = NULL ;
+
+    // X [0:4] are the arrays Ap, Ah, Ab, Ai, and Ax constructed so far, and
+    // Y [0:4] are new arrays for those that change size in the next blob
+    GB_void *X [5] = { NULL, NULL, NULL, NULL, NULL } ;
+    GB_void *Y [5] = { NULL, NULL, NULL, NULL, NULL } ;
+    size_t X_size [5] = { 0, 0, 0, 0, 0 } ;
+    size_t Y_size [5] = { 0, 0, 0, 0, 0 } ;
+    int64_t *Offset = NULL ; size_t Offset_size = 0 ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    //--------------------------------------------------------------------------
+    // apply each blob in the chain
+    //--------------------------------------------------------------------------
+
+    GB_delta_header H, P ;
+    memset (&P, 0, sizeof (GB_delta_header)) ;
+    for (int64_t b = 0 ; b < nblobs ; b++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the header and manifest of the blob
+        //----------------------------------------------------------------------
+
+        const GB_void *blob = blobs [b] ;
+        size_t blob_size = (size_t) blob_sizes [b] ;
+        if (blob == NULL)
+        {
+            // blob is missing
+            GB_FREE_ALL ;
+            return (GrB_NULL_POINTER) ;
+        }
+        GB_OK (GB_deserialize_delta_header (&H, blob, blob_size)) ;
+        int64_t nchunks = H.first [5] ;
+        if (H.blob_size != (uint64_t) blob_size
+            || (b > 0 && (H.prior_hash != P.hash
+                || H.chunk_size != P.chunk_size
+                || H.typecode != P.typecode
+                || H.typesize != P.typesize)))
+        {
+            // blob is invalid, or not the next blob in the chain
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+
+        //----------------------------------------------------------------------
+        // find the position of each compressed chunk in the blob
+        //----------------------------------------------------------------------
+
+        GB_FREE_WORK (&Offset, Offset_size) ;
+        Offset = GB_MALLOC_WORK (nchunks + 1, int64_t, &Offset_size) ;
+        if (Offset == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        bool ok = true ;
+        size_t s = H.manifest_end ;
+        for (int64_t g = 0 ; g < nchunks && ok ; g++)
+        {
+            int64_t csize = H.Csize [g] ;
+            // a chunk not held in the blob must be taken from a prior blob
+            ok = (csize > 0 || (b > 0 && csize == 0))
+                && csize <= INT32_MAX
+                && (uint64_t) csize <= (uint64_t) (blob_size - s) ;
+            Offset [g] = s ;
+            s += csize ;
+        }
+        if (!ok || s != blob_size)
+        {
+            // blob is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+
+        //----------------------------------------------------------------------
+        // allocate new arrays for those that change size
+        //----------------------------------------------------------------------
+
+        int64_t len [5] ;
+        for (int a = 0 ; a < 5 ; a++)
+        {
+            len [a] = H.len [a] ;
+            if (b == 0 || len [a] != P.len [a])
+            {
+                Y [a] = GB_MALLOC (len [a], GB_void, &(Y_size [a])) ; // OK
+                if (Y [a] == NULL)
+                {
+                    // out of memory
+                    GB_FREE_ALL ;
+                    return (GrB_OUT_OF_MEMORY) ;
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // get each chunk from the blob or from the prior arrays
+        //----------------------------------------------------------------------
+
+        int32_t algo, level ;
+        bool delta ;
+        GB_serialize_method (&algo, &level, &delta, H.method) ;
+        int64_t chunk_size = H.chunk_size ;
+
+        int nthreads = GB_IMIN (nthreads_max, GB_IMAX (nchunks, 1)) ;
+        int64_t g ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+            reduction(&&:ok)
+        for (g = 0 ; g < nchunks ; g++)
+        {
+            // chunk g is the kth chunk of the array a
+            int a = 0 ;
+            while (g >= H.first [a+1]) a++ ;
+            int64_t k = g - H.first [a] ;
+            int64_t kstart = k * chunk_size ;
+            int64_t clen = GB_IMIN (chunk_size, len [a] - kstart) ;
+            GB_void *dst = ((Y [a] != NULL) ? Y [a] : X [a]) + kstart ;
+            int64_t csize = H.Csize [g] ;
+            if (csize == 0)
+            {
+                // the chunk is unchanged from the prior blob
+                if (k >= P.first [a+1] - P.first [a]
+                    || GB_IMIN (chunk_size, P.len [a] - kstart) != clen
+                    || P.Hash [P.first [a] + k] != H.Hash [g])
+                {
+                    // blob is invalid
+                    ok = false ;
+                }
+                else if (Y [a] != NULL)
+                {
+                    // copy the chunk from the prior array
+                    memcpy (dst, X [a] + kstart, clen) ;
+                }
+            }
+            else
+            {
+                // uncompress the chunk from the blob
+                const char *src = (const char *) (blob + Offset [g]) ;
+                if (algo == GxB_COMPRESSION_NONE)
+                {
+                    ok = ok && (csize == clen) ;
+                    if (ok) memcpy (dst, src, clen) ;
+                }
+                else if (algo == GxB_COMPRESSION_ZSTD)
+                {
+                    size_t u = ZSTD_decompress (dst, clen, src, csize) ;
+                    ok = ok && (u == (size_t) clen) ;
+                }
+                else
+                {
+                    int u = LZ4_decompress_safe (src, (char *) dst,
+                        (int) csize, (int) clen) ;
+                    ok = ok && (u == (int) clen) ;
+                }
+            }
+        }
+
+        if (!ok)
+        {
+            // blob is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+
+        //----------------------------------------------------------------------
+        // replace the arrays that have changed size
+        //----------------------------------------------------------------------
+
+        for (int a = 0 ; a < 5 ; a++)
+        {
+            if (Y [a] != NULL)
+            {
+                GB_FREE (&(X [a]), X_size [a]) ;
+                X [a] = Y [a] ;
+                X_size [a] = Y_size [a] ;
+                Y [a] = NULL ;
+                Y_size [a] = 0 ;
+            }
+        }
+
+        // the manifest of this blob is used to check the next blob
+        P = H ;
+    }
+
+    GB_FREE_WORKSPACE ;
+
+    //--------------------------------------------------------------------------
+    // determine the matrix type
+    //--------------------------------------------------------------------------
+
+    GB_Type_code ccode = (GB_Type_code) H.typecode ;
+    GrB_Type ctype = GB_code_type (ccode, type_expected) ;
+
+    // ensure the type has the right size
+    if (ctype == NULL || ctype->size != H.typesize)
+    {
+        // blob is invalid; type is missing or the wrong size
+        GB_FREE_ALL ;
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    if (ccode == GB_UDT_code)
+    {
+        // ensure the user-defined type has the right name
+        ASSERT (ctype == type_expected) ;
+        if (strncmp (H.type_name, ctype->name, GxB_MAX_NAME_LEN) != 0)
+        {
+            // blob is invalid
+            GB_FREE_ALL ;
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+    }
+    else if (type_expected != NULL && ctype != type_expected)
+    {
+        // built-in type must match type_expected
+        GB_FREE_ALL ;
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the output matrix C
+    //--------------------------------------------------------------------------
+
+    int32_t sparsity = H.sparsity_iso_csc / 4 ;
+    bool iso = ((H.sparsity_iso_csc & 2) == 2) ;
+    bool is_csc = ((H.sparsity_iso_csc & 1) == 1) ;
+
+    GB_OK (GB_new (&C,  // new header (C is NULL on input)
+        ctype, H.vlen, H.vdim, GB_Ap_null, is_csc,
+        sparsity, H.hyper_switch, H.nvec)) ;
+
+    C->nvec = H.nvec ;
+    C->nvec_nonempty = H.nvec_nonempty ;
+    C->nvals = H.nvals ;
+    C->bitmap_switch = H.bitmap_switch ;
+    C->sparsity_control = H.sparsity_control ;
+    C->iso = iso ;
+
+    // transplant the arrays into C, and free any not needed
+    #define GB_TRANSPLANT(a,field,type)                 \
+    {                                                   \
+        C->field = (type *) X [a] ;                     \
+        C->field ## _size = X_size [a] ;                \
+        X [a] = NULL ;                                  \
+        X_size [a] = 0 ;                                \
+    }
+
+    if (sparsity == GxB_HYPERSPARSE)
+    {
+        GB_TRANSPLANT (1, h, int64_t) ;
+    }
+    if (sparsity == GxB_HYPERSPARSE || sparsity == GxB_SPARSE)
+    {
+        GB_TRANSPLANT (0, p, int64_t) ;
+        GB_TRANSPLANT (3, i, int64_t) ;
+        C->nvals = C->p [C->nvec] ;
+    }
+    if (sparsity == GxB_BITMAP)
+    {
+        GB_TRANSPLANT (2, b, int8_t) ;
+    }
+    GB_TRANSPLANT (4, x, void) ;
+    C->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        GB_FREE (&(X [a]), X_size [a]) ;
+    }
+    (*Chandle) = C ;
+    ASSERT_MATRIX_OK (*Chandle, "Final result from deserialize delta", GB0) ;
+    return (GrB_SUCCESS) ;
+}
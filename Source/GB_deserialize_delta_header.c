@@ -0,0 +1,208 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_delta_header: parse the header of a GB_serialize_delta blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// Reads the header and manifest of a blob created by GB_serialize_delta, and
+// checks them so that no out-of-bounds access can occur when the blob is
+// used.  The hash of the header and manifest is recomputed and compared with
+// the hash held in the blob.  blob_size may be smaller than the size of the
+// whole blob, if only its header and manifest are provided (as is done for the
+// prior blob of GB_serialize_delta).  The compressed chunks are not accessed.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+// xxHash uses switch statements with no default case.
+#if GB_COMPILER_GCC
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#endif
+
+#define XXH_INLINE_ALL
+#define XXH_NO_STREAM
+#include "xxhash.h"
+
+GrB_Info GB_deserialize_delta_header    // parse a GB_serialize_delta blob
+(
+    // output:
+    GB_delta_header *H,         // header and manifest of the blob
+    // input:
+    const GB_void *blob,        // the blob (or just its header and manifest)
+    size_t blob_size            // size of the blob
+)
+{
+
+    //--------------------------------------------------------------------------
+    // read the header
+    //--------------------------------------------------------------------------
+
+    ASSERT (H != NULL && blob != NULL) ;
+    memset (H, 0, sizeof (GB_delta_header)) ;
+    if (blob_size < GB_DELTA_HEADER_SIZE)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    size_t s = 0 ;
+    GB_BLOB_READ (blob_size2, uint64_t) ;
+    GB_BLOB_READ (magic, uint64_t) ;
+    GB_BLOB_READ (prior_hash, uint64_t) ;
+    GB_BLOB_READ (hash, uint64_t) ;
+    GB_BLOB_READ (version, int32_t) ;
+    GB_BLOB_READ (typecode, int32_t) ;
+    GB_BLOB_READ (sparsity_control, int32_t) ;
+    GB_BLOB_READ (sparsity_iso_csc, int32_t) ;
+    GB_BLOB_READ (method, int32_t) ;
+    GB_BLOB_READ (unused, int32_t) ;
+    GB_BLOB_READ (hyper_switch, float) ;
+    GB_BLOB_READ (bitmap_switch, float) ;
+    GB_BLOB_READ (vlen, int64_t) ;
+    GB_BLOB_READ (vdim, int64_t) ;
+    GB_BLOB_READ (nvec, int64_t) ;
+    GB_BLOB_READ (nvec_nonempty, int64_t) ;
+    GB_BLOB_READ (nvals, int64_t) ;
+    GB_BLOB_READ (typesize, int64_t) ;
+    GB_BLOB_READ (chunk_size, int64_t) ;
+    int64_t len [5] ;
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        memcpy (&(len [a]), blob + s, sizeof (int64_t)) ;
+        s += sizeof (int64_t) ;
+    }
+    ASSERT (s == GB_DELTA_HEADER_SIZE) ;
+
+    //--------------------------------------------------------------------------
+    // check the header
+    //--------------------------------------------------------------------------
+
+    int32_t sparsity = sparsity_iso_csc / 4 ;
+    bool iso = ((sparsity_iso_csc & 2) == 2) ;
+    if (magic != GB_DELTA_MAGIC || blob_size2 < (uint64_t) blob_size
+        || typecode < GB_BOOL_code || typecode > GB_UDT_code
+        || typesize <= 0 || typesize > GB_NMAX
+        || chunk_size <= 0 || chunk_size > INT32_MAX / 2
+        || vlen < 0 || vlen > GB_NMAX || vdim < 0 || vdim > GB_NMAX
+        || nvec < 0 || nvec > vdim || nvec_nonempty < 0 || nvals < 0
+        || !(sparsity == GxB_HYPERSPARSE || sparsity == GxB_SPARSE
+          || sparsity == GxB_BITMAP || sparsity == GxB_FULL))
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    // the size of each array must match the header
+    uint64_t expected [5] = { 0, 0, 0, 0, 0 } ;
+    uint64_t anz_held = 0 ;
+    bool ok = true ;
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            expected [1] = sizeof (GrB_Index) * nvec ;
+            // fall through to the sparse case
+        case GxB_SPARSE :
+            ok = (nvals <= GB_NMAX) ;
+            expected [0] = sizeof (GrB_Index) * (nvec+1) ;
+            expected [3] = sizeof (GrB_Index) * nvals ;
+            ok = ok && GB_int64_multiply (&(expected [4]), typesize,
+                iso ? 1 : nvals) ;
+            break ;
+        case GxB_BITMAP :
+        case GxB_FULL :
+            ok = GB_int64_multiply (&anz_held, vlen, vdim) ;
+            if (sparsity == GxB_BITMAP) expected [2] = anz_held ;
+            ok = ok && GB_int64_multiply (&(expected [4]), typesize,
+                iso ? 1 : (int64_t) anz_held) ;
+            break ;
+        default: ;
+    }
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        ok = ok && (len [a] >= 0) && ((uint64_t) len [a] == expected [a]) ;
+    }
+    if (!ok)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the type name and the manifest
+    //--------------------------------------------------------------------------
+
+    int64_t first [6] ;
+    first [0] = 0 ;
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        first [a+1] = first [a] + GB_ICEIL (len [a], chunk_size) ;
+    }
+    int64_t nchunks = first [5] ;
+
+    const char *type_name = NULL ;
+    if (typecode == GB_UDT_code)
+    {
+        if (blob_size < s + GxB_MAX_NAME_LEN)
+        {
+            // blob is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+        type_name = (const char *) (blob + s) ;
+        s += GxB_MAX_NAME_LEN ;
+    }
+
+    if (nchunks > (int64_t) ((blob_size - s) / (2 * sizeof (int64_t))))
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    const uint64_t *Hash = (const uint64_t *) (blob + s) ;
+    s += nchunks * sizeof (uint64_t) ;
+    const int64_t *Csize = (const int64_t *) (blob + s) ;
+
+    // check the hash of the header and Hash [0:nchunks-1]
+    uint64_t hash2 = XXH3_64bits (blob + GB_DELTA_HASH_START,
+        s - GB_DELTA_HASH_START) ;
+    if (hash2 == 0) hash2 = 1 ;
+    if (hash2 != hash)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+    s += nchunks * sizeof (int64_t) ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    H->blob_size = blob_size2 ;
+    H->prior_hash = prior_hash ;
+    H->hash = hash ;
+    H->version = version ;
+    H->typecode = typecode ;
+    H->sparsity_control = sparsity_control ;
+    H->sparsity_iso_csc = sparsity_iso_csc ;
+    H->method = method ;
+    H->hyper_switch = hyper_switch ;
+    H->bitmap_switch = bitmap_switch ;
+    H->vlen = vlen ;
+    H->vdim = vdim ;
+    H->nvec = nvec ;
+    H->nvec_nonempty = nvec_nonempty ;
+    H->nvals = nvals ;
+    H->typesize = typesize ;
+    H->chunk_size = chunk_size ;
+    memcpy (H->len, len, 5 * sizeof (int64_t)) ;
+    memcpy (H->first, first, 6 * sizeof (int64_t)) ;
+    H->type_name = type_name ;
+    H->Hash = Hash ;
+    H->Csize = Csize ;
+    H->manifest_end = s ;
+    return (GrB_SUCCESS) ;
+}
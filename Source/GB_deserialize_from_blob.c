@@ -15,14 +15,25 @@
 // However, the contents of output array are not fully checked.  This step is
 // done by GB_deserialize, if requested.
 
+// If the method includes GxB_COMPRESSION_DELTA, X is an int64_t array, and
+// each block is decompressed into workspace and then delta-decoded into X, in
+// parallel.  The blocks are partitioned by whole int64_t entries, just as
+// done by GB_serialize_array.
+
 #include "GB.h"
 #include "GB_serialize.h"
 #include "GB_lz4.h"
 #include "GB_zstd.h"
 
-#define GB_FREE_ALL         \
-{                           \
-    GB_FREE (&X, X_size) ;  \
+#define GB_FREE_WORKSPACE           \
+{                                   \
+    GB_FREE_WORK (&W, W_size) ;     \
+}
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_FREE_WORKSPACE ;             \
+    GB_FREE (&X, X_size) ;          \
 }
 
 GrB_Info GB_deserialize_from_blob
@@ -59,13 +70,21 @@ GrB_Info GB_deserialize_from_blob
     //--------------------------------------------------------------------------
 
     int32_t algo, level ;
-    GB_serialize_method (&algo, &level, method) ;
+    bool delta ;
+    GB_serialize_method (&algo, &level, &delta, method) ;
+    if (algo == GxB_COMPRESSION_NONE) delta = false ;
+    if (delta && (X_len % sizeof (int64_t) != 0))
+    { 
+        // blob is invalid: a delta-encoded array must be int64_t
+        return (GrB_INVALID_OBJECT) ;
+    }
 
     //--------------------------------------------------------------------------
     // allocate the output array
     //--------------------------------------------------------------------------
 
-    size_t X_size = 0 ;
+    size_t X_size = 0, W_size = 0 ;
+    GB_void *W = NULL ;
     GB_void *X = GB_MALLOC (X_len, GB_void, &X_size) ;  // OK
     if (X == NULL)
     { 
@@ -73,6 +92,18 @@ GrB_Info GB_deserialize_from_blob
         return (GrB_OUT_OF_MEMORY) ;
     }
 
+    if (delta)
+    {
+        // allocate workspace for the delta-encoded blocks
+        W = GB_MALLOC_WORK (X_len, GB_void, &W_size) ;
+        if (W == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // determine the number of threads to use
     //--------------------------------------------------------------------------
@@ -93,7 +124,11 @@ GrB_Info GB_deserialize_from_blob
         // no compression; the array is held in a single block
         //----------------------------------------------------------------------
 
-        if (nblocks > 1 || Sblocks [0] != X_len || s + X_len > blob_size)
+        // An empty array is held in no blocks at all, so Sblocks [0] is not
+        // present and must not be read.
+        if (nblocks > 1 || (nblocks == 0 && X_len != 0)
+            || (nblocks == 1 && Sblocks [0] != X_len)
+            || s + X_len > blob_size)
         { 
             // blob is invalid: guard against an unsafe memcpy
             ok = false ;
@@ -113,6 +148,9 @@ GrB_Info GB_deserialize_from_blob
         // LZ4, LZ4HC, or ZSTD compression
         //----------------------------------------------------------------------
 
+        // with delta encoding, blocks are partitioned by int64_t entries
+        const int64_t unit = (delta) ? sizeof (int64_t) : 1 ;
+        const int64_t nunits = X_len / unit ;
         int nthreads = GB_IMIN (nthreads_max, nblocks) ;
         int32_t blockid ;
         #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
@@ -121,7 +159,9 @@ GrB_Info GB_deserialize_from_blob
         {
             // get the start and end of the compressed and uncompressed blocks
             int64_t kstart, kend ;
-            GB_PARTITION (kstart, kend, X_len, blockid, nblocks) ;
+            GB_PARTITION (kstart, kend, nunits, blockid, nblocks) ;
+            kstart *= unit ;
+            kend *= unit ;
             int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
             int64_t s_end   = Sblocks [blockid] ;
             size_t  s_size  = s_end - s_start ;
@@ -144,7 +184,7 @@ GrB_Info GB_deserialize_from_blob
                 // not yet checked, however.  That step is done in
                 // GB_deserialize, if requested.
                 const char *src = (const char *) (blob + s + s_start) ;
-                char *dst = (char *) (X + kstart) ;
+                char *dst = (char *) ((delta ? W : X) + kstart) ;
                 if (algo == GxB_COMPRESSION_ZSTD)
                 { 
                     // ZSTD
@@ -167,6 +207,12 @@ GrB_Info GB_deserialize_from_blob
                         ok = false ;
                     }
                 }
+                if (ok && delta)
+                { 
+                    // X [kstart:kend-1] = delta decoding of W [kstart:kend-1]
+                    GB_serialize_delta_decode ((int64_t *) (X + kstart),
+                        (uint8_t *) (W + kstart), (kend - kstart) / unit) ;
+                }
             }
         }
     }
@@ -182,6 +228,7 @@ GrB_Info GB_deserialize_from_blob
     // return result: X, its size, and updated index into the blob
     //--------------------------------------------------------------------------
 
+    GB_FREE_WORKSPACE ;
     (*X_handle) = X ;
     (*X_size_handle) = X_size ;
     if (nblocks > 0)
@@ -26,10 +26,14 @@
 // The pattern of C is the intersection of A and B, and also intersection with
 // M if present and not complemented.
 
-// TODO: if C is bitmap on input and C_sparsity is GxB_BITMAP, then C=A.*B,
-// C<M>=A.*B and C<M>+=A.*B can all be done in-place.  Also, if C is bitmap
-// but T<M>=A.*B is sparse (M sparse, with A and B bitmap), then it too can
-// be done in place.
+// C<#M>+=A.*B is done in place by GB_emult_bitmap_accum (called by GB_ewise)
+// if C is bitmap, the accum operator is the same as the binary op, and A and
+// B are bitmap/full.
+
+// TODO: if C is bitmap on input and C_sparsity is GxB_BITMAP, then C=A.*B
+// and C<M>=A.*B can also be done in-place.  Also, if C is bitmap but
+// T<M>=A.*B is sparse (M sparse, with A and B bitmap), then it too can be
+// done in place.
 
 #include "GB_emult.h"
 #include "GB_add.h"
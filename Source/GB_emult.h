@@ -207,6 +207,18 @@ GrB_Info GB_emult_bitmap    // C=A.*B, C<M>=A.*B, or C<!M>=A.*B
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_emult_bitmap_accum  // C<M>+=A.*B or C<!M>+=A.*B, C bitmap
+(
+    GrB_Matrix C,           // input/output matrix, bitmap
+    const GrB_Matrix M,     // optional mask, unused if NULL
+    const bool Mask_struct, // if true, use the only structure of M
+    const bool Mask_comp,   // if true, use !M
+    const GrB_Matrix A,     // input A matrix (bitmap/full)
+    const GrB_Matrix B,     // input B matrix (bitmap/full)
+    const GrB_BinaryOp op,  // op for C=op(A,B), and the accum operator
+    GB_Werk Werk
+) ;
+
 bool GB_emult_iso           // c = op(a,b), return true if C is iso
 (
     // output
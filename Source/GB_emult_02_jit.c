@@ -39,7 +39,7 @@ GrB_Info GB_emult_02_jit      // C<#M>=A.*B, emult_02, via the JIT
     char *suffix ;
     uint64_t hash = GB_encodify_ewise (&encoding, &suffix,
         GB_JIT_KERNEL_EMULT2, true,
-        false, false, C_sparsity, C->type, M, Mask_struct, Mask_comp,
+        false, false, false, C_sparsity, C->type, M, Mask_struct, Mask_comp,
         binaryop, false, A, B) ;
 
     //--------------------------------------------------------------------------
@@ -38,7 +38,7 @@ GrB_Info GB_emult_04_jit      // C<M>=A.*B, emult_04, via the JIT
     char *suffix ;
     uint64_t hash = GB_encodify_ewise (&encoding, &suffix,
         GB_JIT_KERNEL_EMULT4, true,
-        false, false, C_sparsity, C->type, M, Mask_struct, false,
+        false, false, false, C_sparsity, C->type, M, Mask_struct, false,
         binaryop, false, A, B) ;
 
     //--------------------------------------------------------------------------
@@ -41,7 +41,7 @@ GrB_Info GB_emult_08_jit      // C<#M>=A.*B, emult_08, via the JIT
     char *suffix ;
     uint64_t hash = GB_encodify_ewise (&encoding, &suffix,
         GB_JIT_KERNEL_EMULT8, true,
-        false, false, C_sparsity, C->type, M, Mask_struct, Mask_comp,
+        false, false, false, C_sparsity, C->type, M, Mask_struct, Mask_comp,
         binaryop, false, A, B) ;
 
     //--------------------------------------------------------------------------
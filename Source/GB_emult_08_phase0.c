@@ -426,8 +426,6 @@ GrB_Info GB_emult_08_phase0     // find vectors in C for C=A.*B or C<M>=A.*B
         GB_OK (GB_hyper_hash_build (M, Werk)) ;
 
         const int64_t *restrict Mp = M->p ;
-        const int64_t *restrict M_Yp = (M->Y == NULL) ? NULL : M->Y->p ;
-        const int64_t *restrict M_Yi = (M->Y == NULL) ? NULL : M->Y->i ;
         const int64_t *restrict M_Yx = (M->Y == NULL) ? NULL : M->Y->x ;
         const int64_t M_hash_bits = (M->Y == NULL) ? 0 : (M->Y->vdim - 1) ;
 
@@ -438,7 +436,7 @@ GrB_Info GB_emult_08_phase0     // find vectors in C for C=A.*B or C<M>=A.*B
         { 
             int64_t pM, pM_end ;
             int64_t j = Ch [k] ;
-            int64_t kM = GB_hyper_hash_lookup (Mh, Mnvec, Mp, M_Yp, M_Yi, M_Yx,
+            int64_t kM = GB_hyper_hash_lookup (Mh, Mnvec, Mp, M_Yx,
                 M_hash_bits, j, &pM, &pM_end) ;
             C_to_M [k] = (pM < pM_end) ? kM : -1 ;
         }
@@ -464,8 +462,6 @@ GrB_Info GB_emult_08_phase0     // find vectors in C for C=A.*B or C<M>=A.*B
         GB_OK (GB_hyper_hash_build (A, Werk)) ;
 
         const int64_t *restrict Ap = A->p ;
-        const int64_t *restrict A_Yp = (A->Y == NULL) ? NULL : A->Y->p ;
-        const int64_t *restrict A_Yi = (A->Y == NULL) ? NULL : A->Y->i ;
         const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
         const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
 
@@ -476,7 +472,7 @@ GrB_Info GB_emult_08_phase0     // find vectors in C for C=A.*B or C<M>=A.*B
         { 
             int64_t pA, pA_end ;
             int64_t j = Ch [k] ;
-            int64_t kA = GB_hyper_hash_lookup (Ah, Anvec, Ap, A_Yp, A_Yi, A_Yx,
+            int64_t kA = GB_hyper_hash_lookup (Ah, Anvec, Ap, A_Yx,
                 A_hash_bits, j, &pA, &pA_end) ;
             C_to_A [k] = (pA < pA_end) ? kA : -1 ;
         }
@@ -502,8 +498,6 @@ GrB_Info GB_emult_08_phase0     // find vectors in C for C=A.*B or C<M>=A.*B
         GB_OK (GB_hyper_hash_build (B, Werk)) ;
 
         const int64_t *restrict Bp = B->p ;
-        const int64_t *restrict B_Yp = (B->Y == NULL) ? NULL : B->Y->p ;
-        const int64_t *restrict B_Yi = (B->Y == NULL) ? NULL : B->Y->i ;
         const int64_t *restrict B_Yx = (B->Y == NULL) ? NULL : B->Y->x ;
         const int64_t B_hash_bits = (B->Y == NULL) ? 0 : (B->Y->vdim - 1) ;
 
@@ -514,7 +508,7 @@ GrB_Info GB_emult_08_phase0     // find vectors in C for C=A.*B or C<M>=A.*B
         { 
             int64_t pB, pB_end ;
             int64_t j = Ch [k] ;
-            int64_t kB = GB_hyper_hash_lookup (Bh, Bnvec, Bp, B_Yp, B_Yi, B_Yx,
+            int64_t kB = GB_hyper_hash_lookup (Bh, Bnvec, Bp, B_Yx,
                 B_hash_bits, j, &pB, &pB_end) ;
             C_to_B [k] = (pB < pB_end) ? kB : -1 ;
         }
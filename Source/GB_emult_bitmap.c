@@ -55,8 +55,11 @@
             // by method 100, which constructs C as sparse/hyper (the same
             // structure as M), not bitmap.
 
-// TODO: if C is bitmap on input and C_sparsity is GxB_BITMAP, then C=A.*B,
-// C<M>=A.*B and C<M>+=A.*B can all be done in-place.
+// C<#M>+=A.*B, with C bitmap on input, is done in place by
+// GB_emult_bitmap_accum instead.
+
+// TODO: if C is bitmap on input and C_sparsity is GxB_BITMAP, then C=A.*B
+// and C<M>=A.*B can also be done in-place.
 
 #include "GB_ewise.h"
 #include "GB_emult.h"
@@ -263,7 +266,7 @@ GrB_Info GB_emult_bitmap    // C=A.*B, C<M>=A.*B, or C<!M>=A.*B
 
     if (info == GrB_NO_VALUE)
     { 
-        info = GB_emult_bitmap_jit (C, M, Mask_struct,
+        info = GB_emult_bitmap_jit (C, false, M, Mask_struct,
             Mask_comp, op, A, B, M_ek_slicing, M_ntasks, M_nthreads,
             C_nthreads) ;
     }
@@ -0,0 +1,132 @@
+//------------------------------------------------------------------------------
+// GB_emult_bitmap_accum: C<M>+=A.*B or C<!M>+=A.*B, in place, when C is bitmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: done.
+
+// C<#M> += A.*B is computed in place, where C is bitmap and not iso, and the
+// accum operator is the same as the binary operator.  A and B are bitmap or
+// full.  The mask M is either not present, bitmap/full, or sparse/hyper and
+// complemented.  C_replace is false, so C(i,j) is left unchanged where the
+// mask is false or where A(i,j).*B(i,j) is not present.  Otherwise, C(i,j)
+// is modified in place:
+
+//      if C(i,j) is present:   C(i,j) = op (C(i,j), op (A(i,j), B(i,j)))
+//      otherwise:              C(i,j) = op (A(i,j), B(i,j))
+
+// This avoids the construction of T=A.*B and the update C<#M>=accum(C,T) by
+// GB_accum_mask.  No typecasting is done: the types of C, A, B, and the x, y,
+// and z inputs of the operator must all be the same.  No matrix may have any
+// pending work, and C, A, B, and M must all have the same CSR/CSC format.
+// C may be aliased with M, A, and/or B.
+
+// There is no factory or generic kernel for this method: it returns
+// GrB_NO_VALUE if the JIT is disabled or the kernel cannot be compiled, and
+// the caller then computes C<#M>=accum(C,A.*B) in the conventional way.
+
+#include "GB_ewise.h"
+#include "GB_emult.h"
+#include "GB_ek_slice.h"
+#include "GB_stringify.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_WERK_POP (M_ek_slicing, int64_t) ;   \
+}
+
+GrB_Info GB_emult_bitmap_accum  // C<M>+=A.*B or C<!M>+=A.*B, C bitmap
+(
+    GrB_Matrix C,           // input/output matrix, bitmap
+    const GrB_Matrix M,     // optional mask, unused if NULL
+    const bool Mask_struct, // if true, use the only structure of M
+    const bool Mask_comp,   // if true, use !M
+    const GrB_Matrix A,     // input A matrix (bitmap/full)
+    const GrB_Matrix B,     // input B matrix (bitmap/full)
+    const GrB_BinaryOp op,  // op for C=op(A,B), and the accum operator
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT_MATRIX_OK (C, "C for bitmap C<#M>+=A.*B", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for bitmap C<#M>+=A.*B", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for bitmap C<#M>+=A.*B", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for bitmap C<#M>+=A.*B", GB0) ;
+    ASSERT_BINARYOP_OK (op, "op for bitmap C<#M>+=A.*B", GB0) ;
+
+    ASSERT (GB_IS_BITMAP (C) && !C->iso) ;
+    ASSERT (GB_IS_BITMAP (A) || GB_IS_FULL (A)) ;
+    ASSERT (GB_IS_BITMAP (B) || GB_IS_FULL (B)) ;
+    ASSERT (!(A->iso && B->iso)) ;
+    ASSERT (M == NULL || Mask_comp || GB_IS_BITMAP (M) || GB_IS_FULL (M)) ;
+    ASSERT (!GB_OP_IS_POSITIONAL (op)) ;
+    ASSERT (C->type == op->ztype && A->type == op->xtype
+        && B->type == op->ytype && op->xtype == op->ztype
+        && op->ytype == op->ztype) ;
+
+    //--------------------------------------------------------------------------
+    // declare workspace
+    //--------------------------------------------------------------------------
+
+    GB_WERK_DECLARE (M_ek_slicing, int64_t) ;
+    int M_ntasks = 0 ; int M_nthreads = 0 ;
+
+    //--------------------------------------------------------------------------
+    // delete any lingering zombies and assemble any pending tuples
+    //--------------------------------------------------------------------------
+
+    // M can be jumbled
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (M) ;
+
+    GBURBLE ("emult_bitmap:(B<%s%s%s>+=%s.*%s) in place ",
+        Mask_comp ? "!" : "",
+        GB_sparsity_char_matrix (M),
+        Mask_struct ? ",struct" : "",
+        GB_sparsity_char_matrix (A),
+        GB_sparsity_char_matrix (B)) ;
+
+    //--------------------------------------------------------------------------
+    // determine how many threads to use
+    //--------------------------------------------------------------------------
+
+    int64_t cnz = GB_nnz_full (C) ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int C_nthreads = GB_nthreads (cnz, chunk, nthreads_max) ;
+
+    // slice the M matrix if it is sparse or hypersparse (and complemented)
+    if (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M))
+    { 
+        GB_SLICE_MATRIX (M, 8) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // via the JIT or PreJIT kernel
+    //--------------------------------------------------------------------------
+
+    info = GB_emult_bitmap_jit (C, true, M, Mask_struct, Mask_comp, op, A, B,
+        M_ek_slicing, M_ntasks, M_nthreads, C_nthreads) ;
+
+    // no factory or generic kernel: returns GrB_NO_VALUE if no JIT kernel
+    // is available, with C unchanged.
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    if (info == GrB_SUCCESS)
+    { 
+        ASSERT_MATRIX_OK (C, "C output for bitmap C<#M>+=A.*B", GB0) ;
+    }
+    return (info) ;
+}
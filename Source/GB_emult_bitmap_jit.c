@@ -17,6 +17,7 @@ GrB_Info GB_emult_bitmap_jit      // C<#M>=A.*B, emult_bitmap, via the JIT
     // input/output:
     GrB_Matrix C,
     // input:
+    const bool C_in_place,      // if true, C<#M> += A.*B in place
     const GrB_Matrix M,
     const bool Mask_struct,
     const bool Mask_comp,
@@ -38,8 +39,8 @@ GrB_Info GB_emult_bitmap_jit      // C<#M>=A.*B, emult_bitmap, via the JIT
     char *suffix ;
     uint64_t hash = GB_encodify_ewise (&encoding, &suffix,
         GB_JIT_KERNEL_EMULT_BITMAP, true,
-        false, false, GxB_BITMAP, C->type, M, Mask_struct, Mask_comp,
-        binaryop, false, A, B) ;
+        false, false, C_in_place, GxB_BITMAP, C->type, M, Mask_struct,
+        Mask_comp, binaryop, false, A, B) ;
 
     //--------------------------------------------------------------------------
     // get the kernel function pointer, loading or compiling it if needed
@@ -21,6 +21,7 @@ uint64_t GB_encodify_ewise      // encode an ewise problem
     const bool is_eWiseMult,    // if true, method is emult
     const bool C_iso,
     const bool C_in_iso,
+    const bool C_in_place,
     const int C_sparsity,
     const GrB_Type ctype,
     const GrB_Matrix M,
@@ -55,8 +56,8 @@ uint64_t GB_encodify_ewise      // encode an ewise problem
 
     encoding->kcode = kcode ;
     GB_enumify_ewise (&encoding->code, is_eWiseMult, is_eWiseUnion,
-        can_copy_to_C, C_iso, C_in_iso, C_sparsity, ctype, M, Mask_struct,
-        Mask_comp, binaryop, flipxy, A, B) ;
+        can_copy_to_C, C_iso, C_in_iso, C_in_place, C_sparsity, ctype, M,
+        Mask_struct, Mask_comp, binaryop, flipxy, A, B) ;
 
     //--------------------------------------------------------------------------
     // determine the suffix and its length
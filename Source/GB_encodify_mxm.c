@@ -20,6 +20,7 @@ uint64_t GB_encodify_mxm        // encode a GrB_mxm problem
     const GB_jit_kcode kcode,   // kernel to encode
     const bool C_iso,
     const bool C_in_iso,
+    const bool C_in_place,
     const int C_sparsity,
     const GrB_Type ctype,
     const GrB_Matrix M,
@@ -49,8 +50,8 @@ uint64_t GB_encodify_mxm        // encode a GrB_mxm problem
     //--------------------------------------------------------------------------
 
     encoding->kcode = kcode ;
-    GB_enumify_mxm (&encoding->code, C_iso, C_in_iso, C_sparsity, ctype,
-        M, Mask_struct, Mask_comp, semiring, flipxy, A, B) ;
+    GB_enumify_mxm (&encoding->code, C_iso, C_in_iso, C_in_place, C_sparsity,
+        ctype, M, Mask_struct, Mask_comp, semiring, flipxy, A, B) ;
 
     //--------------------------------------------------------------------------
     // determine the suffix and its length
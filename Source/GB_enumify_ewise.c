@@ -16,6 +16,8 @@
 
 // accum is not present.  Kernels that use it would require accum to be
 // the same as the binary operator (but this may change in the future).
+// If C_in_place is true, C<M> += T is computed in place, where the accum
+// operator is the same as the binary operator (GB_emult_bitmap_accum).
 
 void GB_enumify_ewise       // enumerate a GrB_eWise problem
 (
@@ -28,6 +30,7 @@ void GB_enumify_ewise       // enumerate a GrB_eWise problem
     // C matrix:
     bool C_iso,             // if true, C is iso on output
     bool C_in_iso,          // if true, C is iso on input
+    bool C_in_place,        // if true, C<M>+=T is computed in place
     int C_sparsity,         // sparse, hyper, bitmap, or full
     GrB_Type ctype,         // C=((ctype) T) is the final typecast
     // M matrix:
@@ -145,6 +148,7 @@ void GB_enumify_ewise       // enumerate a GrB_eWise problem
     int is_union  = (is_eWiseUnion) ? 1 : 0 ;
     int is_emult  = (is_eWiseMult ) ? 1 : 0 ;
     int copy_to_C = (can_copy_to_C) ? 1 : 0 ;
+    int in_place  = (C_in_place   ) ? 1 : 0 ;
 
     //--------------------------------------------------------------------------
     // enumify the types
@@ -188,11 +192,12 @@ void GB_enumify_ewise       // enumerate a GrB_eWise problem
     // construct the ewise scode
     //--------------------------------------------------------------------------
 
-    // total scode bits: 51 (13 hex digits)
+    // total scode bits: 52 (13 hex digits)
 
     (*scode) =
                                                // range        bits
-                // method (3 bits) (1 hex digit, 0 to 7)
+                // method (4 bits) (1 hex digit, 0 to 15)
+                GB_LSHIFT (in_place   , 51) |  // 0 or 1       1
                 GB_LSHIFT (is_emult   , 50) |  // 0 or 1       1
                 GB_LSHIFT (is_union   , 49) |  // 0 or 1       1
                 GB_LSHIFT (copy_to_C  , 48) |  // 0 or 1       1
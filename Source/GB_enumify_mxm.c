@@ -18,7 +18,9 @@
 // ...
 
 // accum is not present.  Kernels that use it would require accum to be
-// the same as the monoid binary operator.
+// the same as the monoid binary operator.  If C_in_place is true, C += A*B
+// is computed in place for a bitmap C with no mask, where the accum is the
+// same as the monoid (see GB_AxB_bitmap_in_place_control).
 
 void GB_enumify_mxm         // enumerate a GrB_mxm problem
 (
@@ -28,6 +30,7 @@ void GB_enumify_mxm         // enumerate a GrB_mxm problem
     // C matrix:
     bool C_iso,             // C output iso: if true, semiring is ANY_PAIR_BOOL
     bool C_in_iso,          // C input iso status
+    bool C_in_place,        // if true, C+=A*B is computed in place
     int C_sparsity,         // sparse, hyper, bitmap, or full
     GrB_Type ctype,         // C=((ctype) T) is the final typecast
     // M matrix:
@@ -154,6 +157,7 @@ void GB_enumify_mxm         // enumerate a GrB_mxm problem
     int A_iso_code = (A_is_pattern || A->iso) ? 1 : 0 ;
     int B_iso_code = (B_is_pattern || B->iso) ? 1 : 0 ;
     int C_in_iso_cd = (C_in_iso) ? 1 : 0 ;
+    int in_place = (C_in_place) ? 1 : 0 ;
 
     //--------------------------------------------------------------------------
     // enumify the mask
@@ -181,12 +185,12 @@ void GB_enumify_mxm         // enumerate a GrB_mxm problem
     // construct the semiring scode
     //--------------------------------------------------------------------------
 
-    // total scode bits: 63 (16 hex digits)
+    // total scode bits: 64 (16 hex digits)
 
     (*scode) =
                                                // range        bits
                 // monoid (4 hex digits)
-//              GB_LSHIFT (0          , 63) |  // unused       1
+                GB_LSHIFT (in_place   , 63) |  // 0 or 1       1
                 GB_LSHIFT (add_ecode  , 58) |  // 0 to 22      5
                 GB_LSHIFT (id_ecode   , 53) |  // 0 to 31      5
                 GB_LSHIFT (term_ecode , 48) |  // 0 to 31      5
@@ -25,6 +25,7 @@
 #include "GB_transpose.h"
 #include "GB_accum_mask.h"
 #include "GB_binop.h"
+#include "GB_tuner.h"
 
 GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
 (
@@ -349,6 +350,36 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
         }
     }
 
+    if (!eWiseAdd                           // eWiseMult only
+        && GB_IS_BITMAP (C)                 // C is bitmap
+        && !C->iso                          // C is not iso
+        && accum == op && !C_replace        // accum is same as the op
+        && (GB_IS_BITMAP (A1) || GB_IS_FULL (A1))   // A is bitmap/full
+        && (GB_IS_BITMAP (B1) || GB_IS_FULL (B1))   // B is bitmap/full
+        && !(A1->iso && B1->iso)            // A and B are not both iso
+        && (M1 == NULL || Mask_comp ||      // M is not present, complemented,
+            GB_IS_BITMAP (M1) || GB_IS_FULL (M1))   // or bitmap/full
+        && (C->is_csc == T_is_csc)          // no transpose of C
+        && no_typecast                      // no typecasting
+        && op->xtype == op->ztype           // C can be used as the x input
+        && op->ytype == op->ztype           // C can be used as the y input
+        && !op_is_positional                // op is not positional
+        && !any_pending_work)               // no matrix has pending work
+    {
+
+        //----------------------------------------------------------------------
+        // C<#M> += A.*B where C is bitmap, computed in place
+        //----------------------------------------------------------------------
+
+        info = GB_emult_bitmap_accum (C, M1, Mask_struct, Mask_comp, A1, B1,
+            op, Werk) ;
+        if (info != GrB_NO_VALUE)
+        { 
+            GB_FREE_ALL ;
+            return ((info == GrB_SUCCESS) ? GB_conform (C, Werk) : info) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // T = A+B or A.*B, or with any mask M
     //--------------------------------------------------------------------------
@@ -374,9 +405,13 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
         // the final C and the mask is no longer needed.  In this case, it
         // could be faster to exploit the mask duing GB_add.
 
-        GB_OK (GB_add (T, T_type, T_is_csc, M1, Mask_struct, Mask_comp,
+        GB_tuner_state tune ;
+        GB_tuner_begin (&tune, GB_TUNER_ADD, A1, B1) ;
+        info = GB_add (T, T_type, T_is_csc, M1, Mask_struct, Mask_comp,
             &mask_applied, A1, B1, is_eWiseUnion, alpha, beta, op, false,
-            Werk)) ;
+            Werk) ;
+        GB_tuner_end (&tune, info) ;
+        GB_OK (info) ;
 
     }
     else
@@ -393,8 +428,12 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
         // starts as a shallow copy of A1->h, B1->h, or M1->h, but it may be
         // pruned by GB_hypermatrix_prune, and thus no longer shallow.
 
-        GB_OK (GB_emult (T, T_type, T_is_csc, M1, Mask_struct, Mask_comp,
-            &mask_applied, A1, B1, op, Werk)) ;
+        GB_tuner_state tune ;
+        GB_tuner_begin (&tune, GB_TUNER_EMULT, A1, B1) ;
+        info = GB_emult (T, T_type, T_is_csc, M1, Mask_struct, Mask_comp,
+            &mask_applied, A1, B1, op, Werk) ;
+        GB_tuner_end (&tune, info) ;
+        GB_OK (info) ;
 
         //----------------------------------------------------------------------
         // transplant shallow content from AT, BT, or MT
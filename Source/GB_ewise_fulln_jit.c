@@ -32,7 +32,7 @@ GrB_Info GB_ewise_fulln_jit  // C=A+B via the JIT
     char *suffix ;
     uint64_t hash = GB_encodify_ewise (&encoding, &suffix,
         GB_JIT_KERNEL_EWISEFN, false,
-        false, false, GxB_FULL, C->type, NULL, false, false,
+        false, false, false, GxB_FULL, C->type, NULL, false, false,
         binaryop, false, A, B) ;
 
     //--------------------------------------------------------------------------
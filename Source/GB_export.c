@@ -111,6 +111,12 @@ GrB_Info GB_export      // export/unpack a matrix in any format
         default: ;
     }
 
+    //--------------------------------------------------------------------------
+    // ensure A owns its content, if it is attached to a shared-memory file
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_shm_unshare (*A)) ;
+
     //--------------------------------------------------------------------------
     // allocate new space for Ap and Ah if unpacking
     //--------------------------------------------------------------------------
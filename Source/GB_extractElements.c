@@ -0,0 +1,262 @@
+//------------------------------------------------------------------------------
+// GB_extractElements: extract a batch of entries, X(k) = A(I(k),J(k))
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// For each k in the range 0 to n-1, the entry A(I[k],J[k]) is found.  If
+// present, found [k] is set true and the entry is typecasted into X [k].  If
+// not present, found [k] is set false and X [k] is not modified.  Either X or
+// found may be NULL, in which case that output is not computed.  This function
+// does the work for GxB_Matrix_extractElements_* and
+// GxB_Matrix_isStoredElements.
+
+// The checks, the wait for any pending work, and the construction of the
+// hyper_hash are done just once for the whole batch.  The queries are then
+// split into contiguous slices, one per task, so each task does its queries in
+// the order given.  A run of consecutive queries for the same vector A(:,j)
+// shares a single lookup of that vector, so a caller that groups its queries
+// by vector avoids all but the first lookup of each group.
+
+#include "GB.h"
+#include "GB_extractTuples.h"
+
+#define GB_FREE_ALL ;
+
+//------------------------------------------------------------------------------
+// GB_branchless_search: find i in Ai [pleft...pright-1]
+//------------------------------------------------------------------------------
+
+// The search is a binary search with no data-dependent branches: the loop
+// always takes ceil(log2(pright-pleft)) steps, and each step is a conditional
+// move.  On return, Ai [p] == i if found, where p is the position returned.
+
+static inline int64_t GB_branchless_search
+(
+    const int64_t i,                // index to find
+    const int64_t *restrict Ai,     // list to search, in ascending order
+    int64_t pleft,                  // search Ai [pleft...pright-1]
+    const int64_t pright,
+    bool *found                     // true if found
+)
+{
+    int64_t len = pright - pleft ;
+    if (len <= 0)
+    {
+        // the vector is empty
+        (*found) = false ;
+        return (-1) ;
+    }
+    while (len > 1)
+    {
+        int64_t half = len / 2 ;
+        pleft = (Ai [pleft + half] <= i) ? (pleft + half) : pleft ;
+        len -= half ;
+    }
+    (*found) = (Ai [pleft] == i) ;
+    return (pleft) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_extractElements
+//------------------------------------------------------------------------------
+
+GrB_Info GB_extractElements     // X(k) = A(I(k),J(k)) for k = 0:n-1
+(
+    void *X,                    // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GB_Type_code xcode,   // type of array X
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I_in,      // row indices of the entries to extract
+    const GrB_Index *J_in,      // column indices of the entries to extract
+    const GrB_Index n,          // size of I, J, X, and found
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (I_in != NULL && J_in != NULL) ;
+
+    // delete any lingering zombies, assemble any pending tuples, and unjumble
+    GB_MATRIX_WAIT (A) ;
+    ASSERT_MATRIX_OK (A, "A for extractElements", GB0) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+
+    ASSERT (xcode <= GB_UDT_code) ;
+    const GB_Type_code acode = A->type->code ;
+    const size_t asize = A->type->size ;
+    if (X != NULL && !GB_code_compatible (xcode, acode))
+    {
+        // xcode and A must be compatible
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    if (n == 0 || (X == NULL && found == NULL))
+    {
+        // no work to do
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // handle the CSR/CSC format
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ilist = (const int64_t *)
+        (A->is_csc ? I_in : J_in) ;
+    const int64_t *restrict Jlist = (const int64_t *)
+        (A->is_csc ? J_in : I_in) ;
+    const int64_t avlen = A->vlen ;
+    const int64_t avdim = A->vdim ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // check the indices
+    //--------------------------------------------------------------------------
+
+    // Casting the indices to int64_t maps any index of 2^63 or more to a
+    // negative value, which is also caught here.
+    bool ok = true ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:ok)
+    for (k = 0 ; k < (int64_t) n ; k++)
+    {
+        int64_t i = Ilist [k] ;
+        int64_t j = Jlist [k] ;
+        ok = ok && (i >= 0 && i < avlen && j >= 0 && j < avdim) ;
+    }
+    if (!ok)
+    {
+        // at least one index is out of bounds
+        return (GrB_INVALID_INDEX) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the hyper_hash of A, if needed
+    //--------------------------------------------------------------------------
+
+    // A->Y is constructed only if A has enough vectors (see GB_hyper_hash_need)
+    GB_OK (GB_hyper_hash_build (A, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // get the content of A
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int8_t  *restrict Ab = A->b ;
+    const int64_t *restrict Ai = A->i ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+    const int64_t anvec = A->nvec ;
+    const bool A_iso = A->iso ;
+    const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
+    const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
+
+    const size_t xsize = GB_code_size (xcode, asize) ;
+    GB_void *restrict Xout = (GB_void *) X ;
+    GB_cast_function cast_A_to_X = (X == NULL || xcode == acode) ? NULL :
+        GB_cast_factory (xcode, acode) ;
+
+    //--------------------------------------------------------------------------
+    // extract the entries
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t kfirst, klast ;
+        GB_PARTITION (kfirst, klast, (int64_t) n, tid, nthreads) ;
+        int64_t jlast = -1, pA_start = 0, pA_end = 0 ;
+        for (int64_t k = kfirst ; k < klast ; k++)
+        {
+
+            //------------------------------------------------------------------
+            // find the vector A(:,j), if not already found
+            //------------------------------------------------------------------
+
+            int64_t i = Ilist [k] ;
+            int64_t j = Jlist [k] ;
+            if (j != jlast && Ap != NULL)
+            {
+                if (Ah != NULL)
+                {
+                    // A is hypersparse: look for j in the hyperlist
+                    GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yx, A_hash_bits,
+                        j, &pA_start, &pA_end) ;
+                }
+                else
+                {
+                    // A is sparse
+                    pA_start = Ap [j] ;
+                    pA_end   = Ap [j+1] ;
+                }
+                jlast = j ;
+            }
+
+            //------------------------------------------------------------------
+            // find the entry A(i,j)
+            //------------------------------------------------------------------
+
+            int64_t p ;
+            bool present ;
+            if (Ap != NULL)
+            {
+                // A is sparse or hypersparse; pA_start and pA_end are both
+                // -1 if A(:,j) is not in the hyperlist
+                p = GB_branchless_search (i, Ai, pA_start, pA_end, &present) ;
+            }
+            else
+            {
+                // A is bitmap or full
+                p = i + j * avlen ;
+                present = (Ab == NULL) ? true : (Ab [p] == 1) ;
+            }
+
+            //------------------------------------------------------------------
+            // save the result
+            //------------------------------------------------------------------
+
+            if (found != NULL)
+            {
+                found [k] = present ;
+            }
+            if (present && Xout != NULL)
+            {
+                const GB_void *ax = Ax + (A_iso ? 0 : (p * asize)) ;
+                if (cast_A_to_X == NULL)
+                {
+                    // copy the value from A into X, no typecasting
+                    memcpy (Xout + k * xsize, ax, xsize) ;
+                }
+                else
+                {
+                    // typecast the value from A into X
+                    cast_A_to_X (Xout + k * xsize, ax, asize) ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    return (GrB_SUCCESS) ;
+}
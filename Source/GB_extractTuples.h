@@ -30,5 +30,17 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_extractElements     // X(k) = A(I(k),J(k)) for k = 0:n-1
+(
+    void *X,                    // values of the entries found, or NULL
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GB_Type_code xcode,   // type of array X
+    const GrB_Matrix A,         // matrix to extract the entries from
+    const GrB_Index *I_in,      // row indices of the entries to extract
+    const GrB_Index *J_in,      // column indices of the entries to extract
+    const GrB_Index n,          // size of I, J, X, and found
+    GB_Werk Werk
+) ;
+
 #endif
 
@@ -0,0 +1,132 @@
+//------------------------------------------------------------------------------
+// GB_find_elements: find the position of a batch of entries in a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// For each k in the range 0 to n-1, P [k] is the position of the entry
+// C(Ilist[k],Jlist[k]) in C->i and C->x, or -1 if the entry is not present.
+// Ilist and Jlist are in the CSR/CSC-agnostic form: Ilist [k] is the index of
+// the entry within the vector Jlist [k].  The indices must already be checked.
+
+// If C is sparse or hypersparse, zombies are found as well, so P [k] >= 0 may
+// refer to a zombie.  Pending tuples are not searched.  If C is bitmap or
+// full, P [k] is i+j*C->vlen for all k, whether or not Cb [P [k]] is set.
+
+// C must not be jumbled, and C is not modified.  The # of entries not found
+// is returned.
+
+#include "GB.h"
+#include "GB_Element.h"
+
+int64_t GB_find_elements        // find C(I(k),J(k)), return # not found
+(
+    // output:
+    int64_t *restrict P,        // P [k]: position of C(I(k),J(k)), or -1
+    // input:
+    const GrB_Matrix C,         // matrix to search
+    const int64_t *restrict Ilist,  // indices within each vector
+    const int64_t *restrict Jlist,  // vector indices
+    const int64_t n,            // size of P, Ilist, and Jlist
+    const int nthreads          // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (C != NULL && P != NULL) ;
+    ASSERT (!GB_JUMBLED (C)) ;
+
+    //--------------------------------------------------------------------------
+    // get C
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Cp = C->p ;
+    const int64_t *restrict Ch = C->h ;
+    const int64_t *restrict Ci = C->i ;
+    const int64_t cvlen = C->vlen ;
+    const int64_t cnvec = C->nvec ;
+    const int64_t nzombies = C->nzombies ;
+    const int64_t *restrict C_Yx = (C->Y == NULL) ? NULL : C->Y->x ;
+    const int64_t C_hash_bits = (C->Y == NULL) ? 0 : (C->Y->vdim - 1) ;
+    int64_t k, nmissing = 0 ;
+
+    if (Cp == NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // C is bitmap or full
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            P [k] = Ilist [k] + Jlist [k] * cvlen ;
+        }
+
+    }
+    else if (C->nvals == 0 && nzombies == 0)
+    {
+
+        //----------------------------------------------------------------------
+        // C is sparse or hypersparse, and empty
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            P [k] = -1 ;
+        }
+        nmissing = n ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // C is sparse or hypersparse
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:nmissing)
+        for (k = 0 ; k < n ; k++)
+        {
+            int64_t i = Ilist [k] ;
+            int64_t j = Jlist [k] ;
+            int64_t pC_start, pC_end ;
+            bool found = true ;
+            if (Ch != NULL)
+            {
+                // C is hypersparse: look for j in the hyperlist
+                found = (GB_hyper_hash_lookup (Ch, cnvec, Cp, C_Yx,
+                    C_hash_bits, j, &pC_start, &pC_end) >= 0) ;
+            }
+            else
+            {
+                // C is sparse
+                pC_start = Cp [j] ;
+                pC_end   = Cp [j+1] ;
+            }
+            int64_t pleft = pC_start ;
+            if (found)
+            {
+                // binary search for C(i,j) in C(:,j), which may have zombies
+                int64_t pright = pC_end - 1 ;
+                bool is_zombie ;
+                GB_BINARY_SEARCH_ZOMBIE (i, Ci, pleft, pright, found,
+                    nzombies, is_zombie) ;
+            }
+            P [k] = found ? pleft : -1 ;
+            nmissing += (!found) ;
+        }
+    }
+
+    return (nmissing) ;
+}
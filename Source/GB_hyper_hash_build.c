@@ -9,27 +9,27 @@
 
 // JIT: not needed.  Only one variant possible.
 
-#define GB_FREE_WORKSPACE               \
-{                                       \
-    GB_FREE (&I_work, I_work_size) ;    \
-    GB_FREE (&J_work, J_work_size) ;    \
-    GB_FREE (&X_work, X_work_size) ;    \
-}
+// The A->Y hyper_hash is an open-addressing hash table, held as a full matrix
+// (see GB_matrix.h and GB_hyper_hash_lookup.h).  The table is constructed in
+// parallel: each vector k of A is inserted into the first empty slot found by
+// probing the groups of the table, starting at the group GB_HASHF2 (Ah [k]).
+// An empty slot is claimed with an atomic compare-and-exchange, so the slot
+// that holds a given vector can differ from one build to the next, but the
+// result of each lookup does not.
 
 #define GB_FREE_ALL                     \
 {                                       \
-    GB_FREE_WORKSPACE ;                 \
-    GB_phybix_free (A) ;                \
+    GB_Matrix_free (&(A->Y)) ;          \
 }
 
-#include "GB_build.h"
+#include "GB.h"
 
 GrB_Info GB_hyper_hash_build    // construct A->Y if not already constructed
 (
     GrB_Matrix A,
     GB_Werk Werk
 )
-{ 
+{
 
     //--------------------------------------------------------------------------
     // check inputs
@@ -44,10 +44,6 @@ GrB_Info GB_hyper_hash_build    // construct A->Y if not already constructed
     }
 
     GrB_Info info ;
-    int64_t *restrict I_work = NULL ; size_t I_work_size = 0 ;
-    int64_t *restrict J_work = NULL ; size_t J_work_size = 0 ;
-    uint64_t *restrict X_work = NULL ; size_t X_work_size = 0 ;
-
     ASSERT_MATRIX_OK (A, "A for hyper_hash", GB0) ;
     GB_BURBLE_MATRIX (A, "(build hyper hash) ") ;
 
@@ -55,110 +51,97 @@ GrB_Info GB_hyper_hash_build    // construct A->Y if not already constructed
     // allocate A->Y
     //--------------------------------------------------------------------------
 
-    // A->Y is (A->vdim)-by-(hash table size for A->h), with one vector per
-    // hash bucket.
+    // A->Y is (2*GB_HYPER_HASH_GROUP)-by-(# of groups), with one vector per
+    // group of the hash table.  The # of groups is a power of 2, and the load
+    // factor of the table is at most 3/4, so the table always has at least
+    // one empty slot.
 
     const int64_t *restrict Ah = A->h ;
     int64_t anvec = A->nvec ;
-    // this ensures a load factor of 0.5 to 1:
-    int64_t yvdim = ((uint64_t) 1) << (GB_FLOOR_LOG2 (anvec) + 1) ;
-    // divide by 4 to get a load factor of 2 to 4:
-    yvdim = yvdim / 4 ;
-    yvdim = GB_IMAX (yvdim, 4) ;
-    int64_t yvlen = A->vdim ;
+    int64_t nslots = anvec + anvec / 3 + 1 ;
+    int64_t ngroups = GB_ICEIL (nslots, GB_HYPER_HASH_GROUP) ;
+    int64_t yvdim = 1 ;
+    while (yvdim < ngroups)
+    {
+        yvdim = 2 * yvdim ;
+    }
+    int64_t yvlen = 2 * GB_HYPER_HASH_GROUP ;
     int64_t hash_bits = (yvdim - 1) ;   // yvdim is always a power of 2
 
-    GB_OK (GB_new (&(A->Y), // new dynamic header, do not allocate any content
-        GrB_UINT64, yvlen, yvdim, GB_Ap_null, true, GxB_SPARSE,
-        -1, 0)) ;
+    GB_OK (GB_new_bix (&(A->Y), // new dynamic header, full
+        GrB_UINT64, yvlen, yvdim, GB_Ap_null, true, GxB_FULL, false,
+        -1, -1, yvlen * yvdim, true, false)) ;
     GrB_Matrix Y = A->Y ;
+    Y->sparsity_control = GxB_FULL ;    // Y is always full CSC
+    Y->magic = GB_MAGIC ;
+    int64_t *restrict Yx = (int64_t *) Y->x ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
 
     //--------------------------------------------------------------------------
-    // create the tuples for A->Y
+    // clear the table
     //--------------------------------------------------------------------------
 
-    I_work = GB_MALLOC (anvec, int64_t, &I_work_size) ;
-    J_work = GB_MALLOC (anvec, int64_t, &J_work_size) ;
-    X_work = GB_MALLOC (anvec, uint64_t, &X_work_size) ;
-    if (I_work == NULL || J_work == NULL || X_work == NULL)
-    { 
-        // out of memory
-        GB_FREE_ALL ;
-        return (GrB_OUT_OF_MEMORY) ;
+    int64_t ynz = yvlen * yvdim ;
+    int nthreads = GB_nthreads (ynz, chunk, nthreads_max) ;
+    int64_t p ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (p = 0 ; p < ynz ; p++)
+    {
+        Yx [p] = GB_HYPER_HASH_EMPTY ;
     }
 
-    int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
-    int nthreads = GB_nthreads (anvec, chunk, nthreads_max) ;
+    //--------------------------------------------------------------------------
+    // insert each vector of A into the table
+    //--------------------------------------------------------------------------
 
+    nthreads = GB_nthreads (anvec, chunk, nthreads_max) ;
     int64_t k ;
     #pragma omp parallel for num_threads(nthreads) schedule(static)
     for (k = 0 ; k < anvec ; k++)
     {
         int64_t j = Ah [k] ;
-        I_work [k] = j ;
-        J_work [k] = GB_HASHF2 (j, hash_bits) ;     // in range 0 to yvdim-1
-        X_work [k] = (uint64_t) k ;
+        int64_t g = GB_HASHF2 (j, hash_bits) ;
+        bool inserted = false ;
+        while (!inserted)
+        {
+            int64_t *restrict Ykey = Yx + g * (2*GB_HYPER_HASH_GROUP) ;
+            for (int t = 0 ; t < GB_HYPER_HASH_GROUP && !inserted ; t++)
+            {
+                // Try to claim the slot t.  A slot is never released once
+                // claimed, so if j is in group g, all groups probed before g
+                // are full.  This allows GB_hyper_hash_lookup to stop its
+                // search at the first group with an empty slot.
+                while (true)
+                {
+                    int64_t key ;
+                    GB_ATOMIC_READ
+                    key = Ykey [t] ;
+                    if (key != GB_HYPER_HASH_EMPTY)
+                    {
+                        // slot t has been claimed by another vector
+                        break ;
+                    }
+                    if (GB_ATOMIC_COMPARE_EXCHANGE_64 (&(Ykey [t]), key, j))
+                    {
+                        // slot t has been claimed for the vector j = Ah [k]
+                        Ykey [GB_HYPER_HASH_GROUP + t] = k ;
+                        inserted = true ;
+                        break ;
+                    }
+                }
+            }
+            g = (g + 1) & hash_bits ;
+        }
     }
 
-    //--------------------------------------------------------------------------
-    // build A->Y, initially hypersparse
-    //--------------------------------------------------------------------------
-
-    GB_OK (GB_builder (
-        Y,                      // create Y using a dynamic header
-        GrB_UINT64,             // Y->type
-        yvlen,                  // Y->vlen
-        yvdim,                  // Y->vdim
-        true,                   // Y->is_csc
-        (int64_t **) &I_work,   // row indices
-        &I_work_size,
-        (int64_t **) &J_work,   // column indices
-        &J_work_size,
-        (GB_void **) &X_work,   // values
-        &X_work_size,
-        false,                  // tuples need to be sorted
-        true,                   // no duplicates
-        anvec,                  // size of I_work and J_work in # of tuples
-        true,                   // is_matrix: unused
-        NULL, NULL,             // original I,J tuples
-        NULL,                   // no scalar iso value
-        false,                  // Y is never iso
-        anvec,                  // # of tuples
-        NULL,                   // no duplicates, so dup is NUL
-        GrB_UINT64,             // the type of X_work
-        false,                  // no burble (already burbled above)
-        Werk
-    )) ;
-
-    Y->hyper_switch = -1 ;              // never make Y hypersparse
-    Y->sparsity_control = GxB_SPARSE ;  // Y is always sparse CSC
-    ASSERT (GB_IS_HYPERSPARSE (Y)) ;    // Y is currently hypersparse
-
-    // workspace has been freed by GB_builder, or transplanted in to Y
-    ASSERT (I_work == NULL) ;
-    ASSERT (J_work == NULL) ;
-    ASSERT (X_work == NULL) ;
-
-    //--------------------------------------------------------------------------
-    // convert A->Y to sparse
-    //--------------------------------------------------------------------------
-
-    // GB_builder always constructs its matrix as hypersparse.  Y is now
-    // conformed to its required sparsity format: always sparse.  No burble;
-    // (already burbled above).
-
-    GB_OK (GB_convert_hyper_to_sparse (Y, false)) ;
-    ASSERT (anvec == GB_nnz (Y)) ;
-    ASSERT (GB_IS_SPARSE (Y)) ;         // Y is now sparse and will remain so
-
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
 
     ASSERT_MATRIX_OK (A, "A from hyper_hash", GB0) ;
-    ASSERT (!GB_ZOMBIES (Y)) ;
-    ASSERT (!GB_JUMBLED (Y)) ;
+    ASSERT (GB_IS_FULL (Y)) ;
     ASSERT (!GB_PENDING (Y)) ;
     return (GrB_SUCCESS) ;
 }
@@ -55,6 +55,14 @@ GrB_Matrix GB_hyper_shallow         // return C
     C->Y = NULL ;
     C->Y_shallow = false ;
 
+    // remove the cached transpose
+    C->T = NULL ;
+    C->T_cache = false ;
+
+    // the shared-memory mapping, if any, remains owned by A
+    C->shm = NULL ;
+    C->shm_size = 0 ;
+
     // flag all content of C as shallow
     C->p_shallow = true ;
     C->i_shallow = true ;
@@ -198,10 +198,17 @@ GrB_Info GB_import      // import/pack a matrix in any format
     // allocate/reuse the header of the matrix
     //--------------------------------------------------------------------------
 
+    bool T_cache = false ;
     if (packing)
     { 
-        // clear the content and reuse the header
+        // clear the content and reuse the header.  If A is attached to a
+        // shared-memory file (see GxB_Matrix_attach), its shallow content
+        // has just been discarded, so the mapping is removed as well, as
+        // GB_export does with GB_shm_unshare.  No copy of the content is
+        // needed.
+        T_cache = (*A)->T_cache ;
         GB_phybix_free (*A) ;
+        GB_shm_free (*A) ;
         ASSERT (!((*A)->static_header)) ;
     }
 
@@ -218,6 +225,10 @@ GrB_Info GB_import      // import/pack a matrix in any format
     // A never has a static header
     ASSERT (!((*A)->static_header)) ;
 
+    // GxB_TRANSPOSE_CACHE is kept if A is packed; its A->T was freed above,
+    // and is built again for the new content of A when next needed
+    (*A)->T_cache = T_cache ;
+
     //--------------------------------------------------------------------------
     // import the matrix
     //--------------------------------------------------------------------------
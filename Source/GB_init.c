@@ -131,6 +131,8 @@ GrB_Info GB_init            // start up GraphBLAS
     GB_Context_nthreads_max_set (NULL, GB_omp_get_max_threads ( )) ;
     GB_Context_chunk_set        (NULL, GB_CHUNK_DEFAULT) ;
     GB_Context_gpu_id_set       (NULL, -1) ;
+    GB_Context_numa_policy_set  (NULL, GxB_NUMA_DEFAULT) ;
+    GB_Context_defer_set        (NULL, false) ;
 
     //--------------------------------------------------------------------------
     // initialize the blocking/nonblocking mode
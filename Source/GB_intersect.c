@@ -0,0 +1,325 @@
+//------------------------------------------------------------------------------
+// GB_intersect: intersect two sorted lists of indices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_intersect_count and GB_intersect_chunk find the intersection of the
+// patterns of two sparse vectors, A(:,i) and B(:,j), for the dot product
+// methods (Template/GB_AxB_dot_cij.c) when both vectors are sparse.
+// GB_intersect_count returns the size of the intersection, for the PLUS_PAIR
+// semirings.  GB_intersect_chunk returns the positions of the next matching
+// entries, up to nmax of them, so that the caller can compute their
+// products; it is called repeatedly until one list is exhausted, or until the
+// caller can terminate early.
+
+// If the two lists have very different lengths, the entries of the shorter
+// list are found in the longer one by galloping (exponential search followed
+// by binary search).  Otherwise, the lists are compared in blocks of 4 or 8
+// entries each, with AVX2 or AVX512F if the CPU supports it.
+
+// These functions are called by the factory and generic kernels directly, and
+// by the JIT kernels via the GB_callback struct.
+
+#include "GB.h"
+#include "GB_binary_search.h"
+
+// use galloping if one list is this many times longer than the other
+#define GB_GALLOP_RATIO 16
+
+//------------------------------------------------------------------------------
+// GB_intersect_merge_count: count the entries in both lists, one at a time
+//------------------------------------------------------------------------------
+
+static inline int64_t GB_intersect_merge_count
+(
+    const int64_t *restrict Ai,
+    const int64_t anz,
+    const int64_t *restrict Bi,
+    const int64_t bnz
+)
+{
+    int64_t pa = 0, pb = 0, n = 0 ;
+    while (pa < anz && pb < bnz)
+    {
+        const int64_t ia = Ai [pa] ;
+        const int64_t ib = Bi [pb] ;
+        n  += (ia == ib) ;
+        pa += (ia <= ib) ;
+        pb += (ib <= ia) ;
+    }
+    return (n) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_intersect_merge_chunk: find the next matches, one entry at a time
+//------------------------------------------------------------------------------
+
+static inline int64_t GB_intersect_merge_chunk
+(
+    int64_t *restrict Pa,
+    int64_t *restrict Pb,
+    int64_t *pA,
+    int64_t *pB,
+    const int64_t *restrict Ai,
+    const int64_t pA_end,
+    const int64_t *restrict Bi,
+    const int64_t pB_end,
+    const int64_t nmax
+)
+{
+    int64_t pa = (*pA), pb = (*pB), n = 0 ;
+    while (pa < pA_end && pb < pB_end && n < nmax)
+    {
+        const int64_t ia = Ai [pa] ;
+        const int64_t ib = Bi [pb] ;
+        if (ia == ib)
+        {
+            Pa [n] = pa ;
+            Pb [n] = pb ;
+            n++ ;
+        }
+        pa += (ia <= ib) ;
+        pb += (ib <= ia) ;
+    }
+    (*pA) = pa ;
+    (*pB) = pb ;
+    return (n) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_intersect_gallop: find the first entry X [p] >= i in X [pleft...pend-1]
+//------------------------------------------------------------------------------
+
+// Returns pend if all entries are less than i.
+
+static inline int64_t GB_intersect_gallop
+(
+    const int64_t i,
+    const int64_t *restrict X,
+    int64_t pleft,
+    const int64_t pend
+)
+{
+    if (pleft >= pend || X [pleft] >= i) return (pleft) ;
+    // X [pleft] < i; double the step until X [pleft+step] >= i
+    int64_t step = 1 ;
+    while (pleft + step < pend && X [pleft + step] < i)
+    {
+        pleft += step ;
+        step *= 2 ;
+    }
+    // X [pleft] < i, and the result is in X [pleft+1 ... pright]
+    int64_t pright = GB_IMIN (pleft + step, pend - 1) ;
+    pleft++ ;
+    GB_TRIM_BINARY_SEARCH (i, X, pleft, pright) ;
+    return ((pleft < pend && X [pleft] < i) ? pleft + 1 : pleft) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_intersect_gallop_count: count the entries of a short list in a long one
+//------------------------------------------------------------------------------
+
+static int64_t GB_intersect_gallop_count
+(
+    const int64_t *restrict Si,     // short list
+    const int64_t snz,
+    const int64_t *restrict Li,     // long list
+    const int64_t lnz
+)
+{
+    int64_t pl = 0, n = 0 ;
+    for (int64_t ps = 0 ; ps < snz && pl < lnz ; ps++)
+    {
+        pl = GB_intersect_gallop (Si [ps], Li, pl, lnz) ;
+        n += (pl < lnz && Li [pl] == Si [ps]) ;
+    }
+    return (n) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_intersect_gallop_chunk: find the next matches by galloping
+//------------------------------------------------------------------------------
+
+// If A_is_short is true, Ai is the short list and Bi is the long list.
+// Otherwise, the roles are reversed.
+
+static int64_t GB_intersect_gallop_chunk
+(
+    int64_t *restrict Pa,
+    int64_t *restrict Pb,
+    int64_t *pA,
+    int64_t *pB,
+    const int64_t *restrict Ai,
+    const int64_t pA_end,
+    const int64_t *restrict Bi,
+    const int64_t pB_end,
+    const int64_t nmax,
+    const bool A_is_short
+)
+{
+    int64_t pa = (*pA), pb = (*pB), n = 0 ;
+    if (A_is_short)
+    {
+        while (pa < pA_end && pb < pB_end && n < nmax)
+        {
+            const int64_t ia = Ai [pa] ;
+            pb = GB_intersect_gallop (ia, Bi, pb, pB_end) ;
+            if (pb < pB_end && Bi [pb] == ia)
+            {
+                Pa [n] = pa ;
+                Pb [n] = pb ;
+                n++ ;
+                pb++ ;
+            }
+            pa++ ;
+        }
+    }
+    else
+    {
+        while (pa < pA_end && pb < pB_end && n < nmax)
+        {
+            const int64_t ib = Bi [pb] ;
+            pa = GB_intersect_gallop (ib, Ai, pa, pA_end) ;
+            if (pa < pA_end && Ai [pa] == ib)
+            {
+                Pa [n] = pa ;
+                Pb [n] = pb ;
+                n++ ;
+                pa++ ;
+            }
+            pb++ ;
+        }
+    }
+    (*pA) = pa ;
+    (*pB) = pb ;
+    return (n) ;
+}
+
+//------------------------------------------------------------------------------
+// block methods: with AVX512F, AVX2, or neither
+//------------------------------------------------------------------------------
+
+#if GB_COMPILER_SUPPORTS_AVX512F
+    #define GB_W 8
+    #define GB_INTERSECT_TARGET GB_TARGET_AVX512F
+    #define GB_INTERSECT_COUNT  GB_intersect_count_avx512f
+    #define GB_INTERSECT_CHUNK  GB_intersect_chunk_avx512f
+    #include "GB_intersect_template.c"
+#endif
+
+#if GB_COMPILER_SUPPORTS_AVX2
+    #define GB_W 4
+    #define GB_INTERSECT_TARGET GB_TARGET_AVX2
+    #define GB_INTERSECT_COUNT  GB_intersect_count_avx2
+    #define GB_INTERSECT_CHUNK  GB_intersect_chunk_avx2
+    #include "GB_intersect_template.c"
+#endif
+
+#define GB_W 4
+#define GB_INTERSECT_TARGET
+#define GB_INTERSECT_COUNT  GB_intersect_count_vanilla
+#define GB_INTERSECT_CHUNK  GB_intersect_chunk_vanilla
+#include "GB_intersect_template.c"
+
+//------------------------------------------------------------------------------
+// GB_intersect_count: count the entries in both lists
+//------------------------------------------------------------------------------
+
+GB_CALLBACK_INTERSECT_COUNT_PROTO (GB_intersect_count)
+{
+
+    //--------------------------------------------------------------------------
+    // quick return if the lists do not overlap
+    //--------------------------------------------------------------------------
+
+    if (anz == 0 || bnz == 0 || Ai [anz-1] < Bi [0] || Bi [bnz-1] < Ai [0])
+    {
+        return (0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // gallop if the lists have very different lengths
+    //--------------------------------------------------------------------------
+
+    if (anz > GB_GALLOP_RATIO * bnz)
+    {
+        return (GB_intersect_gallop_count (Bi, bnz, Ai, anz)) ;
+    }
+    else if (bnz > GB_GALLOP_RATIO * anz)
+    {
+        return (GB_intersect_gallop_count (Ai, anz, Bi, bnz)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compare the lists in blocks
+    //--------------------------------------------------------------------------
+
+    #if GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global_cpu_features_avx512f ( ))
+    {
+        return (GB_intersect_count_avx512f (Ai, anz, Bi, bnz)) ;
+    }
+    #endif
+
+    #if GB_COMPILER_SUPPORTS_AVX2
+    if (GB_Global_cpu_features_avx2 ( ))
+    {
+        return (GB_intersect_count_avx2 (Ai, anz, Bi, bnz)) ;
+    }
+    #endif
+
+    return (GB_intersect_count_vanilla (Ai, anz, Bi, bnz)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_intersect_chunk: find the next matches in both lists
+//------------------------------------------------------------------------------
+
+// Returns the number of matches found, which is zero only if either list is
+// exhausted (*pA == pA_end or *pB == pB_end) on output.  nmax must be at
+// least 8.
+
+GB_CALLBACK_INTERSECT_CHUNK_PROTO (GB_intersect_chunk)
+{
+
+    //--------------------------------------------------------------------------
+    // gallop if the lists have very different lengths
+    //--------------------------------------------------------------------------
+
+    ASSERT (nmax >= 8) ;
+    const int64_t anz = pA_end - (*pA) ;
+    const int64_t bnz = pB_end - (*pB) ;
+    if (anz > GB_GALLOP_RATIO * bnz || bnz > GB_GALLOP_RATIO * anz)
+    {
+        return (GB_intersect_gallop_chunk (Pa, Pb, pA, pB, Ai, pA_end,
+            Bi, pB_end, nmax, anz < bnz)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compare the lists in blocks
+    //--------------------------------------------------------------------------
+
+    #if GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global_cpu_features_avx512f ( ))
+    {
+        return (GB_intersect_chunk_avx512f (Pa, Pb, pA, pB, Ai, pA_end,
+            Bi, pB_end, nmax)) ;
+    }
+    #endif
+
+    #if GB_COMPILER_SUPPORTS_AVX2
+    if (GB_Global_cpu_features_avx2 ( ))
+    {
+        return (GB_intersect_chunk_avx2 (Pa, Pb, pA, pB, Ai, pA_end,
+            Bi, pB_end, nmax)) ;
+    }
+    #endif
+
+    return (GB_intersect_chunk_vanilla (Pa, Pb, pA, pB, Ai, pA_end,
+        Bi, pB_end, nmax)) ;
+}
+
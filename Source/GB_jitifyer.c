@@ -13,6 +13,7 @@
 #include "GB_zstd.h"
 #include "GB_JITpackage.h"
 #include "GB_file.h"
+#include "GB_jitifyer_embedded.h"
 
 typedef GB_JIT_KERNEL_USER_OP_PROTO ((*GB_user_op_f)) ;
 typedef GB_JIT_KERNEL_USER_TYPE_PROTO ((*GB_user_type_f)) ;
@@ -51,6 +52,10 @@ static size_t   GB_jit_cache_path_allocated = 0 ;
 static char    *GB_jit_error_log = NULL ;
 static size_t   GB_jit_error_log_allocated = 0 ;
 
+// manifest of all kernels used by this process ("" if not recorded):
+static char    *GB_jit_manifest = NULL ;
+static size_t   GB_jit_manifest_allocated = 0 ;
+
 // name of the C compiler:
 static char    *GB_jit_C_compiler = NULL ;
 static size_t   GB_jit_C_compiler_allocated = 0 ;
@@ -75,6 +80,15 @@ static size_t   GB_jit_C_cmake_libs_allocated = 0 ;
 static char    *GB_jit_C_preface = NULL ;
 static size_t   GB_jit_C_preface_allocated = 0 ;
 
+// library of the embedded C compiler ("" if not used):
+static char    *GB_jit_C_embedded = NULL ;
+static size_t   GB_jit_C_embedded_allocated = 0 ;
+
+// private folder holding the #include files for the embedded compiler, if the
+// cache folder cannot be written (NULL if not yet created):
+static char    *GB_jit_embedded_src = NULL ;
+static size_t   GB_jit_embedded_src_allocated = 0 ;
+
 // temporary workspace for filenames and system commands:
 static char    *GB_jit_temp = NULL ;
 static size_t   GB_jit_temp_allocated = 0 ;
@@ -89,6 +103,26 @@ static size_t   GB_jit_temp_allocated = 0 ;
 
 static GxB_JIT_Control GB_jit_control = GB_JIT_C_CONTROL_INIT ;
 
+// If the cache folder cannot be written but the embedded compiler is
+// available, the JIT is not disabled.  Kernels already in the cache can still
+// be loaded, and new kernels are compiled in memory by the embedded compiler,
+// without the kernel lock files or source files of the cache.
+static bool GB_jit_cache_readonly = false ;
+
+// The bundle is a single library in the JIT cache holding many JIT kernels,
+// created by GB_jitifyer_bundle.  It is loaded by GB_jitifyer_init, and its
+// kernels are treated just like PreJIT kernels.  An unchecked kernel in the
+// hash table with prejit_index k1 is the k1-th PreJIT kernel if k1 is less
+// than GB_jit_prejit_nkernels, or a kernel in the bundle otherwise.
+static int32_t  GB_jit_prejit_nkernels = 0 ;
+static void    *GB_jit_bundle_handle = NULL ;
+static int32_t  GB_jit_bundle_nkernels = 0 ;
+static void   **GB_jit_bundle_queries = NULL ;
+static char   **GB_jit_bundle_names = NULL ;
+
+#define GB_JIT_BUNDLE "GB_jit_bundle"
+#define GB_JIT_INDEX  "GB_jit_index"
+
 //------------------------------------------------------------------------------
 // check_table: check if the hash table is OK
 //------------------------------------------------------------------------------
@@ -200,162 +234,84 @@ static void check_table (void)
 void GB_jitifyer_finalize (void)
 { 
     GB_jitifyer_table_free (true) ;
+    if (GB_jit_bundle_handle != NULL)
+    { 
+        // all kernels from the bundle are now removed from the hash table
+        GB_file_dlclose (GB_jit_bundle_handle) ;
+        GB_jit_bundle_handle = NULL ;
+    }
+    GB_jit_bundle_nkernels = 0 ;
+    GB_jit_bundle_queries = NULL ;
+    GB_jit_bundle_names = NULL ;
     GB_FREE_STUFF (GB_jit_cache_path) ;
     GB_FREE_STUFF (GB_jit_error_log) ;
+    GB_FREE_STUFF (GB_jit_manifest) ;
     GB_FREE_STUFF (GB_jit_C_compiler) ;
     GB_FREE_STUFF (GB_jit_C_flags) ;
     GB_FREE_STUFF (GB_jit_C_link_flags) ;
     GB_FREE_STUFF (GB_jit_C_libraries) ;
     GB_FREE_STUFF (GB_jit_C_cmake_libs) ;
     GB_FREE_STUFF (GB_jit_C_preface) ;
+    GB_FREE_STUFF (GB_jit_C_embedded) ;
+    GB_jitifyer_embedded_close ( ) ;
+    if (GB_jit_embedded_src != NULL)
+    { 
+        GB_jitifyer_embedded_rmdir (GB_jit_embedded_src) ;
+    }
+    GB_FREE_STUFF (GB_jit_embedded_src) ;
+    GB_jit_cache_readonly = false ;
     GB_FREE_STUFF (GB_jit_temp) ;
 }
 
 //------------------------------------------------------------------------------
-// GB_jitifyer_init: initialize the CPU and CUDA JIT folders, flags, etc
+// GB_jitifyer_manifest_append: add a kernel to the manifest
 //------------------------------------------------------------------------------
 
-// Returns GrB_SUCCESS or GrB_OUT_OF_MEMORY.  If any other error occurs (such
-// as being unable to access the cache folder), the JIT is disabled, but
-// GrB_SUCCESS is returned.  This is because GrB_init calls this method, and
-// GraphBLAS can continue without the JIT.
+// If a manifest is being recorded (see GB_jitifyer_set_manifest), the name and
+// hash of each kernel are appended to it when the kernel is first used by this
+// process: when a JIT kernel is loaded or compiled, or when a PreJIT or
+// bundled kernel is checked.  The manifest has the same format as the index of
+// the JIT cache, and can be used as the trace for GB_jitifyer_bundle, or to
+// regenerate the PreJIT kernels (with the "prejit" target in the cmake build).
+// Several processes may record the same manifest, so it is locked while a line
+// is appended.  Any file I/O error is ignored.
 
-GrB_Info GB_jitifyer_init (void)
+static void GB_jitifyer_manifest_append (char *kernel_name, uint64_t hash)
 {
-
-    //--------------------------------------------------------------------------
-    // initialize the JIT control
-    //--------------------------------------------------------------------------
-
-    int control = (int) GB_JIT_C_CONTROL_INIT ;
-    control = GB_IMAX (control, (int) GxB_JIT_OFF) ;
-    #ifndef NJIT
-    // The full JIT is available.
-    control = GB_IMIN (control, (int) GxB_JIT_ON) ;
-    #else
-    // The JIT is restricted; only OFF, PAUSE, and RUN settings can be
-    // used.  No JIT kernels can be loaded or compiled.
-    control = GB_IMIN (control, (int) GxB_JIT_RUN) ;
-    #endif
-    GB_jit_control = (GxB_JIT_Control) control ;
-
-    GB_jitifyer_finalize ( ) ;
-
-    //--------------------------------------------------------------------------
-    // find the GB_jit_cache_path
-    //--------------------------------------------------------------------------
-
-    char *cache_path = getenv ("GRAPHBLAS_CACHE_PATH") ;
-    if (cache_path != NULL)
-    { 
-        // use the environment variable GRAPHBLAS_CACHE_PATH as-is
-        GB_COPY_STUFF (GB_jit_cache_path, cache_path) ;
-    }
-    else
+    if (GB_jit_manifest == NULL || GB_jit_manifest [0] == '\0') return ;
+    FILE *fp = NULL ;
+    int fd = -1 ;
+    if (GB_file_open_and_lock (GB_jit_manifest, &fp, &fd))
     { 
-        // Linux, Mac, Unix: look for HOME
-        char *home = getenv ("HOME") ;
-        char *dot = "." ;
-        if (home == NULL)
-        {
-            // Windows: look for LOCALAPPDATA
-            home = getenv ("LOCALAPPDATA") ;
-            dot = "" ;
-        }
-        if (home != NULL)
-        { 
-            // found home; create the cache path
-            size_t len = strlen (home) + 60 ;
-            GB_MALLOC_STUFF (GB_jit_cache_path, len) ;
-            snprintf (GB_jit_cache_path, GB_jit_cache_path_allocated,
-                "%s/%sSuiteSparse/GrB%d.%d.%d"
-                #if defined ( GBMATLAB ) && defined ( __APPLE__ )
-                "_matlab"
-                #endif
-                , home, dot,
-                GxB_IMPLEMENTATION_MAJOR,
-                GxB_IMPLEMENTATION_MINOR,
-                GxB_IMPLEMENTATION_SUB) ;
-        }
-    }
-
-    if (GB_jit_cache_path == NULL)
-    {
-        // cannot determine the JIT cache.  Disable loading and compiling, but
-        // continue with the rest of the initializations.  The PreJIT could
-        // still be used.
-        GBURBLE ("(jit init: unable to access cache path, jit disabled) ") ;
-        GB_jit_control = GxB_JIT_RUN ;
-        GB_FREE_STUFF (GB_jit_cache_path) ;
-        GB_COPY_STUFF (GB_jit_cache_path, "") ;
-    }
-
-    // replace backslash with forward slash
-    for (char *p = GB_jit_cache_path ; *p != '\0' ; p++)
-    {
-        if ((*p) == '\\') (*p) = '/' ; 
+        fprintf (fp, "%s %016" PRIx64 "\n", kernel_name, hash) ;
+        GB_file_unlock_and_close (&fp, &fd) ;
     }
+}
 
-    //--------------------------------------------------------------------------
-    // initialize the remaining strings
-    //--------------------------------------------------------------------------
-
-    GB_COPY_STUFF (GB_jit_error_log,     "") ;
-    GB_COPY_STUFF (GB_jit_C_compiler,   GB_C_COMPILER) ;
-    GB_COPY_STUFF (GB_jit_C_flags,      GB_C_FLAGS) ;
-    GB_COPY_STUFF (GB_jit_C_link_flags, GB_C_LINK_FLAGS) ;
-    GB_COPY_STUFF (GB_jit_C_libraries,  GB_C_LIBRARIES) ;
-    GB_COPY_STUFF (GB_jit_C_cmake_libs, GB_CMAKE_LIBRARIES) ;
-    GB_COPY_STUFF (GB_jit_C_preface,    "") ;
-    OK (GB_jitifyer_alloc_space ( )) ;
-
-    //--------------------------------------------------------------------------
-    // establish the cache path and src path, and make sure they exist
-    //--------------------------------------------------------------------------
-
-    OK (GB_jitifyer_establish_paths (GrB_SUCCESS)) ;
-
-    //--------------------------------------------------------------------------
-    // remove "-arch arm64" if compiling JIT kernels for MATLAB
-    //--------------------------------------------------------------------------
-
-    // When the x86-based version of gcc-12 is configured to compile the MATLAB
-    // GraphBLAS library on an Apple-Silicon-based Mac, cmake gives it the flag
-    // "-arch arm64".  MATLAB does not support that architecture directly,
-    // using Rosetta 2 instead.  gcc-12 also does not support "-arch arm64", so
-    // it ignores it (which is the right thing to do), but it generates a
-    // warning.  This spurious warning message appears every time a JIT kernel
-    // is compiled while inside MATLAB.  As a result, "-arch arm64" is removed
-    // from the initial C flags, if compiling for MATLAB.
-
-    #ifdef GBMATLAB
-    {
-        #define ARCH_ARM64 "-arch arm64"
-        char *dst = strstr (GB_jit_C_flags, ARCH_ARM64) ;
-        if (dst != NULL)
-        {
-            // found it; now remove it from the C flags
-            char *src = dst + strlen (ARCH_ARM64) ;
-            while (((*dst++) = (*src++))) ;
-        }
-    }
-    #endif
-
-    //--------------------------------------------------------------------------
-    // hash all PreJIT kernels
-    //--------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+// GB_jitifyer_hash_kernels: add a list of PreJIT or bundled kernels to the table
+//------------------------------------------------------------------------------
 
-    void **Kernels = NULL ;
-    void **Queries = NULL ;
-    char **Names = NULL ;
-    int32_t nkernels = 0 ;
-    GB_prejit (&nkernels, &Kernels, &Queries, &Names) ;
+// The kernels are inserted as unchecked kernels with no dl_handle, with
+// prejit_index = offset + k for the kth kernel in the list.  Kernels from the
+// PreJIT have offset zero, and kernels from the bundle in the JIT cache follow
+// them (see GB_jitifyer_bundle_load).  Invalid, stale, and duplicate kernels
+// are ignored.  Returns GrB_SUCCESS or GrB_OUT_OF_MEMORY.
 
+static GrB_Info GB_jitifyer_hash_kernels
+(
+    int32_t nkernels,       // # of kernels in the list
+    void **Kernels,         // function pointers to the kernels
+    void **Queries,         // function pointers to the query kernels
+    char **Names,           // names of the kernels
+    int64_t offset          // prejit_index of the first kernel in the list
+)
+{
     for (int k = 0 ; k < nkernels ; k++)
     {
 
         //----------------------------------------------------------------------
-        // get the name and function pointer of the PreJIT kernel
+        // get the name and function pointer of the kernel
         //----------------------------------------------------------------------
 
         void *dl_function = Kernels [k] ;
@@ -450,11 +406,11 @@ GrB_Info GB_jitifyer_init (void)
             ((int32_t) strlen (suffix)) ;
 
         //----------------------------------------------------------------------
-        // get the hash of this PreJIT kernel
+        // get the hash of this kernel
         //----------------------------------------------------------------------
 
         // Query the kernel for its hash and version number.  The hash is
-        // needed now so the PreJIT kernel can be added to the hash table.
+        // needed now so the kernel can be added to the hash table.
 
         // The type/op definitions and monoid id/term values for user-defined
         // types/ops/ monoids are ignored, because the user-defined objects
@@ -488,10 +444,11 @@ GrB_Info GB_jitifyer_init (void)
         }
 
         //----------------------------------------------------------------------
-        // insert the PreJIT kernel in the hash table
+        // insert the kernel in the hash table
         //----------------------------------------------------------------------
 
-        if (!GB_jitifyer_insert (hash, encoding, suffix, NULL, dl_function, k))
+        if (!GB_jitifyer_insert (hash, encoding, suffix, NULL, dl_function,
+            offset + k, false))
         {
             // PreJIT error: out of memory
             GB_jit_control = GxB_JIT_PAUSE ;
@@ -499,6 +456,279 @@ GrB_Info GB_jitifyer_init (void)
         }
     }
 
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_bundle_load: load the bundle of kernels from the JIT cache
+//------------------------------------------------------------------------------
+
+// If the JIT cache holds a bundle created by GB_jitifyer_bundle, all of its
+// kernels are added to the hash table, so that they can be used without
+// opening a separate lib*.so file for each of them.  The kernels are checked
+// the first time they are used, just like PreJIT kernels.  A missing or
+// invalid bundle is silently ignored.  Returns GrB_SUCCESS or
+// GrB_OUT_OF_MEMORY.
+
+typedef void (*GB_jit_bundle_func)
+(
+    int32_t *nkernels,      // return # of kernels
+    void ***Kernel_handle,  // return list of function pointers to kernels
+    void ***Query_handle,   // return list of function pointers to queries
+    char ***Name_handle     // return list of kernel names
+) ;
+
+static GrB_Info GB_jitifyer_bundle_load (void)
+{
+
+    #ifndef NJIT
+
+    if (GB_jit_control < GxB_JIT_LOAD || strlen (GB_jit_cache_path) == 0)
+    { 
+        // loading of JIT kernels is disabled
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // open the bundle, if it exists
+    //--------------------------------------------------------------------------
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%s%s%s",
+        GB_jit_cache_path, GB_LIB_PREFIX, GB_JIT_BUNDLE, GB_LIB_SUFFIX) ;
+    void *dl_handle = GB_file_dlopen (GB_jit_temp) ;
+    if (dl_handle == NULL)
+    { 
+        // no bundle in the JIT cache
+        return (GrB_SUCCESS) ;
+    }
+
+    GB_jit_bundle_func dl_bundle = (GB_jit_bundle_func)
+        GB_file_dlsym (dl_handle, GB_JIT_BUNDLE) ;
+    if (dl_bundle == NULL)
+    { 
+        // the bundle is invalid; ignore it
+        GB_file_dlclose (dl_handle) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // hash all kernels in the bundle
+    //--------------------------------------------------------------------------
+
+    void **Kernels = NULL ;
+    void **Queries = NULL ;
+    char **Names = NULL ;
+    int32_t nkernels = 0 ;
+    dl_bundle (&nkernels, &Kernels, &Queries, &Names) ;
+    GB_jit_bundle_handle = dl_handle ;
+    GB_jit_bundle_nkernels = nkernels ;
+    GB_jit_bundle_queries = Queries ;
+    GB_jit_bundle_names = Names ;
+    GBURBLE ("(jit: bundle with %d kernels) ", nkernels) ;
+    return (GB_jitifyer_hash_kernels (nkernels, Kernels, Queries, Names,
+        GB_jit_prejit_nkernels)) ;
+
+    #else
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_prejit_query: get the query function of an unchecked kernel
+//------------------------------------------------------------------------------
+
+static GB_jit_query_func GB_jitifyer_prejit_query
+(
+    // output:
+    char **kernel_name,     // name of the kernel
+    // input:
+    int64_t k1              // prejit_index of the kernel
+)
+{
+    if (k1 < GB_jit_prejit_nkernels)
+    { 
+        // the kernel is in the PreJIT
+        void **Kernels = NULL ;
+        void **Queries = NULL ;
+        char **Names = NULL ;
+        int32_t nkernels = 0 ;
+        GB_prejit (&nkernels, &Kernels, &Queries, &Names) ;
+        (*kernel_name) = Names [k1] ;
+        return ((GB_jit_query_func) Queries [k1]) ;
+    }
+    else
+    { 
+        // the kernel is in the bundle
+        k1 -= GB_jit_prejit_nkernels ;
+        ASSERT (k1 < GB_jit_bundle_nkernels) ;
+        (*kernel_name) = GB_jit_bundle_names [k1] ;
+        return ((GB_jit_query_func) GB_jit_bundle_queries [k1]) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_init: initialize the CPU and CUDA JIT folders, flags, etc
+//------------------------------------------------------------------------------
+
+// Returns GrB_SUCCESS or GrB_OUT_OF_MEMORY.  If any other error occurs (such
+// as being unable to access the cache folder), the JIT is disabled, but
+// GrB_SUCCESS is returned.  This is because GrB_init calls this method, and
+// GraphBLAS can continue without the JIT.
+
+GrB_Info GB_jitifyer_init (void)
+{
+
+    //--------------------------------------------------------------------------
+    // initialize the JIT control
+    //--------------------------------------------------------------------------
+
+    int control = (int) GB_JIT_C_CONTROL_INIT ;
+    control = GB_IMAX (control, (int) GxB_JIT_OFF) ;
+    #ifndef NJIT
+    // The full JIT is available.
+    control = GB_IMIN (control, (int) GxB_JIT_ON) ;
+    #else
+    // The JIT is restricted; only OFF, PAUSE, and RUN settings can be
+    // used.  No JIT kernels can be loaded or compiled.
+    control = GB_IMIN (control, (int) GxB_JIT_RUN) ;
+    #endif
+    GB_jit_control = (GxB_JIT_Control) control ;
+
+    GB_jitifyer_finalize ( ) ;
+
+    //--------------------------------------------------------------------------
+    // open the embedded compiler, if requested
+    //--------------------------------------------------------------------------
+
+    char *embedded = getenv ("GRAPHBLAS_JIT_EMBEDDED") ;
+    GrB_Info embedded_info = GB_jitifyer_set_C_embedded_worker
+        ((embedded == NULL) ? "" : embedded) ;
+    if (embedded_info == GrB_OUT_OF_MEMORY) return (embedded_info) ;
+
+    //--------------------------------------------------------------------------
+    // find the GB_jit_cache_path
+    //--------------------------------------------------------------------------
+
+    char *cache_path = getenv ("GRAPHBLAS_CACHE_PATH") ;
+    if (cache_path != NULL)
+    { 
+        // use the environment variable GRAPHBLAS_CACHE_PATH as-is
+        GB_COPY_STUFF (GB_jit_cache_path, cache_path) ;
+    }
+    else
+    { 
+        // Linux, Mac, Unix: look for HOME
+        char *home = getenv ("HOME") ;
+        char *dot = "." ;
+        if (home == NULL)
+        {
+            // Windows: look for LOCALAPPDATA
+            home = getenv ("LOCALAPPDATA") ;
+            dot = "" ;
+        }
+        if (home != NULL)
+        { 
+            // found home; create the cache path
+            size_t len = strlen (home) + 60 ;
+            GB_MALLOC_STUFF (GB_jit_cache_path, len) ;
+            snprintf (GB_jit_cache_path, GB_jit_cache_path_allocated,
+                "%s/%sSuiteSparse/GrB%d.%d.%d"
+                #if defined ( GBMATLAB ) && defined ( __APPLE__ )
+                "_matlab"
+                #endif
+                , home, dot,
+                GxB_IMPLEMENTATION_MAJOR,
+                GxB_IMPLEMENTATION_MINOR,
+                GxB_IMPLEMENTATION_SUB) ;
+        }
+    }
+
+    if (GB_jit_cache_path == NULL)
+    {
+        // cannot determine the JIT cache.  Disable loading and compiling, but
+        // continue with the rest of the initializations.  The PreJIT could
+        // still be used.  If the embedded compiler is available, kernels can
+        // still be compiled in memory (see GB_jitifyer_establish_paths).
+        GBURBLE ("(jit init: unable to access cache path) ") ;
+        if (!GB_jitifyer_embedded_ok ( ))
+        { 
+            GB_jit_control = GxB_JIT_RUN ;
+        }
+        GB_FREE_STUFF (GB_jit_cache_path) ;
+        GB_COPY_STUFF (GB_jit_cache_path, "") ;
+    }
+
+    // replace backslash with forward slash
+    for (char *p = GB_jit_cache_path ; *p != '\0' ; p++)
+    {
+        if ((*p) == '\\') (*p) = '/' ; 
+    }
+
+    //--------------------------------------------------------------------------
+    // initialize the remaining strings
+    //--------------------------------------------------------------------------
+
+    GB_COPY_STUFF (GB_jit_error_log,     "") ;
+    char *manifest = getenv ("GRAPHBLAS_JIT_MANIFEST") ;
+    GB_COPY_STUFF (GB_jit_manifest, (manifest == NULL) ? "" : manifest) ;
+    GB_COPY_STUFF (GB_jit_C_compiler,   GB_C_COMPILER) ;
+    GB_COPY_STUFF (GB_jit_C_flags,      GB_C_FLAGS) ;
+    GB_COPY_STUFF (GB_jit_C_link_flags, GB_C_LINK_FLAGS) ;
+    GB_COPY_STUFF (GB_jit_C_libraries,  GB_C_LIBRARIES) ;
+    GB_COPY_STUFF (GB_jit_C_cmake_libs, GB_CMAKE_LIBRARIES) ;
+    GB_COPY_STUFF (GB_jit_C_preface,    "") ;
+    OK (GB_jitifyer_alloc_space ( )) ;
+
+    //--------------------------------------------------------------------------
+    // establish the cache path and src path, and make sure they exist
+    //--------------------------------------------------------------------------
+
+    OK (GB_jitifyer_establish_paths (GrB_SUCCESS)) ;
+
+    //--------------------------------------------------------------------------
+    // remove "-arch arm64" if compiling JIT kernels for MATLAB
+    //--------------------------------------------------------------------------
+
+    // When the x86-based version of gcc-12 is configured to compile the MATLAB
+    // GraphBLAS library on an Apple-Silicon-based Mac, cmake gives it the flag
+    // "-arch arm64".  MATLAB does not support that architecture directly,
+    // using Rosetta 2 instead.  gcc-12 also does not support "-arch arm64", so
+    // it ignores it (which is the right thing to do), but it generates a
+    // warning.  This spurious warning message appears every time a JIT kernel
+    // is compiled while inside MATLAB.  As a result, "-arch arm64" is removed
+    // from the initial C flags, if compiling for MATLAB.
+
+    #ifdef GBMATLAB
+    {
+        #define ARCH_ARM64 "-arch arm64"
+        char *dst = strstr (GB_jit_C_flags, ARCH_ARM64) ;
+        if (dst != NULL)
+        {
+            // found it; now remove it from the C flags
+            char *src = dst + strlen (ARCH_ARM64) ;
+            while (((*dst++) = (*src++))) ;
+        }
+    }
+    #endif
+
+    //--------------------------------------------------------------------------
+    // hash all PreJIT kernels
+    //--------------------------------------------------------------------------
+
+    void **Kernels = NULL ;
+    void **Queries = NULL ;
+    char **Names = NULL ;
+    int32_t nkernels = 0 ;
+    GB_prejit (&nkernels, &Kernels, &Queries, &Names) ;
+    GB_jit_prejit_nkernels = nkernels ;
+    OK (GB_jitifyer_hash_kernels (nkernels, Kernels, Queries, Names, 0)) ;
+
+    //--------------------------------------------------------------------------
+    // hash all kernels in the bundle in the JIT cache, if present
+    //--------------------------------------------------------------------------
+
+    OK (GB_jitifyer_bundle_load ( )) ;
+
     //--------------------------------------------------------------------------
     // uncompress all the source files into the user source folder
     //--------------------------------------------------------------------------
@@ -536,6 +766,10 @@ bool GB_jitifyer_path_256 (char *folder)
 // If the JIT is disabled at compile time, the directories are not created and
 // GrB_SUCCESS is returned (except if an out of memory condition occurs).
 
+// If the paths cannot be established but the embedded compiler is available,
+// the cache is treated as read-only instead: the JIT is not disabled, and
+// GrB_SUCCESS is returned.
+
 GrB_Info GB_jitifyer_establish_paths (GrB_Info error_condition)
 { 
 
@@ -562,6 +796,17 @@ GrB_Info GB_jitifyer_establish_paths (GrB_Info error_condition)
     // make sure the cache and source paths exist
     //--------------------------------------------------------------------------
 
+    GB_jit_cache_readonly = false ;
+    if (!ok && GB_jitifyer_embedded_ok ( ))
+    { 
+        // The cache cannot be written, but new kernels can still be compiled
+        // in memory by the embedded compiler, and any kernels already in the
+        // cache can still be loaded.
+        GBURBLE ("(jit: cache path is read-only, using embedded compiler) ") ;
+        GB_jit_cache_readonly = true ;
+        return (GrB_SUCCESS) ;
+    }
+
     if (!ok)
     { 
         // JIT is disabled, or cannot determine the JIT cache path.
@@ -573,9 +818,91 @@ GrB_Info GB_jitifyer_establish_paths (GrB_Info error_condition)
         GB_COPY_STUFF (GB_jit_cache_path, "") ;
     }
 
-    return (ok ? GrB_SUCCESS : error_condition) ;
+    return (ok ? GrB_SUCCESS : error_condition) ;
+}
+
+#ifndef NJIT
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_write_JITpackage: uncompress the GraphBLAS source into a folder
+//------------------------------------------------------------------------------
+
+// All files in GB_JITpackage are uncompressed into the src folder of the given
+// folder, which must already exist.  Returns GrB_SUCCESS if successful,
+// GrB_OUT_OF_MEMORY if out of memory, or GrB_NO_VALUE if the files cannot be
+// written.
+
+static GrB_Info GB_jitifyer_write_JITpackage (const char *folder)
+{
+
+    //--------------------------------------------------------------------------
+    // allocate workspace for the largest uncompressed file
+    //--------------------------------------------------------------------------
+
+    size_t dst_size = 0 ;
+    for (int k = 0 ; k < GB_JITpackage_nfiles ; k++)
+    { 
+        size_t uncompressed_size = GB_JITpackage_index [k].uncompressed_size ;
+        dst_size = GB_IMAX (dst_size, uncompressed_size) ;
+    }
+
+    uint8_t *dst ;
+    GB_MALLOC_PERSISTENT (dst, (dst_size+2) * sizeof(uint8_t)) ;
+    if (dst == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // uncompress each file into the src folder
+    //--------------------------------------------------------------------------
+
+    bool ok = true ;
+    for (int k = 0 ; k < GB_JITpackage_nfiles ; k++)
+    { 
+        // uncompress the blob
+        uint8_t *src = GB_JITpackage_index [k].blob ;
+        size_t src_size = GB_JITpackage_index [k].compressed_size ;
+        size_t u = ZSTD_decompress (dst, dst_size, src, src_size) ;
+        if (u != GB_JITpackage_index [k].uncompressed_size)
+        {
+            // JITPackage error: blob is invalid
+            ok = false ;
+            break ;
+        }
+        // construct the filename
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/src/%s",
+            folder, GB_JITpackage_index [k].filename) ;
+        // open the file
+        FILE *fp_src = fopen (GB_jit_temp, "w") ;
+        if (fp_src == NULL)
+        {
+            // JITPackage error: file cannot be created
+            ok = false ;
+            break ;
+        }
+        // write the uncompressed blob to the file
+        size_t nwritten = fwrite (dst, sizeof (uint8_t), u, fp_src) ;
+        fclose (fp_src) ;
+        if (nwritten != u)
+        {
+            // JITPackage error: file is invalid
+            ok = false ;
+            break ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_PERSISTENT (dst) ;
+    return (ok ? GrB_SUCCESS : GrB_NO_VALUE) ;
 }
 
+#endif
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_extract_JITpackage: extract the GraphBLAS source
 //------------------------------------------------------------------------------
@@ -583,12 +910,21 @@ GrB_Info GB_jitifyer_establish_paths (GrB_Info error_condition)
 // Returns GrB_SUCCESS if successful, GrB_OUT_OF_MEMORY if out of memory, or
 // error_condition if the files cannot be written to the cache folder for any
 // reason.  If the JIT is disabled at compile time, this method does nothing.
+// If the cache is read-only, the source is not extracted into the cache; the
+// embedded compiler uses its own private copy instead (see
+// GB_jitifyer_embedded_src_path).
 
 GrB_Info GB_jitifyer_extract_JITpackage (GrB_Info error_condition)
 { 
 
     #ifndef NJIT
 
+    if (GB_jit_cache_readonly)
+    { 
+        // the source cannot be written to the cache
+        return (GrB_SUCCESS) ;
+    }
+
     //--------------------------------------------------------------------------
     // lock the lock/00/src_lock file
     //--------------------------------------------------------------------------
@@ -629,77 +965,24 @@ GrB_Info GB_jitifyer_extract_JITpackage (GrB_Info error_condition)
         }
     }
 
-    //--------------------------------------------------------------------------
-    // allocate workspace for the largest uncompressed file
-    //--------------------------------------------------------------------------
-
-    size_t dst_size = 0 ;
-    for (int k = 0 ; k < GB_JITpackage_nfiles ; k++)
-    { 
-        size_t uncompressed_size = GB_JITpackage_index [k].uncompressed_size ;
-        dst_size = GB_IMAX (dst_size, uncompressed_size) ;
-    }
-
-    uint8_t *dst ;
-    GB_MALLOC_PERSISTENT (dst, (dst_size+2) * sizeof(uint8_t)) ;
-    if (dst == NULL)
-    {
-        // JITPackage error: out of memory; disable the JIT
-        GB_jit_control = GxB_JIT_RUN ;
-        return (GrB_OUT_OF_MEMORY) ;
-    }
-
     //--------------------------------------------------------------------------
     // uncompress each file into the src folder
     //--------------------------------------------------------------------------
 
-    bool ok = true ;
-    for (int k = 0 ; k < GB_JITpackage_nfiles ; k++)
-    { 
-        // uncompress the blob
-        uint8_t *src = GB_JITpackage_index [k].blob ;
-        size_t src_size = GB_JITpackage_index [k].compressed_size ;
-        size_t u = ZSTD_decompress (dst, dst_size, src, src_size) ;
-        if (u != GB_JITpackage_index [k].uncompressed_size)
-        {
-            // JITPackage error: blob is invalid
-            ok = false ;
-            break ;
-        }
-        // construct the filename
-        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/src/%s",
-            GB_jit_cache_path, GB_JITpackage_index [k].filename) ;
-        // open the file
-        FILE *fp_src = fopen (GB_jit_temp, "w") ;
-        if (fp_src == NULL)
-        {
-            // JITPackage error: file cannot be created
-            ok = false ;
-            break ;
-        }
-        // write the uncompressed blob to the file
-        size_t nwritten = fwrite (dst, sizeof (uint8_t), u, fp_src) ;
-        fclose (fp_src) ;
-        if (nwritten != u)
-        {
-            // JITPackage error: file is invalid
-            ok = false ;
-            break ;
-        }
-    }
-
-    //--------------------------------------------------------------------------
-    // free workspace
-    //--------------------------------------------------------------------------
-
-    GB_FREE_PERSISTENT (dst) ;
+    GrB_Info info = GB_jitifyer_write_JITpackage (GB_jit_cache_path) ;
 
     //--------------------------------------------------------------------------
     // unlock and close the lock/GB_src_lock file
     //--------------------------------------------------------------------------
 
     GB_file_unlock_and_close (&fp_lock, &fd_lock) ;
-    if (!ok)
+    if (info == GrB_OUT_OF_MEMORY)
+    { 
+        // JITPackage error: out of memory; disable the JIT
+        GB_jit_control = GxB_JIT_RUN ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    else if (info != GrB_SUCCESS)
     {
         // JITPackage error: disable the JIT
         GBURBLE ("(jit: unable to write to source cache, jit disabled) ") ;
@@ -912,6 +1195,132 @@ GrB_Info GB_jitifyer_set_error_log_worker (const char *new_error_log)
     return (GB_jitifyer_alloc_space ( )) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_manifest: return the current manifest file
+//------------------------------------------------------------------------------
+
+const char *GB_jitifyer_get_manifest (void)
+{ 
+    const char *s ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        s = GB_jit_manifest ;
+    }
+    return (s) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_manifest: set a new manifest file
+//------------------------------------------------------------------------------
+
+// If the new_manifest is NULL or the empty string, no manifest is recorded.
+// Otherwise, each kernel used from this point on is appended to the file (see
+// GB_jitifyer_manifest_append).  The initial manifest is given by the
+// GRAPHBLAS_JIT_MANIFEST environment variable, if present when GrB_init is
+// called, so that a workload can be recorded without modifying it.
+
+GrB_Info GB_jitifyer_set_manifest (const char *new_manifest)
+{ 
+
+    //--------------------------------------------------------------------------
+    // set the manifest file in a critical section
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        info = GB_jitifyer_set_manifest_worker
+            ((new_manifest == NULL) ? "" : new_manifest) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_manifest_worker: set manifest file in a critical section
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jitifyer_set_manifest_worker (const char *new_manifest)
+{ 
+    // free the old manifest file
+    GB_FREE_STUFF (GB_jit_manifest) ;
+    // allocate the new GB_jit_manifest
+    GB_COPY_STUFF (GB_jit_manifest, new_manifest) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_C_embedded: return the library of the embedded compiler
+//------------------------------------------------------------------------------
+
+const char *GB_jitifyer_get_C_embedded (void)
+{ 
+    const char *s ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        s = GB_jit_C_embedded ;
+    }
+    return (s) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_C_embedded: set the library of the embedded compiler
+//------------------------------------------------------------------------------
+
+// If the new_C_embedded is NULL or the empty string, the embedded compiler is
+// disabled, and all kernels compiled with it are freed.  Returns
+// GrB_INVALID_VALUE if the library cannot be opened, or is not an embedded
+// compiler, in which case the embedded compiler is disabled.
+
+GrB_Info GB_jitifyer_set_C_embedded (const char *new_C_embedded)
+{ 
+
+    //--------------------------------------------------------------------------
+    // set the embedded compiler in a critical section
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        info = GB_jitifyer_set_C_embedded_worker
+            ((new_C_embedded == NULL) ? "" : new_C_embedded) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_C_embedded_worker: set embedded compiler in critical section
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jitifyer_set_C_embedded_worker (const char *new_C_embedded)
+{ 
+
+    //--------------------------------------------------------------------------
+    // free all kernels compiled by the current embedded compiler
+    //--------------------------------------------------------------------------
+
+    if (GB_jit_table != NULL)
+    {
+        for (uint64_t k = 0 ; k < GB_jit_table_size ; k++)
+        {
+            GB_jit_entry *e = &(GB_jit_table [k]) ;
+            if (e->dl_function != NULL && e->embedded)
+            { 
+                GB_jitifyer_entry_free (e) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // open the new embedded compiler
+    //--------------------------------------------------------------------------
+
+    bool ok = GB_jitifyer_embedded_open (new_C_embedded) ;
+    GB_FREE_STUFF (GB_jit_C_embedded) ;
+    GB_COPY_STUFF (GB_jit_C_embedded, ok ? new_C_embedded : "") ;
+    return ((ok || new_C_embedded [0] == '\0') ?
+        GrB_SUCCESS : GrB_INVALID_VALUE) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_get_C_compiler: return the current C compiler
 //------------------------------------------------------------------------------
@@ -1519,21 +1928,20 @@ GrB_Info GB_jitifyer_worker
         GB_jit_entry *e = &(GB_jit_table [kk]) ;
         if (k1 >= 0)
         {
-            // unchecked PreJIT kernel; check it now
-            void **Kernels = NULL ;
-            void **Queries = NULL ;
-            char **Names = NULL ;
-            int32_t nkernels = 0 ;
-            GB_prejit (&nkernels, &Kernels, &Queries, &Names) ;
-            GB_jit_query_func dl_query = (GB_jit_query_func) Queries [k1] ;
+            // unchecked PreJIT (or bundled) kernel; check it now
+            char *kernel_name = NULL ;
+            GB_jit_query_func dl_query = GB_jitifyer_prejit_query
+                (&kernel_name, k1) ;
             bool ok = GB_jitifyer_query (dl_query, hash, semiring, monoid, op,
                 type1, type2, type3) ;
             if (ok)
             { 
                 // PreJIT kernel is fine; flag it as checked by flipping
                 // its prejit_index.
-                GBURBLE ("(prejit: ok) ") ;
+                GBURBLE ((k1 < GB_jit_prejit_nkernels) ?
+                    "(prejit: ok) " : "(jit bundle: ok) ") ;
                 e->prejit_index = GB_FLIP (k1) ;
+                GB_jitifyer_manifest_append (kernel_name, hash) ;
                 return (GrB_SUCCESS) ;
             }
             else
@@ -1667,40 +2075,234 @@ GrB_Info GB_jitifyer_worker
     GB_macrofy_name (kernel_name, "GB_jit", kname, scode_digits,
         encoding->code, suffix) ;
 
-    //--------------------------------------------------------------------------
-    // lock the kernel
-    //--------------------------------------------------------------------------
+    //--------------------------------------------------------------------------
+    // lock the kernel
+    //--------------------------------------------------------------------------
+
+    // If the cache is read-only, the kernel is not locked, since the lock
+    // file cannot be created.  No other process can write the kernel to the
+    // cache, and this process compiles it only in memory.
+
+    uint32_t bucket = hash & 0xFF ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+        "%s/lock/%02x/%016" PRIx64 "_lock", GB_jit_cache_path, bucket, hash) ;
+    FILE *fp_klock = NULL ;
+    int fd_klock = -1 ;
+    if (!GB_jit_cache_readonly &&
+        !GB_file_open_and_lock (GB_jit_temp, &fp_klock, &fd_klock))
+    {
+        // JIT error: unable to lock the kernel
+        // disable the JIT to avoid repeated load errors
+        GB_jit_control = GxB_JIT_RUN ;
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // load the kernel, compiling it if needed
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_jitifyer_load_worker (dl_function, kernel_name, family,
+        kname, hash, encoding, suffix, semiring, monoid, op, op1, op2,
+        type1, type2, type3) ;
+
+    //--------------------------------------------------------------------------
+    // unlock the kernel
+    //--------------------------------------------------------------------------
+
+    if (!GB_jit_cache_readonly)
+    { 
+        GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
+    }
+    return (info) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_index_append: add a kernel to the index of the JIT cache
+//------------------------------------------------------------------------------
+
+// The index (GB_jit_index in the lib folder of the JIT cache) lists each
+// kernel compiled into the cache, one per line, with its name and hash.  It
+// is shared by all processes using the same cache, and is locked while a line
+// is appended to it.  It is read by GB_jitifyer_bundle.  Any file I/O error is
+// ignored, since the index is not needed to use the JIT.
+
+static void GB_jitifyer_index_append (char *kernel_name, uint64_t hash)
+{
+    FILE *fp = NULL ;
+    int fd = -1 ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%s",
+        GB_jit_cache_path, GB_JIT_INDEX) ;
+    if (GB_file_open_and_lock (GB_jit_temp, &fp, &fd))
+    { 
+        fprintf (fp, "%s %016" PRIx64 "\n", kernel_name, hash) ;
+        GB_file_unlock_and_close (&fp, &fd) ;
+    }
+}
+
+#ifndef NJIT
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_write_source: write the source of a kernel
+//------------------------------------------------------------------------------
+
+static void GB_jitifyer_write_source
+(
+    FILE *fp,                   // file to write the source to
+    char *kernel_name,          // kernel file name (excluding the path)
+    GB_jit_family family,       // kernel family
+    const char *kname,          // kname for the kernel_name
+    uint64_t hash,              // hash code for the kernel
+    GB_jit_encoding *encoding,  // encoding of the problem
+    // operator and type definitions
+    GrB_Semiring semiring,
+    GrB_Monoid monoid,
+    GB_Operator op,
+    GB_Operator op1,
+    GB_Operator op2,
+    GrB_Type type1,
+    GrB_Type type2,
+    GrB_Type type3
+)
+{ 
+    // create the preface
+    GB_macrofy_preface (fp, kernel_name, GB_jit_C_preface) ;
+    // macrofy the kernel operators, types, and matrix formats
+    GB_macrofy_family (fp, family, encoding->code, semiring,
+        monoid, op, type1, type2, type3) ;
+    // #include the kernel, renaming it for the PreJIT
+    fprintf (fp, "#ifndef GB_JIT_RUNTIME\n"
+                 "#define GB_jit_kernel %s\n"
+                 "#define GB_jit_query  %s_query\n"
+                 "#endif\n"
+                 "#include \"GB_jit_kernel_%s.c\"\n",
+                 kernel_name, kernel_name, kname) ;
+    // macrofy the query function
+    bool builtin = (encoding->suffix_len == 0) ;
+    GB_macrofy_query (fp, builtin, monoid, op1, op2, type1, type2,
+        type3, hash) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_embedded_src_path: find the #include folder for the kernels
+//------------------------------------------------------------------------------
+
+// On output, GB_jit_temp holds the folder with the #include files for the
+// embedded compiler.  This is the src folder of the cache, unless the cache is
+// read-only.  In that case, GB_JITpackage is uncompressed into the src folder
+// of a new folder private to this process, the first time it is needed.
+// Returns GrB_SUCCESS if successful, GrB_OUT_OF_MEMORY if out of memory, or
+// GrB_NO_VALUE if the private folder cannot be created.
+
+static GrB_Info GB_jitifyer_embedded_src_path (void)
+{
+
+    if (GB_jit_cache_readonly && GB_jit_embedded_src == NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // create the private folder in TMPDIR (or /tmp)
+        //----------------------------------------------------------------------
+
+        char *tmp = getenv ("TMPDIR") ;
+        if (tmp == NULL || tmp [0] == '\0') tmp = "/tmp" ;
+        size_t len = strlen (tmp) + 20 ;
+        GB_MALLOC_STUFF (GB_jit_embedded_src, len) ;
+        snprintf (GB_jit_embedded_src, GB_jit_embedded_src_allocated,
+            "%s/GrB_XXXXXX", tmp) ;
+        if (!GB_jitifyer_embedded_mkdtemp (GB_jit_embedded_src))
+        { 
+            GB_FREE_STUFF (GB_jit_embedded_src) ;
+            return (GrB_NO_VALUE) ;
+        }
+
+        //----------------------------------------------------------------------
+        // uncompress the GraphBLAS source into its src folder
+        //----------------------------------------------------------------------
+
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/src",
+            GB_jit_embedded_src) ;
+        GrB_Info info = GB_file_mkdir (GB_jit_temp) ?
+            GB_jitifyer_write_JITpackage (GB_jit_embedded_src) : GrB_NO_VALUE ;
+        if (info != GrB_SUCCESS)
+        { 
+            GB_jitifyer_embedded_rmdir (GB_jit_embedded_src) ;
+            GB_FREE_STUFF (GB_jit_embedded_src) ;
+            return (info) ;
+        }
+    }
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/src",
+        GB_jit_cache_readonly ? GB_jit_embedded_src : GB_jit_cache_path) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_embedded_kernel: compile a kernel with the embedded compiler
+//------------------------------------------------------------------------------
 
-    uint32_t bucket = hash & 0xFF ;
-    snprintf (GB_jit_temp, GB_jit_temp_allocated,
-        "%s/lock/%02x/%016" PRIx64 "_lock", GB_jit_cache_path, bucket, hash) ;
-    FILE *fp_klock = NULL ;
-    int fd_klock = -1 ;
-    if (!GB_file_open_and_lock (GB_jit_temp, &fp_klock, &fd_klock))
-    {
-        // JIT error: unable to lock the kernel
-        // disable the JIT to avoid repeated load errors
-        GB_jit_control = GxB_JIT_RUN ;
-        return (GrB_NO_VALUE) ;
-    }
+// The source of the kernel is created in memory, exactly as it would be
+// written to the c folder of the JIT cache, and compiled in memory.  Returns
+// the state of the embedded compiler holding the kernel, or NULL if the
+// kernel cannot be compiled, in which case the C compiler is used instead.
 
-    //--------------------------------------------------------------------------
-    // load the kernel, compiling it if needed
-    //--------------------------------------------------------------------------
+static void *GB_jitifyer_embedded_kernel
+(
+    // output:
+    void **dl_function,         // pointer to JIT kernel
+    // input:
+    char *kernel_name,          // kernel file name (excluding the path)
+    GB_jit_family family,       // kernel family
+    const char *kname,          // kname for the kernel_name
+    uint64_t hash,              // hash code for the kernel
+    GB_jit_encoding *encoding,  // encoding of the problem
+    // operator and type definitions
+    GrB_Semiring semiring,
+    GrB_Monoid monoid,
+    GB_Operator op,
+    GB_Operator op1,
+    GB_Operator op2,
+    GrB_Type type1,
+    GrB_Type type2,
+    GrB_Type type3
+)
+{
 
-    GrB_Info info = GB_jitifyer_load_worker (dl_function, kernel_name, family,
-        kname, hash, encoding, suffix, semiring, monoid, op, op1, op2,
-        type1, type2, type3) ;
+    (*dl_function) = NULL ;
+    char *source = NULL ;
+    size_t len = 0 ;
+    FILE *fp = GB_jitifyer_embedded_source (&source, &len) ;
+    if (fp == NULL) return (NULL) ;
+    GB_jitifyer_write_source (fp, kernel_name, family, kname, hash, encoding,
+        semiring, monoid, op, op1, op2, type1, type2, type3) ;
+    fclose (fp) ;
 
-    //--------------------------------------------------------------------------
-    // unlock the kernel
-    //--------------------------------------------------------------------------
+    // find the folder with the #include files
+    if (GB_jitifyer_embedded_src_path ( ) != GrB_SUCCESS)
+    { 
+        GBURBLE ("(jit: unable to create source for embedded compiler) ") ;
+        free (source) ;     // allocated by the C library, not GB_MALLOC
+        return (NULL) ;
+    }
 
-    GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
-    return (info) ;
-    #endif
+    // compile the kernel, with the #include files from the src folder
+    void *dl_handle = GB_jitifyer_embedded_compile (dl_function, source,
+        GB_jit_temp, GB_jit_error_log) ;
+    free (source) ;         // allocated by the C library, not GB_MALLOC
+
+    if (dl_handle == NULL)
+    { 
+        GBURBLE ("(jit: embedded compiler error) ") ;
+    }
+    else
+    { 
+        GBURBLE ("(jit: compile in memory) ") ;
+    }
+    return (dl_handle) ;
 }
 
+#endif
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_load_worker: load/compile a kernel
 //------------------------------------------------------------------------------
@@ -1772,7 +2374,9 @@ GrB_Info GB_jitifyer_load_worker
     // create and compile source file, if needed
     //--------------------------------------------------------------------------
 
-    if (dl_handle == NULL)
+    bool compiled = (dl_handle == NULL) ;
+    bool embedded = false ;
+    if (compiled)
     { 
 
         //----------------------------------------------------------------------
@@ -1786,6 +2390,36 @@ GrB_Info GB_jitifyer_load_worker
             return (GrB_NO_VALUE) ;
         }
 
+        //----------------------------------------------------------------------
+        // try the embedded compiler first, if enabled
+        //----------------------------------------------------------------------
+
+        if (GB_jitifyer_embedded_ok ( ))
+        { 
+            // compile the kernel in memory with the embedded compiler
+            dl_handle = GB_jitifyer_embedded_kernel (dl_function, kernel_name,
+                family, kname, hash, encoding, semiring, monoid, op, op1, op2,
+                type1, type2, type3) ;
+            embedded = (dl_handle != NULL) ;
+        }
+
+        //----------------------------------------------------------------------
+        // quick return if the cache is read-only
+        //----------------------------------------------------------------------
+
+        if (!embedded && GB_jit_cache_readonly)
+        { 
+            // The C compiler cannot write the kernel to the cache, so punt to
+            // generic.  The JIT is not disabled, since the embedded compiler
+            // may succeed on other kernels.
+            GBURBLE ("(jit: read-only cache, not compiled) ") ;
+            return (GrB_NO_VALUE) ;
+        }
+    }
+
+    if (compiled && !embedded)
+    {
+
         //----------------------------------------------------------------------
         // create the source, compile it, and load it
         //----------------------------------------------------------------------
@@ -1798,22 +2432,8 @@ GrB_Info GB_jitifyer_load_worker
         FILE *fp = fopen (GB_jit_temp, "w") ;
         if (fp != NULL)
         { 
-            // create the preface
-            GB_macrofy_preface (fp, kernel_name, GB_jit_C_preface) ;
-            // macrofy the kernel operators, types, and matrix formats
-            GB_macrofy_family (fp, family, encoding->code, semiring,
-                monoid, op, type1, type2, type3) ;
-            // #include the kernel, renaming it for the PreJIT
-            fprintf (fp, "#ifndef GB_JIT_RUNTIME\n"
-                         "#define GB_jit_kernel %s\n"
-                         "#define GB_jit_query  %s_query\n"
-                         "#endif\n"
-                         "#include \"GB_jit_kernel_%s.c\"\n",
-                         kernel_name, kernel_name, kname) ;
-            // macrofy the query function
-            bool builtin = (encoding->suffix_len == 0) ;
-            GB_macrofy_query (fp, builtin, monoid, op1, op2, type1, type2,
-                type3, hash) ;
+            GB_jitifyer_write_source (fp, kernel_name, family, kname, hash,
+                encoding, semiring, monoid, op, op1, op2, type1, type2, type3) ;
             fclose (fp) ;
         }
 
@@ -1853,7 +2473,7 @@ GrB_Info GB_jitifyer_load_worker
         }
 
     }
-    else
+    else if (!compiled)
     { 
         GBURBLE ("(jit: load) ") ;
     }
@@ -1862,7 +2482,10 @@ GrB_Info GB_jitifyer_load_worker
     // get the jit_kernel_function pointer
     //--------------------------------------------------------------------------
 
-    (*dl_function) = GB_file_dlsym (dl_handle, "GB_jit_kernel") ;
+    if (!embedded)
+    { 
+        (*dl_function) = GB_file_dlsym (dl_handle, "GB_jit_kernel") ;
+    }
     if ((*dl_function) == NULL)
     {
         // JIT error: dlsym unable to find GB_jit_kernel: punt to generic
@@ -1877,9 +2500,16 @@ GrB_Info GB_jitifyer_load_worker
 
     // insert the new kernel into the hash table
     if (!GB_jitifyer_insert (hash, encoding, suffix, dl_handle, (*dl_function),
-        -1))
+        -1, embedded))
     {
         // JIT error: unable to add kernel to hash table: punt to generic
+        if (embedded)
+        { 
+            GB_jitifyer_embedded_free (dl_handle) ; dl_handle = NULL ;
+            (*dl_function) = NULL ;
+            GB_jit_control = GxB_JIT_PAUSE ;
+            return (GrB_NO_VALUE) ;
+        }
         GB_file_dlclose (dl_handle) ; dl_handle = NULL ;
         // disable the JIT to avoid repeated errors
         GB_jit_control = GxB_JIT_PAUSE ;
@@ -1888,6 +2518,13 @@ GrB_Info GB_jitifyer_load_worker
         return (GrB_NO_VALUE) ;
     }
 
+    if (compiled && !embedded)
+    { 
+        // record the new kernel in the index of the JIT cache
+        GB_jitifyer_index_append (kernel_name, hash) ;
+    }
+    GB_jitifyer_manifest_append (kernel_name, hash) ;
+
     return (GrB_SUCCESS) ;
     #else
     (*dl_function) = NULL ;
@@ -1963,7 +2600,8 @@ bool GB_jitifyer_insert         // return true if successful, false if failure
     void *dl_handle,            // library handle from GB_file_dlopen;
                                 // NULL for PreJIT
     void *dl_function,          // function handle from GB_file_dlsym
-    int32_t prejit_index        // index into PreJIT table; =>0 if unchecked.
+    int32_t prejit_index,       // index into PreJIT table; =>0 if unchecked.
+    bool embedded               // true if compiled by the embedded compiler
 )
 {
 
@@ -2080,6 +2718,7 @@ bool GB_jitifyer_insert         // return true if successful, false if failure
             e->dl_function = dl_function ;
             GB_jit_table_populated++ ;
             e->prejit_index = prejit_index ;        // -1 for JIT kernels
+            e->embedded = (int32_t) embedded ;
             ASSERT_TABLE_OK ;
             return (true) ;
         }
@@ -2096,11 +2735,16 @@ void GB_jitifyer_entry_free (GB_jit_entry *e)
     e->dl_function = NULL ;
     GB_jit_table_populated-- ;
     GB_FREE_PERSISTENT (e->suffix) ;
-    // unload the dl library
-    if (e->dl_handle != NULL)
+    // unload the dl library, or free the embedded compiler state
+    if (e->dl_handle != NULL && e->embedded)
+    { 
+        GB_jitifyer_embedded_free (e->dl_handle) ; e->dl_handle = NULL ;
+    }
+    else if (e->dl_handle != NULL)
     { 
         GB_file_dlclose (e->dl_handle) ; e->dl_handle = NULL ;
     }
+    e->embedded = 0 ;
     ASSERT_TABLE_OK ;
 }
 
@@ -2358,6 +3002,506 @@ void GB_jitifyer_direct_compile (char *kernel_name, uint32_t bucket)
 #endif
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_bundle: create a bundle of kernels in the JIT cache
+//------------------------------------------------------------------------------
+
+// GB_jitifyer_bundle compiles a set of kernels already in the JIT cache into
+// a single library, lib/libGB_jit_bundle.so (on Linux).  The next call to
+// GrB_init loads this library (see GB_jitifyer_bundle_load) and adds all of
+// its kernels to the hash table, so that a process does not need to open a
+// separate lib*.so for each kernel, nor to look them up one at a time on
+// first use.
+
+// The kernels are listed in a trace file, one per line, with the kernel name
+// as the first token and an optional hash (in hex) as the second.  Blank
+// lines and lines starting with '#' are ignored, as are duplicates.  This is
+// the same format as the index of the JIT cache (lib/GB_jit_index), which is
+// used if the trace is NULL or the empty string.  Each kernel must have its
+// source in the c folder of the JIT cache.
+
+// Kernels with user-defined types or operators are not included in the
+// bundle, since the definitions of the user-defined functions and types
+// would conflict if more than one of them appeared in a single library.
+// These continue to be loaded from their individual lib*.so files.
+
+// The bundle is always compiled with the C compiler, flags, and libraries
+// of the JIT, even if cmake is used to compile individual JIT kernels.
+
+// Returns GrB_SUCCESS, GrB_OUT_OF_MEMORY, GrB_INVALID_VALUE if the trace
+// cannot be read, or GrB_NO_VALUE if the JIT cannot compile kernels or if
+// the bundle cannot be created.
+
+GrB_Info GB_jitifyer_bundle (const char *trace)
+{ 
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        info = GB_jitifyer_bundle_worker (trace) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_bundle_proto: shorthand prototype macro for a kernel
+//------------------------------------------------------------------------------
+
+static const char *GB_jitifyer_bundle_proto (const char *kname)
+{
+
+    #define IS(kernel) GB_STRING_MATCH (kname, kernel)
+
+    if      (IS ("add"          )) return ("JIT_ADD ") ;
+    else if (IS ("apply_bind1st")) return ("JIT_AP1 ") ;
+    else if (IS ("apply_bind2nd")) return ("JIT_AP2 ") ;
+    else if (IS ("apply_unop"   )) return ("JIT_AP0 ") ;
+    else if (IS ("AxB_dot2"     )) return ("JIT_DOT2") ;
+    else if (IS ("AxB_dot2n"    )) return ("JIT_DO2N") ;
+    else if (IS ("AxB_dot3"     )) return ("JIT_DOT3") ;
+    else if (IS ("AxB_dot4"     )) return ("JIT_DOT4") ;
+    else if (IS ("AxB_saxbit"   )) return ("JIT_SAXB") ;
+    else if (IS ("AxB_saxpy3"   )) return ("JIT_SAX3") ;
+    else if (IS ("AxB_saxpy4"   )) return ("JIT_SAX4") ;
+    else if (IS ("AxB_saxpy5"   )) return ("JIT_SAX5") ;
+    else if (IS ("build"        )) return ("JIT_BLD ") ;
+    else if (IS ("colscale"     )) return ("JIT_COLS") ;
+    else if (IS ("concat_bitmap")) return ("JIT_CONB") ;
+    else if (IS ("concat_full"  )) return ("JIT_CONF") ;
+    else if (IS ("concat_sparse")) return ("JIT_CONS") ;
+    else if (IS ("convert_s2b"  )) return ("JIT_CS2B") ;
+    else if (IS ("emult_02"     )) return ("JIT_EM2 ") ;
+    else if (IS ("emult_03"     )) return ("JIT_EM3 ") ;
+    else if (IS ("emult_04"     )) return ("JIT_EM4 ") ;
+    else if (IS ("emult_08"     )) return ("JIT_EM8 ") ;
+    else if (IS ("emult_bitmap" )) return ("JIT_EMB ") ;
+    else if (IS ("ewise_fulla"  )) return ("JIT_EWFA") ;
+    else if (IS ("ewise_fulln"  )) return ("JIT_EWFN") ;
+    else if (IS ("reduce"       )) return ("JIT_RED ") ;
+    else if (IS ("rowscale"     )) return ("JIT_ROWS") ;
+    else if (IS ("select_bitmap")) return ("JIT_SELB") ;
+    else if (IS ("select_phase1")) return ("JIT_SEL1") ;
+    else if (IS ("select_phase2")) return ("JIT_SEL2") ;
+    else if (IS ("split_bitmap" )) return ("JIT_SPB ") ;
+    else if (IS ("split_full"   )) return ("JIT_SPF ") ;
+    else if (IS ("split_sparse" )) return ("JIT_SPS ") ;
+    else if (IS ("subassign_05d")) return ("JIT_SUB ") ;
+    else if (IS ("subassign_06d")) return ("JIT_SUB ") ;
+    else if (IS ("subassign_22" )) return ("JIT_SUB ") ;
+    else if (IS ("subassign_23" )) return ("JIT_SUB ") ;
+    else if (IS ("subassign_25" )) return ("JIT_SUB ") ;
+    else if (IS ("trans_bind1st")) return ("JIT_TR1 ") ;
+    else if (IS ("trans_bind2nd")) return ("JIT_TR2 ") ;
+    else if (IS ("trans_unop"   )) return ("JIT_TR0 ") ;
+    else if (IS ("union"        )) return ("JIT_UNI ") ;
+    return (NULL) ;
+
+    #undef IS
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_bundle_worker: create the bundle in a critical section
+//------------------------------------------------------------------------------
+
+#define GB_FREE_BUNDLE_WORK                                 \
+{                                                           \
+    if (fp != NULL) fclose (fp) ;                           \
+    fp = NULL ;                                             \
+    if (fr != NULL) fclose (fr) ;                           \
+    fr = NULL ;                                             \
+    for (int64_t k = 0 ; k < nbundle ; k++)                 \
+    {                                                       \
+        /* remove the compiled kernel */                    \
+        snprintf (GB_jit_temp, GB_jit_temp_allocated,       \
+            "%s/tmp/%s%s", GB_jit_cache_path,               \
+            Bundle + k * (GB_KLEN+1), GB_OBJ_SUFFIX) ;      \
+        remove (GB_jit_temp) ;                              \
+    }                                                       \
+    GB_FREE_PERSISTENT (Bundle) ;                           \
+    GB_FREE_PERSISTENT (command) ;                          \
+}
+
+GrB_Info GB_jitifyer_bundle_worker (const char *trace)
+{
+
+    #ifndef NJIT
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    FILE *fp = NULL, *fr = NULL ;
+    char *Bundle = NULL, *command = NULL ;
+    int64_t nbundle = 0, nmax = 0 ;
+
+    if (trace == NULL || strlen (trace) == 0)
+    { 
+        // use the index of the JIT cache as the trace
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%s",
+            GB_jit_cache_path, GB_JIT_INDEX) ;
+        fr = fopen (GB_jit_temp, "r") ;
+    }
+    else
+    { 
+        fr = fopen (trace, "r") ;
+    }
+    if (fr == NULL)
+    { 
+        // the trace cannot be read
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    if (GB_jit_control < GxB_JIT_ON)
+    { 
+        // the JIT is not permitted to compile new kernels
+        GB_FREE_BUNDLE_WORK ;
+        return (GrB_NO_VALUE) ;
+    }
+
+    char *burble_stdout = GB_Global_burble_get ( ) ? "" : GB_DEV_NULL ;
+    char *err_redirect = (strlen (GB_jit_error_log) > 0) ? " 2>> " : "" ;
+
+    //--------------------------------------------------------------------------
+    // compile each kernel in the trace
+    //--------------------------------------------------------------------------
+
+    char line [GB_KLEN+100] ;
+    while (fgets (line, GB_KLEN+100, fr) != NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // parse the line
+        //----------------------------------------------------------------------
+
+        char *token = strtok (line, " \t\r\n") ;
+        if (token == NULL || token [0] == '#' || strlen (token) > GB_KLEN)
+        { 
+            // blank line, comment, or invalid kernel name
+            continue ;
+        }
+        char kernel_name [GB_KLEN+1] ;
+        strncpy (kernel_name, token, GB_KLEN+1) ;
+        uint64_t hash = 0 ;
+        token = strtok (NULL, " \t\r\n") ;
+        bool has_hash = (token != NULL && sscanf (token, "%" SCNx64, &hash)
+            == 1) ;
+
+        char name [GB_KLEN+1] ;
+        strncpy (name, kernel_name, GB_KLEN+1) ;
+        char *name_space = NULL ;
+        char *kname = NULL ;
+        uint64_t scode = 0 ;
+        char *suffix = NULL ;
+        GrB_Info info = GB_demacrofy_name (name, &name_space, &kname, &scode,
+            &suffix) ;
+        if (info != GrB_SUCCESS || !GB_STRING_MATCH (name_space, "GB_jit")
+            || suffix != NULL || GB_jitifyer_bundle_proto (kname) == NULL)
+        { 
+            // invalid kernel, or kernel with user-defined types or operators
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // skip the kernel if it is a duplicate
+        //----------------------------------------------------------------------
+
+        bool duplicate = false ;
+        for (int64_t k = 0 ; k < nbundle && !duplicate ; k++)
+        { 
+            duplicate = GB_STRING_MATCH (Bundle + k * (GB_KLEN+1),
+                kernel_name) ;
+        }
+        if (duplicate) continue ;
+
+        //----------------------------------------------------------------------
+        // find the source of the kernel
+        //----------------------------------------------------------------------
+
+        bool found = false ;
+        for (int b = 0 ; b < 256 && !found ; b++)
+        {
+            // try the bucket given by the hash first, then all the others
+            uint32_t bucket = has_hash ? ((hash + b) & 0xFF) : b ;
+            snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.c",
+                GB_jit_cache_path, bucket, kernel_name) ;
+            fp = fopen (GB_jit_temp, "r") ;
+            found = (fp != NULL) ;
+            if (found) fclose (fp) ;
+            fp = NULL ;
+        }
+        if (!found)
+        { 
+            GBURBLE ("(jit bundle: %s not found) ", kernel_name) ;
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // compile the kernel, renaming it so it can be bundled with others
+        //----------------------------------------------------------------------
+
+        // GB_jit_temp holds the name of the source file, and is not modified
+        // until the command is constructed.
+        size_t len = 2 * strlen (GB_jit_temp) + 4 * GB_KLEN
+            + strlen (GB_jit_C_compiler) + strlen (GB_jit_C_flags)
+            + strlen (GB_jit_cache_path) * 2 + strlen (GB_OMP_INC)
+            + strlen (GB_jit_error_log) + 200 ;
+        GB_MALLOC_PERSISTENT (command, len) ;
+        if (command == NULL)
+        { 
+            // out of memory
+            GB_FREE_BUNDLE_WORK ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        snprintf (command, len,
+            "%s -DGB_JIT_RUNTIME=1 "        // compiler command
+            "-DGB_jit_kernel=%s "           // kernel name
+            "-DGB_jit_query=%s_query "      // query name
+            "%s "                           // C flags
+            "-I%s/src "                     // include source directory
+            "%s "                           // openmp include directories
+            "-o %s/tmp/%s%s "               // *.o output file
+            "-c %s "                        // *.c input file
+            "%s "                           // burble stdout
+            "%s %s ",                       // error log file
+            GB_jit_C_compiler, kernel_name, kernel_name, GB_jit_C_flags,
+            GB_jit_cache_path, GB_OMP_INC,
+            GB_jit_cache_path, kernel_name, GB_OBJ_SUFFIX,
+            GB_jit_temp, burble_stdout, err_redirect, GB_jit_error_log) ;
+        GBURBLE ("(jit bundle: %s) ", command) ;
+        GB_jitifyer_command (command) ;
+        GB_FREE_PERSISTENT (command) ;
+
+        // make sure the kernel was compiled
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/tmp/%s%s",
+            GB_jit_cache_path, kernel_name, GB_OBJ_SUFFIX) ;
+        fp = fopen (GB_jit_temp, "r") ;
+        if (fp == NULL)
+        { 
+            GBURBLE ("(jit bundle: %s not compiled) ", kernel_name) ;
+            continue ;
+        }
+        fclose (fp) ;
+        fp = NULL ;
+
+        //----------------------------------------------------------------------
+        // add the kernel to the bundle
+        //----------------------------------------------------------------------
+
+        if (nbundle == nmax)
+        {
+            // double the size of the Bundle list
+            int64_t nnew = GB_IMAX (64, 2 * nmax) ;
+            char *Bnew = NULL ;
+            GB_MALLOC_PERSISTENT (Bnew, nnew * (GB_KLEN+1)) ;
+            if (Bnew == NULL)
+            { 
+                // out of memory
+                remove (GB_jit_temp) ;
+                GB_FREE_BUNDLE_WORK ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            if (nbundle > 0)
+            { 
+                memcpy (Bnew, Bundle, nbundle * (GB_KLEN+1)) ;
+            }
+            GB_FREE_PERSISTENT (Bundle) ;
+            Bundle = Bnew ;
+            nmax = nnew ;
+        }
+        strncpy (Bundle + nbundle * (GB_KLEN+1), kernel_name, GB_KLEN+1) ;
+        nbundle++ ;
+    }
+
+    fclose (fr) ;
+    fr = NULL ;
+
+    if (nbundle == 0)
+    { 
+        // no kernels to bundle
+        GBURBLE ("(jit bundle: empty) ") ;
+        GB_FREE_BUNDLE_WORK ;
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // create the source of the bundle, with a list of all its kernels
+    //--------------------------------------------------------------------------
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/tmp/%s.c",
+        GB_jit_cache_path, GB_JIT_BUNDLE) ;
+    fp = fopen (GB_jit_temp, "w") ;
+    if (fp == NULL)
+    { 
+        // unable to create the source of the bundle
+        GB_FREE_BUNDLE_WORK ;
+        return (GrB_NO_VALUE) ;
+    }
+
+    fprintf (fp,
+        "//----------------------------------------------------------------"
+        "--------------\n"
+        "// %s.c: bundle of %" PRId64 " JIT kernels\n"
+        "//----------------------------------------------------------------"
+        "--------------\n"
+        "// SuiteSparse:GraphBLAS v%d.%d.%d, Timothy A. Davis, (c) 2017-2023,\n"
+        "// All Rights Reserved.\n"
+        "// SPDX-License-Identifier: Apache-2.0\n"
+        "// The above copyright and license do not apply to any\n"
+        "// user-defined types and operators defined below.\n"
+        "//----------------------------------------------------------------"
+        "--------------\n\n"
+        "#include \"GB_jit_kernel.h\"\n\n", GB_JIT_BUNDLE, nbundle,
+        GxB_IMPLEMENTATION_MAJOR, GxB_IMPLEMENTATION_MINOR,
+        GxB_IMPLEMENTATION_SUB) ;
+
+    for (int64_t k = 0 ; k < nbundle ; k++)
+    {
+        char *kernel_name = Bundle + k * (GB_KLEN+1) ;
+        char name [GB_KLEN+1] ;
+        strncpy (name, kernel_name, GB_KLEN+1) ;
+        char *name_space = NULL ;
+        char *kname = NULL ;
+        uint64_t scode = 0 ;
+        char *suffix = NULL ;
+        GB_demacrofy_name (name, &name_space, &kname, &scode, &suffix) ;
+        fprintf (fp, "%s (%s)\nJIT_Q    (%s_query)\n",
+            GB_jitifyer_bundle_proto (kname), kernel_name, kernel_name) ;
+    }
+
+    fprintf (fp, "\nstatic void *GB_bundle_kernels [%" PRId64 "] =\n{\n",
+        nbundle) ;
+    for (int64_t k = 0 ; k < nbundle ; k++)
+    { 
+        fprintf (fp, "%s,\n", Bundle + k * (GB_KLEN+1)) ;
+    }
+    fprintf (fp, "} ;\n\nstatic void *GB_bundle_queries [%" PRId64 "] =\n{\n",
+        nbundle) ;
+    for (int64_t k = 0 ; k < nbundle ; k++)
+    { 
+        fprintf (fp, "%s_query,\n", Bundle + k * (GB_KLEN+1)) ;
+    }
+    fprintf (fp, "} ;\n\nstatic char *GB_bundle_names [%" PRId64 "] =\n{\n",
+        nbundle) ;
+    for (int64_t k = 0 ; k < nbundle ; k++)
+    { 
+        fprintf (fp, "\"%s\",\n", Bundle + k * (GB_KLEN+1)) ;
+    }
+    fprintf (fp, "} ;\n\n"
+        "#define GB_JIT_BUNDLE_PROTO(f)    \\\n"
+        "GB_JIT_GLOBAL void f               \\\n"
+        "(                                  \\\n"
+        "    int32_t *nkernels,             \\\n"
+        "    void ***Kernel_handle,         \\\n"
+        "    void ***Query_handle,          \\\n"
+        "    char ***Name_handle            \\\n"
+        ")\n\n"
+        "GB_JIT_BUNDLE_PROTO (%s) ;\n"
+        "GB_JIT_BUNDLE_PROTO (%s)\n"
+        "{\n"
+        "    (*nkernels) = %" PRId64 " ;\n"
+        "    (*Kernel_handle) = GB_bundle_kernels ;\n"
+        "    (*Query_handle) = GB_bundle_queries ;\n"
+        "    (*Name_handle) = GB_bundle_names ;\n"
+        "}\n", GB_JIT_BUNDLE, GB_JIT_BUNDLE, nbundle) ;
+    fclose (fp) ;
+    fp = NULL ;
+
+    //--------------------------------------------------------------------------
+    // compile the bundle and link it with all of its kernels
+    //--------------------------------------------------------------------------
+
+    // The bundle is first linked in the tmp folder, and then moved into the
+    // lib folder, so that other processes never see a partial library.
+
+    size_t len = nbundle * (GB_KLEN + strlen (GB_jit_cache_path) + 20)
+        + 2 * strlen (GB_jit_C_compiler) + 2 * strlen (GB_jit_C_flags)
+        + strlen (GB_jit_C_link_flags) + strlen (GB_jit_C_libraries)
+        + 8 * strlen (GB_jit_cache_path) + strlen (GB_OMP_INC)
+        + 2 * strlen (GB_jit_error_log) + 500 ;
+    GB_MALLOC_PERSISTENT (command, len) ;
+    if (command == NULL)
+    { 
+        // out of memory
+        GB_FREE_BUNDLE_WORK ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    size_t n = snprintf (command, len,
+        // compile:
+        "%s -DGB_JIT_RUNTIME=1 "            // compiler command
+        "%s "                               // C flags
+        "-I%s/src "                         // include source directory
+        "%s "                               // openmp include directories
+        "-o %s/tmp/%s%s "                   // *.o output file
+        "-c %s/tmp/%s.c "                   // *.c input file
+        "%s "                               // burble stdout
+        "%s %s ; "                          // error log file
+        // link:
+        "%s "                               // C compiler
+        "%s "                               // C flags
+        "%s "                               // C link flags
+        "-o %s/tmp/%s%s%s "                 // lib*.so output file
+        "%s/tmp/%s%s ",                     // *.o input file (bundle)
+        GB_jit_C_compiler, GB_jit_C_flags, GB_jit_cache_path, GB_OMP_INC,
+        GB_jit_cache_path, GB_JIT_BUNDLE, GB_OBJ_SUFFIX,
+        GB_jit_cache_path, GB_JIT_BUNDLE,
+        burble_stdout, err_redirect, GB_jit_error_log,
+        GB_jit_C_compiler, GB_jit_C_flags, GB_jit_C_link_flags,
+        GB_jit_cache_path, GB_LIB_PREFIX, GB_JIT_BUNDLE, GB_LIB_SUFFIX,
+        GB_jit_cache_path, GB_JIT_BUNDLE, GB_OBJ_SUFFIX) ;
+    for (int64_t k = 0 ; k < nbundle ; k++)
+    { 
+        // *.o input file (kernel)
+        n += snprintf (command + n, len - n, "%s/tmp/%s%s ",
+            GB_jit_cache_path, Bundle + k * (GB_KLEN+1), GB_OBJ_SUFFIX) ;
+    }
+    snprintf (command + n, len - n,
+        "%s "                               // libraries to link with
+        "%s"                                // burble stdout
+        "%s %s ",                           // error log file
+        GB_jit_C_libraries, burble_stdout, err_redirect, GB_jit_error_log) ;
+
+    GBURBLE ("(jit bundle: %s) ", command) ;
+    GB_jitifyer_command (command) ;
+
+    // remove the source and object files of the bundle itself
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/tmp/%s.c",
+        GB_jit_cache_path, GB_JIT_BUNDLE) ;
+    remove (GB_jit_temp) ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/tmp/%s%s",
+        GB_jit_cache_path, GB_JIT_BUNDLE, GB_OBJ_SUFFIX) ;
+    remove (GB_jit_temp) ;
+
+    //--------------------------------------------------------------------------
+    // move the bundle into the lib folder
+    //--------------------------------------------------------------------------
+
+    // command is reused to hold the name of the new bundle
+    snprintf (command, len, "%s/tmp/%s%s%s", GB_jit_cache_path,
+        GB_LIB_PREFIX, GB_JIT_BUNDLE, GB_LIB_SUFFIX) ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%s%s%s",
+        GB_jit_cache_path, GB_LIB_PREFIX, GB_JIT_BUNDLE, GB_LIB_SUFFIX) ;
+    #if GB_WINDOWS
+    // rename does not replace an existing file on Windows
+    remove (GB_jit_temp) ;
+    #endif
+    // elsewhere, rename replaces any prior bundle atomically, so another
+    // process that loads the bundle sees either the old or the new one
+    bool ok = (rename (command, GB_jit_temp) == 0) ;
+    if (!ok)
+    { 
+        // the bundle was not created
+        remove (command) ;
+    }
+    GBURBLE ("(jit bundle: %" PRId64 " kernels %s) ", nbundle,
+        ok ? "bundled" : "not bundled") ;
+    GB_FREE_BUNDLE_WORK ;
+    return (ok ? GrB_SUCCESS : GrB_NO_VALUE) ;
+
+    #else
+    return (GrB_NO_VALUE) ;
+    #endif
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_hash:  compute the hash
 //------------------------------------------------------------------------------
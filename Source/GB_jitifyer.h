@@ -189,8 +189,8 @@ struct GB_jit_encoding_struct
 
 typedef struct GB_jit_encoding_struct GB_jit_encoding ;
 
-// prejit_index could be int32_t, but making it int64_t rounds up the size of
-// the GB_jit_entry_struct to a multiple of 8 (56 bytes):
+// prejit_index and embedded are int32_t, so that the size of the
+// GB_jit_entry_struct remains a multiple of 8 (56 bytes):
 
 struct GB_jit_entry_struct
 {
@@ -198,10 +198,12 @@ struct GB_jit_entry_struct
     GB_jit_encoding encoding ;  // encoding of the problem, except for suffix
     char *suffix ;              // kernel suffix for user-defined op / types,
                                 // NULL for built-in kernels
-    void *dl_handle ;           // handle from dlopen, to be passed to dlclose
+    void *dl_handle ;           // handle from dlopen, to be passed to dlclose,
+                                // or the state of the embedded compiler
     void *dl_function ;         // address of kernel function
-    int64_t prejit_index ;      // -1: JIT kernel or checked PreJIT kernel
+    int32_t prejit_index ;      // -1: JIT kernel or checked PreJIT kernel
                                 // >= 0: index of unchecked PreJIT kernel.
+    int32_t embedded ;          // 1 if compiled by the embedded compiler
 } ;
 
 typedef struct GB_jit_entry_struct GB_jit_entry ;
@@ -293,7 +295,8 @@ bool GB_jitifyer_insert         // return true if successful, false if failure
     const char *suffix,         // suffix for user-defined types/operators
     void *dl_handle,            // library handle from dlopen (NULL for PreJIT)
     void *dl_function,          // function handle from dlsym
-    int32_t prejit_index        // index into PreJIT table; -1 if JIT kernel
+    int32_t prejit_index,       // index into PreJIT table; -1 if JIT kernel
+    bool embedded               // true if compiled by the embedded compiler
 ) ;
 
 uint64_t GB_jitifyer_hash_encoding
@@ -376,8 +379,19 @@ const char *GB_jitifyer_get_error_log (void) ;
 GrB_Info GB_jitifyer_set_error_log (const char *new_error_log) ;
 GrB_Info GB_jitifyer_set_error_log_worker (const char *new_error_log) ;
 
+const char *GB_jitifyer_get_manifest (void) ;
+GrB_Info GB_jitifyer_set_manifest (const char *new_manifest) ;
+GrB_Info GB_jitifyer_set_manifest_worker (const char *new_manifest) ;
+
+const char *GB_jitifyer_get_C_embedded (void) ;
+GrB_Info GB_jitifyer_set_C_embedded (const char *new_C_embedded) ;
+GrB_Info GB_jitifyer_set_C_embedded_worker (const char *new_C_embedded) ;
+
 bool GB_jitifyer_get_use_cmake (void) ;
 void GB_jitifyer_set_use_cmake (bool use_cmake) ;
 
+GrB_Info GB_jitifyer_bundle (const char *trace) ;
+GrB_Info GB_jitifyer_bundle_worker (const char *trace) ;
+
 #endif
 
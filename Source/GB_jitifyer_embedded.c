@@ -0,0 +1,327 @@
+//------------------------------------------------------------------------------
+// GB_jitifyer_embedded.c: in-process compilation of JIT kernels
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The JIT normally compiles each kernel by writing its source to the cache
+// folder and running the C compiler (or cmake) in a child process, which then
+// writes a lib*.so file that is loaded with dlopen.  This is not possible if
+// no compiler is installed or if the cache folder is read-only, and the cost
+// of starting the compiler can dominate the time to JIT a small kernel.
+
+// As an alternative, the JIT can use an embedded C compiler, libtcc (the
+// library form of the Tiny C Compiler), which compiles the kernel source held
+// in memory directly into executable memory in this process.  No source,
+// object, or library files are written.  The library is not linked with
+// GraphBLAS; it is opened at run time with dlopen, by setting
+// GxB_JIT_C_EMBEDDED to its name (for example "libtcc.so"), or with the
+// GRAPHBLAS_JIT_EMBEDDED environment variable when GrB_init is called.  The
+// #include files of the kernels are taken from the src folder of the JIT
+// cache.  If the cache folder cannot be written, the JIT stays enabled, and
+// the #include files are instead uncompressed from GB_JITpackage into the src
+// folder of a new folder private to this process (in TMPDIR, or /tmp), which
+// is removed by GrB_finalize.
+
+// If the embedded compiler fails on a kernel (libtcc does not support all of
+// C11, such as the complex types), the JIT falls back to the C compiler, if
+// permitted.  The kernels compiled by the embedded compiler are generally
+// slower than those compiled by an optimizing C compiler, and OpenMP pragmas
+// are ignored, so they run on a single thread.
+
+// All of these functions are called inside the critical section of the
+// jitifyer (GB_jitifyer_worker).
+
+#ifndef _POSIX_C_SOURCE
+// for open_memstream and mkdtemp
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "GB.h"
+#include "GB_file.h"
+#include "GB_jitifyer_embedded.h"
+#include "GB_JITpackage.h"
+#if !defined ( NJIT ) && !GB_WINDOWS
+#include <unistd.h>
+#endif
+
+#if !defined ( NJIT ) && !GB_WINDOWS
+
+//------------------------------------------------------------------------------
+// the libtcc API, opened at run time
+//------------------------------------------------------------------------------
+
+#define GB_TCC_OUTPUT_MEMORY 1
+#define GB_TCC_RELOCATE_AUTO ((void *) 1)
+
+typedef void *(*GB_tcc_new_f) (void) ;
+typedef void  (*GB_tcc_delete_f) (void *) ;
+typedef void  (*GB_tcc_set_options_f) (void *, const char *) ;
+typedef int   (*GB_tcc_add_include_path_f) (void *, const char *) ;
+typedef void  (*GB_tcc_define_symbol_f) (void *, const char *, const char *) ;
+typedef int   (*GB_tcc_set_output_type_f) (void *, int) ;
+typedef void  (*GB_tcc_set_error_func_f) (void *, void *,
+    void (*) (void *, const char *)) ;
+typedef int   (*GB_tcc_compile_string_f) (void *, const char *) ;
+typedef int   (*GB_tcc_relocate_f) (void *, void *) ;
+typedef void *(*GB_tcc_get_symbol_f) (void *, const char *) ;
+
+// tcc_relocate has a second parameter in libtcc 0.9.27 and earlier, which is
+// ignored by libtcc 0.9.28, so it is always passed GB_TCC_RELOCATE_AUTO.
+
+static void *GB_tcc_dl_handle = NULL ;
+static GB_tcc_new_f               GB_tcc_new = NULL ;
+static GB_tcc_delete_f            GB_tcc_delete = NULL ;
+static GB_tcc_set_options_f       GB_tcc_set_options = NULL ;
+static GB_tcc_add_include_path_f  GB_tcc_add_include_path = NULL ;
+static GB_tcc_define_symbol_f     GB_tcc_define_symbol = NULL ;
+static GB_tcc_set_output_type_f   GB_tcc_set_output_type = NULL ;
+static GB_tcc_set_error_func_f    GB_tcc_set_error_func = NULL ;
+static GB_tcc_compile_string_f    GB_tcc_compile_string = NULL ;
+static GB_tcc_relocate_f          GB_tcc_relocate = NULL ;
+static GB_tcc_get_symbol_f        GB_tcc_get_symbol = NULL ;
+
+// error log file for the compiler errors ("" if none):
+static const char *GB_tcc_error_log = "" ;
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_embedded_close: close the embedded compiler
+//------------------------------------------------------------------------------
+
+// Any kernels compiled by the embedded compiler must be freed first.
+
+void GB_jitifyer_embedded_close (void)
+{
+    #if !defined ( NJIT ) && !GB_WINDOWS
+    if (GB_tcc_dl_handle != NULL)
+    {
+        GB_file_dlclose (GB_tcc_dl_handle) ;
+        GB_tcc_dl_handle = NULL ;
+    }
+    GB_tcc_new = NULL ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_embedded_open: open the embedded compiler
+//------------------------------------------------------------------------------
+
+// Returns true if the library was found and has all the needed functions.
+// Otherwise, the embedded compiler is disabled.
+
+bool GB_jitifyer_embedded_open (const char *library)
+{
+    GB_jitifyer_embedded_close ( ) ;
+    #if !defined ( NJIT ) && !GB_WINDOWS
+    if (library == NULL || library [0] == '\0')
+    {
+        // the embedded compiler is disabled
+        return (false) ;
+    }
+    void *h = GB_file_dlopen ((char *) library) ;
+    if (h == NULL)
+    {
+        GBURBLE ("(jit: embedded compiler %s not found) ", library) ;
+        return (false) ;
+    }
+
+    #define GB_TCC_GET(f)                                               \
+        GB_ ## f = (GB_ ## f ## _f) GB_file_dlsym (h, #f) ;              \
+        ok = ok && (GB_ ## f != NULL) ;
+
+    bool ok = true ;
+    GB_TCC_GET (tcc_new) ;
+    GB_TCC_GET (tcc_delete) ;
+    GB_TCC_GET (tcc_set_options) ;
+    GB_TCC_GET (tcc_add_include_path) ;
+    GB_TCC_GET (tcc_define_symbol) ;
+    GB_TCC_GET (tcc_set_output_type) ;
+    GB_TCC_GET (tcc_set_error_func) ;
+    GB_TCC_GET (tcc_compile_string) ;
+    GB_TCC_GET (tcc_relocate) ;
+    GB_TCC_GET (tcc_get_symbol) ;
+    #undef GB_TCC_GET
+
+    if (!ok)
+    {
+        // the library is not libtcc
+        GBURBLE ("(jit: %s is not an embedded compiler) ", library) ;
+        GB_file_dlclose (h) ;
+        GB_tcc_new = NULL ;
+        return (false) ;
+    }
+    GB_tcc_dl_handle = h ;
+    return (true) ;
+    #else
+    return (false) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_embedded_ok: true if the embedded compiler is available
+//------------------------------------------------------------------------------
+
+bool GB_jitifyer_embedded_ok (void)
+{
+    #if !defined ( NJIT ) && !GB_WINDOWS
+    return (GB_tcc_dl_handle != NULL && GB_tcc_new != NULL) ;
+    #else
+    return (false) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_embedded_error: handle an error message from the compiler
+//------------------------------------------------------------------------------
+
+#if !defined ( NJIT ) && !GB_WINDOWS
+static void GB_jitifyer_embedded_error (void *opaque, const char *msg)
+{
+    if (GB_tcc_error_log != NULL && GB_tcc_error_log [0] != '\0')
+    {
+        FILE *fp = fopen (GB_tcc_error_log, "a") ;
+        if (fp != NULL)
+        {
+            fprintf (fp, "%s\n", msg) ;
+            fclose (fp) ;
+        }
+    }
+    GBURBLE ("(jit embedded: %s) ", msg) ;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_embedded_source: open a stream for the source of a kernel
+//------------------------------------------------------------------------------
+
+// The source is written to a growing buffer in memory.  The buffer is
+// finalized by fclose, and then freed by the caller with free (not
+// GB_FREE), since it is allocated by the C library.
+
+FILE *GB_jitifyer_embedded_source (char **buffer, size_t *len)
+{
+    (*buffer) = NULL ;
+    (*len) = 0 ;
+    #if !defined ( NJIT ) && !GB_WINDOWS
+    return (open_memstream (buffer, len)) ;
+    #else
+    return (NULL) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_embedded_compile: compile a kernel in memory
+//------------------------------------------------------------------------------
+
+// Returns the compiler state, which holds the compiled kernel and must be
+// freed with GB_jitifyer_embedded_free, or NULL if the kernel cannot be
+// compiled.
+
+void *GB_jitifyer_embedded_compile
+(
+    // output:
+    void **dl_function,         // the GB_jit_kernel function
+    // input:
+    const char *source,         // source of the kernel
+    const char *src_path,       // folder with all #include files
+    const char *error_log       // error log file ("" if none)
+)
+{
+    (*dl_function) = NULL ;
+    #if !defined ( NJIT ) && !GB_WINDOWS
+    if (!GB_jitifyer_embedded_ok ( ) || source == NULL) return (NULL) ;
+
+    void *s = GB_tcc_new ( ) ;
+    if (s == NULL) return (NULL) ;
+    GB_tcc_error_log = error_log ;
+    GB_tcc_set_error_func (s, NULL, GB_jitifyer_embedded_error) ;
+    GB_tcc_set_output_type (s, GB_TCC_OUTPUT_MEMORY) ;
+    GB_tcc_set_options (s, "-std=c11 -w") ;
+    GB_tcc_add_include_path (s, src_path) ;
+    GB_tcc_define_symbol (s, "GB_JIT_RUNTIME", "1") ;
+
+    // compile the kernel, and resolve its calls to GraphBLAS and the C
+    // library with the symbols already loaded in this process
+    bool ok = (GB_tcc_compile_string (s, source) == 0) ;
+    ok = ok && (GB_tcc_relocate (s, GB_TCC_RELOCATE_AUTO) >= 0) ;
+    if (ok)
+    {
+        (*dl_function) = GB_tcc_get_symbol (s, "GB_jit_kernel") ;
+        ok = ((*dl_function) != NULL) ;
+    }
+    GB_tcc_error_log = "" ;
+
+    if (!ok)
+    {
+        (*dl_function) = NULL ;
+        GB_tcc_delete (s) ;
+        return (NULL) ;
+    }
+    return (s) ;
+    #else
+    return (NULL) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_embedded_free: free a kernel compiled by the embedded compiler
+//------------------------------------------------------------------------------
+
+void GB_jitifyer_embedded_free (void *handle)
+{
+    #if !defined ( NJIT ) && !GB_WINDOWS
+    if (handle != NULL && GB_tcc_delete != NULL)
+    {
+        GB_tcc_delete (handle) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_embedded_mkdtemp: create a private folder
+//------------------------------------------------------------------------------
+
+// The folder name must end in XXXXXX, which is replaced with a unique string.
+// Returns true if the folder was created.
+
+bool GB_jitifyer_embedded_mkdtemp (char *folder)
+{
+    #if !defined ( NJIT ) && !GB_WINDOWS
+    return (mkdtemp (folder) != NULL) ;
+    #else
+    return (false) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_embedded_rmdir: remove a private folder
+//------------------------------------------------------------------------------
+
+// Removes the files of GB_JITpackage from the src folder of a folder created
+// by GB_jitifyer_embedded_mkdtemp, and then the src folder and the folder
+// itself.  Any file I/O error is ignored.
+
+void GB_jitifyer_embedded_rmdir (const char *folder)
+{
+    #if !defined ( NJIT ) && !GB_WINDOWS
+    size_t len = strlen (folder) + 256 ;
+    char *filename = malloc (len) ;
+    if (filename == NULL) return ;
+    for (int k = 0 ; k < GB_JITpackage_nfiles ; k++)
+    {
+        snprintf (filename, len, "%s/src/%s", folder,
+            GB_JITpackage_index [k].filename) ;
+        remove (filename) ;
+    }
+    snprintf (filename, len, "%s/src", folder) ;
+    rmdir (filename) ;
+    rmdir (folder) ;
+    free (filename) ;
+    #endif
+}
+
@@ -0,0 +1,35 @@
+//------------------------------------------------------------------------------
+// GB_jitifyer_embedded.h: in-process compilation of JIT kernels
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_JITIFYER_EMBEDDED_H
+#define GB_JITIFYER_EMBEDDED_H
+
+bool GB_jitifyer_embedded_open (const char *library) ;
+void GB_jitifyer_embedded_close (void) ;
+bool GB_jitifyer_embedded_ok (void) ;
+
+FILE *GB_jitifyer_embedded_source (char **buffer, size_t *len) ;
+
+void *GB_jitifyer_embedded_compile
+(
+    // output:
+    void **dl_function,         // the GB_jit_kernel function
+    // input:
+    const char *source,         // source of the kernel
+    const char *src_path,       // folder with all #include files
+    const char *error_log       // error log file ("" if none)
+) ;
+
+void GB_jitifyer_embedded_free (void *handle) ;
+
+bool GB_jitifyer_embedded_mkdtemp (char *folder) ;
+void GB_jitifyer_embedded_rmdir (const char *folder) ;
+
+#endif
+
@@ -27,7 +27,8 @@ void GB_macrofy_ewise           // construct all macros for GrB_eWise
     // extract the binaryop scode
     //--------------------------------------------------------------------------
 
-    // method (3 bits)
+    // method (4 bits)
+    bool C_in_place = GB_RSHIFT (scode, 51, 1) ;
 //  bool is_emult   = GB_RSHIFT (scode, 50, 1) ;
 //  bool is_union   = GB_RSHIFT (scode, 49, 1) ;
     bool copy_to_C  = GB_RSHIFT (scode, 48, 1) ;
@@ -148,6 +149,12 @@ void GB_macrofy_ewise           // construct all macros for GrB_eWise
     GB_macrofy_output (fp, "c", "C", "C", ctype, ztype, csparsity, C_iso,
         C_in_iso) ;
 
+    if (C_in_place)
+    { 
+        // C<M> += T is computed in place, with the binary op as the accum
+        fprintf (fp, "#define GB_C_IN_PLACE 1\n") ;
+    }
+
     fprintf (fp, "#define GB_EWISEOP(Cx,p,aij,bij,i,j)") ;
     if (C_iso)
     { 
@@ -28,7 +28,7 @@ void GB_macrofy_mxm        // construct all macros for GrB_mxm
     //--------------------------------------------------------------------------
 
     // monoid (4 hex digits)
-//  int unused      = GB_RSHIFT (scode, 63, 1) ;
+    bool C_in_place = GB_RSHIFT (scode, 63, 1) ;
     int add_ecode   = GB_RSHIFT (scode, 58, 5) ;
     int id_ecode    = GB_RSHIFT (scode, 53, 5) ;
     int term_ecode  = GB_RSHIFT (scode, 48, 5) ;
@@ -352,6 +352,9 @@ void GB_macrofy_mxm        // construct all macros for GrB_mxm
     GB_macrofy_output (fp, "c", "C", "C", ctype, ztype, csparsity, C_iso,
         C_in_iso) ;
 
+    // C += A*B computed in place, for bitmap C with no mask (saxbit and dot2)
+    fprintf (fp, "#define GB_C_IN_PLACE %d\n", C_in_place ? 1 : 0) ;
+
     //--------------------------------------------------------------------------
     // construct the macros to access the mask (if any), and its name
     //--------------------------------------------------------------------------
@@ -34,6 +34,9 @@ static inline void *GB_malloc_helper
     GB_Global_memtable_dump ( ) ;
     #endif
 
+    // apply the NUMA policy of the Context, if any, to a large block
+    GB_numa_bind (p, *size) ;
+
     return (p) ;
 }
 
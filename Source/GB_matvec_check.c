@@ -348,6 +348,7 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
         GBPR ("  ->x: %p shallow: %d size: " GBu "\n",
             A->x, A->x_shallow, (uint64_t) A->x_size) ;
         GBPR ("  ->Y: %p shallow: %d\n", A->Y, A->Y_shallow) ;
+        GBPR ("  ->T: %p cache: %d\n", A->T, A->T_cache) ;
     }
     #endif
 
@@ -864,48 +865,84 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
             GBPR0 ("  hyper_hash invalid") ;
             return (info) ;
         }
-        if (Y->vlen != A->vdim || !GB_IS_POWER_OF_TWO (Y->vdim) ||
-            Y->nvals != A->nvec || !GB_IS_SPARSE (Y) || Y->type != GrB_UINT64 ||
-            !Y->is_csc || GB_ANY_PENDING_WORK (Y))
+        if (Y->vlen != 2*GB_HYPER_HASH_GROUP || !GB_IS_POWER_OF_TWO (Y->vdim)
+            || Y->vdim * GB_HYPER_HASH_GROUP <= A->nvec || !GB_IS_FULL (Y)
+            || Y->iso || Y->type != GrB_UINT64 || !Y->is_csc
+            || GB_ANY_PENDING_WORK (Y))
         { 
-            // Y must be sparse, uint64, held by column, with A->nvec values,
-            // vector length the same as A->vdim, and with a Y->vdim that is a
-            // power of 2. It cannot have any pending work.
+            // Y must be full, uint64, non-iso, and held by column, with a
+            // vector length of 2*GB_HYPER_HASH_GROUP, and with a Y->vdim that
+            // is a power of 2.  It must have more slots than A->nvec.  It
+            // cannot have any pending work.
             GBPR0 ("  hyper_hash invalid") ;
             return (GrB_INVALID_OBJECT) ;
         }
         // ensure that Y is the inverse of A->h
         int64_t hash_bits = Y->vdim - 1 ;
         const int64_t *restrict Yx = (int64_t *) Y->x ;
-        for (int64_t k = 0 ; k < A->nvec ; k++)
+        int64_t nkeys = 0 ;
+        for (int64_t p = 0 ; p < Y->vdim * Y->vlen ; p += Y->vlen)
         {
-            // look for j in the hyper_hash; it must be at position k
-            int64_t j = A->h [k] ;
-            int64_t jhash = GB_HASHF2 (j, hash_bits) ;
-            bool found = false ;
-            for (int64_t p = Y->p [jhash] ; p < Y->p [jhash+1] ; p++)
+            for (int t = 0 ; t < GB_HYPER_HASH_GROUP ; t++)
             {
-                if (j == Y->i [p])
-                {
-                    if (k != Yx [p])
-                    { 
-                        // j is found but not with the right value of k
-                        GBPR0 ("  hyper_hash invalid\n") ;
-                        return (GrB_INVALID_OBJECT) ;
-                    }
-                    found = true ;
-                    break ;
+                int64_t j = Yx [p + t] ;
+                int64_t k = Yx [p + GB_HYPER_HASH_GROUP + t] ;
+                if (j == GB_HYPER_HASH_EMPTY) continue ;
+                if (k < 0 || k >= A->nvec || A->h [k] != j)
+                { 
+                    // the slot must hold a vector j = Ah [k]
+                    GBPR0 ("  hyper_hash invalid\n") ;
+                    return (GrB_INVALID_OBJECT) ;
                 }
+                nkeys++ ;
             }
-            if (!found)
+        }
+        if (nkeys != A->nvec)
+        { 
+            // each vector of A must appear exactly once in the hyper_hash
+            GBPR0 ("  hyper_hash invalid\n") ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        for (int64_t k = 0 ; k < A->nvec ; k++)
+        {
+            // look for j in the hyper_hash; it must be at position k
+            int64_t j = A->h [k] ;
+            int64_t pstart, pend ;
+            if (GB_hyper_hash_lookup (A->h, A->nvec, A->p, Yx, hash_bits, j,
+                &pstart, &pend) != k)
             { 
-                // j must appear in the hyper_hash
+                // j must be found by GB_hyper_hash_lookup
                 GBPR0 ("  hyper_hash invalid\n") ;
                 return (GrB_INVALID_OBJECT) ;
             }
         }
     }
 
+    //--------------------------------------------------------------------------
+    // check A->T
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix T = A->T ;
+    if (T != NULL)
+    {
+        info = GB_matvec_check (T, "T cached transpose", pr_developer, f,
+            "matrix") ;
+        if (info != GrB_SUCCESS)
+        { 
+            // A->T fails the tests in GB_matvec_check
+            GBPR0 ("  cached transpose invalid\n") ;
+            return (info) ;
+        }
+        if (T->vlen != A->vdim || T->vdim != A->vlen || T->type != A->type ||
+            T->is_csc != A->is_csc || T->T != NULL || GB_ANY_PENDING_WORK (T))
+        { 
+            // T must have the transposed dimensions of A, the same type and
+            // format as A, and no pending work.
+            GBPR0 ("  cached transpose invalid\n") ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
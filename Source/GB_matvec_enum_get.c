@@ -28,6 +28,11 @@ GrB_Info GB_matvec_enum_get (GrB_Matrix A, int32_t *value, int field)
             (*value) = A->sparsity_control ;
             break ;
 
+        case GxB_TRANSPOSE_CACHE : 
+
+            (*value) = (int32_t) A->T_cache ;
+            break ;
+
         case GxB_SPARSITY_STATUS : 
 
             (*value) = GB_sparsity (A) ;
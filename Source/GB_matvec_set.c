@@ -49,6 +49,20 @@ GrB_Info GB_matvec_set
             A->sparsity_control = GB_sparsity_control (ivalue, (int64_t) (-1)) ;
             break ;
 
+        case GxB_TRANSPOSE_CACHE : 
+
+            if (is_vector)
+            { 
+                return (GrB_INVALID_VALUE) ;
+            }
+            A->T_cache = (ivalue != 0) ;
+            if (!A->T_cache)
+            { 
+                // free the cached transpose, if any
+                GB_transpose_cache_free (A) ;
+            }
+            break ;
+
         case GrB_STORAGE_ORIENTATION_HINT : 
 
             format = (ivalue == GrB_COLMAJOR) ? GxB_BY_COL : GxB_BY_ROW ;
@@ -69,7 +83,10 @@ GrB_Info GB_matvec_set
             // conform the matrix to the new by-row/by-col format
             if (A->is_csc != new_csc)
             { 
-                // A = A', done in-place, and change to the new format.
+                // A = A', done in-place, and change to the new format.  If
+                // A->T_cache is enabled, A and A->T are swapped, and the
+                // prior A is kept as the new A->T.
+                GB_OK (GB_transpose_cache_build (A, Werk)) ;
                 GB_BURBLE_N (GB_nnz (A), "(transpose) ") ;
                 GB_OK (GB_transpose_in_place (A, new_csc, Werk)) ;
                 ASSERT (A->is_csc == new_csc) ;
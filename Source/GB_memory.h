@@ -59,6 +59,12 @@ void *GB_xalloc_memory      // return the newly-allocated space
     size_t *size            // resulting size
 ) ;
 
+void GB_numa_bind
+(
+    void *p,                // block of memory to bind
+    size_t size             // size of the block, in bytes
+) ;
+
 //------------------------------------------------------------------------------
 // parallel memcpy and memset
 //------------------------------------------------------------------------------
@@ -160,6 +160,18 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
         }
     }
 
+    if (A->T != NULL)
+    { 
+        // A->T is never shallow
+        int64_t T_nallocs = 0 ;
+        size_t T_mem_deep = 0 ;
+        size_t T_mem_shallow = 0 ;
+        GB_memoryUsage (&T_nallocs, &T_mem_deep, &T_mem_shallow, A->T, true) ;
+        (*nallocs) += T_nallocs ;
+        (*mem_deep) += T_mem_deep ;
+        (*mem_shallow) += T_mem_shallow ;
+    }
+
     #pragma omp flush
     return ;
 }
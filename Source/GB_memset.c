@@ -26,6 +26,50 @@ GB_CALLBACK_MEMSET_PROTO (GB_memset)
 
         memset (dest, c, n) ;
     }
+    else if (GB_Context_numa_policy ( ) == GxB_NUMA_FIRST_TOUCH)
+    {
+
+        //----------------------------------------------------------------------
+        // memset using one contiguous partition per thread
+        //----------------------------------------------------------------------
+
+        // Each thread clears one contiguous part of the block, of equal size
+        // (with GB_PARTITION) and split at page boundaries.  With threads
+        // pinned to cores, each page is first touched (and thus placed) on
+        // the NUMA node of the same thread each time.  This matches a kernel
+        // that splits the array into equal parts, but not one that balances
+        // its work with GB_ek_slice.  A static schedule is required so that
+        // the thread/partition mapping is the same each time.
+
+        GB_void *pdest = (GB_void *) dest ;
+        uintptr_t base = (uintptr_t) dest ;
+        const size_t pagesize = 4096 ;
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            size_t start, end ;
+            GB_PARTITION (start, end, n, tid, nthreads) ;
+            // move the interior boundaries to the next page boundary
+            if (tid > 0)
+            { 
+                start = ((base + start + pagesize - 1) / pagesize) * pagesize
+                      - base ;
+            }
+            if (tid < nthreads - 1)
+            { 
+                end = ((base + end + pagesize - 1) / pagesize) * pagesize
+                    - base ;
+            }
+            start = GB_IMIN (start, n) ;
+            end = GB_IMIN (end, n) ;
+            if (start < end)
+            { 
+                memset (pdest + start, c, end - start) ;
+            }
+        }
+    }
     else
     {
 
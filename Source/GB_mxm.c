@@ -126,10 +126,10 @@ GrB_Info GB_mxm                     // C<M> = A*B
     // dense with all entries present.  C can have any sparsity structure;
     // its pattern is ignored.
 
-    // If C is bitmap, then it can always be be done in-place (assuming the
-    // type of C is OK).  The accum operator need not be present.  GB_AxB_meta
-    // can easily insert non-entries into C and check for non-entries, via the
-    // bitmap.
+    // If C is bitmap, no mask is present, and the accum is present and
+    // matches the monoid of the semiring (other than ANY), then C+=A*B can be
+    // done in-place by the bitmap saxpy or dot2 methods.  Entries are inserted
+    // into C and checked for via its bitmap.
 
     // To compute C in-place, its type must match the accum->ztype, or the
     // semiring->add->ztype if accum is not present.  To compute in-place,
@@ -12,6 +12,20 @@
 #include "GB_AxB_saxpy.h"
 #include "GB_binop.h"
 
+//------------------------------------------------------------------------------
+// GB_GET_AXB_PLAN: use the saxpy3 plan of the descriptor, if enabled
+//------------------------------------------------------------------------------
+
+// The plan is held in the descriptor, and GB_AxB_saxpy3 accesses it via the
+// Werk (see GB_AxB_saxpy3_plan.c).
+
+#define GB_GET_AXB_PLAN(desc)                                   \
+    if (desc != NULL && desc->axb_plan)                         \
+    {                                                           \
+        Werk->plan_handle = &(desc->Plan) ;                     \
+        Werk->plan_size_handle = &(desc->Plan_size) ;           \
+    }
+
 //------------------------------------------------------------------------------
 
 GrB_Info GB_mxm                     // C<M> = A*B
@@ -33,6 +47,21 @@ GrB_Info GB_mxm                     // C<M> = A*B
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_mxv_batch               // W[j] = accum (W[j], A*U[j]) for all j
+(
+    GrB_Vector *W,                  // array of k input/output vectors
+    const bool C_replace,           // if true, clear each W[j] first
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Vector *U,            // array of k input vectors
+    const int64_t k,                // number of vectors in W and U
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return C unjumbled
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_AxB_dot                 // dot product (multiple methods)
 (
     GrB_Matrix C,                   // output matrix, static header
@@ -117,6 +146,7 @@ bool GB_AxB_semiring_builtin        // true if semiring is builtin
 GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
 (
     GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C_in,                // input/output matrix, if done in-place
     const bool C_iso,               // true if C is iso
     const GB_void *cscalar,         // iso value of C
     const GrB_Matrix M_in,          // mask matrix for C<!M>=A'*B, may be NULL
@@ -127,6 +157,7 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
     const GrB_Matrix B_in,          // input matrix
     const GrB_Semiring semiring,    // semiring that defines C=A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    bool *done_in_place,            // if true, C_in was computed in-place
     GB_Werk Werk
 ) ;
 
@@ -158,6 +189,9 @@ GrB_Info GB_AxB_dot3_slice
     int *p_nthreads,                // # of threads to use
     // input:
     const GrB_Matrix C,             // matrix to slice
+    const GrB_Matrix M,             // mask matrix, with the same pattern as C
+    const GrB_Matrix A,             // input matrix A, for C<M>=A'*B
+    const GrB_Matrix B,             // input matrix B
     GB_Werk Werk
 ) ;
 
@@ -224,6 +258,33 @@ static inline bool GB_AxB_dot4_control
         && (C_in->type == accum->ztype)) ;  // ctype must match ztype
 }
 
+//------------------------------------------------------------------------------
+// GB_AxB_bitmap_in_place_control: determine if a bitmap C can be done in-place
+//------------------------------------------------------------------------------
+
+// C += A*B or C += A'*B where C is bitmap and modified in-place by dot2 or
+// saxbit.  C may be iso on input but not on output.  The accum must match the
+// monoid, which cannot be ANY.  C remains bitmap on output.
+
+static inline bool GB_AxB_bitmap_in_place_control
+(
+    const bool C_out_iso,       // true if C is iso on output; must be false
+    const GrB_Matrix C_in,      // must be present and bitmap
+    const GrB_Matrix M,         // must be NULL
+    const bool Mask_comp,       // must be false
+    const GrB_BinaryOp accum,   // accum must match the monoid
+    const GrB_Semiring semiring
+)
+{
+    return (!C_out_iso                  // C must not be iso on output
+        && GB_IS_BITMAP (C_in)          // C must be present and bitmap
+        && (M == NULL) && (!Mask_comp)  // no mask, and must not be complemented
+        && (accum != NULL)              // accum must be present
+        && (accum == semiring->add->op)     // accum must match the monoid
+        && (accum->opcode != GB_ANY_binop_code) // monoid must not be ANY
+        && (C_in->type == accum->ztype)) ;  // ctype must match ztype
+}
+
 //------------------------------------------------------------------------------
 // GB_AxB_dot3_control: determine if the dot3 method should be used
 //------------------------------------------------------------------------------
@@ -274,6 +335,16 @@ bool GB_AxB_iso             // C = A*B, return true if C is iso
 // GB_AxB_adotb_meta_control: determine method for C=A'*B
 //------------------------------------------------------------------------------
 
+bool GB_AxB_meta_direction      // true: pull, false: push
+(
+    const GrB_Matrix M,         // mask for C<M>, or NULL
+    const bool Mask_comp,       // if true, use !M
+    const GrB_Matrix A,         // input matrix
+    const bool A_transpose,     // if true, op(A) is A', else A
+    const GrB_Matrix B,         // input vector
+    const GrB_Semiring semiring // semiring that defines C=A*B
+) ;
+
 void GB_AxB_meta_adotb_control
 (
     // output:
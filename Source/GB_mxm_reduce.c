@@ -0,0 +1,280 @@
+//------------------------------------------------------------------------------
+// GB_mxm_reduce: reduce a matrix-matrix product to a vector or scalar
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// w<M> = accum (w, reduce (A*B)), or s = accum (s, reduce (A*B)).
+
+// This function is not user-callable.  It does the work for the user-callable
+// functions GxB_mxm_reduce and GxB_mxm_reduce_Scalar.
+
+// For the vector case, each row of the product T=A*B is reduced to a single
+// entry, t(i) = reduce (T(i,:)), just as GrB_reduce (w, M, accum, monoid, T,
+// desc) with no transpose of T.  For the scalar case, all entries of T are
+// reduced to a single scalar.  A and/or B may be transposed, as determined by
+// the descriptor.
+
+// The product T is never formed in its entirety.  Instead, op(B) is split into
+// panels of contiguous columns, and each panel of T is computed by GB_mxm,
+// Tpanel = A*op(B)(:,j1:j2), then reduced into the vector t with the monoid,
+// t = t + reduce (Tpanel), and then freed.  The panels are sized from an
+// estimate of the flop count so that each Tpanel holds roughly no more than
+// O(nnz(A)+nnz(B)+m) entries, where m is the number of rows of T.  If the
+// entire product is small enough, a single panel is used.
+
+// If A is transposed and more than one panel is used, op(A) = A' is computed
+// just once, before the first panel (or taken from A->T, if A has a cached
+// transpose), rather than by GB_mxm for each panel.
+
+// The scalar case reduces the vector t to the scalar s.
+
+#define GB_FREE_WORKSPACE               \
+{                                       \
+    GB_Matrix_free (&Tpanel) ;          \
+    GB_Matrix_free (&Bpanel) ;          \
+    GB_Matrix_free (&AT) ;              \
+}
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE_WORKSPACE ;                 \
+    GB_Matrix_free (&T) ;               \
+}
+
+#include "GB_mxm.h"
+#include "GB_reduce.h"
+#include "GB_subref.h"
+#include "GB_accum_mask.h"
+#include "GB_transpose.h"
+
+// minimum number of flops in a single panel
+#define GB_MXM_REDUCE_PANEL_MIN (1024*1024)
+
+GrB_Info GB_mxm_reduce              // C<M> = accum (C, reduce (A*B))
+(
+    GrB_Matrix C,                   // input/output vector or GrB_Scalar
+    const bool C_is_scalar,         // if true, C is a GrB_Scalar
+    const bool C_replace,           // if true, clear C before writing to it
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Monoid monoid,        // reduce monoid for t=reduce(A*B)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return C unjumbled
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    // C may be aliased with M, A, and/or B
+
+    GrB_Info info ;
+    struct GB_Matrix_opaque T_header, Tpanel_header, Bpanel_header, AT_header ;
+    GrB_Matrix T = NULL, Tpanel = NULL, Bpanel = NULL, AT = NULL ;
+
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_FAULTY (M) ;
+    GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (monoid) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+
+    ASSERT_MATRIX_OK (C, "C input for GB_mxm_reduce", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_mxm_reduce", GB0) ;
+    ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_mxm_reduce", GB0) ;
+    ASSERT_MONOID_OK (monoid, "monoid for GB_mxm_reduce", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for GB_mxm_reduce", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for GB_mxm_reduce", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for GB_mxm_reduce", GB0) ;
+    ASSERT (GB_VECTOR_OK (C)) ;
+    ASSERT (GB_IMPLIES (M != NULL, GB_VECTOR_OK (M))) ;
+    ASSERT (GB_IMPLIES (C_is_scalar, M == NULL)) ;
+
+    // check domains and dimensions for C<M> = accum (C,t)
+    GrB_Type ttype = monoid->op->ztype ;
+    GB_OK (GB_compatible (C->type, C, M, Mask_struct, accum, ttype, Werk)) ;
+
+    // A*B via semiring: A and B must be compatible with semiring->multiply
+    GB_OK (GB_BinaryOp_compatible (semiring->multiply, NULL, A->type, B->type,
+        GB_ignore_code, Werk)) ;
+
+    // t = reduce (A*B) must be compatible
+    GrB_Type ztype = semiring->add->op->ztype ;
+    if (!GB_Type_compatible (ztype, ttype))
+    { 
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Incompatible type for reduction monoid z=%s(x,y):\n"
+            "semiring monoid of type [%s]\n"
+            "cannot be typecast to reduction monoid of type [%s]",
+            monoid->op->name, ztype->name, ttype->name) ;
+    }
+
+    // check the dimensions
+    int64_t anrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    int64_t ancols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    int64_t bnrows = (B_transpose) ? GB_NCOLS (B) : GB_NROWS (B) ;
+    int64_t bncols = (B_transpose) ? GB_NROWS (B) : GB_NCOLS (B) ;
+    if (ancols != bnrows || (!C_is_scalar && GB_NROWS (C) != anrows))
+    { 
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "Dimensions not compatible:\n"
+            "output is " GBd "-by-" GBd "\n"
+            "first input is " GBd "-by-" GBd "%s\n"
+            "second input is " GBd "-by-" GBd "%s",
+            GB_NROWS (C), GB_NCOLS (C),
+            anrows, ancols, A_transpose ? " (transposed)" : "",
+            bnrows, bncols, B_transpose ? " (transposed)" : "") ;
+    }
+
+    // quick return if an empty mask is complemented
+    GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
+
+    // delete any lingering zombies and assemble any pending tuples
+    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT (B) ;        // cannot be jumbled for GB_subref
+
+    //--------------------------------------------------------------------------
+    // determine the number of panels
+    //--------------------------------------------------------------------------
+
+    // The flop count of T=A*B is estimated as nnz(B) times the average number
+    // of entries in each column of op(A).
+
+    double anz = (double) GB_nnz (A) ;
+    double bnz = (double) GB_nnz (B) ;
+    double flops = bnz * (anz / ((double) GB_IMAX (ancols, 1))) ;
+    double panel_flops = GB_IMAX (anz + bnz + anrows, GB_MXM_REDUCE_PANEL_MIN) ;
+    int64_t npanels = (int64_t) ceil (flops / panel_flops) ;
+    npanels = GB_IMAX (npanels, 1) ;
+    npanels = GB_IMIN (npanels, GB_IMAX (bncols, 1)) ;
+    int64_t panel_width = GB_IMAX (1, (bncols + npanels - 1) / npanels) ;
+    GBURBLE ("(mxm reduce: %g flops, " GBd " panels) ", flops, npanels) ;
+
+    //--------------------------------------------------------------------------
+    // create the vector t
+    //--------------------------------------------------------------------------
+
+    GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+    GB_OK (GB_new (&T, // sparse, existing header
+        ttype, anrows, 1, GB_Ap_calloc, true, GxB_SPARSE,
+        GB_NEVER_HYPER, 1)) ;
+
+    //--------------------------------------------------------------------------
+    // AT = A', if A is transposed and used for more than one panel
+    //--------------------------------------------------------------------------
+
+    // AT is a shallow copy of A->T if A has a cached transpose, which is
+    // constructed here if A->T_cache is enabled and C is not aliased with A.
+
+    GrB_Matrix A2 = A ;
+    bool A2_transpose = A_transpose ;
+    if (A_transpose && npanels > 1)
+    { 
+        GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
+        GB_OK (GB_transpose_cache_cast (AT, A->type, A->is_csc, A, false,
+            C != A, Werk)) ;
+        ASSERT_MATRIX_OK (AT, "AT for GB_mxm_reduce", GB0) ;
+        A2 = AT ;
+        A2_transpose = false ;
+    }
+
+    //--------------------------------------------------------------------------
+    // t = reduce (A*B), one panel of op(B) at a time
+    //--------------------------------------------------------------------------
+
+    // If op(B)(:,j1:j2) is a set of vectors of B, then it is extracted as
+    // B(:,j1:j2) in CSC format (or B(j1:j2,:) in CSR format).  Otherwise, it
+    // is extracted as B(j1:j2,:) from a CSC matrix B and returned as a CSR
+    // panel (or from a CSR B and returned as CSC), which is op(B)(:,j1:j2)
+    // without an explicit transpose.  See GB_extract.
+    bool panel_is_vectors = (B->is_csc != B_transpose) ;
+
+    for (int64_t j1 = 0 ; j1 < bncols ; j1 += panel_width)
+    {
+
+        //----------------------------------------------------------------------
+        // Bpanel = op(B)(:,j1:j2), or use op(B) as-is if only one panel
+        //----------------------------------------------------------------------
+
+        int64_t j2 = GB_IMIN (j1 + panel_width, bncols) - 1 ;
+        int64_t width = j2 - j1 + 1 ;
+        GrB_Matrix Bj = B ;
+        bool Bj_transpose = B_transpose ;
+        if (npanels > 1)
+        {
+            GrB_Index Range [2] ;
+            Range [GxB_BEGIN] = j1 ;
+            Range [GxB_END  ] = j2 ;
+            GB_CLEAR_STATIC_HEADER (Bpanel, &Bpanel_header) ;
+            if (panel_is_vectors)
+            { 
+                GB_OK (GB_subref (Bpanel, false, true, B, GrB_ALL, B->vlen,
+                    Range, GxB_RANGE, false, Werk)) ;
+            }
+            else
+            { 
+                GB_OK (GB_subref (Bpanel, false, false, B, Range, GxB_RANGE,
+                    GrB_ALL, B->vdim, false, Werk)) ;
+            }
+            ASSERT_MATRIX_OK (Bpanel, "Bpanel for GB_mxm_reduce", GB0) ;
+            ASSERT (GB_NROWS (Bpanel) == bnrows) ;
+            ASSERT (GB_NCOLS (Bpanel) == width) ;
+            Bj = Bpanel ;
+            Bj_transpose = false ;
+        }
+
+        //----------------------------------------------------------------------
+        // Tpanel = A*op(B)(:,j1:j2)
+        //----------------------------------------------------------------------
+
+        GB_CLEAR_STATIC_HEADER (Tpanel, &Tpanel_header) ;
+        GB_OK (GB_new (&Tpanel, // auto sparsity, existing header
+            ztype, anrows, width, GB_Ap_calloc, true, GxB_AUTO_SPARSITY,
+            GB_Global_hyper_switch_get ( ), 1)) ;
+        GB_OK (GB_mxm (Tpanel, true, NULL, false, false, NULL, semiring,
+            A2, A2_transpose, Bj, Bj_transpose, false, AxB_method, do_sort,
+            Werk)) ;
+        GB_Matrix_free (&Bpanel) ;
+
+        //----------------------------------------------------------------------
+        // t = t + reduce (Tpanel)
+        //----------------------------------------------------------------------
+
+        GB_OK (GB_reduce_to_vector (T, NULL, monoid->op, monoid, Tpanel, NULL,
+            Werk)) ;
+        GB_Matrix_free (&Tpanel) ;
+    }
+
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (T, "t = reduce (A*B) for GB_mxm_reduce", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C,t), or s = accum (s, reduce (t))
+    //--------------------------------------------------------------------------
+
+    if (C_is_scalar)
+    { 
+        info = GB_Scalar_reduce ((GrB_Scalar) C, accum, monoid, T, Werk) ;
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+    else
+    { 
+        return (GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
+            Mask_struct, Werk)) ;
+    }
+}
@@ -0,0 +1,240 @@
+//------------------------------------------------------------------------------
+// GB_mxv_batch: compute many matrix-vector products with a single A*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// W[j] = accum (W[j], op(A)*U[j]), for j = 0 to k-1.
+
+// This function is not user-callable.  It does the work for the user-callable
+// function GxB_mxv_batch.
+
+// Computing each w = A*u with a separate call to GrB_mxv reads all of A once
+// for each vector u.  If A is much larger than the cache, and many vectors u
+// are multiplied by the same A, the time is dominated by the memory traffic
+// for A.  Instead, the k vectors U[0:k-1] are concatenated into a single
+// n-by-k matrix B, and the product T = op(A)*B is computed by GB_mxm, which
+// selects the saxpy or dot product method best suited for a tall-and-skinny
+// matrix B (typically the bitmap saxpy method, or dot2).  A is then read just
+// once for all k vectors.  T is split into its k columns, and each column is
+// accumulated into its vector W[j].
+
+// The vectors W[0:k-1] must all be distinct, but any W[j] may be aliased with
+// any vector U[i] or with A, since all of T is computed before any W[j] is
+// modified.  GrB_INVALID_VALUE is returned if W[i] and W[j] are the same
+// vector, for any i != j.  An error found in a given W[j] or U[j] is logged
+// in W[j].
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_Matrix_free (&B) ;                           \
+    GB_Matrix_free (&T) ;                           \
+    if (Tiles != NULL)                              \
+    {                                               \
+        for (int64_t j = 0 ; j < k ; j++)           \
+        {                                           \
+            GB_Matrix_free (&(Tiles [j])) ;         \
+        }                                           \
+    }                                               \
+    GB_FREE_WORK (&Tiles, Tiles_size) ;             \
+    GB_FREE_WORK (&Tile_ncols, Tile_ncols_size) ;   \
+    GB_FREE_WORK (&Wlist, Wlist_size) ;             \
+}
+
+#include "GB_mxm.h"
+#include "GB_concat.h"
+#include "GB_split.h"
+#include "GB_accum_mask.h"
+#include "GB_sort.h"
+
+// log any error in W[j]
+#define GB_LOG_IN(w)                                            \
+{                                                               \
+    Werk->logger_handle = &((w)->logger) ;                      \
+    Werk->logger_size_handle = &((w)->logger_size) ;            \
+}
+
+GrB_Info GB_mxv_batch               // W[j] = accum (W[j], A*U[j]) for all j
+(
+    GrB_Vector *W,                  // array of k input/output vectors
+    const bool C_replace,           // if true, clear each W[j] first
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Vector *U,            // array of k input vectors
+    const int64_t k,                // number of vectors in W and U
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return C unjumbled
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    struct GB_Matrix_opaque B_header, T_header ;
+    GrB_Matrix B = NULL, T = NULL ;
+    GrB_Matrix *Tiles = NULL ; size_t Tiles_size = 0 ;
+    GrB_Index *Tile_ncols = NULL ; size_t Tile_ncols_size = 0 ;
+    int64_t *Wlist = NULL ; size_t Wlist_size = 0 ;
+
+    GB_RETURN_IF_NULL (W) ;
+    GB_RETURN_IF_NULL (U) ;
+    GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    for (int64_t j = 0 ; j < k ; j++)
+    {
+        GB_RETURN_IF_NULL_OR_FAULTY (W [j]) ;
+        GB_RETURN_IF_NULL_OR_FAULTY (U [j]) ;
+    }
+
+    ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_mxv_batch", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for GB_mxv_batch", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for GB_mxv_batch", GB0) ;
+
+    // get the dimensions of op(A)
+    int64_t anrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    int64_t ancols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+
+    // check the domains and dimensions of each W[j] and U[j]
+    GrB_Type ztype = semiring->add->op->ztype ;
+    GrB_Type btype = semiring->multiply->ytype ;
+    for (int64_t j = 0 ; j < k ; j++)
+    {
+        GrB_Matrix w = (GrB_Matrix) W [j] ;
+        GrB_Matrix u = (GrB_Matrix) U [j] ;
+        GB_LOG_IN (w) ;
+        ASSERT_VECTOR_OK (W [j], "W[j] input for GB_mxv_batch", GB0) ;
+        ASSERT_VECTOR_OK (U [j], "U[j] input for GB_mxv_batch", GB0) ;
+        GB_OK (GB_compatible (w->type, w, NULL, false, accum, ztype, Werk)) ;
+        GB_OK (GB_BinaryOp_compatible (semiring->multiply, NULL, A->type,
+            u->type, GB_ignore_code, Werk)) ;
+        if (GB_NROWS (w) != anrows || GB_NROWS (u) != ancols)
+        {
+            GB_ERROR (GrB_DIMENSION_MISMATCH,
+                "Dimensions not compatible:\n"
+                "output W[" GBd "] is " GBd "-by-1\n"
+                "first input is " GBd "-by-" GBd "%s\n"
+                "second input U[" GBd "] is " GBd "-by-1",
+                j, GB_NROWS (w), anrows, ancols,
+                A_transpose ? " (transposed)" : "", j, GB_NROWS (u)) ;
+        }
+    }
+
+    if (k == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check that the output vectors are distinct
+    //--------------------------------------------------------------------------
+
+    Wlist = GB_MALLOC_WORK (k, int64_t, &Wlist_size) ;
+    if (Wlist == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    for (int64_t j = 0 ; j < k ; j++)
+    {
+        Wlist [j] = (int64_t) (W [j]) ;
+    }
+    GB_qsort_1 (Wlist, k) ;
+    for (int64_t j = 1 ; j < k ; j++)
+    {
+        if (Wlist [j-1] == Wlist [j])
+        {
+            GrB_Vector w = (GrB_Vector) Wlist [j] ;
+            GB_FREE_ALL ;
+            GB_LOG_IN (w) ;
+            GB_ERROR (GrB_INVALID_VALUE, "%s", "The output vectors W[0:k-1] "
+                "must be distinct") ;
+        }
+    }
+    GB_FREE_WORK (&Wlist, Wlist_size) ;
+    GB_LOG_IN (W [0]) ;
+
+    GBURBLE ("(mxv batch: " GBd " vectors) ", k) ;
+
+    // B and T are held in the same orientation as op(A).  If A is held by
+    // row and not transposed, each entry A(i,k) then accesses the row
+    // B(k,:), which is contiguous in memory, and updates the row T(i,:).
+    bool T_is_csc = (A->is_csc != A_transpose) ;
+
+    //--------------------------------------------------------------------------
+    // B = [U[0] U[1] ... U[k-1]]
+    //--------------------------------------------------------------------------
+
+    GB_CLEAR_STATIC_HEADER (B, &B_header) ;
+    GB_OK (GB_new (&B, // auto sparsity, existing header
+        btype, T_is_csc ? ancols : k, T_is_csc ? k : ancols, GB_Ap_calloc,
+        T_is_csc, GxB_AUTO_SPARSITY,
+        GB_Global_hyper_switch_get ( ), 1)) ;
+    GB_OK (GB_concat (B, (GrB_Matrix *) U, 1, k, Werk)) ;
+    ASSERT_MATRIX_OK (B, "B = [U[0:k-1]] for GB_mxv_batch", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // T = op(A)*B
+    //--------------------------------------------------------------------------
+
+    GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+    GB_OK (GB_new (&T, // auto sparsity, existing header
+        ztype, T_is_csc ? anrows : k, T_is_csc ? k : anrows, GB_Ap_calloc,
+        T_is_csc, GxB_AUTO_SPARSITY,
+        GB_Global_hyper_switch_get ( ), 1)) ;
+    GB_OK (GB_mxm (T, true, NULL, false, false, NULL, semiring,
+        A, A_transpose, B, false, false, AxB_method, do_sort, Werk)) ;
+    GB_Matrix_free (&B) ;
+    ASSERT_MATRIX_OK (T, "T = A*B for GB_mxv_batch", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // split T into its k columns
+    //--------------------------------------------------------------------------
+
+    Tiles = GB_CALLOC_WORK (k, GrB_Matrix, &Tiles_size) ;
+    Tile_ncols = GB_MALLOC_WORK (k, GrB_Index, &Tile_ncols_size) ;
+    if (Tiles == NULL || Tile_ncols == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    for (int64_t j = 0 ; j < k ; j++)
+    {
+        Tile_ncols [j] = 1 ;
+    }
+    GrB_Index Tile_nrows [1] ;
+    Tile_nrows [0] = anrows ;
+    GB_OK (GB_split (Tiles, 1, k, Tile_nrows, Tile_ncols, T, Werk)) ;
+    GB_Matrix_free (&T) ;
+
+    //--------------------------------------------------------------------------
+    // W[j] = accum (W[j], T(:,j)) for each j
+    //--------------------------------------------------------------------------
+
+    for (int64_t j = 0 ; j < k ; j++)
+    {
+        GB_LOG_IN (W [j]) ;
+        GB_OK (GB_accum_mask ((GrB_Matrix) W [j], NULL, NULL, accum,
+            &(Tiles [j]), C_replace, false, false, Werk)) ;
+        ASSERT_VECTOR_OK (W [j], "W[j] output for GB_mxv_batch", GB0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
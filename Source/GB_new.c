@@ -32,6 +32,7 @@
 // input.
 
 #include "GB.h"
+#include "GB_tuner.h"
 
 GrB_Info GB_new                 // create matrix, except for indices & values
 (
@@ -103,7 +104,7 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     bool A_is_hyper ;
     bool A_is_full_or_bitmap = false ;
     A->hyper_switch = hyper_switch ;
-    A->bitmap_switch = GB_Global_bitmap_switch_matrix_get (vlen, vdim) ;
+    A->bitmap_switch = GB_tuner_bitmap_switch (vlen, vdim) ;
     A->sparsity_control = GxB_AUTO_SPARSITY ;
 
     if (sparsity == GxB_HYPERSPARSE)
@@ -159,9 +160,11 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->p = NULL ; A->p_shallow = false ; A->p_size = 0 ;
     A->h = NULL ; A->h_shallow = false ; A->h_size = 0 ;
     A->Y = NULL ; A->Y_shallow = false ;
+    A->T = NULL ; A->T_cache = false ;
     A->b = NULL ; A->b_shallow = false ; A->b_size = 0 ;
     A->i = NULL ; A->i_shallow = false ; A->i_size = 0 ;
     A->x = NULL ; A->x_shallow = false ; A->x_size = 0 ;
+    A->shm = NULL ; A->shm_size = 0 ;
 
     A->nvals = 0 ;
     A->nzombies = 0 ;
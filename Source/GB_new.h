@@ -83,11 +83,26 @@ void GB_hyper_hash_free         // free the A->Y hyper_hash of a matrix
     GrB_Matrix A                // matrix with content to free
 ) ;
 
+void GB_transpose_cache_free    // free the A->T cached transpose of a matrix
+(
+    GrB_Matrix A                // matrix with content to free
+) ;
+
 void GB_phybix_free             // free all content of a matrix
 (
     GrB_Matrix A                // matrix with content to free
 ) ;
 
+void GB_shm_free                // remove the shared-memory mapping of A
+(
+    GrB_Matrix A                // matrix with content to free
+) ;
+
+GrB_Info GB_shm_unshare         // copy the shared-memory content of A
+(
+    GrB_Matrix A                // matrix to modify
+) ;
+
 void GB_Matrix_free             // free a matrix
 (
     GrB_Matrix *Ahandle         // handle of matrix to free
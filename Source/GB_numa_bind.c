@@ -0,0 +1,91 @@
+//------------------------------------------------------------------------------
+// GB_numa_bind: apply the NUMA policy of the Context to a block of memory
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If the NUMA policy of the Context of the calling user thread is
+// GxB_NUMA_INTERLEAVE or GxB_NUMA_LOCAL, the pages of a large block of
+// memory, just allocated and not yet touched, are bound with the mbind system
+// call.  The policy is only a hint: if the block is small, if the system does
+// not support NUMA, or if mbind fails, nothing is done.  Only pages that lie
+// entirely inside the block are modified, since the user-provided malloc
+// function may place other blocks in the same page.  Linux only; the system
+// call is used directly, so that GraphBLAS need not link against libnuma.
+
+// GxB_NUMA_FIRST_TOUCH requires no binding; it is handled by GB_memset.
+
+#include "GB.h"
+
+#if defined ( __linux__ )
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+// from linux/mempolicy.h:
+#define GB_MPOL_PREFERRED  1
+#define GB_MPOL_INTERLEAVE 3
+
+// blocks smaller than this are not bound
+#define GB_NUMA_MIN_SIZE (2*1024*1024)
+
+void GB_numa_bind
+(
+    void *p,                // block of memory to bind
+    size_t size             // size of the block, in bytes
+)
+{
+
+    #if defined ( __linux__ ) && defined ( SYS_mbind )
+
+        //----------------------------------------------------------------------
+        // check inputs
+        //----------------------------------------------------------------------
+
+        if (p == NULL || size < GB_NUMA_MIN_SIZE) return ;
+        int numa_policy = GB_Context_numa_policy ( ) ;
+        if (numa_policy != GxB_NUMA_INTERLEAVE &&
+            numa_policy != GxB_NUMA_LOCAL)
+        { 
+            return ;
+        }
+
+        //----------------------------------------------------------------------
+        // find the pages that lie entirely inside the block
+        //----------------------------------------------------------------------
+
+        long pagesize = sysconf (_SC_PAGESIZE) ;
+        if (pagesize <= 0) return ;
+        uintptr_t first = (uintptr_t) p ;
+        uintptr_t last  = first + size ;
+        first = ((first + pagesize - 1) / pagesize) * pagesize ;
+        last  = (last / pagesize) * pagesize ;
+        if (first >= last) return ;
+
+        //----------------------------------------------------------------------
+        // bind the pages
+        //----------------------------------------------------------------------
+
+        if (numa_policy == GxB_NUMA_INTERLEAVE)
+        { 
+            // interleave across all nodes: the kernel intersects the nodemask
+            // with the nodes the process is allowed to use
+            unsigned long nodemask [16] ;
+            memset (nodemask, 0xFF, sizeof (nodemask)) ;
+            (void) syscall (SYS_mbind, (void *) first, last - first,
+                GB_MPOL_INTERLEAVE, nodemask, 8 * sizeof (nodemask), 0) ;
+        }
+        else
+        { 
+            // MPOL_PREFERRED with an empty nodemask: allocate each page on
+            // the node of the thread that first touches it
+            (void) syscall (SYS_mbind, (void *) first, last - first,
+                GB_MPOL_PREFERRED, NULL, 0, 0) ;
+        }
+
+    #endif
+}
+
@@ -57,5 +57,25 @@ GrB_Info GB_Scalar_reduce
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_mxm_reduce              // C<M> = accum (C, reduce (A*B))
+(
+    GrB_Matrix C,                   // input/output vector or GrB_Scalar
+    const bool C_is_scalar,         // if true, C is a GrB_Scalar
+    const bool C_replace,           // if true, clear C before writing to it
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Monoid monoid,        // reduce monoid for t=reduce(A*B)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return C unjumbled
+    GB_Werk Werk
+) ;
+
 #endif
 
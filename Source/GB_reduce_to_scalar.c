@@ -27,6 +27,7 @@
 #include "GB_reduce.h"
 #include "GB_binop.h"
 #include "GB_stringify.h"
+#include "GB_tuner.h"
 #ifndef GBCOMPACT
 #include "GB_red__include.h"
 #endif
@@ -156,6 +157,8 @@ GrB_Info GB_reduce_to_scalar    // z = reduce_to_scalar (A)
         // use OpenMP on the CPU threads
         //----------------------------------------------------------------------
 
+        GB_tuner_state tune ;
+        GB_tuner_begin (&tune, GB_TUNER_REDUCE, A, NULL) ;
         int nthreads_max = GB_Context_nthreads_max ( ) ;
         double chunk = GB_Context_chunk ( ) ;
         int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
@@ -172,6 +175,7 @@ GrB_Info GB_reduce_to_scalar    // z = reduce_to_scalar (A)
         if (W == NULL || F == NULL)
         { 
             // out of memory
+            GB_tuner_end (&tune, GrB_OUT_OF_MEMORY) ;
             GB_FREE_ALL ;
             return (GrB_OUT_OF_MEMORY) ;
         }
@@ -386,6 +390,7 @@ GrB_Info GB_reduce_to_scalar    // z = reduce_to_scalar (A)
             }
             info = GrB_SUCCESS ;
         }
+        GB_tuner_end (&tune, info) ;
     }
 
     if (info != GrB_SUCCESS)
@@ -99,6 +99,11 @@ GrB_Info GB_reshape         // reshape a GrB_Matrix into another GrB_Matrix
     //--------------------------------------------------------------------------
 
     GB_MATRIX_WAIT (A) ;
+    if (in_place)
+    { 
+        // A is modified in-place, so its cached transpose is no longer valid
+        GB_transpose_cache_free (A) ;
+    }
 
     GrB_Type type = A->type ;
     bool A_is_csc = A->is_csc ;
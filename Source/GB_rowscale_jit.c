@@ -33,7 +33,7 @@ GrB_Info GB_rowscale_jit      // C=D*B, rowscale, via the JIT
     char *suffix ;
     uint64_t hash = GB_encodify_ewise (&encoding, &suffix,
         GB_JIT_KERNEL_ROWSCALE, false,
-        false, false, GB_sparsity (C), C->type, NULL, false, false,
+        false, false, false, GB_sparsity (C), C->type, NULL, false, false,
         binaryop, flipxy, D, B) ;
 
     //--------------------------------------------------------------------------
@@ -18,6 +18,7 @@
 #include "GB_accum_mask.h"
 #include "GB_transpose.h"
 #include "GB_scalar_wrap.h"
+#include "GB_tuner.h"
 
 GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
 (
@@ -384,7 +385,11 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     else
     { 
         // T = select (A, Thunk)
-        GB_OK (GB_selector (T, op, flipij, A, Thunk2, Werk)) ;
+        GB_tuner_state tune ;
+        GB_tuner_begin (&tune, GB_TUNER_SELECT, A, NULL) ;
+        info = GB_selector (T, op, flipij, A, Thunk2, Werk) ;
+        GB_tuner_end (&tune, info) ;
+        GB_OK (info) ;
     }
 
     T->is_csc = A_csc ;
@@ -362,24 +362,28 @@ GrB_Info GB_select_sparse
         // transplant Cp, Ci, Cx back into A
         //----------------------------------------------------------------------
 
-        // TODO: this is not parallel: use GB_hyper_prune
         if (A->h != NULL && C_nvec_nonempty < anvec)
         {
-            // prune empty vectors from Ah and Ap
-            int64_t cnvec = 0 ;
-            for (int64_t k = 0 ; k < anvec ; k++)
-            {
-                if (Cp [k] < Cp [k+1])
-                { 
-                    Ah [cnvec] = Ah [k] ;
-                    Ap [cnvec] = Cp [k] ;
-                    cnvec++ ;
-                }
+            // prune empty vectors from Ah and Cp, in parallel
+            int64_t *restrict Ap_new = NULL ; size_t Ap_new_size = 0 ;
+            int64_t *restrict Ah_new = NULL ; size_t Ah_new_size = 0 ;
+            int64_t nvec_new, plen_new ;
+            info = GB_hyper_prune (&Ap_new, &Ap_new_size, &Ah_new,
+                &Ah_new_size, &nvec_new, &plen_new, Cp, Ah, anvec, Werk) ;
+            if (info != GrB_SUCCESS)
+            { 
+                // out of memory
+                GB_FREE_ALL ;
+                return (info) ;
             }
-            Ap [cnvec] = Cp [anvec] ;
-            A->nvec = cnvec ;
-            ASSERT (A->nvec == C_nvec_nonempty) ;
+            ASSERT (nvec_new == C_nvec_nonempty) ;
             GB_FREE (&Cp, Cp_size) ;
+            GB_FREE (&Ap, Ap_size) ;
+            GB_FREE (&(A->h), A->h_size) ;
+            A->p = Ap_new ; A->p_size = Ap_new_size ;
+            A->h = Ah_new ; A->h_size = Ah_new_size ;
+            A->nvec = nvec_new ;
+            A->plen = plen_new ;
             // the A->Y hyper_hash is now invalid
             GB_hyper_hash_free (A) ;
         }
@@ -428,26 +432,18 @@ GrB_Info GB_select_sparse
             // A and C are hypersparse: copy non-empty vectors from Ah to Ch
             //------------------------------------------------------------------
 
-            Ch = GB_MALLOC (anvec, int64_t, &Ch_size) ;
-            if (Ch == NULL)
+            int64_t *restrict Cp_new = NULL ; size_t Cp_new_size = 0 ;
+            int64_t cnvec ;
+            info = GB_hyper_prune (&Cp_new, &Cp_new_size, &Ch, &Ch_size,
+                &cnvec, &cplen, Cp, Ah, anvec, Werk) ;
+            if (info != GrB_SUCCESS)
             { 
                 // out of memory
                 GB_FREE_ALL ;
-                return (GrB_OUT_OF_MEMORY) ;
+                return (info) ;
             }
-
-            // TODO: do in parallel: use GB_hyper_prune
-            int64_t cnvec = 0 ;
-            for (int64_t k = 0 ; k < anvec ; k++)
-            {
-                if (Cp [k] < Cp [k+1])
-                { 
-                    Ch [cnvec] = Ah [k] ;
-                    Cp [cnvec] = Cp [k] ;
-                    cnvec++ ;
-                }
-            }
-            Cp [cnvec] = Cp [anvec] ;
+            GB_FREE (&Cp, Cp_size) ;
+            Cp = Cp_new ; Cp_size = Cp_new_size ;
             C->nvec = cnvec ;
             ASSERT (C->nvec == C_nvec_nonempty) ;
         }
@@ -128,14 +128,17 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     //--------------------------------------------------------------------------
 
     int32_t algo, level ;
-    GB_serialize_method (&algo, &level, method) ;
+    bool delta ;
+    GB_serialize_method (&algo, &level, &delta, method) ;
     method = algo + level ;
-    GBURBLE ("(compression: %s%s%s%s:%d) ",
+    // the integer arrays Ap, Ah, and Ai are delta-encoded if requested
+    int32_t index_method = method + (delta ? GxB_COMPRESSION_DELTA : 0) ;
+    GBURBLE ("(compression: %s%s%s%s:%d%s) ",
         (algo == GxB_COMPRESSION_NONE ) ? "none" : "",
         (algo == GxB_COMPRESSION_LZ4  ) ? "LZ4" : "",
         (algo == GxB_COMPRESSION_LZ4HC) ? "LZ4HC" : "",
         (algo == GxB_COMPRESSION_ZSTD ) ? "ZSTD" : "",
-        level) ;
+        level, delta ? "+delta" : "") ;
 
     //--------------------------------------------------------------------------
     // get the content of the matrix
@@ -199,27 +202,30 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     GB_OK (GB_serialize_array (&Ap_Blocks, &Ap_Blocks_size,
         &Ap_Sblocks, &Ap_Sblocks_size, &Ap_nblocks, &Ap_method,
         &Ap_compressed_size, dryrun,
-        (GB_void *) A->p, Ap_len, method, algo, level, Werk)) ;
+        (GB_void *) A->p, Ap_len, index_method, algo, level, delta,
+        Werk)) ;
 
     GB_OK (GB_serialize_array (&Ah_Blocks, &Ah_Blocks_size,
         &Ah_Sblocks, &Ah_Sblocks_size, &Ah_nblocks, &Ah_method,
         &Ah_compressed_size, dryrun,
-        (GB_void *) A->h, Ah_len, method, algo, level, Werk)) ;
+        (GB_void *) A->h, Ah_len, index_method, algo, level, delta,
+        Werk)) ;
 
     GB_OK (GB_serialize_array (&Ab_Blocks, &Ab_Blocks_size,
         &Ab_Sblocks, &Ab_Sblocks_size, &Ab_nblocks, &Ab_method,
         &Ab_compressed_size, dryrun,
-        (GB_void *) A->b, Ab_len, method, algo, level, Werk)) ;
+        (GB_void *) A->b, Ab_len, method, algo, level, false, Werk)) ;
 
     GB_OK (GB_serialize_array (&Ai_Blocks, &Ai_Blocks_size,
         &Ai_Sblocks, &Ai_Sblocks_size, &Ai_nblocks, &Ai_method,
         &Ai_compressed_size, dryrun,
-        (GB_void *) A->i, Ai_len, method, algo, level, Werk)) ;
+        (GB_void *) A->i, Ai_len, index_method, algo, level, delta,
+        Werk)) ;
 
     GB_OK (GB_serialize_array (&Ax_Blocks, &Ax_Blocks_size,
         &Ax_Sblocks, &Ax_Sblocks_size, &Ax_nblocks, &Ax_method,
         &Ax_compressed_size, dryrun,
-        (GB_void *) A->x, Ax_len, method, algo, level, Werk)) ;
+        (GB_void *) A->x, Ax_len, method, algo, level, false, Werk)) ;
 
     //--------------------------------------------------------------------------
     // determine the size of the blob
@@ -26,6 +26,7 @@ void GB_serialize_method
     // output
     int32_t *algo,                  // algorithm to use
     int32_t *level,                 // compression level
+    bool *delta,                    // if true, delta-encode Ap, Ah, and Ai
     // input
     int32_t method
 ) ;
@@ -65,6 +66,7 @@ GrB_Info GB_serialize_array
     int32_t method,                     // compression method requested
     int32_t algo,                       // compression algorithm
     int32_t level,                      // compression level
+    bool delta,                         // if true, delta-encode X as int64
     GB_Werk Werk
 ) ;
 
@@ -103,6 +105,116 @@ GrB_Info GB_deserialize_from_blob
     size_t *s_handle            // where to read from the blob
 ) ;
 
+GrB_Info GB_serialize_delta         // serialize the changes to a matrix
+(
+    // output:
+    GB_void **blob_handle,          // serialized matrix, allocated on output
+    size_t *blob_size_handle,       // size of the blob
+    // input:
+    const GrB_Matrix A,             // matrix to serialize
+    const GB_void *prior,           // prior blob from GB_serialize_delta,
+                                    // or NULL
+    size_t prior_size,              // size of the prior blob
+    int32_t method,                 // method to use
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_deserialize_delta       // deserialize a chain of blobs
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the blobs
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const GB_void **blobs,          // blobs [0:nblobs-1]
+    const GrB_Index *blob_sizes,    // blob_sizes [0:nblobs-1]
+    int64_t nblobs                  // # of blobs in the chain
+) ;
+
+//------------------------------------------------------------------------------
+// delta encoding of int64_t arrays
+//------------------------------------------------------------------------------
+
+// With GxB_COMPRESSION_DELTA, each block X [0:n-1] of an int64_t array (Ap,
+// Ah, or Ai) is transformed before it is compressed.  The differences d =
+// X [k] - X [k-1] are computed (with X [-1] taken as zero, so each block can
+// be decoded independently), and mapped to unsigned integers by a zigzag
+// encoding, so that small negative deltas (at the start of each vector of Ai)
+// also become small.  The bytes are then transposed, so that byte b of the
+// kth delta is held in W [b*n + k].  The upper bytes of the deltas are
+// nearly all zero, and they become long runs that LZ4 and ZSTD compress very
+// well.  W and X have the same size, so the layout of the blob is unchanged.
+
+// The deltas are computed and transposed in tiles of GB_DELTA_TILE entries,
+// so that the inner loops are simple and can be vectorized by the compiler.
+
+#define GB_DELTA_TILE 256
+
+static inline void GB_serialize_delta_encode
+(
+    uint8_t *restrict W,            // output of size 8*n bytes
+    const int64_t *restrict X,      // input of size n
+    const int64_t n
+)
+{
+    uint64_t U [GB_DELTA_TILE] ;
+    uint64_t prev = 0 ;
+    for (int64_t k1 = 0 ; k1 < n ; k1 += GB_DELTA_TILE)
+    {
+        int64_t t = GB_IMIN (GB_DELTA_TILE, n - k1) ;
+        // U = zigzag (X [k1:k1+t-1] - X [k1-1:k1+t-2])
+        for (int64_t k = 0 ; k < t ; k++)
+        { 
+            uint64_t x = (uint64_t) X [k1 + k] ;
+            int64_t d = (int64_t) (x - prev) ;
+            prev = x ;
+            U [k] = (((uint64_t) d) << 1) ^ ((uint64_t) (d >> 63)) ;
+        }
+        // scatter the bytes of U into the 8 byte planes of W
+        for (int b = 0 ; b < 8 ; b++)
+        {
+            uint8_t *restrict Wb = W + b*n + k1 ;
+            for (int64_t k = 0 ; k < t ; k++)
+            { 
+                Wb [k] = (uint8_t) (U [k] >> (8*b)) ;
+            }
+        }
+    }
+}
+
+static inline void GB_serialize_delta_decode
+(
+    int64_t *restrict X,            // output of size n
+    const uint8_t *restrict W,      // input of size 8*n bytes
+    const int64_t n
+)
+{
+    uint64_t U [GB_DELTA_TILE] ;
+    uint64_t prev = 0 ;
+    for (int64_t k1 = 0 ; k1 < n ; k1 += GB_DELTA_TILE)
+    {
+        int64_t t = GB_IMIN (GB_DELTA_TILE, n - k1) ;
+        // gather the bytes of U from the 8 byte planes of W
+        for (int64_t k = 0 ; k < t ; k++)
+        { 
+            U [k] = (uint64_t) W [k1 + k] ;
+        }
+        for (int b = 1 ; b < 8 ; b++)
+        {
+            const uint8_t *restrict Wb = W + b*n + k1 ;
+            for (int64_t k = 0 ; k < t ; k++)
+            { 
+                U [k] |= ((uint64_t) Wb [k]) << (8*b) ;
+            }
+        }
+        // X [k1:k1+t-1] = cumulative sum of the decoded deltas
+        for (int64_t k = 0 ; k < t ; k++)
+        { 
+            prev += (U [k] >> 1) ^ (-(U [k] & 1)) ;
+            X [k1 + k] = (int64_t) prev ;
+        }
+    }
+}
+
 #define GB_BLOB_HEADER_SIZE \
     sizeof (uint64_t)           /* blob_size                            */  \
     + 11 * sizeof (int64_t)     /* vlen, vdim, nvec, nvec_nonempty,     */  \
@@ -112,6 +224,58 @@ GrB_Info GB_deserialize_from_blob
                                 /* sparsity_iso_csc                     */  \
     + 2 * sizeof (float)        /* hyper_switch, bitmap_switch          */
 
+// The checkpoint blob for GB_serialize_delta and GB_deserialize_delta.  Each
+// of the 5 arrays Ap, Ah, Ab, Ai, and Ax is split into chunks of chunk_size
+// bytes (the last chunk of each array may be smaller).  The header is followed
+// by the 128-byte type name (for user-defined types only), the manifest
+// Hash [0:nchunks-1] of all chunks of all 5 arrays, the compressed sizes
+// Csize [0:nchunks-1] of each chunk held in the blob (zero if the chunk is
+// unchanged from the prior blob), and then the compressed chunks themselves.
+// The hash of the blob is the hash of the header (starting at version) and
+// the manifest, and prior_hash is the hash of the prior blob in the chain
+// (zero for a blob with no prior).
+
+#define GB_DELTA_MAGIC  0x61746C6544427247  /* "GrBDelta" */
+#define GB_DELTA_CHUNK  (64*1024)
+
+#define GB_DELTA_HEADER_SIZE \
+    sizeof (uint64_t)           /* blob_size                            */  \
+    + 3 * sizeof (uint64_t)     /* magic, prior_hash, hash              */  \
+    + 6 * sizeof (int32_t)      /* version, typecode, sparsity_control, */  \
+                                /* sparsity_iso_csc, method, unused     */  \
+    + 2 * sizeof (float)        /* hyper_switch, bitmap_switch          */  \
+    + 12 * sizeof (int64_t)     /* vlen, vdim, nvec, nvec_nonempty,     */  \
+                                /* nvals, typesize, chunk_size,         */  \
+                                /* A[phbix]_len                         */
+
+// offset of the hashed portion of the header (starting at version)
+#define GB_DELTA_HASH_START (4 * sizeof (uint64_t))
+
+// contents of the header and manifest of a blob from GB_serialize_delta
+typedef struct
+{
+    uint64_t blob_size, prior_hash, hash ;
+    int32_t version, typecode, sparsity_control, sparsity_iso_csc, method ;
+    float hyper_switch, bitmap_switch ;
+    int64_t vlen, vdim, nvec, nvec_nonempty, nvals, typesize, chunk_size ;
+    int64_t len [5] ;           // size in bytes of Ap, Ah, Ab, Ai, and Ax
+    int64_t first [6] ;         // chunks of array a are first [a:a+1]-1
+    const char *type_name ;     // type name, or NULL if not user-defined
+    const uint64_t *Hash ;      // Hash [0:nchunks-1], in the blob
+    const int64_t *Csize ;      // Csize [0:nchunks-1], in the blob
+    size_t manifest_end ;       // end of the manifest, in the blob
+}
+GB_delta_header ;
+
+GrB_Info GB_deserialize_delta_header    // parse a GB_serialize_delta blob
+(
+    // output:
+    GB_delta_header *H,         // header and manifest of the blob
+    // input:
+    const GB_void *blob,        // the blob (or just its header and manifest)
+    size_t blob_size            // size of the blob
+) ;
+
 // write a scalar to the blob
 #define GB_BLOB_WRITE(x,type)                                               \
     memcpy (blob + s, &(x), sizeof (type)) ;                                \
@@ -13,6 +13,11 @@
 // a sequence of independently allocated blocks, or returned as-is if not
 // compressed.  Currently, only LZ4, LZ4HC, and ZSTD are supported.
 
+// If delta is true, X is an int64_t array (Ap, Ah, or Ai), and each block is
+// delta-encoded by GB_serialize_delta_encode before it is compressed.  The
+// blocks then hold whole int64_t entries, and GB_deserialize_from_blob must
+// partition X in the same way.
+
 #include "GB.h"
 #include "GB_serialize.h"
 #include "GB_lz4.h"
@@ -21,6 +26,7 @@
 #define GB_FREE_ALL                                             \
 {                                                               \
     GB_FREE (&Sblocks, Sblocks_size) ;                          \
+    GB_FREE_WORK (&W, W_size) ;                                 \
     GB_serialize_free_blocks (&Blocks, Blocks_size, nblocks) ;  \
 }
 
@@ -42,6 +48,7 @@ GrB_Info GB_serialize_array
     int32_t method,                     // compression method requested
     int32_t algo,                       // compression algorithm
     int32_t level,                      // compression level
+    bool delta,                         // if true, delta-encode X as int64
     GB_Werk Werk
 )
 {
@@ -61,6 +68,7 @@ GrB_Info GB_serialize_array
     size_t Blocks_size = 0, Sblocks_size = 0 ;
     int32_t nblocks = 0 ;
     int64_t *Sblocks = NULL ;
+    GB_void *W = NULL ; size_t W_size = 0 ;
 
     //--------------------------------------------------------------------------
     // check for quick return
@@ -146,6 +154,12 @@ GrB_Info GB_serialize_array
     nthreads = GB_IMIN (nthreads, nblocks) ;
     (*nblocks_handle) = nblocks ;
 
+    // with delta encoding, X is partitioned into blocks of whole int64_t
+    // entries, in units of 8 bytes
+    ASSERT (GB_IMPLIES (delta, len % sizeof (int64_t) == 0)) ;
+    const int64_t unit = (delta) ? sizeof (int64_t) : 1 ;
+    const int64_t nunits = len / unit ;
+
     // allocate the output Blocks: one per block plus the sentinel block
     if (!dryrun)
     {
@@ -166,8 +180,8 @@ GrB_Info GB_serialize_array
     { 
         // allocate a single block for the compression of X [kstart:kend-1]
         int64_t kstart, kend ;
-        GB_PARTITION (kstart, kend, len, blockid, nblocks) ;
-        size_t uncompressed = kend - kstart ;
+        GB_PARTITION (kstart, kend, nunits, blockid, nblocks) ;
+        size_t uncompressed = (kend - kstart) * unit ;
         ASSERT (uncompressed < INT32_MAX) ;
         ASSERT (uncompressed > 0) ;
 
@@ -210,6 +224,13 @@ GrB_Info GB_serialize_array
         return (GrB_SUCCESS) ;
     }
 
+    if (ok && delta)
+    { 
+        // allocate workspace for the delta-encoded blocks
+        W = GB_MALLOC_WORK (len, GB_void, &W_size) ;
+        ok = (W != NULL) ;
+    }
+
     if (!ok)
     { 
         // out of memory
@@ -227,10 +248,21 @@ GrB_Info GB_serialize_array
     {
         // compress X [kstart:kend-1] into Blocks [blockid].p
         int64_t kstart, kend ;
-        GB_PARTITION (kstart, kend, len, blockid, nblocks) ;
-        const char *src = (const char *) (X + kstart) ;     // source
+        GB_PARTITION (kstart, kend, nunits, blockid, nblocks) ;
+        const char *src ;                                   // source
+        if (delta)
+        { 
+            // W [kstart:kend-1] = delta encoding of X [kstart:kend-1]
+            GB_serialize_delta_encode ((uint8_t *) (W + kstart*unit),
+                ((int64_t *) X) + kstart, kend - kstart) ;
+            src = (const char *) (W + kstart*unit) ;
+        }
+        else
+        { 
+            src = (const char *) (X + kstart) ;
+        }
         char *dst = (char *) Blocks [blockid].p ;           // destination
-        int srcSize = (int) (kend - kstart) ;               // size of source
+        int srcSize = (int) ((kend - kstart) * unit) ;
         size_t dsize = Blocks [blockid].p_size_allocated ;  // size of dest
         int dstCapacity = (int) GB_IMIN (dsize, INT32_MAX) ;
         int s ;
@@ -274,6 +306,7 @@ GrB_Info GB_serialize_array
     //--------------------------------------------------------------------------
 
     GB_cumsum (Sblocks, nblocks, NULL, 1, Werk) ;
+    GB_FREE_WORK (&W, W_size) ;
 
     //--------------------------------------------------------------------------
     // free workspace return result
@@ -0,0 +1,454 @@
+//------------------------------------------------------------------------------
+// GB_serialize_delta: serialize the changes to a matrix since a prior blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// An incremental checkpoint of a matrix.  Each of the arrays Ap, Ah, Ab, Ai,
+// and Ax is split into chunks of GB_DELTA_CHUNK bytes, and the hash of each
+// chunk is computed with XXH3_64bits.  If a prior blob is given, only the
+// chunks whose hash and size differ from the chunk at the same position in the
+// prior blob are compressed and written to the new blob.  All other chunks are
+// taken from the prior blob by GB_deserialize_delta.  If there is no prior
+// blob, all chunks are written, and the blob can be used as the base of a
+// chain of checkpoints.
+
+// The new blob holds the hashes of all the chunks of the matrix (not just the
+// ones that changed), so it can be used as the prior blob for the next
+// checkpoint.  Only the header and manifest of the prior blob are accessed.
+
+// Chunks are held at fixed positions in each array, so changes to the values
+// of existing entries (in Ax or Ab) lead to a small blob.  Inserting or
+// deleting entries of a sparse matrix shifts all of Ai and Ax after the first
+// change, and so all of those chunks must be written.
+
+// The GrB_NAME of the matrix is not saved in the blob.
+
+#include "GB.h"
+#include "GB_serialize.h"
+#include "GB_lz4.h"
+#include "GB_zstd.h"
+
+// xxHash uses switch statements with no default case.
+#if GB_COMPILER_GCC
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#endif
+
+#define XXH_INLINE_ALL
+#define XXH_NO_STREAM
+#include "xxhash.h"
+
+#define GB_FREE_WORKSPACE                               \
+{                                                       \
+    GB_FREE_WORK (&Hash, Hash_size) ;                   \
+    GB_FREE_WORK (&Csize, Csize_size) ;                 \
+    GB_FREE_WORK (&Changed, Changed_size) ;             \
+    GB_serialize_free_blocks (&Blocks, Blocks_size,     \
+        (int32_t) nchanged) ;                           \
+}
+
+#define GB_FREE_ALL                                     \
+{                                                       \
+    GB_FREE_WORKSPACE ;                                 \
+    GB_FREE (&blob, blob_size_allocated) ;              \
+}
+
+GrB_Info GB_serialize_delta         // serialize the changes to a matrix
+(
+    // output:
+    GB_void **blob_handle,          // serialized matrix, allocated on output
+    size_t *blob_size_handle,       // size of the blob
+    // input:
+    const GrB_Matrix A,             // matrix to serialize
+    const GB_void *prior,           // prior blob from GB_serialize_delta,
+                                    // or NULL
+    size_t prior_size,              // size of the prior blob
+    int32_t method,                 // method to use
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (blob_handle != NULL && blob_size_handle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for serialize delta", GB0) ;
+
+    GB_void *blob = NULL ; size_t blob_size_allocated = 0 ;
+    uint64_t *Hash = NULL ; size_t Hash_size = 0 ;
+    int64_t *Csize = NULL ; size_t Csize_size = 0 ;
+    int64_t *Changed = NULL ; size_t Changed_size = 0 ;
+    GB_blocks *Blocks = NULL ; size_t Blocks_size = 0 ;
+    int64_t nchanged = 0 ;
+    (*blob_handle) = NULL ;
+    (*blob_size_handle) = 0 ;
+
+    // get the header and manifest of the prior blob, if present
+    GB_delta_header Prior ;
+    if (prior != NULL)
+    {
+        GB_OK (GB_deserialize_delta_header (&Prior, prior, prior_size)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // ensure all pending work is finished
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_wait (A, "A to serialize", Werk)) ;
+    ASSERT (A->nvec_nonempty >= 0) ;
+
+    //--------------------------------------------------------------------------
+    // determine maximum # of threads
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    //--------------------------------------------------------------------------
+    // parse the method
+    //--------------------------------------------------------------------------
+
+    // GxB_COMPRESSION_DELTA is ignored; each chunk is compressed as-is
+    int32_t algo, level ;
+    bool delta ;
+    GB_serialize_method (&algo, &level, &delta, method) ;
+    method = algo + level ;
+    GBURBLE ("(compression: %s%s%s%s:%d%s) ",
+        (algo == GxB_COMPRESSION_NONE ) ? "none" : "",
+        (algo == GxB_COMPRESSION_LZ4  ) ? "LZ4" : "",
+        (algo == GxB_COMPRESSION_LZ4HC) ? "LZ4HC" : "",
+        (algo == GxB_COMPRESSION_ZSTD ) ? "ZSTD" : "",
+        level, (prior == NULL) ? "" : ", delta from prior blob") ;
+
+    //--------------------------------------------------------------------------
+    // get the content of the matrix
+    //--------------------------------------------------------------------------
+
+    int32_t version = GxB_IMPLEMENTATION ;
+    int64_t vlen = A->vlen ;
+    int64_t vdim = A->vdim ;
+    int64_t nvec = A->nvec ;
+    int64_t nvals = A->nvals ;
+    int64_t nvec_nonempty = A->nvec_nonempty ;
+    int32_t sparsity = GB_sparsity (A) ;
+    bool iso = A->iso ;
+    float hyper_switch = A->hyper_switch ;
+    float bitmap_switch = A->bitmap_switch ;
+    int32_t sparsity_control = A->sparsity_control ;
+    int32_t sparsity_iso_csc = (4 * sparsity) + (iso ? 2 : 0) +
+        (A->is_csc ? 1 : 0) ;
+    int32_t unused = 0 ;
+    GrB_Type atype = A->type ;
+    int64_t typesize = atype->size ;
+    int32_t typecode = (int32_t) (atype->code) ;
+    int64_t anz = GB_nnz (A) ;
+    int64_t anz_held = GB_nnz_held (A) ;
+    int64_t chunk_size = GB_DELTA_CHUNK ;
+
+    // determine the uncompressed sizes of Ap, Ah, Ab, Ai, and Ax
+    int64_t len [5] = { 0, 0, 0, 0, 0 } ;
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            len [1] = sizeof (GrB_Index) * nvec ;
+            // fall through to the sparse case
+        case GxB_SPARSE :
+            len [0] = sizeof (GrB_Index) * (nvec+1) ;
+            len [3] = sizeof (GrB_Index) * anz ;
+            len [4] = typesize * (iso ? 1 : anz) ;
+            break ;
+        case GxB_BITMAP :
+            len [2] = sizeof (int8_t) * anz_held ;
+            // fall through to the full case
+        case GxB_FULL :
+            len [4] = typesize * (iso ? 1 : anz_held) ;
+            break ;
+        default: ;
+    }
+    const GB_void *X [5] = { (GB_void *) A->p, (GB_void *) A->h,
+        (GB_void *) A->b, (GB_void *) A->i, (GB_void *) A->x } ;
+
+    // chunks of the array a are first [a] to first [a+1]-1
+    int64_t first [6] ;
+    first [0] = 0 ;
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        first [a+1] = first [a] + GB_ICEIL (len [a], chunk_size) ;
+    }
+    int64_t nchunks = first [5] ;
+
+    // the prior chunks can only be reused if the chunk size is the same
+    bool use_prior = (prior != NULL && Prior.chunk_size == chunk_size) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    Hash = GB_MALLOC_WORK (nchunks + 1, uint64_t, &Hash_size) ;
+    Csize = GB_CALLOC_WORK (nchunks + 1, int64_t, &Csize_size) ;
+    Changed = GB_MALLOC_WORK (nchunks + 1, int64_t, &Changed_size) ;
+    if (Hash == NULL || Csize == NULL || Changed == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // hash each chunk and compare with the prior blob
+    //--------------------------------------------------------------------------
+
+    int nthreads = GB_IMIN (nthreads_max, GB_IMAX (nchunks, 1)) ;
+    int64_t g ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (g = 0 ; g < nchunks ; g++)
+    {
+        // chunk g is the kth chunk of the array a
+        int a = 0 ;
+        while (g >= first [a+1]) a++ ;
+        int64_t k = g - first [a] ;
+        int64_t kstart = k * chunk_size ;
+        int64_t clen = GB_IMIN (chunk_size, len [a] - kstart) ;
+        uint64_t hash = XXH3_64bits (X [a] + kstart, clen) ;
+        Hash [g] = hash ;
+        // the chunk is unchanged if the prior chunk k of array a has the
+        // same size and the same hash
+        bool changed = true ;
+        if (use_prior && k < Prior.first [a+1] - Prior.first [a])
+        {
+            int64_t prior_clen = GB_IMIN (chunk_size, Prior.len [a] - kstart) ;
+            changed = (prior_clen != clen) ||
+                (Prior.Hash [Prior.first [a] + k] != hash) ;
+        }
+        Changed [g] = changed ;
+    }
+
+    // Changed [0:nchanged-1] = list of the chunks that have changed
+    for (g = 0 ; g < nchunks ; g++)
+    {
+        if (Changed [g])
+        {
+            Changed [nchanged++] = g ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the compressed chunks
+    //--------------------------------------------------------------------------
+
+    Blocks = GB_CALLOC (nchanged + 1, GB_blocks, &Blocks_size) ;
+    if (Blocks == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    bool ok = true ;
+    for (int64_t c = 0 ; c < nchanged && ok ; c++)
+    {
+        g = Changed [c] ;
+        int a = 0 ;
+        while (g >= first [a+1]) a++ ;
+        int64_t kstart = (g - first [a]) * chunk_size ;
+        int64_t clen = GB_IMIN (chunk_size, len [a] - kstart) ;
+        if (algo == GxB_COMPRESSION_NONE)
+        {
+            // the chunk is not compressed; it is copied as-is into the blob
+            Blocks [c].p = (void *) (X [a] + kstart) ;
+            Blocks [c].p_size_allocated = 0 ;   // p is shallow
+        }
+        else
+        {
+            // allocate space for the compressed chunk
+            size_t s = (algo == GxB_COMPRESSION_ZSTD) ?
+                ZSTD_compressBound (clen) :
+                (size_t) LZ4_compressBound ((int) clen) ;
+            size_t size_allocated = 0 ;
+            GB_void *p = GB_MALLOC (s, GB_void, &size_allocated) ;
+            ok = (p != NULL) ;
+            Blocks [c].p = p ;
+            Blocks [c].p_size_allocated = size_allocated ;
+        }
+    }
+
+    if (!ok)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compress the changed chunks in parallel
+    //--------------------------------------------------------------------------
+
+    nthreads = GB_IMIN (nthreads_max, GB_IMAX (nchanged, 1)) ;
+    int64_t c ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+        reduction(&&:ok)
+    for (c = 0 ; c < nchanged ; c++)
+    {
+        int64_t gc = Changed [c] ;
+        int a = 0 ;
+        while (gc >= first [a+1]) a++ ;
+        int64_t kstart = (gc - first [a]) * chunk_size ;
+        int64_t clen = GB_IMIN (chunk_size, len [a] - kstart) ;
+        const char *src = (const char *) (X [a] + kstart) ;
+        char *dst = (char *) Blocks [c].p ;
+        int dstCapacity = (int) GB_IMIN (Blocks [c].p_size_allocated,
+            INT32_MAX) ;
+        int s ;
+        size_t s64 ;
+        switch (algo)
+        {
+
+            case GxB_COMPRESSION_NONE :
+                s64 = clen ;
+                break ;
+
+            case GxB_COMPRESSION_LZ4 :
+                s = LZ4_compress_default (src, dst, (int) clen, dstCapacity) ;
+                ok = ok && (s > 0) ;
+                s64 = (size_t) s ;
+                break ;
+
+            case GxB_COMPRESSION_LZ4HC :
+                s = LZ4_compress_HC (src, dst, (int) clen, dstCapacity,
+                    level) ;
+                ok = ok && (s > 0) ;
+                s64 = (size_t) s ;
+                break ;
+
+            default :
+            case GxB_COMPRESSION_ZSTD :
+                s64 = ZSTD_compress (dst, dstCapacity, src, clen, level) ;
+                ok = ok && (s64 <= dstCapacity) ;
+                break ;
+        }
+        // the compressed chunk is now in dst [0:s64-1]
+        Csize [gc] = (int64_t) s64 ;
+    }
+
+    if (!ok)
+    {
+        // compression failure: this can "never" occur
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the size of the blob and allocate it
+    //--------------------------------------------------------------------------
+
+    // Changed [c] becomes the position of the cth changed chunk in the blob
+    size_t s = GB_DELTA_HEADER_SIZE
+        + ((typecode == GB_UDT_code) ? GxB_MAX_NAME_LEN : 0)
+        + nchunks * (sizeof (uint64_t) + sizeof (int64_t)) ;
+    for (c = 0 ; c < nchanged ; c++)
+    {
+        int64_t csize = Csize [Changed [c]] ;
+        Changed [c] = s ;
+        s += csize ;
+    }
+    size_t blob_size = s ;
+
+    blob = GB_MALLOC (blob_size, GB_void, &blob_size_allocated) ;
+    if (blob == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the header, type name, and manifest into the blob
+    //--------------------------------------------------------------------------
+
+    s = 0 ;
+    uint64_t blob_size64 = (uint64_t) blob_size ;
+    uint64_t magic = GB_DELTA_MAGIC ;
+    uint64_t prior_hash = (prior == NULL) ? 0 : Prior.hash ;
+    uint64_t hash = 0 ;     // computed below
+    GB_BLOB_WRITE (blob_size64, uint64_t) ;
+    GB_BLOB_WRITE (magic, uint64_t) ;
+    GB_BLOB_WRITE (prior_hash, uint64_t) ;
+    GB_BLOB_WRITE (hash, uint64_t) ;
+    GB_BLOB_WRITE (version, int32_t) ;
+    GB_BLOB_WRITE (typecode, int32_t) ;
+    GB_BLOB_WRITE (sparsity_control, int32_t) ;
+    GB_BLOB_WRITE (sparsity_iso_csc, int32_t) ;
+    GB_BLOB_WRITE (method, int32_t) ;
+    GB_BLOB_WRITE (unused, int32_t) ;
+    GB_BLOB_WRITE (hyper_switch, float) ;
+    GB_BLOB_WRITE (bitmap_switch, float) ;
+    GB_BLOB_WRITE (vlen, int64_t) ;
+    GB_BLOB_WRITE (vdim, int64_t) ;
+    GB_BLOB_WRITE (nvec, int64_t) ;
+    GB_BLOB_WRITE (nvec_nonempty, int64_t) ;
+    GB_BLOB_WRITE (nvals, int64_t) ;
+    GB_BLOB_WRITE (typesize, int64_t) ;
+    GB_BLOB_WRITE (chunk_size, int64_t) ;
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        GB_BLOB_WRITE (len [a], int64_t) ;
+    }
+    ASSERT (s == GB_DELTA_HEADER_SIZE) ;
+
+    if (typecode == GB_UDT_code)
+    {
+        // only copy the type_name for user-defined types
+        memset (blob + s, 0, GxB_MAX_NAME_LEN) ;
+        #if GB_COMPILER_GCC
+        #if (__GNUC__ > 5)
+        #pragma GCC diagnostic ignored "-Wstringop-truncation"
+        #endif
+        #endif
+        strncpy ((char *) (blob + s), atype->name, GxB_MAX_NAME_LEN-1) ;
+        s += GxB_MAX_NAME_LEN ;
+    }
+
+    memcpy (blob + s, Hash, nchunks * sizeof (uint64_t)) ;
+    s += nchunks * sizeof (uint64_t) ;
+
+    // the hash of the blob is the hash of the header and Hash [0:nchunks-1]
+    hash = XXH3_64bits (blob + GB_DELTA_HASH_START, s - GB_DELTA_HASH_START) ;
+    if (hash == 0) hash = 1 ;   // zero denotes no prior blob
+    memcpy (blob + 3 * sizeof (uint64_t), &hash, sizeof (uint64_t)) ;
+
+    memcpy (blob + s, Csize, nchunks * sizeof (int64_t)) ;
+    s += nchunks * sizeof (int64_t) ;
+
+    //--------------------------------------------------------------------------
+    // copy the compressed chunks into the blob
+    //--------------------------------------------------------------------------
+
+    nthreads = GB_IMIN (nthreads_max, GB_IMAX (nchanged, 1)) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+    for (c = 0 ; c < nchanged ; c++)
+    {
+        int64_t pstart = Changed [c] ;
+        int64_t pend = (c == nchanged-1) ? blob_size : Changed [c+1] ;
+        memcpy (blob + pstart, Blocks [c].p, pend - pstart) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    #ifdef GB_MEMDUMP
+    printf ("removing blob %p size %ld from memtable\n", blob,      // MEMDUMP
+        blob_size_allocated) ;
+    #endif
+    GB_Global_memtable_remove (blob) ;
+    (*blob_handle) = blob ;
+    (*blob_size_handle) = blob_size ;
+    return (GrB_SUCCESS) ;
+}
@@ -15,6 +15,7 @@ void GB_serialize_method
     // output
     int32_t *algo,                  // algorithm to use
     int32_t *level,                 // compression level
+    bool *delta,                    // if true, delta-encode Ap, Ah, and Ai
     // input
     int32_t method
 )
@@ -25,9 +26,17 @@ void GB_serialize_method
         // no compression if method is negative
         (*algo) = GxB_COMPRESSION_NONE ;
         (*level) = 0 ;
+        (*delta) = false ;
         return ;
     }
 
+    // GxB_COMPRESSION_DELTA can be added to any method
+    (*delta) = (method >= GxB_COMPRESSION_DELTA) ;
+    if (*delta)
+    { 
+        method = method % GxB_COMPRESSION_DELTA ;
+    }
+
     // Determine the algorithm and level.  Lower levels give faster compression
     // time but not as good of compression.  Higher levels give more compact
     // compressions, at the cost of higher run times.  For all methods: a level
@@ -232,13 +232,11 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
         else if (Ch != NULL)
         {
             // C is hypersparse, with at least one entry
-            const int64_t *restrict C_Yp = (C->Y == NULL) ? NULL : C->Y->p ;
-            const int64_t *restrict C_Yi = (C->Y == NULL) ? NULL : C->Y->i ;
             const int64_t *restrict C_Yx = (C->Y == NULL) ? NULL : C->Y->x ;
             const int64_t C_hash_bits = (C->Y == NULL) ? 0 : (C->Y->vdim - 1) ;
             const int64_t cnvec = C->nvec ;
-            int64_t k = GB_hyper_hash_lookup (Ch, cnvec, Cp, C_Yp, C_Yi, C_Yx,
-                C_hash_bits, j, &pC_start, &pC_end) ;
+            int64_t k = GB_hyper_hash_lookup (Ch, cnvec, Cp, C_Yx, C_hash_bits,
+                j, &pC_start, &pC_end) ;
             found = (k >= 0) ;
             ASSERT (GB_IMPLIES (found, j == Ch [k])) ;
         }
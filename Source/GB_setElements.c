@@ -0,0 +1,427 @@
+//------------------------------------------------------------------------------
+// GB_setElements: set a batch of entries, C(I(k),J(k)) = X(k) or += X(k)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// Sets a batch of n entries in C, typecasting from the type of X to the type
+// of C, as needed.  Not user-callable; does the work for the user-callable
+// GxB_Matrix_setElements_* methods.  The result is the same as n calls to
+// GB_setElement, in order, with accum = dup:
+
+//      for (k = 0 ; k < n ; k++)
+//      {
+//          if (dup == NULL)   C(I[k],J[k]) = X [k] ;
+//          else               C(I[k],J[k]) = dup (C(I[k],J[k]), X [k]) ;
+//      }
+
+// The tuples (I,J,X) may appear in any order, and may contain duplicates.
+
+// The checks, and any wait on C, are done once for the whole batch.  The
+// entries of C are then found in parallel (see GB_find_elements).  Entries
+// already present in C (including zombies) are updated in place, in the order
+// given, so that duplicates have the same effect as n calls to GB_setElement.
+// All other tuples are appended to the pending tuples of C in parallel, as
+// copies of I, J, and X with no typecasting.  C->Pending->sorted is updated,
+// so that if the batch is in sorted order (and follows any prior pending
+// tuples), GB_builder does not need to sort the pending tuples in GB_wait.
+
+#include "GB_Pending.h"
+#include "GB_Element.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_WERK_POP (Count, int64_t) ;          \
+    GB_FREE_WORK (&P, P_size) ;             \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+}
+
+GrB_Info GB_setElements             // C(I(k),J(k)) = X(k) or += X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I_in,          // row indices of the tuples
+    const GrB_Index *J_in,          // column indices of the tuples
+    const void *X,                  // values of the tuples
+    const GrB_Index n,              // # of tuples
+    const GrB_BinaryOp dup,         // if NULL: C(i,j) = x, else C(i,j) += x
+    const GB_Type_code xcode,       // type of X
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL && I_in != NULL && J_in != NULL && X != NULL) ;
+    int64_t *restrict P = NULL ; size_t P_size = 0 ;
+    GB_WERK_DECLARE (Count, int64_t) ;
+
+    ASSERT (xcode <= GB_UDT_code) ;
+    GrB_Type ctype = C->type ;
+    GB_Type_code ccode = ctype->code ;
+    size_t csize = ctype->size ;
+
+    // xcode and C must be compatible
+    if (!GB_code_compatible (xcode, ccode))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Input array of type [%s]\n"
+            "cannot be typecast to entries of type [%s]",
+            GB_code_string (xcode), ctype->name) ;
+    }
+
+    if (dup != NULL)
+    {
+        // C and X must be compatible with the dup operator
+        GB_RETURN_IF_FAULTY_OR_POSITIONAL (dup) ;
+        GB_OK (GB_BinaryOp_compatible (dup, ctype, ctype, NULL, xcode, Werk)) ;
+    }
+
+    if (n == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // check the indices
+    //--------------------------------------------------------------------------
+
+    const GrB_Index nrows = GB_NROWS (C) ;
+    const GrB_Index ncols = GB_NCOLS (C) ;
+    bool ok = true ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:ok)
+    for (k = 0 ; k < (int64_t) n ; k++)
+    {
+        ok = ok && (I_in [k] < nrows) && (J_in [k] < ncols) ;
+    }
+    if (!ok)
+    {
+        GB_ERROR (GrB_INVALID_INDEX, "Row or column index out of range; "
+            "must be < " GBd " and < " GBd " respectively", nrows, ncols) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wait on C if it is jumbled, or if its pending tuples are incompatible
+    //--------------------------------------------------------------------------
+
+    // stype is the type of X
+    GrB_Type stype = GB_code_type (xcode, ctype) ;
+    size_t ssize = stype->size ;
+
+    // The type of the new pending tuples must match the type of any prior
+    // pending tuples, and their operators must be the same (or both the
+    // implicit or explicit SECOND_ctype operator), as in GB_setElement.
+    bool wait = C->jumbled || (C->Pending != NULL &&
+        (stype != C->Pending->type ||
+        !((dup == C->Pending->op) || (GB_op_is_second (dup, ctype) &&
+            GB_op_is_second (C->Pending->op, ctype))))) ;
+
+    //--------------------------------------------------------------------------
+    // check if C needs to convert to non-iso
+    //--------------------------------------------------------------------------
+
+    if (C->iso)
+    {
+        // C remains iso only if dup is NULL, and if all of X, typecasted to
+        // the type of C, is equal to the iso value of C
+        bool convert_to_non_iso = (dup != NULL) ;
+        if (!convert_to_non_iso)
+        {
+            GB_cast_function cast_X_to_C = GB_cast_factory (ccode, xcode) ;
+            const GB_void *restrict Xin = (GB_void *) X ;
+            const GB_void *restrict cscalar = (GB_void *) C->x ;
+            bool all_iso = true ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(&&:all_iso)
+            for (k = 0 ; k < (int64_t) n ; k++)
+            {
+                if (!all_iso) continue ;
+                GB_void s [GB_VLA(csize)] ;
+                cast_X_to_C (s, Xin + k * ssize, ssize) ;
+                all_iso = (memcmp (cscalar, s, csize) == 0) ;
+            }
+            convert_to_non_iso = !all_iso ;
+        }
+        if (convert_to_non_iso)
+        {
+            // assemble all pending tuples and convert C to non-iso.  Zombies
+            // are OK.
+            if (wait || C->Pending != NULL)
+            {
+                GB_OK (GB_wait (C, "C (setElements:to non-iso)", Werk)) ;
+                wait = false ;
+            }
+            GB_OK (GB_convert_any_to_non_iso (C, true)) ;
+        }
+    }
+
+    if (wait)
+    {
+        GB_OK (GB_wait (C, "C (setElements)", Werk)) ;
+    }
+
+    ASSERT (!GB_JUMBLED (C)) ;
+    ASSERT (GB_PENDING_OK (C)) ;
+    ASSERT (GB_ZOMBIES_OK (C)) ;
+
+    //--------------------------------------------------------------------------
+    // handle the CSR/CSC format
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ilist = (const int64_t *)
+        (C->is_csc ? I_in : J_in) ;
+    const int64_t *restrict Jlist = (const int64_t *)
+        (C->is_csc ? J_in : I_in) ;
+
+    //--------------------------------------------------------------------------
+    // find the position of each entry in C
+    //--------------------------------------------------------------------------
+
+    P = GB_MALLOC_WORK (n, int64_t, &P_size) ;
+    if (P == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // construct the hyper_hash of C, if needed
+    GB_OK (GB_hyper_hash_build (C, Werk)) ;
+
+    int64_t nnew = GB_find_elements (P, C, Ilist, Jlist, n, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // update the entries already in C
+    //--------------------------------------------------------------------------
+
+    // This phase is sequential, since the same entry of C can appear more
+    // than once in the batch.  The search for each entry has already been
+    // done in parallel, above.
+
+    if (nnew < (int64_t) n)
+    {
+        int64_t *restrict Ci = C->i ;
+        int8_t  *restrict Cb = C->b ;
+        GB_void *restrict Cx = (GB_void *) C->x ;
+        const GB_void *restrict Xin = (GB_void *) X ;
+        const bool C_iso = C->iso ;
+        int64_t nzombies = C->nzombies ;
+        int64_t nvals = C->nvals ;
+
+        GB_cast_function cast_X_to_C = GB_cast_factory (ccode, xcode) ;
+        GxB_binary_function fdup = NULL ;
+        GB_cast_function cast_C_to_X = NULL, cast_S_to_Y = NULL,
+            cast_Z_to_C = NULL ;
+        size_t dxsize = 1, dysize = 1, dzsize = 1 ;
+        if (dup != NULL)
+        {
+            fdup = dup->binop_function ;
+            cast_C_to_X = GB_cast_factory (dup->xtype->code, ccode) ;
+            cast_S_to_Y = GB_cast_factory (dup->ytype->code, xcode) ;
+            cast_Z_to_C = GB_cast_factory (ccode, dup->ztype->code) ;
+            dxsize = dup->xtype->size ;
+            dysize = dup->ytype->size ;
+            dzsize = dup->ztype->size ;
+        }
+        GB_void xdup [GB_VLA(dxsize)] ;
+        GB_void ydup [GB_VLA(dysize)] ;
+        GB_void zdup [GB_VLA(dzsize)] ;
+
+        for (k = 0 ; k < (int64_t) n ; k++)
+        {
+            int64_t p = P [k] ;
+            if (p < 0) continue ;
+
+            // determine if C(i,j) is a live entry, and bring it to life if not
+            bool live ;
+            if (Cb != NULL)
+            {
+                // C is bitmap
+                live = (Cb [p] != 0) ;
+                if (!live)
+                {
+                    Cb [p] = 1 ;
+                    nvals++ ;
+                }
+            }
+            else if (Ci != NULL)
+            {
+                // C is sparse or hypersparse
+                live = !GB_IS_ZOMBIE (Ci [p]) ;
+                if (!live)
+                {
+                    // bring the zombie back to life
+                    Ci [p] = Ilist [k] ;
+                    nzombies-- ;
+                }
+            }
+            else
+            {
+                // C is full
+                live = true ;
+            }
+
+            if (C_iso) continue ;
+
+            // set the value of C(i,j)
+            GB_void *cx = Cx + p * csize ;
+            const GB_void *x = Xin + k * ssize ;
+            if (dup == NULL || !live)
+            {
+                // C(i,j) = (ctype) X [k]
+                cast_X_to_C (cx, x, ssize) ;
+            }
+            else
+            {
+                // C(i,j) = dup (C(i,j), X [k])
+                cast_C_to_X (xdup, cx, csize) ;
+                cast_S_to_Y (ydup, x, ssize) ;
+                fdup (zdup, xdup, ydup) ;
+                cast_Z_to_C (cx, zdup, dzsize) ;
+            }
+        }
+
+        C->nzombies = nzombies ;
+        C->nvals = nvals ;
+    }
+
+    //--------------------------------------------------------------------------
+    // append all other tuples to the pending tuples of C
+    //--------------------------------------------------------------------------
+
+    if (nnew > 0)
+    {
+
+        //----------------------------------------------------------------------
+        // ensure the list of pending tuples is large enough
+        //----------------------------------------------------------------------
+
+        // C is sparse or hypersparse, since all entries of a bitmap or full
+        // matrix are found above
+        ASSERT (GB_IS_SPARSE (C) || GB_IS_HYPERSPARSE (C)) ;
+        if (!GB_Pending_ensure (&(C->Pending), C->iso, stype, dup, C->vdim > 1,
+            nnew, Werk))
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            GB_phybix_free (C) ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        GB_Pending Pending = C->Pending ;
+        ASSERT (Pending->type == stype) ;
+        int64_t *restrict Pending_i = Pending->i ;
+        int64_t *restrict Pending_j = Pending->j ;
+        GB_void *restrict Pending_x = Pending->x ;
+        const GB_void *restrict Xin = (GB_void *) X ;
+        const int64_t npending = Pending->n ;
+
+        //----------------------------------------------------------------------
+        // count the new tuples in each slice of the batch
+        //----------------------------------------------------------------------
+
+        int ntasks = nthreads ;
+        GB_WERK_PUSH (Count, ntasks+1, int64_t) ;
+        if (Count == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t kfirst, klast, cnt = 0 ;
+            GB_PARTITION (kfirst, klast, (int64_t) n, tid, ntasks) ;
+            for (int64_t k = kfirst ; k < klast ; k++)
+            {
+                cnt += (P [k] < 0) ;
+            }
+            Count [tid] = cnt ;
+        }
+        GB_cumsum (Count, ntasks, NULL, 1, NULL) ;
+        ASSERT (Count [ntasks] == nnew) ;
+
+        //----------------------------------------------------------------------
+        // append the new tuples, in the order given
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t kfirst, klast ;
+            GB_PARTITION (kfirst, klast, (int64_t) n, tid, ntasks) ;
+            int64_t t = npending + Count [tid] ;
+            for (int64_t k = kfirst ; k < klast ; k++)
+            {
+                if (P [k] >= 0) continue ;
+                int64_t i = Ilist [k] ;
+                int64_t j = Jlist [k] ;
+                Pending_i [t] = i ;
+                if (Pending_j != NULL)
+                {
+                    Pending_j [t] = j ;
+                }
+                if (Pending_x != NULL)
+                {
+                    memcpy (Pending_x + t * ssize, Xin + k * ssize, ssize) ;
+                }
+                t++ ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // check if the pending tuples are still in sorted order
+        //----------------------------------------------------------------------
+
+        bool sorted = Pending->sorted ;
+        int64_t pfirst = GB_IMAX (npending, 1) ;
+        int64_t plast = npending + nnew ;
+        int nth = GB_nthreads (plast - pfirst, chunk, nthreads_max) ;
+        int64_t t ;
+        #pragma omp parallel for num_threads(nth) schedule(static) \
+            reduction(&&:sorted)
+        for (t = pfirst ; t < plast ; t++)
+        {
+            if (!sorted) continue ;
+            int64_t jprev = (Pending_j != NULL) ? Pending_j [t-1] : 0 ;
+            int64_t jt    = (Pending_j != NULL) ? Pending_j [t  ] : 0 ;
+            sorted = (jprev < jt) || (jprev == jt &&
+                Pending_i [t-1] <= Pending_i [t]) ;
+        }
+
+        Pending->sorted = sorted ;
+        Pending->n += nnew ;
+        ASSERT (GB_PENDING (C)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (C, "C after setElements", GB0) ;
+    return (GB_block (C, Werk)) ;
+}
@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+// GB_shm.h: definitions for shared-memory matrices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_publish writes a matrix to a file (typically in /dev/shm) in a
+// self-describing layout, and GxB_Matrix_attach maps that file into memory as
+// a GrB_Matrix whose Ap, Ah, Ab, Ai, and Ax arrays are shallow pointers into
+// the mapped file.  Any number of processes on the same host can attach to the
+// same file, and all of them share a single copy of the matrix content.
+
+// The file consists of a GB_shm_header, followed by the arrays Ap, Ah, Ab, Ai,
+// and Ax.  Each array starts on a GB_SHM_ALIGN byte boundary, and takes at
+// least GB_SHM_ALIGN bytes, even if empty, so that each present array has a
+// valid address in the file.  The header is not portable to other hosts,
+// since it is written as a C struct.
+
+#ifndef GB_SHM_H
+#define GB_SHM_H
+
+#define GB_SHM_MAGIC 0x316D687342724731     // "1GrBshm1"
+#define GB_SHM_ALIGN 64
+
+typedef struct
+{
+    uint64_t magic ;            // GB_SHM_MAGIC
+    uint64_t file_size ;        // size of the file, in bytes
+    int32_t version ;           // GxB_IMPLEMENTATION of the publisher
+    int32_t typecode ;          // type code of the matrix
+    int32_t sparsity_iso_csc ;  // 4*sparsity + 2*iso + is_csc
+    int32_t sparsity_control ;  // A->sparsity_control
+    float hyper_switch ;        // A->hyper_switch
+    float bitmap_switch ;       // A->bitmap_switch
+    int64_t vlen ;              // A->vlen
+    int64_t vdim ;              // A->vdim
+    int64_t nvec ;              // A->nvec
+    int64_t nvec_nonempty ;     // A->nvec_nonempty
+    int64_t nvals ;             // # of entries in A
+    int64_t typesize ;          // size of the type of A
+    int64_t offset [5] ;        // offsets of Ap, Ah, Ab, Ai, Ax in the file
+    int64_t len [5] ;           // sizes of Ap, Ah, Ab, Ai, Ax in bytes
+    char type_name [GxB_MAX_NAME_LEN] ;     // name of the type of A
+}
+GB_shm_header ;
+
+// size of the header in the file
+#define GB_SHM_HEADER_SIZE \
+    (GB_ICEIL (sizeof (GB_shm_header), GB_SHM_ALIGN) * GB_SHM_ALIGN)
+
+GrB_Info GB_shm_publish             // write a matrix to a shared-memory file
+(
+    const char *filename,           // name of the file to create
+    GrB_Matrix A,                   // matrix to publish
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_shm_attach              // attach to a shared-memory file
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix attached to the file
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const char *filename,           // name of the file
+    GB_Werk Werk
+) ;
+
+#endif
+
@@ -0,0 +1,270 @@
+//------------------------------------------------------------------------------
+// GB_shm_attach: attach to a matrix written by GxB_Matrix_publish
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// The file is mapped into memory, and the Ap, Ah, Ab, Ai, and Ax arrays of the
+// output matrix C are shallow pointers into the mapped file.  The mapping is
+// private and read-only, so the file is never modified, and any write to the
+// shallow arrays faults instead of silently copying a page.  Pages of the file
+// are shared with all other processes that have attached to it, and with the
+// page cache.  The mapping is removed when C is freed (see GB_shm_free), or
+// when C is first modified (see GB_shm_unshare).
+
+// As in GB_deserialize, the header of the file is checked so that no
+// out-of-bounds access occurs, but the contents of the output matrix are not
+// checked.  The mmap system call is not available on Windows, so this method
+// returns GrB_NOT_IMPLEMENTED there.
+
+#include "GB.h"
+#include "GB_shm.h"
+#include "GB_file.h"
+
+#if !GB_WINDOWS
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_Matrix_free (&C) ;                           \
+    if (base != NULL) munmap (base, file_size) ;    \
+}
+
+GrB_Info GB_shm_attach              // attach to a shared-memory file
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix attached to the file
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const char *filename,           // name of the file
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Chandle != NULL && filename != NULL) ;
+    (*Chandle) = NULL ;
+
+    #if GB_WINDOWS
+    {
+        // mmap is not available
+        return (GrB_NOT_IMPLEMENTED) ;
+    }
+    #else
+    {
+
+        GrB_Info info ;
+        GrB_Matrix C = NULL ;
+        void *base = NULL ;
+        size_t file_size = 0 ;
+
+        //----------------------------------------------------------------------
+        // map the file into memory
+        //----------------------------------------------------------------------
+
+        int fd = open (filename, O_RDONLY) ;
+        if (fd < 0)
+        {
+            // file cannot be opened
+            GB_ERROR (GrB_INVALID_VALUE, "Unable to open file [%s]",
+                filename) ;
+        }
+
+        struct stat st ;
+        if (fstat (fd, &st) != 0 || st.st_size < (off_t) GB_SHM_HEADER_SIZE)
+        {
+            // file is invalid
+            close (fd) ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        file_size = (size_t) st.st_size ;
+
+        base = mmap (NULL, file_size, PROT_READ, MAP_PRIVATE, fd, 0) ;
+        close (fd) ;
+        if (base == MAP_FAILED)
+        {
+            // file cannot be mapped
+            base = NULL ;
+            GB_ERROR (GrB_INVALID_VALUE, "Unable to map file [%s]", filename);
+        }
+
+        //----------------------------------------------------------------------
+        // check the header
+        //----------------------------------------------------------------------
+
+        GB_shm_header H ;
+        memcpy (&H, base, sizeof (GB_shm_header)) ;
+        int32_t sparsity = H.sparsity_iso_csc / 4 ;
+        bool iso = ((H.sparsity_iso_csc & 2) == 2) ;
+        bool is_csc = ((H.sparsity_iso_csc & 1) == 1) ;
+        if (H.magic != GB_SHM_MAGIC || H.file_size != (uint64_t) file_size
+            || H.typecode < GB_BOOL_code || H.typecode > GB_UDT_code
+            || H.typesize <= 0 || H.typesize > GB_NMAX
+            || H.vlen < 0 || H.vlen > GB_NMAX
+            || H.vdim < 0 || H.vdim > GB_NMAX
+            || H.nvec < 0 || H.nvec > H.vdim
+            || H.nvec_nonempty < 0 || H.nvals < 0 || H.nvals > GB_NMAX
+            || !(sparsity == GxB_HYPERSPARSE || sparsity == GxB_SPARSE
+              || sparsity == GxB_BITMAP || sparsity == GxB_FULL)
+            || (sparsity != GxB_HYPERSPARSE && H.nvec != H.vdim))
+        {
+            // file is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+
+        // the size of each array must match the header
+        uint64_t expected [5] = { 0, 0, 0, 0, 0 } ;
+        bool present [5] = { false, false, false, false, true } ;
+        uint64_t anz_held = 0 ;
+        bool ok = true ;
+        switch (sparsity)
+        {
+            case GxB_HYPERSPARSE :
+                expected [1] = sizeof (GrB_Index) * H.nvec ;
+                present [1] = true ;
+                // fall through to the sparse case
+            case GxB_SPARSE :
+                expected [0] = sizeof (GrB_Index) * (H.nvec+1) ;
+                expected [3] = sizeof (GrB_Index) * H.nvals ;
+                ok = GB_int64_multiply (&(expected [4]), H.typesize,
+                    iso ? 1 : H.nvals) ;
+                present [0] = true ;
+                present [3] = true ;
+                break ;
+            case GxB_BITMAP :
+            case GxB_FULL :
+                ok = GB_int64_multiply (&anz_held, H.vlen, H.vdim) ;
+                if (sparsity == GxB_BITMAP)
+                {
+                    expected [2] = anz_held ;
+                    present [2] = true ;
+                }
+                ok = ok && GB_int64_multiply (&(expected [4]), H.typesize,
+                    iso ? 1 : (int64_t) anz_held) ;
+                break ;
+            default: ;
+        }
+
+        // each present array must lie inside the file, after the header
+        size_t X_size [5] = { 0, 0, 0, 0, 0 } ;
+        for (int a = 0 ; a < 5 && ok ; a++)
+        {
+            ok = (H.len [a] >= 0) && ((uint64_t) H.len [a] == expected [a]) ;
+            if (ok && present [a])
+            {
+                X_size [a] = GB_ICEIL (GB_IMAX (H.len [a], 1), GB_SHM_ALIGN)
+                    * GB_SHM_ALIGN ;
+                ok = (H.offset [a] >= (int64_t) GB_SHM_HEADER_SIZE)
+                    && (H.offset [a] % GB_SHM_ALIGN == 0)
+                    && ((uint64_t) H.offset [a] <= file_size)
+                    && (X_size [a] <= file_size - H.offset [a]) ;
+            }
+        }
+
+        // Ap [nvec] must be the number of entries
+        GB_void *X [5] ;
+        for (int a = 0 ; a < 5 ; a++)
+        {
+            X [a] = present [a] ? (((GB_void *) base) + H.offset [a]) : NULL ;
+        }
+        ok = ok && (!present [0] || ((int64_t *) X [0]) [H.nvec] == H.nvals) ;
+        if (!ok)
+        {
+            // file is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+
+        //----------------------------------------------------------------------
+        // determine the matrix type
+        //----------------------------------------------------------------------
+
+        GB_Type_code ccode = (GB_Type_code) H.typecode ;
+        GrB_Type ctype = GB_code_type (ccode, type_expected) ;
+
+        // ensure the type has the right size
+        if (ctype == NULL || ctype->size != H.typesize)
+        {
+            // file is invalid; type is missing or the wrong size
+            GB_FREE_ALL ;
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+
+        if (ccode == GB_UDT_code)
+        {
+            // ensure the user-defined type has the right name
+            ASSERT (ctype == type_expected) ;
+            if (strncmp (H.type_name, ctype->name, GxB_MAX_NAME_LEN) != 0)
+            {
+                // file is invalid
+                GB_FREE_ALL ;
+                return (GrB_DOMAIN_MISMATCH) ;
+            }
+        }
+        else if (type_expected != NULL && ctype != type_expected)
+        {
+            // built-in type must match type_expected
+            GB_FREE_ALL ;
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+
+        //----------------------------------------------------------------------
+        // construct the output matrix C
+        //----------------------------------------------------------------------
+
+        GB_OK (GB_new (&C,  // new header (C is NULL on input)
+            ctype, H.vlen, H.vdim, GB_Ap_null, is_csc,
+            sparsity, H.hyper_switch, H.nvec)) ;
+
+        C->nvec = H.nvec ;
+        C->nvec_nonempty = H.nvec_nonempty ;
+        C->nvals = H.nvals ;
+        C->bitmap_switch = H.bitmap_switch ;
+        C->sparsity_control = H.sparsity_control ;
+        C->iso = iso ;
+
+        // the content of C is shallow, in the mapped file
+        #define GB_ATTACH(a,field,type)                             \
+        if (present [a])                                            \
+        {                                                           \
+            C->field = (type *) X [a] ;                             \
+            C->field ## _size = X_size [a] ;                        \
+            C->field ## _shallow = true ;                           \
+        }
+
+        GB_ATTACH (0, p, int64_t) ;
+        GB_ATTACH (1, h, int64_t) ;
+        GB_ATTACH (2, b, int8_t) ;
+        GB_ATTACH (3, i, int64_t) ;
+        GB_ATTACH (4, x, void) ;
+
+        // C now owns the mapping, which is removed when C is freed
+        C->shm = base ;
+        C->shm_size = file_size ;
+        C->magic = GB_MAGIC ;
+
+        //----------------------------------------------------------------------
+        // return result
+        //----------------------------------------------------------------------
+
+        (*Chandle) = C ;
+        ASSERT_MATRIX_OK (*Chandle, "Final result from attach", GB0) ;
+        return (GrB_SUCCESS) ;
+    }
+    #endif
+}
+
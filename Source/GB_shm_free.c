@@ -0,0 +1,43 @@
+//------------------------------------------------------------------------------
+// GB_shm_free: remove the mapping of a shared-memory file from a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If A was created by GxB_Matrix_attach, it owns the mapping of the file it
+// is attached to.  The mapping is removed here, when A itself is freed or when
+// GB_shm_unshare has given A its own copy of the content.  It is not removed
+// by GB_phybix_free, since the methods that change the sparsity format of A
+// free the content of A and then give it back any shallow component they
+// have kept, such as A->x.  The file itself is not modified.
+
+#include "GB.h"
+#include "GB_file.h"
+
+#if !GB_WINDOWS
+#include <sys/mman.h>
+#endif
+
+void GB_shm_free                // remove the shared-memory mapping of A
+(
+    GrB_Matrix A                // matrix with content to free
+)
+{
+
+    //--------------------------------------------------------------------------
+    // unmap the file
+    //--------------------------------------------------------------------------
+
+    if (A != NULL && A->shm != NULL)
+    { 
+        #if !GB_WINDOWS
+        munmap (A->shm, A->shm_size) ;
+        #endif
+        A->shm = NULL ;
+        A->shm_size = 0 ;
+    }
+}
+
@@ -0,0 +1,192 @@
+//------------------------------------------------------------------------------
+// GB_shm_publish: write a matrix to a file for GxB_Matrix_attach
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// The matrix is written to a temporary file, which is then renamed to the
+// requested filename.  A process that attaches to the file thus never sees a
+// partially written matrix, and any process already attached to a prior
+// version of the file keeps its mapping of the prior version.  See GB_shm.h
+// for the layout of the file.
+
+#include "GB.h"
+#include "GB_shm.h"
+#include "GB_file.h"
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    if (fp != NULL) fclose (fp) ;                   \
+    fp = NULL ;                                     \
+    if (tmpname != NULL) remove (tmpname) ;         \
+    GB_FREE_WORK (&tmpname, tmpname_size) ;         \
+}
+
+GrB_Info GB_shm_publish             // write a matrix to a shared-memory file
+(
+    const char *filename,           // name of the file to create
+    GrB_Matrix A,                   // matrix to publish
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (filename != NULL) ;
+    ASSERT_MATRIX_OK (A, "A to publish", GB0) ;
+    FILE *fp = NULL ;
+    char *tmpname = NULL ; size_t tmpname_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // ensure all pending work is finished
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_wait (A, "A to publish", Werk)) ;
+    ASSERT (A->nvec_nonempty >= 0) ;
+    ASSERT (A->Pending == NULL) ;
+    ASSERT (A->nzombies == 0) ;
+    ASSERT (!A->jumbled) ;
+
+    //--------------------------------------------------------------------------
+    // construct the header
+    //--------------------------------------------------------------------------
+
+    GB_shm_header H ;
+    memset (&H, 0, sizeof (GB_shm_header)) ;
+    int32_t sparsity = GB_sparsity (A) ;
+    bool iso = A->iso ;
+    int64_t typesize = A->type->size ;
+    int64_t anz = GB_nnz (A) ;
+    int64_t anz_held = GB_nnz_held (A) ;
+    H.magic = GB_SHM_MAGIC ;
+    H.version = GxB_IMPLEMENTATION ;
+    H.typecode = (int32_t) (A->type->code) ;
+    H.sparsity_iso_csc = (sparsity << 2) + (iso ? 2 : 0) + (A->is_csc ? 1 : 0);
+    H.sparsity_control = A->sparsity_control ;
+    H.hyper_switch = A->hyper_switch ;
+    H.bitmap_switch = A->bitmap_switch ;
+    H.vlen = A->vlen ;
+    H.vdim = A->vdim ;
+    H.nvec = A->nvec ;
+    H.nvec_nonempty = A->nvec_nonempty ;
+    H.nvals = anz ;
+    H.typesize = typesize ;
+    if (A->type->code == GB_UDT_code)
+    {
+        // only user-defined types have their name in the file
+        strncpy (H.type_name, A->type->name, GxB_MAX_NAME_LEN-1) ;
+    }
+
+    // determine the sizes of Ap, Ah, Ab, Ai, and Ax
+    const GB_void *X [5] = { (GB_void *) A->p, (GB_void *) A->h,
+        (GB_void *) A->b, (GB_void *) A->i, (GB_void *) A->x } ;
+    bool present [5] = { false, false, false, false, true } ;
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            H.len [1] = sizeof (GrB_Index) * H.nvec ;
+            present [1] = true ;
+            // fall through to the sparse case
+        case GxB_SPARSE :
+            H.len [0] = sizeof (GrB_Index) * (H.nvec+1) ;
+            H.len [3] = sizeof (GrB_Index) * anz ;
+            H.len [4] = typesize * (iso ? 1 : anz) ;
+            present [0] = true ;
+            present [3] = true ;
+            break ;
+        case GxB_BITMAP :
+            H.len [2] = sizeof (int8_t) * anz_held ;
+            present [2] = true ;
+            // fall through to the full case
+        case GxB_FULL :
+            H.len [4] = typesize * (iso ? 1 : anz_held) ;
+            break ;
+        default: ;
+    }
+
+    // each present array starts on a GB_SHM_ALIGN boundary
+    size_t s = GB_SHM_HEADER_SIZE ;
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        if (present [a])
+        {
+            H.offset [a] = s ;
+            s += GB_ICEIL (GB_IMAX (H.len [a], 1), GB_SHM_ALIGN)
+                * GB_SHM_ALIGN ;
+        }
+    }
+    H.file_size = s ;
+
+    //--------------------------------------------------------------------------
+    // write the matrix to a temporary file
+    //--------------------------------------------------------------------------
+
+    size_t len = strlen (filename) ;
+    tmpname = GB_MALLOC_WORK (len + 5, char, &tmpname_size) ;
+    if (tmpname == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    snprintf (tmpname, len + 5, "%s.tmp", filename) ;
+
+    fp = fopen (tmpname, "wb") ;
+    if (fp == NULL)
+    {
+        // file cannot be created
+        GB_FREE_WORK (&tmpname, tmpname_size) ;
+        GB_ERROR (GrB_INVALID_VALUE, "Unable to create file [%s]", filename);
+    }
+
+    static const GB_void zeros [GB_SHM_ALIGN] = { 0 } ;
+    bool ok = (fwrite (&H, sizeof (GB_shm_header), 1, fp) == 1) ;
+    s = sizeof (GB_shm_header) ;
+    for (int a = 0 ; a < 5 && ok ; a++)
+    {
+        if (!present [a]) continue ;
+        // pad the prior array, then write this array
+        size_t pad = H.offset [a] - s ;
+        ok = (fwrite (zeros, 1, pad, fp) == pad) ;
+        ok = ok && (fwrite (X [a], 1, H.len [a], fp) == (size_t) H.len [a]) ;
+        s = H.offset [a] + H.len [a] ;
+    }
+    size_t pad = H.file_size - s ;
+    ok = ok && (fwrite (zeros, 1, pad, fp) == pad) ;
+    ok = (fclose (fp) == 0) && ok ;
+    fp = NULL ;
+
+    //--------------------------------------------------------------------------
+    // rename the temporary file
+    //--------------------------------------------------------------------------
+
+    #if GB_WINDOWS
+    if (ok)
+    {
+        // rename does not replace an existing file on Windows
+        remove (filename) ;
+    }
+    #endif
+    ok = ok && (rename (tmpname, filename) == 0) ;
+    if (!ok)
+    {
+        // file cannot be written
+        GB_FREE_ALL ;
+        GB_ERROR (GrB_INVALID_VALUE, "Unable to write file [%s]", filename) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK (&tmpname, tmpname_size) ;
+    return (GrB_SUCCESS) ;
+}
+
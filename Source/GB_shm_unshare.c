@@ -0,0 +1,73 @@
+//------------------------------------------------------------------------------
+// GB_shm_unshare: give a matrix its own copy of its shared-memory content
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix created by GxB_Matrix_attach has shallow components that point into
+// a mapped file.  Before the matrix is modified, each shallow component is
+// copied into memory owned by the matrix, and the mapping is then removed.
+// This function is called by GB_WHERE on entry to any user-callable method
+// that can modify A, and by GB_export.  If A is not attached to a file,
+// nothing is done.  If out of memory, A remains valid and attached.
+
+#include "GB.h"
+
+GrB_Info GB_shm_unshare         // copy the shared-memory content of A
+(
+    GrB_Matrix A                // matrix to modify
+)
+{
+
+    //--------------------------------------------------------------------------
+    // quick return if A is not attached to a file
+    //--------------------------------------------------------------------------
+
+    if (A == NULL || A->shm == NULL)
+    { 
+        return (GrB_SUCCESS) ;
+    }
+
+    GBURBLE ("(unshare) ") ;
+
+    //--------------------------------------------------------------------------
+    // copy each shallow component of A
+    //--------------------------------------------------------------------------
+
+    // Any component that is not shallow has already been replaced, by a
+    // change of sparsity format for example.
+
+    #define GB_UNSHARE(field)                                               \
+    if (A->field ## _shallow)                                               \
+    {                                                                       \
+        size_t X_size = 0 ;                                                 \
+        GB_void *X = GB_MALLOC (A->field ## _size, GB_void, &X_size) ;      \
+        if (X == NULL)                                                      \
+        {                                                                   \
+            /* out of memory */                                             \
+            return (GrB_OUT_OF_MEMORY) ;                                    \
+        }                                                                   \
+        memcpy (X, A->field, A->field ## _size) ;                           \
+        A->field = (void *) X ;                                             \
+        A->field ## _size = X_size ;                                        \
+        A->field ## _shallow = false ;                                      \
+    }
+
+    GB_UNSHARE (p) ;
+    GB_UNSHARE (h) ;
+    GB_UNSHARE (b) ;
+    GB_UNSHARE (i) ;
+    GB_UNSHARE (x) ;
+
+    //--------------------------------------------------------------------------
+    // remove the mapping
+    //--------------------------------------------------------------------------
+
+    ASSERT (!GB_is_shallow (A)) ;
+    GB_shm_free (A) ;
+    return (GrB_SUCCESS) ;
+}
+
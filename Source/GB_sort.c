@@ -273,6 +273,11 @@ GrB_Info GB_sort
     { 
         GB_phybix_free (C) ;
     }
+    else
+    { 
+        // A is sorted in place, so its cached transpose is no longer valid
+        GB_transpose_cache_free (A) ;
+    }
 
     //--------------------------------------------------------------------------
     // make a copy of A, unless it is aliased with C
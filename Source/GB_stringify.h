@@ -125,6 +125,7 @@ uint64_t GB_encodify_ewise      // encode an ewise problem
     const bool is_eWiseMult,    // if true, method is emult
     const bool C_iso,
     const bool C_in_iso,
+    const bool C_in_place,
     const int C_sparsity,
     const GrB_Type ctype,
     const GrB_Matrix M,
@@ -147,6 +148,7 @@ void GB_enumify_ewise       // enumerate a GrB_eWise problem
     // C matrix:
     bool C_iso,             // if true, C is iso on output
     bool C_in_iso,          // if true, C is iso on input
+    bool C_in_place,        // if true, C<M>+=T is computed in place
     int C_sparsity,         // sparse, hyper, bitmap, or full
     GrB_Type ctype,         // C=((ctype) T) is the final typecast
     // M matrix:
@@ -313,6 +315,7 @@ GrB_Info GB_emult_bitmap_jit      // C<#M>=A.*B, emult_bitmap, via the JIT
     // input/output:
     GrB_Matrix C,
     // input:
+    const bool C_in_place,      // if true, C<#M> += A.*B in place
     const GrB_Matrix M,
     const bool Mask_struct,
     const bool Mask_comp,
@@ -389,6 +392,7 @@ uint64_t GB_encodify_mxm        // encode a GrB_mxm problem
     const GB_jit_kcode kcode,   // kernel to encode
     const bool C_iso,
     const bool C_in_iso,
+    const bool C_in_place,
     const int C_sparsity,
     const GrB_Type ctype,
     const GrB_Matrix M,
@@ -408,6 +412,7 @@ void GB_enumify_mxm         // enumerate a GrB_mxm problem
     // C matrix:
     bool C_iso,             // C output iso: if true, semiring is ANY_PAIR_BOOL
     bool C_in_iso,          // C input iso status
+    bool C_in_place,        // if true, C+=A*B is computed in place
     int C_sparsity,         // sparse, hyper, bitmap, or full
     GrB_Type ctype,         // C=((ctype) T) is the final typecast
     // M matrix:
@@ -494,6 +499,7 @@ GrB_Info GB_AxB_saxbit_jit      // C<M>=A*B, saxbit, via the JIT
     // input/output:
     GrB_Matrix C,
     // input:
+    const bool C_in_place,          // if true, C+=A*B is computed in place
     const GrB_Matrix M,
     const bool Mask_comp,
     const bool Mask_struct,
@@ -520,6 +526,7 @@ GrB_Info GB_AxB_dot2_jit        // C<M>=A'*B, dot2 method, via the JIT
     // input/output:
     GrB_Matrix C,
     // input:
+    const bool C_in_place,          // if true, C+=A*B is computed in place
     const GrB_Matrix M,
     const bool Mask_comp,
     const bool Mask_struct,
@@ -539,6 +546,7 @@ GrB_Info GB_AxB_dot2n_jit        // C<M>=A*B, dot2n method, via the JIT
     // input/output:
     GrB_Matrix C,
     // input:
+    const bool C_in_place,          // if true, C+=A*B is computed in place
     const GrB_Matrix M,
     const bool Mask_comp,
     const bool Mask_struct,
@@ -89,8 +89,6 @@ GrB_Info GB_subassign_06n
     GrB_BinaryOp accum = NULL ;
 
     GB_OK (GB_hyper_hash_build (A, Werk)) ;
-    const int64_t *restrict A_Yp = (A->Y == NULL) ? NULL : A->Y->p ;
-    const int64_t *restrict A_Yi = (A->Y == NULL) ? NULL : A->Y->i ;
     const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
     const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
 
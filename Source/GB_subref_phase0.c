@@ -326,9 +326,6 @@ GrB_Info GB_subref_phase0
     { 
         GB_OK (GB_hyper_hash_build (A, Werk)) ;
     }
-
-    const int64_t *restrict A_Yp = (A->Y == NULL) ? NULL : A->Y->p ;
-    const int64_t *restrict A_Yi = (A->Y == NULL) ? NULL : A->Y->i ;
     const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
     const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
 
@@ -486,7 +483,7 @@ GrB_Info GB_subref_phase0
                 { 
                     // find jA using the hyper_hash
                     int64_t ignore1, ignore2 ;
-                    kA = GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yp, A_Yi, A_Yx,
+                    kA = GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yx,
                         A_hash_bits, jA, &ignore1, &ignore2) ;
                     found = (kA >= 0) ;
                 }
@@ -683,7 +680,7 @@ GrB_Info GB_subref_phase0
                 { 
                     // find jA using the hyper_hash
                     int64_t ignore1, ignore2 ;
-                    kA = GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yp, A_Yi, A_Yx,
+                    kA = GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yx,
                         A_hash_bits, jA, &ignore1, &ignore2) ;
                     found = (kA >= 0) ;
                 }
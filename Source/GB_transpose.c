@@ -119,6 +119,25 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
     ASSERT (GB_JUMBLED_OK (A)) ;
     ASSERT (GB_IMPLIES (avdim == 1, !GB_JUMBLED (A))) ;
 
+    //--------------------------------------------------------------------------
+    // C = C' in-place, with the cached transpose of C
+    //--------------------------------------------------------------------------
+
+    if (in_place && A->T != NULL && op_in == NULL
+        && (ctype == NULL || ctype == A->type))
+    { 
+        // C and C->T are swapped, and C->T becomes the prior C
+        GBURBLE ("(cached transpose) ") ;
+        if (GB_JUMBLED (A))
+        { 
+            GB_OK (GB_wait (A, "A", Werk)) ;
+        }
+        GB_transpose_cache_swap (A, C_is_csc) ;
+        GB_OK (GB_conform (C, Werk)) ;
+        ASSERT_MATRIX_OK (C, "C output of GB_transpose (cached)", GB0) ;
+        return (GrB_SUCCESS) ;
+    }
+
     //--------------------------------------------------------------------------
     // get A
     //--------------------------------------------------------------------------
@@ -254,6 +273,20 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
             ctype, avdim, avlen, GB_Ap_calloc, C_is_csc, GxB_HYPERSPARSE,
             true, A_hyper_switch, 1, 1, true, false)) ;
 
+    }
+    else if (A->T != NULL && op == NULL && !in_place)
+    { 
+
+        //----------------------------------------------------------------------
+        // use the cached transpose of A
+        //----------------------------------------------------------------------
+
+        // T is a purely shallow copy of A->T.  It is copied into C, and
+        // typecasted if needed, by GB_transplant below.
+
+        GBURBLE ("(cached transpose) ") ;
+        GB_OK (GB_shallow_copy (T, C_is_csc, A->T, Werk)) ;
+
     }
     else if (A_is_bitmap || GB_IS_FULL (A))
     {
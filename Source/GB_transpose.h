@@ -95,6 +95,34 @@ GrB_Info GB_transpose_op // transpose, typecast, and apply operator to a matrix
     int nthreads                        // # of threads to use
 ) ;
 
+bool GB_transpose_cache_need    // return true if A needs its A->T
+(
+    GrB_Matrix A
+) ;
+
+GrB_Info GB_transpose_cache_build   // construct A->T if not already built
+(
+    GrB_Matrix A,
+    GB_Werk Werk
+) ;
+
+void GB_transpose_cache_swap    // A = A', using A->T
+(
+    GrB_Matrix A,
+    const bool A_is_csc         // new CSR/CSC format of A and A->T
+) ;
+
+GrB_Info GB_transpose_cache_cast    // C = (ctype) A' or one (A'), via A->T
+(
+    GrB_Matrix C,               // output matrix C, static header
+    GrB_Type ctype,             // desired type of C
+    const bool C_is_csc,        // desired CSR/CSC format of C
+    const GrB_Matrix A,         // input matrix; C != A
+    const bool iso_one,         // if true, C = one (A'); values not accessed
+    const bool build,           // if true, construct A->T if requested
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_shallow_copy    // create a purely shallow matrix
 (
     GrB_Matrix C,           // output matrix C, with a static header
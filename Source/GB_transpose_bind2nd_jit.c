@@ -35,7 +35,7 @@ GrB_Info GB_transpose_bind2nd_jit
     char *suffix ;
     uint64_t hash = GB_encodify_ewise (&encoding, &suffix,
         GB_JIT_KERNEL_TRANSBIND2, false,
-        false, false, GB_sparsity (C), C->type, NULL, false, false,
+        false, false, false, GB_sparsity (C), C->type, NULL, false, false,
         binaryop, false, A, NULL) ;
 
     //--------------------------------------------------------------------------
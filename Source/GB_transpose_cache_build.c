@@ -0,0 +1,83 @@
+//------------------------------------------------------------------------------
+// GB_transpose_cache_build: construct A->T, the cached transpose of A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed; GB_transpose uses the JIT if needed.
+
+// A->T = A' is constructed if A->T_cache is true and A->T does not yet exist.
+// A->T has the same type and CSR/CSC format as A.  A is not modified, except
+// for its A->T component.  If A has any pending work (pending tuples, zombies,
+// or jumbled vectors), A->T is not built, since finishing the work would
+// modify A; A->T is then built by GrB_Matrix_wait, or when A is next used
+// without any pending work.  If A is used as an input matrix by more than one
+// user thread at the same time, A->T must be constructed first by
+// GrB_Matrix_wait.
+
+#include "GB_transpose.h"
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_Matrix_free (&T) ;               \
+}
+
+GrB_Info GB_transpose_cache_build   // construct A->T if not already built
+(
+    GrB_Matrix A,
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (!GB_transpose_cache_need (A))
+    { 
+        // quick return: A is NULL, a vector, A->T already computed, or
+        // A->T_cache is false
+        return (GrB_SUCCESS) ;
+    }
+
+    if (GB_ANY_PENDING_WORK (A))
+    { 
+        // quick return: A->T is built once the pending work of A is finished
+        return (GrB_SUCCESS) ;
+    }
+
+    GrB_Info info ;
+    GrB_Matrix T = NULL ;
+    ASSERT_MATRIX_OK (A, "A for transpose cache", GB0) ;
+    GB_BURBLE_MATRIX (A, "(build transpose cache) ") ;
+
+    //--------------------------------------------------------------------------
+    // T = A', with no typecast, in the same format as A
+    //--------------------------------------------------------------------------
+
+    // A->T remains NULL until T is complete, so that GB_transpose does not
+    // attempt to use it.
+
+    GB_OK (GB_new (&T, // new dynamic header, do not allocate any content
+        A->type, A->vdim, A->vlen, GB_Ap_null, A->is_csc, GxB_AUTO_SPARSITY,
+        GB_Global_hyper_switch_get ( ), 0)) ;
+    GB_OK (GB_transpose_cast (T, A->type, A->is_csc, A, false, Werk)) ;
+    if (GB_ANY_PENDING_WORK (T))
+    { 
+        // the transpose may be jumbled; A->T must not have any pending work
+        GB_OK (GB_wait (T, "T", Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (T, "A->T cached transpose", GB0) ;
+    ASSERT (T->T == NULL && !T->T_cache) ;
+    A->T = T ;
+    return (GrB_SUCCESS) ;
+}
+
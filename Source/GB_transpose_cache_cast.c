@@ -0,0 +1,56 @@
+//------------------------------------------------------------------------------
+// GB_transpose_cache_cast: C = (ctype) A' or one (A'), using A->T if possible
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Identical to GB_transpose_cast, except that if A has a cached transpose
+// A->T and no typecast is needed, C is returned in O(1) time as a purely
+// shallow copy of A->T.  If iso_one is true, the values of C are not
+// accessed by the caller, so A->T can be used for any ctype.  If build is true
+// and A->T_cache is enabled, A->T is constructed first if it does not yet
+// exist.  C must be freed before A is modified.
+
+#include "GB_transpose.h"
+#define GB_FREE_ALL ;
+
+GrB_Info GB_transpose_cache_cast    // C = (ctype) A' or one (A'), via A->T
+(
+    GrB_Matrix C,               // output matrix C, static header
+    GrB_Type ctype,             // desired type of C
+    const bool C_is_csc,        // desired CSR/CSC format of C
+    const GrB_Matrix A,         // input matrix; C != A
+    const bool iso_one,         // if true, C = one (A'); values not accessed
+    const bool build,           // if true, construct A->T if requested
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // construct A->T, if requested
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    if (build)
+    {
+        GB_OK (GB_transpose_cache_build (A, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C = A', as a shallow copy of A->T, or computed by GB_transpose_cast
+    //--------------------------------------------------------------------------
+
+    if (A->T != NULL && (iso_one || ctype == A->type))
+    {
+        GBURBLE ("(cached transpose) ") ;
+        return (GB_shallow_copy (C, C_is_csc, A->T, Werk)) ;
+    }
+    else
+    {
+        return (GB_transpose_cast (C, ctype, C_is_csc, A, iso_one, Werk)) ;
+    }
+}
+
@@ -0,0 +1,33 @@
+//------------------------------------------------------------------------------
+// GB_transpose_cache_free: free the A->T cached transpose of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Free the A->T cached transpose of a matrix.  The matrix remains valid since
+// A->T can be reconstructed by any method that requires it, via
+// GB_transpose_cache_build.  This function is called by GB_WHERE on entry to
+// any user-callable method that can modify A, and whenever the content of A
+// is freed.  A->T_cache is not modified.
+
+#include "GB.h"
+
+void GB_transpose_cache_free    // free the A->T cached transpose of a matrix
+(
+    GrB_Matrix A                // matrix with content to free
+)
+{
+
+    //--------------------------------------------------------------------------
+    // free A->T
+    //--------------------------------------------------------------------------
+
+    if (A != NULL && A->T != NULL)
+    { 
+        GB_Matrix_free (&(A->T)) ;
+    }
+}
+
@@ -0,0 +1,24 @@
+//------------------------------------------------------------------------------
+// GB_transpose_cache_need: determine if a matrix needs its cached transpose
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Returns true if A->T_cache is enabled but A->T has not yet been computed.
+// Vectors and scalars never have a cached transpose.
+
+#include "GB.h"
+#include "GB_transpose.h"
+
+bool GB_transpose_cache_need    // return true if A needs its A->T
+(
+    GrB_Matrix A
+)
+{
+    return (A != NULL && A->T_cache && A->T == NULL && A->vdim > 1
+        && A->vlen > 1) ;
+}
+
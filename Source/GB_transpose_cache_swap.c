@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------------
+// GB_transpose_cache_swap: A = A' by swapping A with its cached transpose
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The content of A and A->T are exchanged in O(1) time, so that A becomes A'
+// and A->T holds the prior content of A (which is the transpose of the new A).
+// Both are given the CSR/CSC format A_is_csc.  The control settings of A
+// (hyper_switch, bitmap_switch, and sparsity_control) are not changed.  A must
+// have a cached transpose, and neither A nor A->T can have any pending work.
+
+#include "GB_transpose.h"
+
+#define GB_SWAP(type,field)                                         \
+{                                                                   \
+    type t = A->field ; A->field = T->field ; T->field = t ;        \
+}
+
+void GB_transpose_cache_swap    // A = A', using A->T
+(
+    GrB_Matrix A,
+    const bool A_is_csc         // new CSR/CSC format of A and A->T
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix T = A->T ;
+    ASSERT (T != NULL) ;
+    ASSERT_MATRIX_OK (A, "A to swap with A->T", GB0) ;
+    ASSERT_MATRIX_OK (T, "A->T to swap with A", GB0) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (T)) ;
+    ASSERT (A->type == T->type) ;
+
+    //--------------------------------------------------------------------------
+    // swap the content of A and T
+    //--------------------------------------------------------------------------
+
+    GB_SWAP (int64_t, plen) ;
+    GB_SWAP (int64_t, vlen) ;
+    GB_SWAP (int64_t, vdim) ;
+    GB_SWAP (int64_t, nvec) ;
+    GB_SWAP (int64_t, nvec_nonempty) ;
+    GB_SWAP (int64_t, nvals) ;
+
+    GB_SWAP (int64_t *, h) ;
+    GB_SWAP (int64_t *, p) ;
+    GB_SWAP (int64_t *, i) ;
+    GB_SWAP (void *, x) ;
+    GB_SWAP (int8_t *, b) ;
+    GB_SWAP (GrB_Matrix, Y) ;
+
+    GB_SWAP (size_t, h_size) ;
+    GB_SWAP (size_t, p_size) ;
+    GB_SWAP (size_t, i_size) ;
+    GB_SWAP (size_t, x_size) ;
+    GB_SWAP (size_t, b_size) ;
+
+    GB_SWAP (bool, h_shallow) ;
+    GB_SWAP (bool, p_shallow) ;
+    GB_SWAP (bool, i_shallow) ;
+    GB_SWAP (bool, x_shallow) ;
+    GB_SWAP (bool, b_shallow) ;
+    GB_SWAP (bool, Y_shallow) ;
+
+    GB_SWAP (bool, jumbled) ;
+    GB_SWAP (bool, iso) ;
+
+    A->is_csc = A_is_csc ;
+    T->is_csc = A_is_csc ;
+
+    ASSERT_MATRIX_OK (A, "A swapped with A->T", GB0) ;
+    ASSERT_MATRIX_OK (T, "A->T swapped with A", GB0) ;
+}
+
@@ -0,0 +1,591 @@
+//------------------------------------------------------------------------------
+// GB_tuner.c: online tuner for chunk, hyper_switch, and bitmap_switch
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// See GB_tuner.h for a description of the tuner.  A tuned method is wrapped
+// as follows:
+//
+//      GB_tuner_state tune ;
+//      GB_tuner_begin (&tune, GB_TUNER_DOT3, A, B) ;
+//      info = GB_AxB_dot3 (...) ;
+//      GB_tuner_end (&tune, info) ;
+//      GB_OK (info) ;
+//
+// GB_tuner_begin selects the chunk for this call, and GB_Context_chunk
+// returns it until GB_tuner_end is called.  If a tuned method calls another
+// tuned method, only the outer one is tuned.  The tuner of a Context may be
+// shared by many user threads, so its statistics are updated in a critical
+// section.  The tuner must not be disabled while another user thread is using
+// the same Context.
+
+#include "GB.h"
+#include "GB_tuner.h"
+
+// candidate chunk sizes, as multiples of the chunk of the Context
+static const double GB_tuner_factor [GB_TUNER_NCHUNK] =
+    { 0.25, 0.5, 1, 2, 4, 16, 64 } ;
+
+// order in which the candidates are first tried
+static const int GB_tuner_order [GB_TUNER_NCHUNK] = { 2, 1, 3, 0, 4, 5, 6 } ;
+
+// names of each method, for GB_tuner_export and GB_tuner_import
+static const char *GB_tuner_name [GB_TUNER_NMETHODS] =
+{
+    "saxpy3", "saxbit", "saxpy4", "saxpy5", "dot2", "dot3", "dot4",
+    "add", "emult", "apply", "select", "reduce"
+} ;
+
+#define GB_TUNER_HEADER "GraphBLAS tuner profile v1"
+
+//------------------------------------------------------------------------------
+// GB_tuner_class: bitmap_switch class of a matrix (see GB_Global.c)
+//------------------------------------------------------------------------------
+
+static inline int GB_tuner_class (int64_t vlen, int64_t vdim)
+{
+    int64_t d = GB_IMIN (vlen, vdim) ;
+    if (d <=  1) return (0) ;
+    if (d <=  2) return (1) ;
+    if (d <=  4) return (2) ;
+    if (d <=  8) return (3) ;
+    if (d <= 16) return (4) ;
+    if (d <= 32) return (5) ;
+    if (d <= 64) return (6) ;
+    return (7) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_tuner_reset: reset the tuner to the global settings
+//------------------------------------------------------------------------------
+
+static void GB_tuner_reset (GB_Tuner tuner)
+{
+    size_t header_size = tuner->header_size ;
+    memset (tuner, 0, sizeof (struct GB_Tuner_struct)) ;
+    tuner->header_size = header_size ;
+    tuner->hyper_switch = GB_Global_hyper_switch_get ( ) ;
+    for (int k = 0 ; k < GxB_NBITMAP_SWITCH ; k++)
+    {
+        tuner->bitmap_switch [k] = GB_Global_bitmap_switch_get (k) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_tuner_new: create a new tuner
+//------------------------------------------------------------------------------
+
+GrB_Info GB_tuner_new (GB_Tuner *tuner_handle)
+{
+    size_t header_size ;
+    GB_Tuner tuner = GB_MALLOC (1, struct GB_Tuner_struct, &header_size) ;
+    if (tuner == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    tuner->header_size = header_size ;
+    GB_tuner_reset (tuner) ;
+    (*tuner_handle) = tuner ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_tuner_free: free a tuner
+//------------------------------------------------------------------------------
+
+void GB_tuner_free (GB_Tuner *tuner_handle)
+{
+    if (tuner_handle != NULL && (*tuner_handle) != NULL)
+    {
+        size_t header_size = (*tuner_handle)->header_size ;
+        GB_FREE (tuner_handle, header_size) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_tuner_begin: select the chunk for a call to a tuned method
+//------------------------------------------------------------------------------
+
+void GB_tuner_begin
+(
+    GB_tuner_state *state,          // state of this call
+    int method,                     // method to tune
+    const GrB_Matrix A,             // first input matrix
+    const GrB_Matrix B              // second input matrix (may be NULL)
+)
+{
+
+    state->tuner = NULL ;
+    GB_Tuner tuner = GB_Context_tuner ( ) ;
+    if (tuner == NULL || A == NULL || GB_Context_chunk_tuned ( ))
+    {
+        // the Context is not tuned, or this call is inside another tuned
+        // method
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the size class of the problem
+    //--------------------------------------------------------------------------
+
+    double work = (double) GB_nnz_held (A) + 1 ;
+    if (B != NULL) work += (double) GB_nnz_held (B) ;
+    int size = (int) floor (log2 (work)) ;
+    size = GB_IMIN (size, GB_TUNER_NSIZE-1) ;
+
+    //--------------------------------------------------------------------------
+    // check if A is in a hysteresis band of the bitmap_switch or hyper_switch
+    //--------------------------------------------------------------------------
+
+    int bitmap_class = GB_tuner_class (A->vlen, A->vdim) ;
+    int bitmap_format = -1 ;
+    int hyper_format = -1 ;
+    bool A_is_full = GB_IS_FULL (A) ;
+    double anz = (double) GB_nnz (A) ;
+    double adense = ((double) A->vlen) * ((double) A->vdim) ;
+    if (!A_is_full && adense > 0)
+    {
+        float sw = tuner->bitmap_switch [bitmap_class] ;
+        double d = anz / adense ;
+        if (d >= sw/2 && d <= sw)
+        {
+            bitmap_format = GB_IS_BITMAP (A) ? 1 : 0 ;
+        }
+    }
+    if ((GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) && A->nvec_nonempty >= 0
+        && A->vdim > 1)
+    {
+        double h = tuner->hyper_switch ;
+        double nh = ((double) A->vdim) * h ;
+        double k = (double) A->nvec_nonempty ;
+        if (h > 0 && h < 1 && k > nh && k <= 2 * nh)
+        {
+            hyper_format = GB_IS_HYPERSPARSE (A) ? 1 : 0 ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // select the candidate chunk
+    //--------------------------------------------------------------------------
+
+    int cand = GB_TUNER_DEFAULT ;
+    bool first = false ;
+    #pragma omp critical (GB_tuner)
+    {
+        int64_t calls = ++(tuner->calls [method][size]) ;
+        first = (calls == 1) ;
+        int64_t *count = tuner->count [method][size] ;
+        double  *time  = tuner->time  [method][size] ;
+        bool warmup = false ;
+        for (int k = 0 ; k < GB_TUNER_NCHUNK && !warmup ; k++)
+        {
+            int c = GB_tuner_order [k] ;
+            if (count [c] < GB_TUNER_WARMUP)
+            {
+                // try each candidate a few times
+                cand = c ;
+                warmup = true ;
+            }
+        }
+        if (!warmup && (calls % GB_TUNER_EXPLORE) == 0)
+        {
+            // occasionally re-explore the least-used candidate
+            for (int c = 0 ; c < GB_TUNER_NCHUNK ; c++)
+            {
+                if (count [c] < count [cand]) cand = c ;
+            }
+        }
+        else if (!warmup)
+        {
+            // use the fastest candidate
+            double tbest = time [cand] / count [cand] ;
+            for (int c = 0 ; c < GB_TUNER_NCHUNK ; c++)
+            {
+                double tc = time [c] / count [c] ;
+                if (tc < tbest)
+                {
+                    tbest = tc ;
+                    cand = c ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // set the chunk for this user thread and start the timer
+    //--------------------------------------------------------------------------
+
+    double chunk = GB_Context_chunk ( ) * GB_tuner_factor [cand] ;
+    if (!GB_Context_chunk_tune (GB_IMAX (chunk, 1)))
+    {
+        // the chunk cannot be tuned without thread-local storage
+        return ;
+    }
+    state->tuner = tuner ;
+    state->method = method ;
+    state->size = size ;
+    state->cand = cand ;
+    state->bitmap_class = bitmap_class ;
+    state->bitmap_format = bitmap_format ;
+    state->hyper_format = hyper_format ;
+    state->first = first ;
+    state->work = work ;
+    state->t = GB_omp_get_wtime ( ) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_tuner_end: record the time for a call to a tuned method
+//------------------------------------------------------------------------------
+
+void GB_tuner_end
+(
+    GB_tuner_state *state,          // state of this call
+    GrB_Info info                   // result of the method
+)
+{
+
+    GB_Tuner tuner = state->tuner ;
+    if (tuner == NULL)
+    {
+        // this call was not tuned
+        return ;
+    }
+
+    double t = (GB_omp_get_wtime ( ) - state->t) / state->work ;
+    GB_Context_chunk_tune (0) ;
+    state->tuner = NULL ;
+    if (info != GrB_SUCCESS || state->first)
+    {
+        // the method failed, or declined to do the work, or this is the
+        // first call of this method and size, which may include the time to
+        // load or compile a JIT kernel; do not record it
+        return ;
+    }
+
+    int method = state->method ;
+    #pragma omp critical (GB_tuner)
+    {
+
+        //----------------------------------------------------------------------
+        // record the time for the chunk candidate
+        //----------------------------------------------------------------------
+
+        tuner->count [method][state->size][state->cand]++ ;
+        tuner->time  [method][state->size][state->cand] += t ;
+
+        //----------------------------------------------------------------------
+        // move the bitmap_switch toward the faster format
+        //----------------------------------------------------------------------
+
+        int fmt = state->bitmap_format ;
+        if (fmt >= 0)
+        {
+            int k = state->bitmap_class ;
+            int64_t *count = tuner->bitmap_count [method][k] ;
+            double  *time  = tuner->bitmap_time  [method][k] ;
+            count [fmt]++ ;
+            time  [fmt] += t ;
+            if (count [0] >= GB_TUNER_NSAMPLES &&
+                count [1] >= GB_TUNER_NSAMPLES)
+            {
+                double tsparse = time [0] / count [0] ;
+                double tbitmap = time [1] / count [1] ;
+                float sw = tuner->bitmap_switch [k] ;
+                if (tbitmap < 0.9 * tsparse)
+                {
+                    // bitmap is faster: use it for sparser matrices
+                    sw = GB_IMAX (sw * 0.8, 0.001) ;
+                }
+                else if (tsparse < 0.9 * tbitmap)
+                {
+                    // sparse is faster: use bitmap only for denser matrices
+                    sw = GB_IMIN (sw * 1.25, 1) ;
+                }
+                tuner->bitmap_switch [k] = sw ;
+                count [0] = 0 ; count [1] = 0 ;
+                time  [0] = 0 ; time  [1] = 0 ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // move the hyper_switch toward the faster format
+        //----------------------------------------------------------------------
+
+        fmt = state->hyper_format ;
+        if (fmt >= 0)
+        {
+            int64_t *count = tuner->hyper_count [method] ;
+            double  *time  = tuner->hyper_time  [method] ;
+            count [fmt]++ ;
+            time  [fmt] += t ;
+            if (count [0] >= GB_TUNER_NSAMPLES &&
+                count [1] >= GB_TUNER_NSAMPLES)
+            {
+                double tsparse = time [0] / count [0] ;
+                double thyper  = time [1] / count [1] ;
+                float h = tuner->hyper_switch ;
+                if (thyper < 0.9 * tsparse)
+                {
+                    // hypersparse is faster: use it for more matrices
+                    h = GB_IMIN (h * 1.25, 0.5) ;
+                }
+                else if (tsparse < 0.9 * thyper)
+                {
+                    // sparse is faster: use hypersparse for fewer matrices
+                    h = GB_IMAX (h * 0.8, 0.0001) ;
+                }
+                tuner->hyper_switch = h ;
+                count [0] = 0 ; count [1] = 0 ;
+                time  [0] = 0 ; time  [1] = 0 ;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_tuner_hyper_switch: hyper_switch for a new matrix
+//------------------------------------------------------------------------------
+
+float GB_tuner_hyper_switch (void)
+{
+    GB_Tuner tuner = GB_Context_tuner ( ) ;
+    if (tuner == NULL)
+    {
+        return (GB_Global_hyper_switch_get ( )) ;
+    }
+    float h ;
+    GB_ATOMIC_READ
+    h = tuner->hyper_switch ;
+    return (h) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_tuner_bitmap_switch: bitmap_switch for a new matrix
+//------------------------------------------------------------------------------
+
+float GB_tuner_bitmap_switch (int64_t vlen, int64_t vdim)
+{
+    GB_Tuner tuner = GB_Context_tuner ( ) ;
+    if (tuner == NULL)
+    {
+        return (GB_Global_bitmap_switch_matrix_get (vlen, vdim)) ;
+    }
+    float sw ;
+    int k = GB_tuner_class (vlen, vdim) ;
+    GB_ATOMIC_READ
+    sw = tuner->bitmap_switch [k] ;
+    return (sw) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_tuner_export: export the tuner as a string
+//------------------------------------------------------------------------------
+
+// The profile is a set of lines of text:
+//
+//      GraphBLAS tuner profile v1
+//      hyper_switch h
+//      bitmap_switch b0 b1 b2 b3 b4 b5 b6 b7
+//      chunk method size candidate count time
+//      ...
+//      end
+//
+// with one chunk line for each candidate that has been timed.
+//
+// If profile is NULL, the size of the profile (including the nul terminator)
+// is returned in (*size), and also kept in tuner->export_size.  Otherwise,
+// the profile is written to a string of that size, or GrB_INSUFFICIENT_SPACE
+// is returned if the size has not been queried or the profile has since
+// grown.  tuner->export_size is read and written in the critical section,
+// since another user thread may query the size at the same time.
+
+#define GB_APPEND(...)                                                      \
+{                                                                           \
+    int n = snprintf ((profile == NULL) ? NULL : (profile + slen),          \
+        (profile == NULL || slen >= len) ? 0 : (len - slen), __VA_ARGS__) ; \
+    slen += (size_t) GB_IMAX (n, 0) ;                                       \
+}
+
+GrB_Info GB_tuner_export
+(
+    char *profile,              // output string, or NULL to get the size only
+    size_t *size,               // size of the profile, if profile is NULL
+    const GB_Tuner tuner        // tuner to export
+)
+{
+    size_t slen = 0, len = 0 ;
+    GrB_Info info = GrB_SUCCESS ;
+    #pragma omp critical (GB_tuner)
+    {
+        if (profile != NULL)
+        {
+            len = tuner->export_size ;
+            if (len > 0) profile [0] = '\0' ;
+        }
+        if (profile != NULL && len == 0)
+        { 
+            // the size of the profile has not been queried
+            info = GrB_INSUFFICIENT_SPACE ;
+        }
+        else
+        {
+            GB_APPEND ("%s\n", GB_TUNER_HEADER) ;
+            GB_APPEND ("hyper_switch %.9g\n", (double) tuner->hyper_switch) ;
+            GB_APPEND ("bitmap_switch") ;
+            for (int k = 0 ; k < GxB_NBITMAP_SWITCH ; k++)
+            {
+                GB_APPEND (" %.9g", (double) tuner->bitmap_switch [k]) ;
+            }
+            GB_APPEND ("\n") ;
+            for (int method = 0 ; method < GB_TUNER_NMETHODS ; method++)
+            {
+                for (int size = 0 ; size < GB_TUNER_NSIZE ; size++)
+                {
+                    for (int c = 0 ; c < GB_TUNER_NCHUNK ; c++)
+                    {
+                        int64_t count = tuner->count [method][size][c] ;
+                        if (count > 0)
+                        {
+                            GB_APPEND ("chunk %s %d %d %" PRId64 " %.17g\n",
+                                GB_tuner_name [method], size, c, count,
+                                tuner->time [method][size][c]) ;
+                        }
+                    }
+                }
+            }
+            GB_APPEND ("end\n") ;
+            if (profile == NULL)
+            { 
+                // remember the size, to bound the next export of the profile
+                tuner->export_size = slen + 1 ;
+            }
+            else if (slen >= len)
+            { 
+                // the profile has grown, and no longer fits in the string
+                profile [0] = '\0' ;
+                info = GrB_INSUFFICIENT_SPACE ;
+            }
+        }
+    }
+    if (profile == NULL) (*size) = slen + 1 ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_tuner_import: import a profile into a tuner
+//------------------------------------------------------------------------------
+
+// The profile is parsed into a workspace tuner, so the tuner is not modified
+// if the profile is invalid.
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL GB_tuner_free (&T) ;
+
+GrB_Info GB_tuner_import
+(
+    GB_Tuner tuner,             // tuner to modify
+    const char *profile         // string with the profile
+)
+{
+
+    GrB_Info info ;
+    GB_Tuner T = NULL ;
+    GB_OK (GB_tuner_new (&T)) ;
+
+    //--------------------------------------------------------------------------
+    // parse the header and the switches
+    //--------------------------------------------------------------------------
+
+    const char *p = profile ;
+    int n = 0 ;
+    size_t hlen = strlen (GB_TUNER_HEADER) ;
+    if (strncmp (p, GB_TUNER_HEADER, hlen) != 0)
+    {
+        GB_FREE_ALL ;
+        return (GrB_INVALID_VALUE) ;
+    }
+    p += hlen ;
+    double h ;
+    if (sscanf (p, " hyper_switch %lg%n", &h, &n) != 1)
+    {
+        GB_FREE_ALL ;
+        return (GrB_INVALID_VALUE) ;
+    }
+    p += n ;
+    T->hyper_switch = (float) h ;
+    n = 0 ;
+    sscanf (p, " bitmap_switch%n", &n) ;
+    if (n == 0)
+    {
+        GB_FREE_ALL ;
+        return (GrB_INVALID_VALUE) ;
+    }
+    p += n ;
+    for (int k = 0 ; k < GxB_NBITMAP_SWITCH ; k++)
+    {
+        double b ;
+        if (sscanf (p, " %lg%n", &b, &n) != 1 || b < 0 || b > 1)
+        {
+            GB_FREE_ALL ;
+            return (GrB_INVALID_VALUE) ;
+        }
+        p += n ;
+        T->bitmap_switch [k] = (float) b ;
+    }
+
+    //--------------------------------------------------------------------------
+    // parse the chunk table
+    //--------------------------------------------------------------------------
+
+    while (true)
+    {
+        char name [16] ;
+        int size, c ;
+        int64_t count ;
+        double t ;
+        n = 0 ;
+        sscanf (p, " end%n", &n) ;
+        if (n > 0) break ;
+        if (sscanf (p, " chunk %15s %d %d %" SCNd64 " %lg%n", name, &size,
+            &c, &count, &t, &n) != 5 || size < 0 || size >= GB_TUNER_NSIZE
+            || c < 0 || c >= GB_TUNER_NCHUNK || count < 0 || t < 0)
+        {
+            GB_FREE_ALL ;
+            return (GrB_INVALID_VALUE) ;
+        }
+        p += n ;
+        int method = -1 ;
+        for (int k = 0 ; k < GB_TUNER_NMETHODS ; k++)
+        {
+            if (strcmp (name, GB_tuner_name [k]) == 0) method = k ;
+        }
+        if (method < 0)
+        {
+            GB_FREE_ALL ;
+            return (GrB_INVALID_VALUE) ;
+        }
+        T->count [method][size][c] = count ;
+        T->time  [method][size][c] = t ;
+        T->calls [method][size] += count ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy the result into the tuner
+    //--------------------------------------------------------------------------
+
+    #pragma omp critical (GB_tuner)
+    {
+        size_t header_size = tuner->header_size ;
+        size_t export_size = tuner->export_size ;
+        memcpy (tuner, T, sizeof (struct GB_Tuner_struct)) ;
+        tuner->header_size = header_size ;
+        tuner->export_size = export_size ;
+    }
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
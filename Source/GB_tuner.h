@@ -0,0 +1,139 @@
+//------------------------------------------------------------------------------
+// GB_tuner.h: online tuner for chunk, hyper_switch, and bitmap_switch
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The tuner is an optional part of a GxB_Context, enabled with
+// GrB_set (Context, true, GxB_TUNER).  It records the run time of each
+// method, for each size class of the problem (floor(log2(work))), and for
+// each of a small set of candidate chunk sizes (multiples of the chunk of the
+// Context).  Each call to a tuned method selects a chunk size: each candidate
+// is first tried a few times, and then the fastest one is used, with
+// occasional re-exploration so that the table can adapt.
+
+// The tuner also adjusts the hyper_switch and bitmap_switch used for new
+// matrices created in the Context.  Each of these has a hysteresis band in
+// which a matrix can be held in either of two formats (sparse or bitmap for
+// the bitmap_switch, sparse or hypersparse for the hyper_switch).  When the
+// input matrix of a method lies in this band, its run time per entry is
+// recorded for its format.  Once enough samples of both formats are found,
+// the switch is moved toward the faster format.
+
+// The learned table can be exported and imported as a string, with
+// GrB_get/GrB_set (Context, string, GxB_TUNER_PROFILE).
+
+#ifndef GB_TUNER_H
+#define GB_TUNER_H
+
+// methods that are tuned:
+typedef enum
+{
+    GB_TUNER_SAXPY3 = 0,    // C<M>=A*B, saxpy3 (sparse/hyper C)
+    GB_TUNER_SAXBIT = 1,    // C<M>=A*B, saxbit (bitmap C)
+    GB_TUNER_SAXPY4 = 2,    // C+=A*B, saxpy4 (full C)
+    GB_TUNER_SAXPY5 = 3,    // C+=A*B, saxpy5 (full C)
+    GB_TUNER_DOT2   = 4,    // C<M>=A'*B, dot2 (bitmap/full C)
+    GB_TUNER_DOT3   = 5,    // C<M>=A'*B, dot3 (sparse/hyper C)
+    GB_TUNER_DOT4   = 6,    // C+=A'*B, dot4 (full C)
+    GB_TUNER_ADD    = 7,    // eWiseAdd and eWiseUnion
+    GB_TUNER_EMULT  = 8,    // eWiseMult
+    GB_TUNER_APPLY  = 9,    // apply
+    GB_TUNER_SELECT = 10,   // select
+    GB_TUNER_REDUCE = 11,   // reduce to scalar
+}
+GB_tuner_method ;
+
+#define GB_TUNER_NMETHODS 12    // # of methods tuned
+#define GB_TUNER_NSIZE 48       // # of size classes, floor(log2(work))
+#define GB_TUNER_NCHUNK 7       // # of candidate chunk sizes
+#define GB_TUNER_DEFAULT 2      // candidate for the chunk of the Context
+#define GB_TUNER_WARMUP 2       // # of trials of each candidate
+#define GB_TUNER_EXPLORE 64     // re-explore once every 64 calls
+#define GB_TUNER_NSAMPLES 8     // # of samples before a switch is moved
+
+struct GB_Tuner_struct
+{
+    size_t header_size ;        // size of the malloc'd block for this struct
+    size_t export_size ;        // size of the profile given by the last
+                                // GrB_get (Context, &size, GxB_TUNER_PROFILE)
+
+    //--------------------------------------------------------------------------
+    // chunk: for each method, size class, and candidate chunk
+    //--------------------------------------------------------------------------
+
+    int64_t calls [GB_TUNER_NMETHODS][GB_TUNER_NSIZE] ;
+    int64_t count [GB_TUNER_NMETHODS][GB_TUNER_NSIZE][GB_TUNER_NCHUNK] ;
+    double  time  [GB_TUNER_NMETHODS][GB_TUNER_NSIZE][GB_TUNER_NCHUNK] ;
+                                // sum of (time/work) for each call
+
+    //--------------------------------------------------------------------------
+    // sparsity switches for new matrices, and their statistics
+    //--------------------------------------------------------------------------
+
+    float hyper_switch ;
+    float bitmap_switch [GxB_NBITMAP_SWITCH] ;
+
+    // [k][0]: sparse input, [k][1]: hypersparse/bitmap input
+    int64_t hyper_count  [GB_TUNER_NMETHODS][2] ;
+    double  hyper_time   [GB_TUNER_NMETHODS][2] ;
+    int64_t bitmap_count [GB_TUNER_NMETHODS][GxB_NBITMAP_SWITCH][2] ;
+    double  bitmap_time  [GB_TUNER_NMETHODS][GxB_NBITMAP_SWITCH][2] ;
+} ;
+
+typedef struct GB_Tuner_struct *GB_Tuner ;
+
+// the state of a single call to a tuned method
+typedef struct
+{
+    GB_Tuner tuner ;        // NULL if this call is not tuned
+    int method ;            // method being tuned
+    int size ;              // size class of the problem
+    int cand ;              // candidate chunk size in use
+    int bitmap_class ;      // bitmap_switch class of the input matrix
+    int bitmap_format ;     // 0: sparse, 1: bitmap, -1: not in the band
+    int hyper_format ;      // 0: sparse, 1: hypersparse, -1: not in the band
+    bool first ;            // true for the first call of this method and size
+    double work ;           // work for this call
+    double t ;              // start time
+}
+GB_tuner_state ;
+
+GrB_Info GB_tuner_new (GB_Tuner *tuner_handle) ;
+void GB_tuner_free (GB_Tuner *tuner_handle) ;
+
+void GB_tuner_begin
+(
+    GB_tuner_state *state,          // state of this call
+    int method,                     // method to tune
+    const GrB_Matrix A,             // first input matrix
+    const GrB_Matrix B              // second input matrix (may be NULL)
+) ;
+
+void GB_tuner_end
+(
+    GB_tuner_state *state,          // state of this call
+    GrB_Info info                   // result of the method
+) ;
+
+float GB_tuner_hyper_switch (void) ;
+float GB_tuner_bitmap_switch (int64_t vlen, int64_t vdim) ;
+
+GrB_Info GB_tuner_export
+(
+    char *profile,              // output string, or NULL to get the size only
+    size_t *size,               // size of the profile, if profile is NULL
+    const GB_Tuner tuner        // tuner to export
+) ;
+
+GrB_Info GB_tuner_import
+(
+    GB_Tuner tuner,             // tuner to modify
+    const char *profile         // string with the profile
+) ;
+
+#endif
+
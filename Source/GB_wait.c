@@ -51,13 +51,12 @@
     GB_phybix_free (A) ;                \
 }
 
-#include "GB_select.h"
+#include "GB.h"
 #include "GB_add.h"
 #include "GB_binop.h"
 #include "GB_Pending.h"
 #include "GB_build.h"
 #include "GB_jappend.h"
-#include "GB_scalar_wrap.h"
 
 GrB_Info GB_wait                // finish all pending computations
 (
@@ -251,20 +250,17 @@ GrB_Info GB_wait                // finish all pending computations
     // deletion, but hasn't been deleted yet.  It is marked by "negating"
     // replacing its index i with GB_FLIP(i).
 
-    // TODO: pass tnz to GB_selector, to pad the reallocated A matrix
+    // The zombies are deleted in place, so A->i and A->x keep their size, and
+    // the space they held can be used for the pending tuples in T, below.
     ASSERT_MATRIX_OK (A, "A before zombies removed", GB0) ;
 
     if (nzombies > 0)
     { 
-        // remove all zombies from A
-        // GB_selector frees A->Y if it changes A->h, or leaves it
-        // unmodified (and valid) otherwise.
-        struct GB_Scalar_opaque Thunk_header ;
-        int64_t k = 0 ;
-        GrB_Scalar Thunk = GB_Scalar_wrap (&Thunk_header, GrB_INT64, &k) ;
-        GB_OK (GB_selector (NULL, GxB_NONZOMBIE, false, A, Thunk, Werk)) ;
-        ASSERT (A->nzombies == (anz_orig - GB_nnz (A))) ;
-        A->nzombies = 0 ;
+        // remove all zombies from A.  GB_zombie_compact frees A->Y if it
+        // changes A->h, or leaves it unmodified (and valid) otherwise.
+        GB_OK (GB_zombie_compact (A, Werk)) ;
+        ASSERT (nzombies == (anz_orig - GB_nnz (A))) ;
+        ASSERT (A->nzombies == 0) ;
     }
 
     ASSERT_MATRIX_OK (A, "A after zombies removed", GB0) ;
@@ -384,8 +380,8 @@ GrB_Info GB_wait                // finish all pending computations
         // If anz1 is zero, or small compared to anz0, then it is faster to
         // leave A0 unmodified, and to update just A1.
 
-        // TODO: if A also had zombies, GB_selector could pad A so that
-        // GB_nnz_max (A) is equal to anz + tnz.
+        // If A had zombies, they were deleted in place above, so
+        // GB_nnz_max (A) is at least anz_orig, which may be enough already.
 
         // make sure A has enough space for the new tuples
         if (anz_new > GB_nnz_max (A))
@@ -29,6 +29,12 @@ GrB_Info GB_unjumble        // unjumble a matrix
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_zombie_compact      // delete all zombies from A, in place
+(
+    GrB_Matrix A,               // matrix to compact
+    GB_Werk Werk
+) ;
+
 // wait if condition holds
 #define GB_WAIT_IF(condition,A,name)                                    \
 {                                                                       \
@@ -34,21 +34,52 @@
     Werk->logger_handle = NULL ;                                    \
     Werk->logger_size_handle = NULL ;                               \
     /* initialize the Werk stack */                                 \
-    Werk->pwerk = 0 ;
+    Werk->pwerk = 0 ;                                               \
+    /* no saxpy3 plan, unless enabled by the descriptor */          \
+    Werk->plan_handle = NULL ;                                      \
+    Werk->plan_size_handle = NULL ;
 
-// C is a matrix, vector, scalar, or descriptor
+// C is a matrix, vector, or scalar that may be modified by the method, so
+// its cached transpose is freed (see GB_transpose_cache_build), and it is
+// given its own copy of any content it shares with a file (see
+// GxB_Matrix_attach).  Any deferred operators of this user thread are
+// computed first (see GB_defer.c).
 #define GB_WHERE(C,where_string)                                    \
+    GB_WHERE_DEFER (C, where_string)                                \
+    GB_DEFER_FINISH
+
+// GB_WHERE_DEFER: same as GB_WHERE, but deferred operators are not computed.
+// Only GrB_apply uses GB_WHERE_DEFER; GB_apply either adds C = op (C) to the
+// chain of deferred operators, or computes the chain itself.
+#define GB_WHERE_DEFER(C,where_string)                              \
+    GB_WHERE_LOG (C, where_string)                                  \
+    GB_transpose_cache_free ((GrB_Matrix) C) ;                      \
+    if (C != NULL && ((GrB_Matrix) C)->shm != NULL)                 \
+    {                                                               \
+        GrB_Info shm_info = GB_shm_unshare ((GrB_Matrix) C) ;       \
+        if (shm_info != GrB_SUCCESS) return (shm_info) ;            \
+    }
+
+// GB_WHERE_KEEP: same as GB_WHERE, except that X is a descriptor, or a
+// matrix, vector, or scalar whose values are not modified by the method
+// (GrB_wait and GxB_set), so any cached transpose of X is kept.
+#define GB_WHERE_KEEP(X,where_string)                               \
+    GB_WHERE_LOG (X, where_string)                                  \
+    GB_DEFER_FINISH
+
+// GB_WHERE_LOG: create the Werk, and log any error in the object X
+#define GB_WHERE_LOG(X,where_string)                                \
     if (!GB_Global_GrB_init_called_get ( ))                         \
     {                                                               \
         return (GrB_PANIC) ; /* GrB_init not called */              \
     }                                                               \
     GB_WERK (where_string)                                          \
-    if (C != NULL)                                                  \
+    if (X != NULL)                                                  \
     {                                                               \
         /* free any prior error logged in the object */             \
-        GB_FREE (&(C->logger), C->logger_size) ;                    \
-        Werk->logger_handle = &(C->logger) ;                        \
-        Werk->logger_size_handle = &(C->logger_size) ;              \
+        GB_FREE (&(X->logger), X->logger_size) ;                    \
+        Werk->logger_handle = &(X->logger) ;                        \
+        Werk->logger_size_handle = &(X->logger_size) ;              \
     }
 
 // create the Werk, with no error logging
@@ -57,7 +88,8 @@
     {                                                               \
         return (GrB_PANIC) ; /* GrB_init not called */              \
     }                                                               \
-    GB_WERK (where_string)
+    GB_WERK (where_string)                                          \
+    GB_DEFER_FINISH
 
 //------------------------------------------------------------------------------
 // GB_ERROR: error logging
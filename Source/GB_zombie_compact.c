@@ -0,0 +1,299 @@
+//------------------------------------------------------------------------------
+// GB_zombie_compact: delete all zombies from a matrix, in place
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// Deletes all zombies from a sparse or hypersparse matrix A, by compacting
+// A->i and A->x in place.  A->i and A->x are not reallocated, so GB_nnz_max (A)
+// does not change and any space freed by the zombies remains available for
+// pending tuples assembled later by GB_wait.  A->p is updated in place.  If A
+// is hypersparse and any vectors become empty, they are pruned from the
+// hyperlist by GB_hypermatrix_prune, which also frees A->Y.  Otherwise A->h
+// and A->Y are not modified.  If A is jumbled, it remains jumbled.
+
+// The entries of A are split into equal-sized slices, one per task.  In the
+// first phase, each task compacts the live entries of its slice to the start
+// of that slice, and replaces A->p [k] with the # of live entries that precede
+// it within the slice, for each vector k that starts in the slice.  In the
+// second phase, each slice is moved down to its final position, and A->p is
+// offset to its final value.  A slice can move onto the space of the prior
+// slice, so the moves are done one slice at a time.  Each move uses all
+// threads, unless the slice overlaps its final position (which happens only
+// if fewer zombies precede the slice than it has live entries).
+
+// A must not have shallow content, nor any pending tuples.
+
+#include "GB.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_WERK_POP (Work, int64_t) ;           \
+}
+
+#define GB_FREE_ALL ;
+
+//------------------------------------------------------------------------------
+// GB_compact_slice: compact the live entries of a slice of A
+//------------------------------------------------------------------------------
+
+#define GB_COMPACT_SLICE(GB_COPY_X)                                         \
+{                                                                           \
+    GB_PRAGMA (omp parallel for num_threads(nthreads) schedule(static,1))   \
+    for (tid = 0 ; tid < ntasks ; tid++)                                    \
+    {                                                                       \
+        int64_t pstart, pend ;                                              \
+        GB_PARTITION (pstart, pend, anz, tid, ntasks) ;                     \
+        int64_t k = Kfirst [tid] ;                                          \
+        const int64_t klast = Kfirst [tid+1] ;                              \
+        int64_t pdest = pstart ;                                            \
+        for (int64_t p = pstart ; p < pend ; p++)                           \
+        {                                                                   \
+            /* A(:,k) starts at p, so its new start is pdest */             \
+            for ( ; k < klast && Ap [k] == p ; k++)                         \
+            {                                                               \
+                Ap [k] = pdest - pstart ;                                   \
+            }                                                               \
+            int64_t i = Ai [p] ;                                            \
+            if (GB_IS_ZOMBIE (i)) continue ;                                \
+            Ai [pdest] = i ;                                                \
+            GB_COPY_X ;                                                     \
+            pdest++ ;                                                       \
+        }                                                                   \
+        Nlive [tid] = pdest - pstart ;                                      \
+    }                                                                       \
+}
+
+//------------------------------------------------------------------------------
+// GB_zombie_compact
+//------------------------------------------------------------------------------
+
+GrB_Info GB_zombie_compact      // delete all zombies from A, in place
+(
+    GrB_Matrix A,               // matrix to compact
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT_MATRIX_OK (A, "A for zombie_compact", GB0) ;
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (GB_ZOMBIES_OK (A)) ;
+    ASSERT (GB_JUMBLED_OK (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!A->p_shallow && !A->i_shallow && !A->x_shallow) ;
+    GB_WERK_DECLARE (Work, int64_t) ;
+
+    if (A->nzombies == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get A
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Ap = A->p ;
+    int64_t *restrict Ai = A->i ;
+    GB_void *restrict Ax = (GB_void *) A->x ;
+    const int64_t anvec = A->nvec ;
+    const int64_t anz = GB_nnz (A) ;
+    const size_t asize = (A->iso) ? 0 : A->type->size ;
+    ASSERT (anz > 0) ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (anz + anvec, chunk, nthreads_max) ;
+    int ntasks = (int) GB_IMIN (nthreads, anz) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    GB_WERK_PUSH (Work, 2 * (ntasks + 1), int64_t) ;
+    if (Work == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    int64_t *restrict Kfirst = Work ;
+    int64_t *restrict Nlive  = Work + (ntasks + 1) ;
+
+    //--------------------------------------------------------------------------
+    // find the first vector that starts in each slice
+    //--------------------------------------------------------------------------
+
+    // Kfirst [tid] is the first vector k with Ap [k] >= pstart of the slice.
+    // The vectors that start in the slice are Kfirst [tid:tid+1]-1.  This must
+    // be done before Ap is modified below.
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid <= ntasks ; tid++)
+    {
+        int64_t pstart, pend ;
+        GB_PARTITION (pstart, pend, anz, tid, ntasks) ;
+        int64_t klo = 0, khi = anvec ;
+        while (klo < khi)
+        {
+            int64_t kmid = (klo + khi) / 2 ;
+            if (Ap [kmid] < pstart)
+            {
+                klo = kmid + 1 ;
+            }
+            else
+            {
+                khi = kmid ;
+            }
+        }
+        Kfirst [tid] = klo ;
+    }
+
+    //--------------------------------------------------------------------------
+    // phase1: compact each slice in place
+    //--------------------------------------------------------------------------
+
+    switch (asize)
+    {
+        case 0 :    // A is iso
+            GB_COMPACT_SLICE (;) ;
+            break ;
+
+        case GB_1BYTE :
+            GB_COMPACT_SLICE (((uint8_t *) Ax) [pdest] =
+                ((uint8_t *) Ax) [p]) ;
+            break ;
+
+        case GB_2BYTE :
+            GB_COMPACT_SLICE (((uint16_t *) Ax) [pdest] =
+                ((uint16_t *) Ax) [p]) ;
+            break ;
+
+        case GB_4BYTE :
+            GB_COMPACT_SLICE (((uint32_t *) Ax) [pdest] =
+                ((uint32_t *) Ax) [p]) ;
+            break ;
+
+        case GB_8BYTE :
+            GB_COMPACT_SLICE (((uint64_t *) Ax) [pdest] =
+                ((uint64_t *) Ax) [p]) ;
+            break ;
+
+        case GB_16BYTE :
+            GB_COMPACT_SLICE (
+                ((uint64_t *) Ax) [2*pdest  ] = ((uint64_t *) Ax) [2*p  ] ;
+                ((uint64_t *) Ax) [2*pdest+1] = ((uint64_t *) Ax) [2*p+1]) ;
+            break ;
+
+        default :
+            GB_COMPACT_SLICE (
+                if (pdest < p)
+                {
+                    memcpy (Ax + pdest * asize, Ax + p * asize, asize) ;
+                }) ;
+            break ;
+    }
+
+    //--------------------------------------------------------------------------
+    // cumulative sum of the live entries in each slice
+    //--------------------------------------------------------------------------
+
+    // Nlive [tid] is now the final position of the first live entry of the
+    // slice, and Nlive [ntasks] is the # of live entries in A.
+    GB_cumsum (Nlive, ntasks, NULL, 1, NULL) ;
+    const int64_t nlive = Nlive [ntasks] ;
+    ASSERT (nlive == anz - A->nzombies) ;
+
+    //--------------------------------------------------------------------------
+    // phase2: finalize Ap
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        const int64_t offset = Nlive [tid] ;
+        for (int64_t k = Kfirst [tid] ; k < Kfirst [tid+1] ; k++)
+        {
+            Ap [k] += offset ;
+        }
+    }
+
+    // vectors that start at anz are empty, and now start at nlive
+    for (int64_t k = Kfirst [ntasks] ; k <= anvec ; k++)
+    {
+        Ap [k] = nlive ;
+    }
+
+    //--------------------------------------------------------------------------
+    // phase2: move each slice to its final position
+    //--------------------------------------------------------------------------
+
+    // The first slice is already in its final position.
+    for (tid = 1 ; tid < ntasks ; tid++)
+    {
+        int64_t pstart, pend ;
+        GB_PARTITION (pstart, pend, anz, tid, ntasks) ;
+        const int64_t pdest = Nlive [tid] ;
+        const int64_t len = Nlive [tid+1] - pdest ;
+        if (len == 0 || pdest == pstart) continue ;
+        ASSERT (pdest < pstart) ;
+        if (pdest + len <= pstart)
+        {
+            // the slice does not overlap its final position
+            GB_memcpy (Ai + pdest, Ai + pstart, len * sizeof (int64_t),
+                nthreads) ;
+            GB_memcpy (Ax + pdest * asize, Ax + pstart * asize, len * asize,
+                nthreads) ;
+        }
+        else
+        {
+            // the slice overlaps its final position
+            memmove (Ai + pdest, Ai + pstart, len * sizeof (int64_t)) ;
+            memmove (Ax + pdest * asize, Ax + pstart * asize, len * asize) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and finalize A
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    A->nzombies = 0 ;
+    A->nvals = nlive ;
+    ASSERT (A->nvals == Ap [anvec]) ;
+
+    //--------------------------------------------------------------------------
+    // count the non-empty vectors and prune the hyperlist
+    //--------------------------------------------------------------------------
+
+    int64_t nvec_nonempty = 0 ;
+    int64_t k ;
+    int nthreads2 = GB_nthreads (anvec, chunk, nthreads_max) ;
+    #pragma omp parallel for num_threads(nthreads2) schedule(static) \
+        reduction(+:nvec_nonempty)
+    for (k = 0 ; k < anvec ; k++)
+    {
+        nvec_nonempty += (Ap [k] < Ap [k+1]) ;
+    }
+    A->nvec_nonempty = nvec_nonempty ;
+
+    // if A is hypersparse, remove its empty vectors and free A->Y, if needed.
+    // A->Y is not modified if A->h does not change.
+    GB_OK (GB_hypermatrix_prune (A, Werk)) ;
+    ASSERT_MATRIX_OK (A, "A after zombie_compact", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -11,6 +11,7 @@
 // ignored.
 
 #include "GB.h"
+#include "GB_AxB_saxpy3.h"
 
 GrB_Info GrB_Descriptor_free            // free a descriptor
 (
@@ -31,6 +32,8 @@ GrB_Info GrB_Descriptor_free            // free a descriptor
             { 
                 GB_FREE (&(desc->logger), desc->logger_size) ;
                 desc->logger_size = 0 ;
+                GB_AxB_saxpy3_plan_free (&(desc->Plan), desc->Plan_size) ;
+                desc->Plan_size = 0 ;
                 desc->magic = GB_FREED ;  // to help detect dangling pointers
                 desc->header_size = 0 ;
                 GB_FREE (descriptor, header_size) ;
@@ -67,6 +67,11 @@ static GrB_Info GB_desc_get
             if ((*value) != GrB_DEFAULT) (*value) = GxB_SECURE_IMPORT ;
             break ;
 
+        case GxB_AxB_PLAN : 
+
+            (*value) = (int32_t) ((desc == NULL) ? false : desc->axb_plan) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -54,6 +54,9 @@ GrB_Info GrB_Descriptor_new     // create a new descriptor
     desc->do_sort = false ;        // do not sort in GrB_mxm and others
     desc->compression = GxB_DEFAULT ;
     desc->import = GxB_DEFAULT ;   // trust input data in GxB import/deserialize
+    desc->axb_plan = false ;       // do not save a plan for saxpy3
+    desc->Plan = NULL ;
+    desc->Plan_size = 0 ;
     return (GrB_SUCCESS) ;
 }
 
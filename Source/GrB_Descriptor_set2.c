@@ -8,6 +8,7 @@
 //------------------------------------------------------------------------------
 
 #include "GB_get_set.h"
+#include "GB_AxB_saxpy3.h"
 
 //------------------------------------------------------------------------------
 // GB_desc_set
@@ -127,6 +128,14 @@ static GrB_Info GB_desc_set
                 (value == GrB_DEFAULT) ? GxB_FAST_IMPORT : GxB_SECURE_IMPORT ;
             break ;
 
+        case GxB_AxB_PLAN : 
+
+            // any prior plan is discarded
+            desc->axb_plan = (value != GrB_DEFAULT) ;
+            GB_AxB_saxpy3_plan_free (&(desc->Plan), desc->Plan_size) ;
+            desc->Plan_size = 0 ;
+            break ;
+
         default : 
             return (GrB_INVALID_VALUE) ;
     }
@@ -157,7 +166,7 @@ GrB_Info GrB_Descriptor_set_Scalar
         return (GrB_INVALID_VALUE) ;
     }
 
-    GB_WHERE (desc, "GrB_Descriptor_set_Scalar (desc, value, field)") ;
+    GB_WHERE_KEEP (desc, "GrB_Descriptor_set_Scalar (desc, value, field)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (desc) ;
     GB_RETURN_IF_NULL_OR_FAULTY (value) ;
     ASSERT_DESCRIPTOR_OK (desc, "desc to set", GB0) ;
@@ -197,7 +206,7 @@ GrB_Info GrB_Descriptor_set_String
         return (GrB_INVALID_VALUE) ;
     }
 
-    GB_WHERE (desc, "GrB_Descriptor_set_String (desc, value, field)") ;
+    GB_WHERE_KEEP (desc, "GrB_Descriptor_set_String (desc, value, field)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (desc) ;
     GB_RETURN_IF_NULL (value) ;
     ASSERT_DESCRIPTOR_OK (desc, "desc to set", GB0) ;
@@ -232,7 +241,7 @@ GrB_Info GrB_Descriptor_set_INT32
         return (GrB_INVALID_VALUE) ;
     }
 
-    GB_WHERE (desc, "GrB_Descriptor_set_INT32 (desc, value, field)") ;
+    GB_WHERE_KEEP (desc, "GrB_Descriptor_set_INT32 (desc, value, field)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (desc) ;
     ASSERT_DESCRIPTOR_OK (desc, "desc to set", GB0) ;
 
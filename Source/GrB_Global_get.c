@@ -98,6 +98,11 @@ static GrB_Info GB_global_enum_get (int32_t *value, int field)
             (*value) = (int) GB_Context_gpu_id_get (NULL) ;
             break ;
 
+        case GxB_GLOBAL_NUMA_POLICY :       // same as GxB_NUMA_POLICY
+
+            (*value) = (int) GB_Context_numa_policy_get (NULL) ;
+            break ;
+
         case GxB_BURBLE : 
 
             (*value) = (int) GB_Global_burble_get ( ) ;
@@ -316,6 +321,16 @@ static GrB_Info GB_global_string_get (const char **value, int field)
             (*value) = GB_jitifyer_get_cache_path ( ) ;
             break ;
 
+        case GxB_JIT_MANIFEST : 
+
+            (*value) = GB_jitifyer_get_manifest ( ) ;
+            break ;
+
+        case GxB_JIT_C_EMBEDDED : 
+
+            (*value) = GB_jitifyer_get_C_embedded ( ) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -51,6 +51,11 @@ static GrB_Info GB_global_enum_set (int32_t value, int field)
             GB_Context_gpu_id_set (NULL, value) ;
             break ;
 
+        case GxB_GLOBAL_NUMA_POLICY :       // same as GxB_NUMA_POLICY
+
+            GB_Context_numa_policy_set (NULL, value) ;
+            break ;
+
         case GxB_BURBLE : 
 
             GB_Global_burble_set ((bool) value) ;
@@ -210,6 +215,18 @@ GrB_Info GrB_Global_set_String
 
             return (GB_jitifyer_set_cache_path (value)) ;
 
+        case GxB_JIT_MANIFEST : 
+
+            return (GB_jitifyer_set_manifest (value)) ;
+
+        case GxB_JIT_C_EMBEDDED : 
+
+            return (GB_jitifyer_set_C_embedded (value)) ;
+
+        case GxB_JIT_BUNDLE : 
+
+            return (GB_jitifyer_bundle (value)) ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -30,7 +30,7 @@ GrB_Info GrB_Matrix_apply           // C<M> = accum (C, op(A)) or op(A')
     // check inputs
     //--------------------------------------------------------------------------
 
-    GB_WHERE (C, "GrB_Matrix_apply (C, M, accum, op, A, desc)") ;
+    GB_WHERE_DEFER (C, "GrB_Matrix_apply (C, M, accum, op, A, desc)") ;
     GB_BURBLE_START ("GrB_apply") ;
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;
     GB_RETURN_IF_FAULTY (M_in) ;
@@ -174,7 +174,7 @@ GrB_Info GrB_Matrix_apply_BinaryOp1st_Scalar    // C<M>=accum(C,op(x,A))
     const GrB_Descriptor desc       // descriptor for C, M, and A
 )
 { 
-    GB_WHERE (C, "GrB_Matrix_apply_BinaryOp1st_Scalar"
+    GB_WHERE_DEFER (C, "GrB_Matrix_apply_BinaryOp1st_Scalar"
         " (C, M, accum, op, x, A, desc)") ;
     return (GB_1st (C, M, accum, op, x, A, desc, Werk)) ;
 }
@@ -213,7 +213,7 @@ GrB_Info GrB_Matrix_apply_BinaryOp2nd_Scalar    // C<M>=accum(C,op(A,y))
     const GrB_Descriptor desc       // descriptor for C, M, and A
 )
 { 
-    GB_WHERE (C, "GrB_Matrix_apply_BinaryOp2nd_Scalar"
+    GB_WHERE_DEFER (C, "GrB_Matrix_apply_BinaryOp2nd_Scalar"
         " (C, M, accum, op, A, y, desc)") ;
     return (GB_2nd (C, M, accum, (GB_Operator) op, A, y, desc, Werk)) ;
 }
@@ -253,7 +253,7 @@ GrB_Info GB_EVAL3 (prefix, _Matrix_apply_BinaryOp1st_, T)                   \
     const GrB_Descriptor desc       /* descriptor for C, M, and A */        \
 )                                                                           \
 {                                                                           \
-    GB_WHERE (C, GB_STR(prefix) "_Matrix_apply_BinaryOp1st_" GB_STR(T)      \
+    GB_WHERE_DEFER (C, GB_STR(prefix) "_Matrix_apply_BinaryOp1st_" GB_STR(T)   \
         " (C, M, accum, op, x, A, desc)") ;                                 \
     GB_SCALAR_WRAP (scalar, x, GB_EVAL3 (prefix, _, T)) ;                   \
     return (GB_1st (C, M, accum, op, scalar, A, desc, Werk)) ;              \
@@ -288,7 +288,7 @@ GrB_Info GrB_Matrix_apply_BinaryOp1st_UDT
     const GrB_Descriptor desc       // descriptor for C, M, and A
 )
 { 
-    GB_WHERE (C, "GrB_Matrix_apply_BinaryOp1st_UDT "
+    GB_WHERE_DEFER (C, "GrB_Matrix_apply_BinaryOp1st_UDT "
         " (C, M, accum, op, x, A, desc)") ;
     GB_SCALAR_WRAP_UDT (scalar, x, (op == NULL) ? NULL : op->xtype) ;
     return (GB_1st (C, M, accum, op, scalar, A, desc, Werk)) ;
@@ -310,7 +310,7 @@ GrB_Info GB_EVAL3 (prefix, _Matrix_apply_BinaryOp2nd_, T)                   \
     const GrB_Descriptor desc       /* descriptor for C, M, and A */        \
 )                                                                           \
 {                                                                           \
-    GB_WHERE (C, GB_STR(prefix) "_Matrix_apply_BinaryOp2nd_" GB_STR(T)      \
+    GB_WHERE_DEFER (C, GB_STR(prefix) "_Matrix_apply_BinaryOp2nd_" GB_STR(T)   \
         " (C, M, accum, op, A, y, desc)") ;                                 \
     GB_SCALAR_WRAP (scalar, y, GB_EVAL3 (prefix, _, T)) ;                   \
     return (GB_2nd (C, M, accum, (GB_Operator) op, A, scalar, desc, Werk)) ;\
@@ -345,7 +345,7 @@ GrB_Info GrB_Matrix_apply_BinaryOp2nd_UDT
     const GrB_Descriptor desc       // descriptor for C, M, and A
 )
 { 
-    GB_WHERE (C, "GrB_Matrix_apply_BinaryOp2nd_UDT"
+    GB_WHERE_DEFER (C, "GrB_Matrix_apply_BinaryOp2nd_UDT"
         " (C, M, accum, op, A, y, desc)") ;
     GB_SCALAR_WRAP_UDT (scalar, y, (op == NULL) ? NULL : op->ytype) ;
     return (GB_2nd (C, M, accum, (GB_Operator) op, A, scalar, desc, Werk)) ;
@@ -367,7 +367,7 @@ GrB_Info GB_EVAL3 (prefix, _Matrix_apply_IndexOp_, T)                       \
     const GrB_Descriptor desc       /* descriptor for C, M, and A */        \
 )                                                                           \
 {                                                                           \
-    GB_WHERE (C, GB_STR(prefix) "_Matrix_apply_IndexOp_" GB_STR(T)          \
+    GB_WHERE_DEFER (C, GB_STR(prefix) "_Matrix_apply_IndexOp_" GB_STR(T)       \
         " (C, M, accum, op, A, thunk, desc)") ;                             \
     GB_SCALAR_WRAP (scalar, thunk, GB_EVAL3 (prefix, _, T)) ;               \
     return (GB_2nd (C, M, accum, (GB_Operator) op, A, scalar, desc, Werk)) ;\
@@ -402,7 +402,7 @@ GrB_Info GrB_Matrix_apply_IndexOp_UDT
     const GrB_Descriptor desc       // descriptor for C, M, and A
 )
 { 
-    GB_WHERE (C, "GrB_Matrix_apply_IndexOp_UDT"
+    GB_WHERE_DEFER (C, "GrB_Matrix_apply_IndexOp_UDT"
         " (C, M, accum, op, A, thunk, desc)") ;
     GB_SCALAR_WRAP_UDT (scalar, thunk, (op == NULL) ? NULL : op->ytype) ;
     return (GB_2nd (C, M, accum, (GB_Operator) op, A, scalar, desc, Werk)) ;
@@ -423,7 +423,7 @@ GrB_Info GrB_Matrix_apply_IndexOp_Scalar    // C<M>=accum(C,op(A,i,j,thunk))
     const GrB_Descriptor desc       // descriptor for C, M, and A
 )
 { 
-    GB_WHERE (C, "GrB_Matrix_apply_IndexOp_Scalar"
+    GB_WHERE_DEFER (C, "GrB_Matrix_apply_IndexOp_Scalar"
         " (C, M, accum, op, A, thunk, desc)") ;
     return (GB_2nd (C, M, accum, (GB_Operator) op, A, thunk, desc, Werk)) ;
 }
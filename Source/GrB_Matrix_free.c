@@ -18,6 +18,8 @@ GrB_Info GrB_Matrix_free        // free a matrix
 )
 { 
 
+    // discard any deferred operators on A
+    if (A != NULL) GB_defer_drop (*A) ;
     GB_Matrix_free (A) ;
     return (GrB_SUCCESS) ;
 }
@@ -9,7 +9,7 @@
 
 // Finishes all work on a matrix, followed by an OpenMP flush.
 
-#include "GB.h"
+#include "GB_transpose.h"
 
 #define GB_FREE_ALL ;
 
@@ -24,20 +24,21 @@ GrB_Info GrB_Matrix_wait    // finish all work on a matrix
     // check inputs
     //--------------------------------------------------------------------------
 
-    GB_WHERE (A, "GrB_Matrix_wait (A, waitmode)") ;
+    GB_WHERE_KEEP (A, "GrB_Matrix_wait (A, waitmode)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
 
     //--------------------------------------------------------------------------
-    // finish all pending work on the matrix, including creating A->Y
+    // finish all pending work on the matrix, including creating A->Y and A->T
     //--------------------------------------------------------------------------
 
-    if (waitmode != GrB_COMPLETE &&
-        (GB_ANY_PENDING_WORK (A) || GB_hyper_hash_need (A)))
+    if (waitmode != GrB_COMPLETE && (GB_ANY_PENDING_WORK (A) ||
+        GB_hyper_hash_need (A) || GB_transpose_cache_need (A)))
     { 
         GrB_Info info ;
         GB_BURBLE_START ("GrB_Matrix_wait") ;
         GB_OK (GB_wait (A, "matrix", Werk)) ;
         GB_OK (GB_hyper_hash_build (A, Werk)) ;
+        GB_OK (GB_transpose_cache_build (A, Werk)) ;
         GB_BURBLE_END ;
     }
 
@@ -30,7 +30,7 @@ GrB_Info GrB_Vector_apply           // w<M> = accum (w, op(u))
     // check inputs
     //--------------------------------------------------------------------------
 
-    GB_WHERE (w, "GrB_Vector_apply (w, M, accum, op, u, desc)") ;
+    GB_WHERE_DEFER (w, "GrB_Vector_apply (w, M, accum, op, u, desc)") ;
     GB_BURBLE_START ("GrB_apply") ;
     GB_RETURN_IF_NULL_OR_FAULTY (w) ;
     GB_RETURN_IF_FAULTY (M_in) ;
@@ -186,7 +186,7 @@ GrB_Info GrB_Vector_apply_BinaryOp1st_Scalar    // w<mask> = accum (w, op(x,u))
     const GrB_Descriptor desc       // descriptor for w and M
 )
 { 
-    GB_WHERE (w, "GrB_Vector_apply_BinaryOp1st_Scalar"
+    GB_WHERE_DEFER (w, "GrB_Vector_apply_BinaryOp1st_Scalar"
         " (w, M, accum, op, x, u, desc)") ;
     return (GB_1st (w, M, accum, op, x, u, desc, Werk)) ;
 }
@@ -225,7 +225,7 @@ GrB_Info GrB_Vector_apply_BinaryOp2nd_Scalar    // w<mask> = accum (w, op(u,y))
     const GrB_Descriptor desc       // descriptor for w and M
 )
 { 
-    GB_WHERE (w, "GrB_Vector_apply_BinaryOp2nd_Scalar"
+    GB_WHERE_DEFER (w, "GrB_Vector_apply_BinaryOp2nd_Scalar"
         " (w, M, accum, op, u, y, desc)") ;
     return (GB_2nd (w, M, accum, (GB_Operator) op, u, y, desc, Werk)) ;
 }
@@ -265,7 +265,7 @@ GrB_Info GB_EVAL3 (prefix, _Vector_apply_BinaryOp1st_, T)                   \
     const GrB_Descriptor desc       /* descriptor for w and M */            \
 )                                                                           \
 {                                                                           \
-    GB_WHERE (w, GB_STR(prefix) "_Vector_apply_BinaryOp1st_" GB_STR(T)      \
+    GB_WHERE_DEFER (w, GB_STR(prefix) "_Vector_apply_BinaryOp1st_" GB_STR(T)   \
         " (w, M, accum, op, x, u, desc)") ;                                 \
     GB_SCALAR_WRAP (scalar, x, GB_EVAL3 (prefix, _, T)) ;                   \
     return (GB_1st (w, M, accum, op, scalar, u, desc, Werk)) ;              \
@@ -300,7 +300,7 @@ GrB_Info GrB_Vector_apply_BinaryOp1st_UDT
     const GrB_Descriptor desc       // descriptor for w and M
 )
 { 
-    GB_WHERE (w, "GrB_Vector_apply_BinaryOp1st_UDT"
+    GB_WHERE_DEFER (w, "GrB_Vector_apply_BinaryOp1st_UDT"
         " (w, M, accum, op, x, u, desc)") ;
     GB_SCALAR_WRAP_UDT (scalar, x, (op == NULL) ? NULL : op->xtype) ;
     return (GB_1st (w, M, accum, op, scalar, u, desc, Werk)) ;
@@ -322,7 +322,7 @@ GrB_Info GB_EVAL3 (prefix, _Vector_apply_BinaryOp2nd_, T)                   \
     const GrB_Descriptor desc       /* descriptor for w and M */            \
 )                                                                           \
 {                                                                           \
-    GB_WHERE (w, GB_STR(prefix) "_Vector_apply_BinaryOp2nd_" GB_STR(T)      \
+    GB_WHERE_DEFER (w, GB_STR(prefix) "_Vector_apply_BinaryOp2nd_" GB_STR(T)   \
         " (w, M, accum, op, u, y, desc)") ;                                 \
     GB_SCALAR_WRAP (scalar, y, GB_EVAL3 (prefix, _, T)) ;                   \
     return (GB_2nd (w, M, accum, (GB_Operator) op, u, scalar, desc, Werk)) ;\
@@ -357,7 +357,7 @@ GrB_Info GrB_Vector_apply_BinaryOp2nd_UDT
     const GrB_Descriptor desc       // descriptor for w and M
 )
 { 
-    GB_WHERE (w, "GrB_Vector_apply_BinaryOp2nd_UDT"
+    GB_WHERE_DEFER (w, "GrB_Vector_apply_BinaryOp2nd_UDT"
         " (w, M, accum, op, u, y, desc)") ;
     GB_SCALAR_WRAP_UDT (scalar, y, (op == NULL) ? NULL : op->ytype) ;
     return (GB_2nd (w, M, accum, (GB_Operator) op, u, scalar, desc, Werk)) ;
@@ -379,7 +379,7 @@ GrB_Info GB_EVAL3 (prefix, _Vector_apply_IndexOp_, T)                       \
     const GrB_Descriptor desc       /* descriptor for w and M */            \
 )                                                                           \
 {                                                                           \
-    GB_WHERE (w, GB_STR(prefix) "_Vector_apply_IndexOp_" GB_STR(T)          \
+    GB_WHERE_DEFER (w, GB_STR(prefix) "_Vector_apply_IndexOp_" GB_STR(T)       \
         " (w, M, accum, op, u, thunk, desc)") ;                             \
     GB_SCALAR_WRAP (scalar, thunk, GB_EVAL3 (prefix, _, T)) ;               \
     return (GB_2nd (w, M, accum, (GB_Operator) op, u, scalar, desc, Werk)) ;\
@@ -414,7 +414,7 @@ GrB_Info GrB_Vector_apply_IndexOp_UDT
     const GrB_Descriptor desc       // descriptor for w and M
 )
 { 
-    GB_WHERE (w, "GrB_Vector_apply_IndexOp_UDT"
+    GB_WHERE_DEFER (w, "GrB_Vector_apply_IndexOp_UDT"
         " (w, M, accum, op, u, thunk, desc)") ;
     GB_SCALAR_WRAP_UDT (scalar, thunk, (op == NULL) ? NULL : op->ytype) ;
     return (GB_2nd (w, M, accum, (GB_Operator) op, u, scalar, desc, Werk)) ;
@@ -435,7 +435,7 @@ GrB_Info GrB_Vector_apply_IndexOp_Scalar
     const GrB_Descriptor desc       // descriptor for w and M
 )
 { 
-    GB_WHERE (w, "GrB_Vector_apply_IndexOp_Scalar"
+    GB_WHERE_DEFER (w, "GrB_Vector_apply_IndexOp_Scalar"
         " (w, M, accum, op, u, thunk, desc)") ;
     return (GB_2nd (w, M, accum, (GB_Operator) op, u, thunk, desc, Werk)) ;
 }
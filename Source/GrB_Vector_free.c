@@ -18,6 +18,8 @@ GrB_Info GrB_Vector_free    // free a vector
 )
 { 
 
+    // discard any deferred operators on v
+    if (v != NULL) GB_defer_drop ((GrB_Matrix) (*v)) ;
     GB_Matrix_free ((GrB_Matrix *) v) ;
     return (GrB_SUCCESS) ;
 }
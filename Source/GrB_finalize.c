@@ -17,6 +17,8 @@
 
 GrB_Info GrB_finalize ( )
 { 
+    GB_defer_drop (NULL) ;
+    GB_Context_tuner_set (GxB_CONTEXT_WORLD, false) ;
     GB_jitifyer_finalize ( ) ;
     return (GrB_SUCCESS) ;
 }
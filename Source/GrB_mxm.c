@@ -42,6 +42,7 @@ GrB_Info GrB_mxm                    // C<M> = accum (C, A*B)
     // get the descriptor
     GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
         A_transpose, B_transpose, AxB_method, do_sort) ;
+    GB_GET_AXB_PLAN (desc) ;
 
     // get the mask
     GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
@@ -45,6 +45,7 @@ GrB_Info GrB_mxv                    // w<M> = accum (w, A*u)
     // get the descriptor
     GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
         A_transpose, xx, AxB_method, do_sort) ;
+    GB_GET_AXB_PLAN (desc) ;
 
     // get the mask
     GrB_Matrix M = GB_get_mask ((GrB_Matrix) M_in, &Mask_comp, &Mask_struct) ;
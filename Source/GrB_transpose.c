@@ -89,14 +89,17 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
 
         // T = A', the default behavior.  This step may seem counter-intuitive,
         // but method computes C<M>=A' by default when A_transpose is false.
+        // If A has a cached transpose, T is a shallow copy of A->T, unless
+        // a typecast is required.  C is modified below, so A->T is not
+        // constructed if C and A are aliased.
 
         // Precasting:
         if (accum == NULL)
         { 
             // If there is no accum operator, T is transplanted into Z and
             // typecasted into the C->type during the transpose.
-            GB_OK (GB_transpose_cast (T, C->type, C_is_csc, A, false,
-                Werk)) ;
+            GB_OK (GB_transpose_cache_cast (T, C->type, C_is_csc, A, false,
+                C != A, Werk)) ;
         }
         else
         { 
@@ -105,8 +108,8 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
             // but not C are typecasted directly into C->type.  Thus, the
             // typecast of T (if any) must wait, and be done in call to GB_add
             // in GB_accum_mask.
-            GB_OK (GB_transpose_cast (T, A->type, C_is_csc, A, false,
-                Werk)) ;
+            GB_OK (GB_transpose_cache_cast (T, A->type, C_is_csc, A, false,
+                C != A, Werk)) ;
         }
 
         // no operator; typecasting done if accum is NULL
@@ -8,6 +8,7 @@
 //------------------------------------------------------------------------------
 
 #include "GB_get_set.h"
+#include "GB_tuner.h"
 
 //------------------------------------------------------------------------------
 // GxB_Context_get_Scalar
@@ -56,6 +57,21 @@ GrB_Info GxB_Context_get_Scalar
             ivalue= GB_Context_gpu_id_get (Context) ;
             break ;
 
+        case GxB_CONTEXT_NUMA_POLICY :      // same as GxB_NUMA_POLICY
+
+            ivalue = GB_Context_numa_policy_get (Context) ;
+            break ;
+
+        case GxB_CONTEXT_TUNER :            // same as GxB_TUNER
+
+            ivalue = (GB_Context_tuner_get (Context) != NULL) ;
+            break ;
+
+        case GxB_CONTEXT_DEFER :            // same as GxB_DEFER
+
+            ivalue = GB_Context_defer_get (Context) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -104,6 +120,25 @@ GrB_Info GxB_Context_get_String
     // get the field
     //--------------------------------------------------------------------------
 
+    if (field == GxB_CONTEXT_TUNER_PROFILE)
+    { 
+        // export the tuner profile.  The string has the size given by the
+        // last call to GrB_get (Context, &size, GxB_TUNER_PROFILE), and no
+        // more than that is written to it.  The profile can grow between the
+        // two calls, if the Context is in use by another user thread.
+        GB_Tuner tuner = GB_Context_tuner_get (Context) ;
+        if (tuner == NULL)
+        { 
+            // the tuner is not enabled
+            return (GrB_INVALID_VALUE) ;
+        }
+        // returns GrB_INSUFFICIENT_SPACE if the size has not been queried,
+        // or if the profile has grown and no longer fits in the string
+        GrB_Info info = GB_tuner_export (value, NULL, tuner) ;
+        #pragma omp flush
+        return (info) ;
+    }
+
     if (field != GrB_NAME)
     { 
         return (GrB_INVALID_VALUE) ;
@@ -163,6 +198,21 @@ GrB_Info GxB_Context_get_INT
             (*value) = GB_Context_gpu_id_get (Context) ;
             break ;
 
+        case GxB_CONTEXT_NUMA_POLICY :      // same as GxB_NUMA_POLICY
+
+            (*value) = GB_Context_numa_policy_get (Context) ;
+            break ;
+
+        case GxB_CONTEXT_TUNER :            // same as GxB_TUNER
+
+            (*value) = (GB_Context_tuner_get (Context) != NULL) ;
+            break ;
+
+        case GxB_CONTEXT_DEFER :            // same as GxB_DEFER
+
+            (*value) = GB_Context_defer_get (Context) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -197,6 +247,20 @@ GrB_Info GxB_Context_get_SIZE
     // get the field
     //--------------------------------------------------------------------------
 
+    if (field == GxB_CONTEXT_TUNER_PROFILE)
+    { 
+        // size of the tuner profile, including the nul terminator
+        GB_Tuner tuner = GB_Context_tuner_get (Context) ;
+        if (tuner == NULL)
+        { 
+            // the tuner is not enabled
+            return (GrB_INVALID_VALUE) ;
+        }
+        // the size is also kept in the tuner, to bound the export by
+        // GxB_Context_get_String
+        return (GB_tuner_export (NULL, value, tuner)) ;
+    }
+
     if (field != GrB_NAME)
     { 
         return (GrB_INVALID_VALUE) ;
@@ -48,6 +48,9 @@ GrB_Info GxB_Context_new            // create a new Context
     Context->nthreads_max = GB_Context_nthreads_max_get (NULL) ;
     Context->chunk = GB_Context_chunk_get (NULL) ;
     Context->gpu_id = GB_Context_gpu_id_get (NULL) ;
+    Context->numa_policy = GB_Context_numa_policy_get (NULL) ;
+    Context->tuner = NULL ;                 // tuner is off by default
+    Context->defer = GB_Context_defer_get (NULL) ;
 
     // return the result
     (*Context_handle) = Context ;
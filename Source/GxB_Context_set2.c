@@ -8,6 +8,7 @@
 //------------------------------------------------------------------------------
 
 #include "GB_get_set.h"
+#include "GB_tuner.h"
 
 //------------------------------------------------------------------------------
 // GxB_Context_set_Scalar
@@ -43,6 +44,9 @@ GrB_Info GxB_Context_set_Scalar
 
         case GxB_CONTEXT_NTHREADS :         // same as GxB_NTHREADS
         case GxB_CONTEXT_GPU_ID :           // same as GxB_GPU_ID
+        case GxB_CONTEXT_NUMA_POLICY :      // same as GxB_NUMA_POLICY
+        case GxB_CONTEXT_TUNER :            // same as GxB_TUNER
+        case GxB_CONTEXT_DEFER :            // same as GxB_DEFER
             info = GrB_Scalar_extractElement_INT32 (&ivalue, value) ;
             break ;
 
@@ -78,6 +82,20 @@ GrB_Info GxB_Context_set_Scalar
 
             GB_Context_chunk_set (Context, dvalue) ;
             break ;
+
+        case GxB_CONTEXT_NUMA_POLICY :      // same as GxB_NUMA_POLICY
+
+            GB_Context_numa_policy_set (Context, ivalue) ;
+            break ;
+
+        case GxB_CONTEXT_DEFER :            // same as GxB_DEFER
+
+            GB_Context_defer_set (Context, ivalue != 0) ;
+            break ;
+
+        case GxB_CONTEXT_TUNER :            // same as GxB_TUNER
+
+            return (GB_Context_tuner_set (Context, ivalue != 0)) ;
     }
 
     return (GrB_SUCCESS) ;
@@ -104,6 +122,23 @@ GrB_Info GxB_Context_set_String
     GB_RETURN_IF_NULL (value) ;
     ASSERT_CONTEXT_OK (Context, "Context to get option", GB0) ;
 
+    if (field == GxB_CONTEXT_TUNER_PROFILE)
+    { 
+        // import a tuner profile, and enable the tuner if needed.  If the
+        // profile is invalid, the tuner is left as it was: unchanged if it
+        // was already enabled, or disabled if it was not.
+        bool enabled = (GB_Context_tuner_get (Context) != NULL) ;
+        GrB_Info info = GB_Context_tuner_set (Context, true) ;
+        if (info != GrB_SUCCESS) return (info) ;
+        info = GB_tuner_import (GB_Context_tuner_get (Context), value) ;
+        if (info != GrB_SUCCESS && !enabled)
+        { 
+            // disable the tuner that was enabled above
+            GB_Context_tuner_set (Context, false) ;
+        }
+        return (info) ;
+    }
+
     if (Context == GxB_CONTEXT_WORLD || field != GrB_NAME)
     { 
         // built-in GxB_CONTEXT_WORLD may not be modified
@@ -155,6 +190,20 @@ GrB_Info GxB_Context_set_INT
             GB_Context_gpu_id_set (Context, value) ;
             break ;
 
+        case GxB_CONTEXT_NUMA_POLICY :      // same as GxB_NUMA_POLICY
+
+            GB_Context_numa_policy_set (Context, value) ;
+            break ;
+
+        case GxB_CONTEXT_DEFER :            // same as GxB_DEFER
+
+            GB_Context_defer_set (Context, value != 0) ;
+            break ;
+
+        case GxB_CONTEXT_TUNER :            // same as GxB_TUNER
+
+            return (GB_Context_tuner_set (Context, value != 0)) ;
+
         default : 
             return (GrB_INVALID_VALUE) ;
     }
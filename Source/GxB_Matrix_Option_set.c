@@ -37,7 +37,7 @@ GrB_Info GxB_Matrix_Option_set_INT32    // set an option in a matrix
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
-    GB_WHERE (A, "GxB_Matrix_Option_set_INT32 (A, field, value)") ;
+    GB_WHERE_KEEP (A, "GxB_Matrix_Option_set_INT32 (A, field, value)") ;
     GB_BURBLE_START ("GxB_set") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
     ASSERT_MATRIX_OK (A, "A to set option", GB0) ;
@@ -66,7 +66,10 @@ GrB_Info GxB_Matrix_Option_set_INT32    // set an option in a matrix
             // conform the matrix to the new by-row/by-col format
             if (A->is_csc != new_csc)
             { 
-                // A = A', done in-place, and change to the new format.
+                // A = A', done in-place, and change to the new format.  If
+                // A->T_cache is enabled, A and A->T are swapped, and the
+                // prior A is kept as the new A->T.
+                GB_OK (GB_transpose_cache_build (A, Werk)) ;
                 GB_BURBLE_N (GB_nnz (A), "(transpose) ") ;
                 GB_OK (GB_transpose_in_place (A, new_csc, Werk)) ;
                 ASSERT (A->is_csc == new_csc) ;
@@ -107,7 +110,7 @@ GrB_Info GxB_Matrix_Option_set_FP64     // set an option in a matrix
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
-    GB_WHERE (A, "GxB_Matrix_Option_set_FP64 (A, field, value)") ;
+    GB_WHERE_KEEP (A, "GxB_Matrix_Option_set_FP64 (A, field, value)") ;
     GB_BURBLE_START ("GxB_set") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
     ASSERT_MATRIX_OK (A, "A to set option", GB0) ;
@@ -162,7 +165,7 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
-    GB_WHERE (A, "GxB_Matrix_Option_set (A, field, value)") ;
+    GB_WHERE_KEEP (A, "GxB_Matrix_Option_set (A, field, value)") ;
     GB_BURBLE_START ("GxB_set") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
     ASSERT_MATRIX_OK (A, "A to set option", GB0) ;
@@ -223,7 +226,9 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
                 // conform the matrix to the new by-row/by-col format
                 if (A->is_csc != new_csc)
                 { 
-                    // A = A', done in-place, and change to the new format.
+                    // A = A', done in-place, and change to the new format,
+                    // swapping A and A->T if A->T_cache is enabled.
+                    GB_OK (GB_transpose_cache_build (A, Werk)) ;
                     GB_BURBLE_N (GB_nnz (A), "(transpose) ") ;
                     GB_OK (GB_transpose_in_place (A, new_csc, Werk)) ;
                     ASSERT (A->is_csc == new_csc) ;
@@ -0,0 +1,50 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_attach: attach to a matrix written by GxB_Matrix_publish
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Creates a matrix C whose content is held in a file written by
+// GxB_Matrix_publish, which is mapped into memory but not copied.  The file is
+// never modified.  If C is later modified, it is first given its own copy of
+// its content and detached from the file.  The file can be removed or replaced
+// while C is attached to it.  The type must be given if the matrix in the file
+// has a user-defined type.
+
+#include "GB.h"
+#include "GB_shm.h"
+
+GrB_Info GxB_Matrix_attach      // attach to a shared-memory file
+(
+    // output:
+    GrB_Matrix *C,              // output matrix attached to the file
+    // input:
+    GrB_Type type,              // type of the matrix C, or NULL
+    const char *filename,       // file created by GxB_Matrix_publish
+    const GrB_Descriptor desc   // currently unused
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_attach (&C, type, filename, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_attach") ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_RETURN_IF_NULL (filename) ;
+    GB_RETURN_IF_FAULTY (type) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // attach to the file
+    //--------------------------------------------------------------------------
+
+    info = GB_shm_attach (C, type, filename, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_delta: construct a matrix from a chain of blobs
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The blobs [0:nblobs-1] are a chain of checkpoints created by
+// GxB_Matrix_serialize_delta: blobs [0] holds the whole matrix (it was
+// created with no prior blob), and each blobs [k] was created with
+// blobs [k-1] as its prior blob.  The matrix C is constructed as it was when
+// the last blob was created.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize_delta   // deserialize a chain of blobs
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blobs
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blobs hold a
+                        // matrix of user-defined type.  May be NULL if the
+                        // blobs hold a built-in type; otherwise must match the
+                        // type of C.
+    const void **blobs,             // blobs [0:nblobs-1]
+    const GrB_Index *blob_sizes,    // blob_sizes [0:nblobs-1]
+    GrB_Index nblobs,               // # of blobs in the chain
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize_delta (&C, type, blobs, blob_sizes, "
+        "nblobs, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_delta") ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_RETURN_IF_NULL (blobs) ;
+    GB_RETURN_IF_NULL (blob_sizes) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    if (nblobs == 0 || nblobs > GB_NMAX)
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "Invalid number of blobs: " GBu,
+            nblobs) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // deserialize the chain of blobs into a matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize_delta (C, type, (const GB_void **) blobs,
+        blob_sizes, (int64_t) nblobs) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
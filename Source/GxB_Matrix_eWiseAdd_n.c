@@ -0,0 +1,62 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_eWiseAdd_n: sum k matrices with a monoid
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M> = accum (C, A[0]+A[1]+...+A[k-1]), with the same result as k-1 calls to
+// GrB_Matrix_eWiseAdd_Monoid, but computed in a balanced binary tree of
+// additions.  See GB_add_n for details.
+
+// The input matrices A[0:k-1] are optionally transposed, as determined by the
+// GrB_INP0 setting of the Descriptor desc.
+
+#include "GB_add.h"
+#include "GB_get_mask.h"
+
+GrB_Info GxB_Matrix_eWiseAdd_n      // C<M> = accum (C, A[0]+...+A[k-1])
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Monoid monoid,        // defines '+' for T=A[0]+...+A[k-1]
+    const GrB_Matrix *A,            // array of k input matrices
+    GrB_Index k,                    // number of input matrices
+    const GrB_Descriptor desc       // descriptor for C, M, and A[0:k-1]
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_Matrix_eWiseAdd_n (C, M, accum, monoid, A, k, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_eWiseAdd_n") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_FAULTY (Mask) ;
+    if (k > GB_NMAX)
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "Number of input matrices k = " GBu
+            " is too large", k) ;
+    }
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, xx1, xx2, xx3) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (Mask, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C,A[0]+...+A[k-1]) and variations
+    //--------------------------------------------------------------------------
+
+    info = GB_add_n (C, C_replace, M, Mask_comp, Mask_struct, accum, monoid,
+        A, A_transpose, (int64_t) k, Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
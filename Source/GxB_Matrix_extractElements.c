@@ -0,0 +1,89 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_extractElements: extract a batch of entries from a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Extracts n entries from a matrix: X [k] = A (I [k], J [k]) for each k in the
+// range 0 to n-1, typecasting from the type of A to the type of X, as needed.
+// If A(I[k],J[k]) is present, found [k] is set true and X [k] is set to its
+// value.  Otherwise, found [k] is set false and X [k] is not modified.  Either
+// X or found may be NULL, in which case that output is not computed.
+
+// GxB_Matrix_isStoredElements is the same, except that only found is computed.
+
+// The result is the same as n calls to GrB_Matrix_extractElement, but the
+// checks and any pending work are done once for all n entries, and the entries
+// are found in parallel.  If any index is out of bounds, GrB_INVALID_INDEX is
+// returned and the contents of X and found are undefined.
+
+#include "GB.h"
+#include "GB_extractTuples.h"
+
+#define GB_EXTRACT(type,T)                                                    \
+GrB_Info GB_EVAL2 (GxB_Matrix_extractElements_, T)  /* X(k)=A(I(k),J(k)) */   \
+(                                                                             \
+    type *X,                /* values of the entries found, or NULL      */   \
+    bool *found,            /* found [k] true if A(I(k),J(k)) present    */   \
+    const GrB_Matrix A,     /* matrix to extract the entries from        */   \
+    const GrB_Index *I,     /* row indices of the entries to extract     */   \
+    const GrB_Index *J,     /* column indices of the entries to extract  */   \
+    GrB_Index n             /* size of I, J, X, and found                */   \
+)                                                                             \
+{                                                                             \
+    GB_WHERE1 ("GxB_Matrix_extractElements_" GB_STR(T)                        \
+        " (X, found, A, I, J, n)") ;                                          \
+    GB_BURBLE_START ("GxB_Matrix_extractElements") ;                          \
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;                                         \
+    GB_RETURN_IF_NULL (I) ;                                                   \
+    GB_RETURN_IF_NULL (J) ;                                                   \
+    GrB_Info info = GB_extractElements (X, found, GB_ ## T ## _code, A,       \
+        I, J, n, Werk) ;                                                      \
+    GB_BURBLE_END ;                                                           \
+    GB_PRAGMA (omp flush)                                                     \
+    return (info) ;                                                           \
+}
+
+GB_EXTRACT (bool      , BOOL   )
+GB_EXTRACT (int8_t    , INT8   )
+GB_EXTRACT (uint8_t   , UINT8  )
+GB_EXTRACT (int16_t   , INT16  )
+GB_EXTRACT (uint16_t  , UINT16 )
+GB_EXTRACT (int32_t   , INT32  )
+GB_EXTRACT (uint32_t  , UINT32 )
+GB_EXTRACT (int64_t   , INT64  )
+GB_EXTRACT (uint64_t  , UINT64 )
+GB_EXTRACT (float     , FP32   )
+GB_EXTRACT (double    , FP64   )
+GB_EXTRACT (GxB_FC32_t, FC32   )
+GB_EXTRACT (GxB_FC64_t, FC64   )
+GB_EXTRACT (void      , UDT    )
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_isStoredElements: check if a batch of entries is present
+//------------------------------------------------------------------------------
+
+GrB_Info GxB_Matrix_isStoredElements    // found(k) true if A(I(k),J(k)) present
+(
+    bool *found,                // found [k] true if A(I(k),J(k)) present
+    const GrB_Matrix A,         // matrix to check
+    const GrB_Index *I,         // row indices of the entries to check
+    const GrB_Index *J,         // column indices of the entries to check
+    GrB_Index n                 // size of I, J, and found
+)
+{
+    GB_WHERE1 ("GxB_Matrix_isStoredElements (found, A, I, J, n)") ;
+    GB_BURBLE_START ("GxB_Matrix_isStoredElements") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL (found) ;
+    GB_RETURN_IF_NULL (I) ;
+    GB_RETURN_IF_NULL (J) ;
+    GrB_Info info = GB_extractElements (NULL, found, A->type->code, A, I, J,
+        n, Werk) ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_publish: write a matrix to a shared-memory file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Writes a matrix A to a file, so that other processes on the same host can
+// attach to it with GxB_Matrix_attach, without copying its content.  The file
+// is typically in /dev/shm, so that it is held in memory.  Any pending work on
+// A is finished first.  Example usage:
+
+/*
+    // in the process that creates the matrix:
+    GxB_Matrix_publish ("/dev/shm/graph", A, NULL) ;
+
+    // in each worker process:
+    GrB_Matrix G ;
+    GxB_Matrix_attach (&G, NULL, "/dev/shm/graph", NULL) ;
+    // ... use G, then free it:
+    GrB_free (&G) ;
+*/
+
+#include "GB.h"
+#include "GB_shm.h"
+
+GrB_Info GxB_Matrix_publish     // write a matrix to a shared-memory file
+(
+    const char *filename,       // file to create, or replace
+    GrB_Matrix A,               // matrix to publish
+    const GrB_Descriptor desc   // currently unused
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE_KEEP (A, "GxB_Matrix_publish (filename, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_publish") ;
+    GB_RETURN_IF_NULL (filename) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // write the matrix to the file
+    //--------------------------------------------------------------------------
+
+    info = GB_shm_publish (filename, A, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,191 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_removeElements: remove a batch of entries from a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Removes the entries C(I[k],J[k]) for k = 0 to n-1, if present.  The result
+// is the same as n calls to GrB_Matrix_removeElement.  The indices may appear
+// in any order, and may contain duplicates.
+
+// If C has pending tuples, they are assembled first, once for the whole batch.
+// The entries are then found in parallel, and each entry found becomes a
+// zombie (if C is sparse or hypersparse) or is cleared from the bitmap (if C
+// is bitmap).  If the same entry appears more than once in the batch, an
+// atomic compare-and-exchange ensures it is removed just once.  If C is full,
+// it is first converted to sparse, as in GrB_Matrix_removeElement.
+
+#include "GB.h"
+#include "GB_Element.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORK (&P, P_size) ;             \
+}
+
+GrB_Info GxB_Matrix_removeElements  // remove C(I(k),J(k)) for k = 0:n-1
+(
+    GrB_Matrix C,               // matrix to remove entries from
+    const GrB_Index *I,         // row indices of the entries to remove
+    const GrB_Index *J,         // column indices of the entries to remove
+    GrB_Index n                 // size of I and J
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_WHERE (C, "GxB_Matrix_removeElements (C, I, J, n)") ;
+    GB_BURBLE_START ("GxB_Matrix_removeElements") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_NULL (I) ;
+    GB_RETURN_IF_NULL (J) ;
+    int64_t *restrict P = NULL ; size_t P_size = 0 ;
+
+    if (n == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    const GrB_Index nrows = GB_NROWS (C) ;
+    const GrB_Index ncols = GB_NCOLS (C) ;
+    bool ok = true ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:ok)
+    for (k = 0 ; k < (int64_t) n ; k++)
+    {
+        ok = ok && (I [k] < nrows) && (J [k] < ncols) ;
+    }
+    if (!ok)
+    {
+        GB_ERROR (GrB_INVALID_INDEX, "Row or column index out of range; "
+            "must be < " GBd " and < " GBd " respectively", nrows, ncols) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // convert C to non-full, and finish any pending tuples
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_FULL (C))
+    {
+        // convert C from full to sparse
+        GB_OK (GB_convert_to_nonfull (C, Werk)) ;
+    }
+    else if (C->jumbled || GB_PENDING (C))
+    {
+        // assemble the pending tuples, since they may hold entries to remove
+        GB_OK (GB_wait (C, "C (removeElements)", Werk)) ;
+    }
+
+    ASSERT (!GB_IS_FULL (C)) ;
+    ASSERT (!GB_JUMBLED (C)) ;
+    ASSERT (!GB_PENDING (C)) ;
+    ASSERT (GB_ZOMBIES_OK (C)) ;
+
+    if (GB_nnz (C) == 0)
+    {
+        // quick return
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the entries to remove
+    //--------------------------------------------------------------------------
+
+    P = GB_MALLOC_WORK (n, int64_t, &P_size) ;
+    if (P == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    GB_OK (GB_hyper_hash_build (C, Werk)) ;
+    const int64_t *restrict Ilist = (const int64_t *) (C->is_csc ? I : J) ;
+    const int64_t *restrict Jlist = (const int64_t *) (C->is_csc ? J : I) ;
+    GB_find_elements (P, C, Ilist, Jlist, n, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // remove the entries found
+    //--------------------------------------------------------------------------
+
+    int64_t nremoved = 0 ;
+    if (GB_IS_BITMAP (C))
+    {
+
+        //----------------------------------------------------------------------
+        // C is bitmap: clear each entry from the bitmap
+        //----------------------------------------------------------------------
+
+        int8_t *restrict Cb = C->b ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:nremoved)
+        for (k = 0 ; k < (int64_t) n ; k++)
+        {
+            int64_t p = P [k] ;
+            while (true)
+            {
+                int8_t cb, zero = 0 ;
+                GB_ATOMIC_READ
+                cb = Cb [p] ;
+                if (cb == 0) break ;
+                if (GB_ATOMIC_COMPARE_EXCHANGE_8 (&(Cb [p]), cb, zero))
+                {
+                    nremoved++ ;
+                    break ;
+                }
+            }
+        }
+        C->nvals -= nremoved ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // C is sparse or hypersparse: each live entry becomes a zombie
+        //----------------------------------------------------------------------
+
+        int64_t *restrict Ci = C->i ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:nremoved)
+        for (k = 0 ; k < (int64_t) n ; k++)
+        {
+            int64_t p = P [k] ;
+            if (p < 0) continue ;
+            while (true)
+            {
+                int64_t ci ;
+                GB_ATOMIC_READ
+                ci = Ci [p] ;
+                if (GB_IS_ZOMBIE (ci)) break ;
+                int64_t zombie = GB_FLIP (ci) ;
+                if (GB_ATOMIC_COMPARE_EXCHANGE_64 (&(Ci [p]), ci, zombie))
+                {
+                    nremoved++ ;
+                    break ;
+                }
+            }
+        }
+        C->nzombies += nremoved ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    GB_BURBLE_END ;
+    ASSERT_MATRIX_OK (C, "C after removeElements", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,78 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_serialize_delta: serialize the changes to a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Creates an incremental checkpoint of a matrix A.  If prior_blob is NULL,
+// all of A is serialized into the blob, which can be used as the base of a
+// chain of checkpoints.  Otherwise, prior_blob must be the last blob in the
+// chain (created by GxB_Matrix_serialize_delta), and the new blob holds only
+// the chunks of A that have changed since the prior blob was created.  Only
+// the header and manifest of the prior blob are accessed, not its compressed
+// chunks.  The chain is deserialized by GxB_Matrix_deserialize_delta.
+// Example usage:
+
+/*
+    void *blob [3] ;
+    GrB_Index blob_size [3] ;
+    GxB_Matrix_serialize_delta (&blob [0], &blob_size [0], A, NULL, 0, NULL) ;
+    // ... modify A
+    GxB_Matrix_serialize_delta (&blob [1], &blob_size [1], A,
+        blob [0], blob_size [0], NULL) ;
+    // ... modify A
+    GxB_Matrix_serialize_delta (&blob [2], &blob_size [2], A,
+        blob [1], blob_size [1], NULL) ;
+    // C = A
+    GxB_Matrix_deserialize_delta (&C, atype, (const void **) blob, blob_size,
+        3, NULL) ;
+*/
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_serialize_delta // serialize the changes to a matrix
+(
+    // output:
+    void **blob_handle,             // the blob, allocated on output
+    GrB_Index *blob_size_handle,    // size of the blob on output
+    // input:
+    GrB_Matrix A,                   // matrix to serialize
+    const void *prior_blob,         // prior blob in the chain, or NULL
+    GrB_Index prior_blob_size,      // size of the prior blob
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_serialize_delta (&blob, &blob_size, A, "
+        "prior_blob, prior_blob_size, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_serialize_delta") ;
+    GB_RETURN_IF_NULL (blob_handle) ;
+    GB_RETURN_IF_NULL (blob_size_handle) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    // get the compression method from the descriptor
+    int method = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+
+    //--------------------------------------------------------------------------
+    // serialize the matrix
+    //--------------------------------------------------------------------------
+
+    (*blob_handle) = NULL ;
+    size_t blob_size = 0 ;
+    info = GB_serialize_delta ((GB_void **) blob_handle, &blob_size, A,
+        (const GB_void *) prior_blob, (size_t) prior_blob_size, method, Werk) ;
+    (*blob_size_handle) = (GrB_Index) blob_size ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
@@ -0,0 +1,61 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_setElements: set a batch of entries in a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Sets n entries in a matrix: C (I [k], J [k]) = X [k] for each k in the range
+// 0 to n-1, typecasting from the type of X to the type of C, as needed.  If
+// dup is not NULL, C (I [k], J [k]) = dup (C (I [k], J [k]), X [k]) is done
+// instead for entries already present in C, and for duplicate tuples.
+
+// The result is the same as n calls to GrB_Matrix_setElement (if dup is NULL)
+// or to GrB_Matrix_assign_TYPE with an accum operator (otherwise), but the
+// checks are done once for all n entries, and the entries are found in
+// parallel.  Entries not already in C are appended to its pending tuples.
+
+#define GB_FREE_ALL ;
+#include "GB.h"
+#include "GB_Element.h"
+
+#define GB_SET(type,T)                                                        \
+GrB_Info GB_EVAL2 (GxB_Matrix_setElements_, T)  /* C(I(k),J(k)) = X(k) */     \
+(                                                                             \
+    GrB_Matrix C,           /* matrix to modify                          */   \
+    const GrB_Index *I,     /* row indices of the tuples                 */   \
+    const GrB_Index *J,     /* column indices of the tuples              */   \
+    const type *X,          /* values of the tuples                      */   \
+    GrB_Index n,            /* size of I, J, and X                       */   \
+    const GrB_BinaryOp dup  /* if NULL: C(i,j) = x, else C(i,j) += x     */   \
+)                                                                             \
+{                                                                             \
+    GB_WHERE (C, "GxB_Matrix_setElements_" GB_STR(T)                          \
+        " (C, I, J, X, n, dup)") ;                                            \
+    GB_BURBLE_START ("GxB_Matrix_setElements") ;                              \
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;                                         \
+    GB_RETURN_IF_NULL (I) ;                                                   \
+    GB_RETURN_IF_NULL (J) ;                                                   \
+    GB_RETURN_IF_NULL (X) ;                                                   \
+    GrB_Info info = GB_setElements (C, I, J, X, n, dup, GB_ ## T ## _code,    \
+        Werk) ;                                                               \
+    GB_BURBLE_END ;                                                           \
+    return (info) ;                                                           \
+}
+
+GB_SET (bool      , BOOL   )
+GB_SET (int8_t    , INT8   )
+GB_SET (uint8_t   , UINT8  )
+GB_SET (int16_t   , INT16  )
+GB_SET (uint16_t  , UINT16 )
+GB_SET (int32_t   , INT32  )
+GB_SET (uint32_t  , UINT32 )
+GB_SET (int64_t   , INT64  )
+GB_SET (uint64_t  , UINT64 )
+GB_SET (float     , FP32   )
+GB_SET (double    , FP64   )
+GB_SET (GxB_FC32_t, FC32   )
+GB_SET (GxB_FC64_t, FC64   )
+GB_SET (void      , UDT    )
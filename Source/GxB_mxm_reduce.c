@@ -0,0 +1,112 @@
+//------------------------------------------------------------------------------
+// GxB_mxm_reduce: reduce a matrix-matrix product to a vector or scalar
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// w<M> = accum (w, reduce (A*B)) and s = accum (s, reduce (A*B)), where
+// reduce(A*B) reduces each row of A*B to a scalar with the monoid (for
+// GxB_mxm_reduce), or all of A*B to a single scalar (GxB_mxm_reduce_Scalar).
+// The result is the same as T = A*B followed by GrB_reduce (w, M, accum,
+// monoid, T, desc), but the product T is never held in memory all at once.
+
+// The input matrices A and B are optionally transposed, as determined by the
+// Descriptor desc.  To reduce each column of A*B instead, use B'*A' (with a
+// semiring whose multiply operator has its inputs flipped, if it is not
+// commutative).
+
+#include "GB_reduce.h"
+#include "GB_get_mask.h"
+
+//------------------------------------------------------------------------------
+// GxB_mxm_reduce: w<M> = accum (w, reduce (A*B))
+//------------------------------------------------------------------------------
+
+GrB_Info GxB_mxm_reduce             // w<M> = accum (w, reduce (A*B))
+(
+    GrB_Vector w,                   // input/output vector for results
+    const GrB_Vector M_in,          // optional mask for w, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Monoid monoid,        // reduce monoid for t=reduce(A*B)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for w, M, A, and B
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (w, "GxB_mxm_reduce (w, M, accum, monoid, semiring, A, B, desc)") ;
+    GB_BURBLE_START ("GxB_mxm_reduce") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (w) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, B_transpose, AxB_method, do_sort) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask ((GrB_Matrix) M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // w<M> = accum (w, reduce (A*B))
+    //--------------------------------------------------------------------------
+
+    info = GB_mxm_reduce ((GrB_Matrix) w, false, C_replace, M, Mask_comp,
+        Mask_struct, accum, monoid, semiring, A, A_transpose, B, B_transpose,
+        AxB_method, do_sort, Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GxB_mxm_reduce_Scalar: s = accum (s, reduce (A*B))
+//------------------------------------------------------------------------------
+
+GrB_Info GxB_mxm_reduce_Scalar      // s = accum (s, reduce (A*B))
+(
+    GrB_Scalar s,                   // input/output scalar for results
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Monoid monoid,        // reduce monoid for t=reduce(A*B)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for A and B
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (s, "GxB_mxm_reduce_Scalar (s, accum, monoid, semiring, A, B, "
+        "desc)") ;
+    GB_BURBLE_START ("GxB_mxm_reduce_Scalar") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (s) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, A_transpose, B_transpose,
+        AxB_method, do_sort) ;
+
+    //--------------------------------------------------------------------------
+    // s = accum (s, reduce (A*B))
+    //--------------------------------------------------------------------------
+
+    info = GB_mxm_reduce ((GrB_Matrix) s, true, false, NULL, false, false,
+        accum, monoid, semiring, A, A_transpose, B, B_transpose, AxB_method,
+        do_sort, Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
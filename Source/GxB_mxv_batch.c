@@ -0,0 +1,87 @@
+//------------------------------------------------------------------------------
+// GxB_mxv_batch: multiply a matrix by many vectors
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// W[j] = accum (W[j], A*U[j]) for j = 0 to k-1, with the same result as k
+// calls to GrB_mxv (W[j], NULL, accum, semiring, A, U[j], desc), but with A
+// traversed just once for all k vectors.  See GB_mxv_batch for details.
+
+// The input matrix A is optionally transposed, as determined by the
+// Descriptor desc.  No mask can be used.
+
+// Each output vector W[j] is prepared as GB_WHERE does for a single output:
+// any prior error logged in W[j] is cleared, and W[j] is unshared from any
+// shared-memory segment it is attached to.  An error found in a given W[j] or
+// U[j] is logged in W[j]; other errors are logged in W[0].
+
+#include "GB_mxm.h"
+
+GrB_Info GxB_mxv_batch              // W[j] = accum (W[j], A*U[j]) for all j
+(
+    GrB_Vector *W,                  // array of k input/output vectors
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*U[j]
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Vector *U,            // second input: array of k vectors
+    GrB_Index k,                    // number of vectors in W and U
+    const GrB_Descriptor desc       // descriptor for W and A
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_mxv_batch (W, accum, semiring, A, U, k, desc)") ;
+    GB_BURBLE_START ("GxB_mxv_batch") ;
+    GB_RETURN_IF_NULL (W) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    if (k > GB_NMAX)
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "Number of vectors k = " GBu
+            " is too large", k) ;
+    }
+
+    for (int64_t j = 0 ; j < (int64_t) k ; j++)
+    {
+        GrB_Vector w = W [j] ;
+        GB_RETURN_IF_NULL_OR_FAULTY (w) ;
+        // free any prior error logged in W[j]
+        GB_FREE (&(w->logger), w->logger_size) ;
+        // W[j] is modified, so free its cached transpose, if any, and unshare
+        // it if it is attached to a shared-memory segment
+        GB_transpose_cache_free ((GrB_Matrix) w) ;
+        if (w->shm != NULL)
+        { 
+            GrB_Info shm_info = GB_shm_unshare ((GrB_Matrix) w) ;
+            if (shm_info != GrB_SUCCESS) return (shm_info) ;
+        }
+    }
+
+    if (k > 0)
+    { 
+        // log any error in W[0], unless it is specific to another W[j]
+        Werk->logger_handle = &(W [0]->logger) ;
+        Werk->logger_size_handle = &(W [0]->logger_size) ;
+    }
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, xx1, xx2, A_transpose, xx3,
+        AxB_method, do_sort) ;
+
+    //--------------------------------------------------------------------------
+    // W[j] = accum (W[j], A*U[j]) for all j, using the mxm kernel
+    //--------------------------------------------------------------------------
+
+    info = GB_mxv_batch (W, C_replace, accum, semiring, A, A_transpose, U,
+        (int64_t) k, AxB_method, do_sort, Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -37,13 +37,13 @@
 // owned by the user application and freeing it is the responsibility of the
 // user application.
 
-// Basic checks are perfomed on Y: Y must have the right dimensions:  if A is
-// HyperCSR and m-by-n with nvec vectors present in Ah, then Y must be n-by-v
-// where v is a power of 2; if A is HyperCSR and m-by-n, then Y must be m-by-v.
-// nvals(Y) must equal nvec.  Y must be sparse, held by column, and have type
-// int64.  It cannot have any pending work.  It cannot have a hyper_hash
-// of its own.  If any of these conditions hold, GrB_INVALID is returned and
-// A and Y are unchanged.
+// Basic checks are perfomed on Y: Y must have the right dimensions:  if A has
+// nvec vectors present in Ah, then Y must be 16-by-v, where v is a power of 2
+// and 8*v > nvec.  Y must be full, held by column, not iso, and have type
+// uint64.  It cannot have any pending work.  It cannot have a hyper_hash
+// of its own.  If any of these conditions do not hold, GrB_INVALID_OBJECT is
+// returned and A and Y are unchanged.  In particular, a Y matrix in the sparse
+// format of SuiteSparse:GraphBLAS v9.0 and earlier is not accepted.
 
 // If Y is moved into A as its hyper_hash, then the caller's Y is set to NULL
 // to indicate that it has been moved into A.  It is no longer owned by the
@@ -90,9 +90,10 @@ GrB_Info GxB_pack_HyperHash         // move Y into A->Y
     // basic error checks
     //--------------------------------------------------------------------------
 
-    if ((*Y)->vlen != A->vdim || !GB_IS_POWER_OF_TWO ((*Y)->vdim) ||
-        (*Y)->nvals != A->nvec || !GB_IS_SPARSE (*Y) || (*Y)->Y != NULL ||
-        (*Y)->type != GrB_UINT64 || !(*Y)->is_csc || GB_ANY_PENDING_WORK (*Y))
+    if ((*Y)->vlen != 2*GB_HYPER_HASH_GROUP || !GB_IS_POWER_OF_TWO ((*Y)->vdim)
+        || (*Y)->vdim * GB_HYPER_HASH_GROUP <= A->nvec || !GB_IS_FULL (*Y)
+        || (*Y)->iso || (*Y)->Y != NULL || (*Y)->type != GrB_UINT64
+        || !(*Y)->is_csc || GB_ANY_PENDING_WORK (*Y))
     { 
         // Y is invalid
         return (GrB_INVALID_OBJECT) ;
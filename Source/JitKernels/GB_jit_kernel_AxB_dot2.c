@@ -12,6 +12,14 @@
 GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_DOT2_PROTO (GB_jit_kernel) ;
 GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_DOT2_PROTO (GB_jit_kernel)
 {
+    #ifdef GB_JIT_RUNTIME
+    // get callback functions
+    GB_intersect_count_f GB_intersect_count =
+        my_callback->GB_intersect_count_func ;
+    GB_intersect_chunk_f GB_intersect_chunk =
+        my_callback->GB_intersect_chunk_func ;
+    #endif
+
     #include "GB_AxB_dot2_meta.c"
     return (GrB_SUCCESS) ;
 }
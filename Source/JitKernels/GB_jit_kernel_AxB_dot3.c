@@ -12,6 +12,16 @@
 GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_DOT3_PROTO (GB_jit_kernel) ;
 GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_DOT3_PROTO (GB_jit_kernel)
 {
+    #ifdef GB_JIT_RUNTIME
+    // get callback functions
+    GB_free_memory_f GB_free_memory = my_callback->GB_free_memory_func ;
+    GB_malloc_memory_f GB_malloc_memory = my_callback->GB_malloc_memory_func ;
+    GB_intersect_count_f GB_intersect_count =
+        my_callback->GB_intersect_count_func ;
+    GB_intersect_chunk_f GB_intersect_chunk =
+        my_callback->GB_intersect_chunk_func ;
+    #endif
+
     #include "GB_AxB_dot3_meta.c"
     return (GrB_SUCCESS) ;
 }
@@ -42,6 +42,11 @@
 #define GB_COPY_B_to_C(Cx,pC,Bx,pB,B_iso) Cx [pC] = Bx [(B_iso) ? 0 : (pB)]
 #endif
 
+// 1 if C<M> += T is computed in place, with the binary op as the accum
+#ifndef GB_C_IN_PLACE
+#define GB_C_IN_PLACE 0
+#endif
+
 // 1 if C and A have the same type
 #ifndef GB_CTYPE_IS_ATYPE
 #define GB_CTYPE_IS_ATYPE 1
@@ -19,9 +19,13 @@
 // which is always a power of 2.  The function is (i*257) & (hash_bits).
 #define GB_HASHF(i,hash_bits) ((((i) << 8) + (i)) & (hash_bits))
 
-// hash function for the A->Y hyperhash:
-// lots of intentional collisions: but blocks are scattered
-#define GB_HASHF2(i,hash_bits) ((((i) >> 2) + 17L*((i) >> 8)) & (hash_bits))
+// hash function for the A->Y hyperhash, which returns the first group of the
+// open-addressing table to probe.  A multiplicative (Fibonacci) hash is used,
+// so that runs of consecutive indices i are scattered across the groups.  The
+// table has at most 2^32 groups that can be the first one probed.
+#define GB_HASHF2(i,hash_bits)                                              \
+    (((int64_t) ((((uint64_t) (i)) * 0x9E3779B97F4A7C15ULL) >> 32))         \
+        & (hash_bits))
 
 // rehash function, for subsequent hash lookups if the initial hash function
 // refers to a hash entry that is already occupied.  Linear probing is used,
@@ -13,6 +13,16 @@
 // Let j = Ah [k]
 // k = A->Y (j, hash(j)), if present, or k=-1 if not found.
 
+// The A->Y hyper_hash is an open-addressing hash table, held as the values of
+// a full matrix Y of size 2*GB_HYPER_HASH_GROUP by (# of groups).  Each column
+// of Y is one group: the first GB_HYPER_HASH_GROUP entries of the group are
+// keys j (or GB_HYPER_HASH_EMPTY if the slot is empty), and the next
+// GB_HYPER_HASH_GROUP entries are the corresponding values k.  See
+// GB_matrix.h for details.
+
+#define GB_HYPER_HASH_GROUP 8
+#define GB_HYPER_HASH_EMPTY (-1)
+
 GB_STATIC_INLINE int64_t GB_hyper_hash_lookup  // k if j==Ah[k]; -1 if not found
 (
     // new inputs, not modified
@@ -20,10 +30,8 @@ GB_STATIC_INLINE int64_t GB_hyper_hash_lookup  // k if j==Ah[k]; -1 if not found
     const int64_t anvec,
     // input, not modified
     const int64_t *restrict Ap,     // A->p [0..A->nvec]: pointers to vectors
-    const int64_t *restrict Yp,     // A->Y->p
-    const int64_t *restrict Yi,     // A->Y->i
     const int64_t *restrict Yx,     // A->Y->x
-    const int64_t hash_bits,        // A->Y->vdim-1, which is hash table size-1
+    const int64_t hash_bits,        // A->Y->vdim-1, which is # of groups - 1
     const int64_t j,                // find j in Ah [0..anvec-1], using A->Y
     // output
     int64_t *restrict pstart,       // start of vector: Ap [k]
@@ -34,7 +42,7 @@ GB_STATIC_INLINE int64_t GB_hyper_hash_lookup  // k if j==Ah[k]; -1 if not found
     bool found = false ;
     int64_t k ;
 
-    if (Yp == NULL)
+    if (Yx == NULL)
     { 
 
         //----------------------------------------------------------------------
@@ -54,43 +62,32 @@ GB_STATIC_INLINE int64_t GB_hyper_hash_lookup  // k if j==Ah[k]; -1 if not found
         // using the hyper_hash
         //----------------------------------------------------------------------
 
-        // determine the hash bucket that would contain vector j
-        const int64_t jhash = GB_HASHF2 (j, hash_bits) ;
-
-        //----------------------------------------------------------------------
-        // search for j in the jhash bucket: Yi [Yp [jhash] ... Yp [jhash+1]-1]
-        //----------------------------------------------------------------------
+        // Probe the groups of the table in order, starting at the group given
+        // by the hash of j.  The search stops at the group that holds j, or
+        // at the first group with an empty slot.  The table always has at
+        // least one empty slot, so the search terminates.
 
-        const int64_t ypstart = Yp [jhash] ;
-        const int64_t ypend = Yp [jhash+1] ;
-        k = -1 ;
-        if ((ypend - ypstart) > 256)
-        {
-            // The hash bucket jhash has over 256 entries, which is a very high
-            // number of collisions.  The load factor of the hash table ranges
-            // from 2 to 4.  Do a binary search as a fallback.
-            int64_t p = ypstart ;
-            int64_t pright = ypend - 1 ;
-            GB_BINARY_SEARCH (j, Yi, p, pright, found) ;
-            if (found)
-            { 
-                k = Yx [p] ;
-            }
-        }
-        else
+        int64_t g = GB_HASHF2 (j, hash_bits) ;
+        int64_t kfound = 0 ;
+        while (true)
         {
-            // Linear-time search for j in the jhash bucket.
-            for (int64_t p = ypstart ; p < ypend ; p++)
+            const int64_t *restrict Ykey = Yx + g * (2*GB_HYPER_HASH_GROUP) ;
+            const int64_t *restrict Yval = Ykey + GB_HYPER_HASH_GROUP ;
+            // Compare j with all the keys in the group.  Each key appears at
+            // most once in the table, so kfound is 1+k if j is found in the
+            // group, or zero otherwise.  This loop has no early exit, so it
+            // can be vectorized by the compiler.
+            int nempty = 0 ;
+            for (int t = 0 ; t < GB_HYPER_HASH_GROUP ; t++)
             {
-                if (j == Yi [p])
-                { 
-                    // found: j = Ah [k] where k is given by k = Yx [p]
-                    k = Yx [p] ;
-                    break ;
-                }
+                kfound += (Ykey [t] == j) ? (Yval [t] + 1) : 0 ;
+                nempty += (Ykey [t] == GB_HYPER_HASH_EMPTY) ;
             }
-            found = (k >= 0) ;
+            if (kfound > 0 || nempty > 0) break ;
+            g = (g + 1) & hash_bits ;
         }
+        k = kfound - 1 ;
+        found = (k >= 0) ;
     }
 
     //--------------------------------------------------------------------------
@@ -244,63 +244,62 @@ size_t x_size ;         // exact size of A->x in bytes, zero if A->x is NULL
     binary search.
 
         anvec = A->nvec
-        avdim = A->vdim
         Ah = A->h
-        nhash is the size of the hash table Y, which is always a power of 2.
-            Its size is determined by GB_hyper_hash_build.
-
-    Then A->Y has dimension Y->vdim = nhash (one vector in Y for each hash
-    bucket), and Y->vlen = avdim.  If Y is considered as held in column-format,
-    then Y is avlen-by-nhash.  The row/col format of Y is not important.  Each
-    of its vectors (nhash of them) corresponds to a single hash bucket, and
-    each hash bucket can hold up to avdim entries (assuming worst-case
-    collisions where all entries j land in the same hash bucket).  Y is always
-    in sparse format; never full, bitmap, or hypersparse.  Its type is always
-    GrB_INT64, and it is never iso-valued.  The # of entries in Y is exactly
-    anvec.
-
-    Let f(j) = GB_HASHF2(j,nhash-1) be the hash function for the value j.  Its
-    value is in the range 0 to nhash-1, where nhash is always a power of 2.
-
-    If j = Ah [k], then k = Y (j,f (j)).
-    If j is not in the Ah hyperlist, then Y (j,f(j)) does not appear
-    as an entry in Y.
-
-    Ideally, if the hash function had no collisions, each vector in Y would
-    have length 0 or 1, and k = Y (j,f(j)) would be O(1) time lookup.
-    However, the load factor is normally in the range of 2 to 4, so ideally
-    each bucket will contain about 4 entries on average, if the load factor
-    is 4.
+        ngroups is the # of groups in the hash table Y, which is always a
+            power of 2.  Its size is determined by GB_hyper_hash_build.
+
+    Y is an open-addressing hash table, with groups of GB_HYPER_HASH_GROUP (8)
+    slots.  A->Y has dimension Y->vdim = ngroups (one vector in Y for each
+    group), and Y->vlen = 2*GB_HYPER_HASH_GROUP.  Y is always full and held
+    by column; never sparse, hypersparse, or bitmap.  Its type is always
+    GrB_UINT64, and it is never iso-valued.  Each group g is held in
+    Yx [g*16 ... g*16+15], where Yx = A->Y->x.  The first 8 entries of the
+    group are keys (a vector index j, or GB_HYPER_HASH_EMPTY if the slot is
+    empty), and the next 8 entries are the corresponding values k.
+
+    Let f(j) = GB_HASHF2(j,ngroups-1) be the hash function for the value j.
+    Its value is in the range 0 to ngroups-1.  If j = Ah [k], then the key j
+    and value k appear in the first group that had an empty slot when j was
+    inserted, found by probing the groups f(j), f(j)+1, ... (modulo ngroups)
+    in order.  The load factor of the table is at most 3/4, so there is
+    always at least one empty slot.  The search for j can thus stop at the
+    first group that holds j, or at the first group with an empty slot if j
+    is not in the Ah hyperlist.  The 8 keys of a group are compared with j
+    all at once, which the compiler can vectorize.  Normally only one group
+    needs to be searched, which takes one or two cache misses.
 
     A->Y is only computed when required, or if GrB_Matrix_wait (Y) is
     explicitly called.  Once computed, k can be found as follows:
 
         // This can be done once, and reused for many searches:
-        int64_t nhash = A->Y->vdim ;    // # of buckets in the hash table
-        int64_t hash_bits = nhash-1 ;
-        int64_t *Yp = A->Y->p ;         // pointers to each hash bucket
-                                        // Yp has size nhash+1.
-        int64_t *Yi = A->Y->i ;         // "row" indices j; Yi has size anvec.
-        int64_t *Yx = A->Y->x ;         // values k; Yx has size anvec.
-
-        // Given a value j to find in the list Ah: find the entry k =
-        // Y(j,f(j)), if it exists, or k=-1 if j is not in the Ah
-        // hyperlist.
-        int64_t jhash = GB_HASHF2 (j, hash_bits) ;     // in range 0 to nhash-1
+        int64_t ngroups = A->Y->vdim ;  // # of groups in the hash table
+        int64_t hash_bits = ngroups-1 ;
+        int64_t *Yx = A->Y->x ;         // the hash table; size 16*ngroups
+
+        // Given a value j to find in the list Ah: find k so that j = Ah [k],
+        // if it exists, or k=-1 if j is not in the Ah hyperlist.
         int64_t k = -1 ;
-        for (int64_t p = Yp [jhash] ; p < Yp [jhash+1] ; p++)
+        for (int64_t g = GB_HASHF2 (j, hash_bits) ; ; g = (g+1) & hash_bits)
         {
-            if (j == Yi [p])
+            int64_t *Ykey = Yx + g*16 ;     // keys of the group g
+            int64_t *Yval = Ykey + 8 ;      // values of the group g
+            bool empty = false ;
+            for (int t = 0 ; t < 8 ; t++)
             {
-                k = Yx [p] ;        // k = Y (j,jhash) has been found
-                break ;
+                if (Ykey [t] == j) k = Yval [t] ;   // j has been found
+                if (Ykey [t] == GB_HYPER_HASH_EMPTY) empty = true ;
             }
-            // or this could be done instead:
-            // k = (j == Yi [p]) ? Yx [p] : k ;  // break not needed.
+            if (k >= 0 || empty) break ;
         }
 
-    The hyper_hash is based on the HashGraph method by Oded Green,
-    ACM Trans. Parallel Computing, June 2021, https://doi.org/10.1145/3460872
+    See GB_hyper_hash_lookup for the method used in practice.
+
+    The groups of slots follow the design of the "Swiss tables" of the Abseil
+    C++ library, except that the keys themselves are compared, not a 7-bit
+    tag for each key.  Prior versions of SuiteSparse:GraphBLAS (v9.0 and
+    earlier) used a sparse Y matrix of hash buckets, based on the HashGraph
+    method by Oded Green, ACM Trans. Parallel Computing, June 2021,
+    https://doi.org/10.1145/3460872 .
 */
 
 GrB_Matrix Y ;      // Y is a matrix that represents the inverse of A->h.
@@ -466,7 +465,7 @@ int sparsity_control ;  // controls sparsity structure: hypersparse,
 // to the content of another matrix, or A->Y which points to the Y hyper_hash
 // of another matrix.  Using shallow components speeds up computations and
 // saves memory, but shallow matrices are never passed back to the user
-// application.
+// application, except for matrices created by GxB_Matrix_attach (see below).
 
 // If the following are true, then the corresponding component of the
 // object is a pointer into components of another object.  They must not
@@ -512,6 +511,36 @@ bool jumbled ;          // true if the matrix may be jumbled.  bitmap and full
 
 bool iso ;              // true if all entries have the same value
 
+//------------------------------------------------------------------------------
+// cached transpose
+//------------------------------------------------------------------------------
+
+// If A->T_cache is true (see GxB_TRANSPOSE_CACHE), A->T holds a copy of the
+// transpose of A, once it has been computed.  A->T has the same type and the
+// same CSR/CSC format as A, so that A->T' is an alternative representation of
+// A.  Methods that need to access A by the opposite orientation, such as a
+// dot product (pull) instead of a saxpy (push) for C=A*B, can use A->T
+// instead of transposing A themselves.  A->T is computed by
+// GB_transpose_cache_build, when first required or by GrB_Matrix_wait, and is
+// freed whenever the content of A changes.  A->T is never shallow.
+
+GrB_Matrix T ;          // cached transpose of A, or NULL
+bool T_cache ;          // if true, keep A->T once it has been computed
+
+//------------------------------------------------------------------------------
+// shared-memory matrices
+//------------------------------------------------------------------------------
+
+// A matrix created by GxB_Matrix_attach has shallow components that point
+// into a file written by GxB_Matrix_publish and mapped into memory, so that
+// many processes can share one copy of the matrix.  A->shm is the mapping of
+// the file, which is owned by A.  It is removed when A is freed, or when
+// GB_WHERE gives A its own copy of the content before A is modified (see
+// GB_shm_unshare).
+
+void *shm ;             // mapped file that A is attached to, or NULL
+size_t shm_size ;       // size of the mapped file
+
 //------------------------------------------------------------------------------
 // iterating through a matrix
 //------------------------------------------------------------------------------
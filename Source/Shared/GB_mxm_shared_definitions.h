@@ -21,6 +21,14 @@
 // special semirings
 //------------------------------------------------------------------------------
 
+// 1 if C += A*B may be computed in place, for a bitmap C with no mask, where
+// the accum is the same as the monoid.  Each JIT kernel is compiled for one
+// case or the other.  The factory and generic kernels handle both cases, since
+// C->b is calloc'd if C is not computed in place.
+#ifndef GB_C_IN_PLACE
+#define GB_C_IN_PLACE 1
+#endif
+
 // 1 for the symbolic ANY_PAIR semiring
 #ifndef GB_IS_ANY_PAIR_SEMIRING
 #define GB_IS_ANY_PAIR_SEMIRING 0
@@ -462,6 +462,9 @@ struct GB_Descriptor_opaque // content of GrB_Descriptor
     int compression ;       // compression method for GxB_Matrix_serialize
     bool do_sort ;          // if nonzero, do the sort in GrB_mxm
     int import ;            // if zero (default), trust input data
+    bool axb_plan ;         // if true, reuse the saxpy3 analysis in GrB_mxm
+    struct GB_saxpy3_plan_struct *Plan ;    // saxpy3 plan, or NULL
+    size_t Plan_size ;      // size of the malloc'd block for Plan, or 0
 } ;
 
 struct GB_Context_opaque    // content of GxB_Context
@@ -478,6 +481,12 @@ struct GB_Context_opaque    // content of GxB_Context
     // GPU:
     int gpu_id ;            // if negative: use the CPU only; do not use a GPU
                             // if >= 0: then use GPU gpu_id
+    // memory:
+    int numa_policy ;       // GxB_NUMA_DEFAULT, FIRST_TOUCH, INTERLEAVE, LOCAL
+    // tuner:
+    struct GB_Tuner_struct *tuner ; // NULL if the Context is not tuned
+    // deferred execution:
+    bool defer ;            // if true, defer and fuse chains of GrB_apply
 } ;
 
 //------------------------------------------------------------------------------
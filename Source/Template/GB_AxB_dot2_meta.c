@@ -23,7 +23,8 @@
     // dimensions.  The C bitmap/full matrix is converted back into a sparse or
     // hypersparse matrix when done.
 
-    int64_t cnvals = 0 ;
+    // C->nvals is nonzero on input only if C+=A'*B is computed in-place
+    int64_t cnvals = C->nvals ;
 
     ASSERT (GB_IS_BITMAP (C) || GB_IS_FULL (C)) ;
     int8_t *restrict Cb = C->b ;
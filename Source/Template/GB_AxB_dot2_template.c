@@ -25,6 +25,24 @@
         /* Cx [pC] = cij */             \
         GB_PUTC (cij, Cx, pC) ;         \
     }
+#elif GB_NO_MASK && GB_C_IN_PLACE
+    // C is bitmap with no mask: C(i,j) may be present on input, if C+=A'*B
+    // is being computed in-place, and then it is updated with the monoid.
+    #define GB_DOT_ALWAYS_SAVE_CIJ      \
+    {                                   \
+        if (Cb [pC])                    \
+        {                               \
+            /* Cx [pC] += cij */        \
+            GB_CIJ_UPDATE (pC, cij) ;   \
+        }                               \
+        else                            \
+        {                               \
+            /* Cx [pC] = cij */         \
+            GB_PUTC (cij, Cx, pC) ;     \
+            Cb [pC] = 1 ;               \
+            task_cnvals++ ;             \
+        }                               \
+    }
 #else
     #define GB_DOT_ALWAYS_SAVE_CIJ      \
     {                                   \
@@ -55,6 +73,23 @@
 #error "mask undefined"
 #endif
 
+// GB_DOT2_TILE: C=A'*B with A, B, and C all full and no mask, is computed in
+// tiles by GB_AxB_dot2_tile_template.c.  The tiled method is not used for the
+// generic kernel, nor for semirings where the untiled method has a special
+// case that does not need to compute any products (the ANY monoid, the PAIR
+// multiplier, and the MIN_FIRSTJ and MAX_FIRSTJ semirings), nor for monoids
+// whose type is larger than double complex.
+#undef GB_DOT2_TILE
+#if ( GB_C_IS_FULL && GB_NO_MASK && GB_A_IS_FULL && GB_B_IS_FULL         \
+    && !defined ( GB_A_NOT_TRANSPOSED ) && !defined ( GB_GENERIC )       \
+    && !GB_IS_ANY_MONOID && !GB_IS_PAIR_MULTIPLIER                        \
+    && !GB_IS_MIN_FIRSTJ_SEMIRING && !GB_IS_MAX_FIRSTJ_SEMIRING           \
+    && ( GB_Z_NBITS <= 128 ) )
+#define GB_DOT2_TILE 1
+#else
+#define GB_DOT2_TILE 0
+#endif
+
 #if ( !GB_A_IS_HYPER && !GB_B_IS_HYPER )
 {
 
@@ -86,6 +121,16 @@
         int64_t task_cnvals = 0 ;
         #endif
 
+        #if GB_DOT2_TILE
+
+        //----------------------------------------------------------------------
+        // C=A'*B via tiled dot products, where A, B, and C are full
+        //----------------------------------------------------------------------
+
+        #include "GB_AxB_dot2_tile_template.c"
+
+        #else
+
         //----------------------------------------------------------------------
         // C=A'*B, C<M>=A'*B, or C<!M>=A'*B via dot products
         //----------------------------------------------------------------------
@@ -111,7 +156,10 @@
                 if (bjnz == 0)
                 { 
                     // no work to do if B(:,j) is empty, except to clear Cb
+                    // if the mask has been scattered into it
+                    #if !GB_NO_MASK
                     memset (&Cb [pC_start + kA_start], 0, kA_end - kA_start) ;
+                    #endif
                     continue ;
                 }
                 #if GB_A_IS_SPARSE
@@ -177,8 +225,9 @@
 
                 #else
 
-                // C is bitmap; M is not present
-                Cb [pC] = 0 ;
+                // C is bitmap; M is not present.  Cb has been calloc'd, or it
+                // holds the entries of C if C+=A'*B is computed in-place, so
+                // Cb [pC] is not cleared.
 
                 #endif
                 { 
@@ -217,6 +266,9 @@
                 }
             }
         }
+
+        #endif
+
         #if (!GB_C_IS_FULL)
         cnvals += task_cnvals ;
         #endif
@@ -234,4 +286,5 @@
 #undef GB_B_IS_FULL
 #undef GB_DOT_ALWAYS_SAVE_CIJ
 #undef GB_DOT_SAVE_CIJ
+#undef GB_DOT2_TILE
 
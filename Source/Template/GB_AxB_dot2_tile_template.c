@@ -0,0 +1,190 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot2_tile_template: C=A'*B via tiled dot products; A, B, C all full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This template computes the task C(kA_start:kA_end-1,kB_start:kB_end-1) =
+// A(:,kA_start:kA_end-1)'*B(:,kB_start:kB_end-1), where A, B, and C are all
+// full, and no mask is present.  It is #include'd by GB_AxB_dot2_template.c
+// inside its parallel loop over all tasks.
+
+// Rather than computing each dot product C(i,j) = A(:,i)'*B(:,j) one at a
+// time, the task is split into tiles of C of size GB_TILE_MR-by-GB_TILE_NR.
+// The dot products for all entries in a single tile are computed together,
+// with the tile of C held in an array of scalars that the compiler can keep
+// in registers.  For each k, the GB_TILE_MR entries A(k,i0:i0+MR-1) and the
+// GB_TILE_NR entries B(k,j0:j0+NR-1) are loaded once, and then used MR*NR
+// times.
+
+// The k dimension is split into chunks of size GB_TILE_KC.  The chunk
+// B(k0:k0+KC-1,j0:j0+NR-1) is typecast and copied into a small panel on the
+// stack (of at most GB_TILE_PANEL bytes), in row-major order, where it stays
+// in the L1 cache while all of the tiles for C(:,j0:j0+NR-1) are computed.
+// Since the entries B(k,j0:j0+NR-1) are adjacent in the panel, the
+// compiler can vectorize the update of a whole row of the tile.  The tile of
+// C is loaded back from Cx for each chunk after the first (C has the same
+// type as the monoid, since C is not iso).
+
+// Each entry C(i,j) is computed with its terms in the same order as the
+// untiled loop in Template/GB_AxB_dot_cij.c, so the results are identical,
+// even for the MIN and MAX monoids with NaNs.  If the monoid is terminal, the
+// untiled loop checks each cij after every term.  Here, the whole tile is
+// checked every GB_TILE_KT terms instead, and the tile is done once all its
+// entries have reached the terminal value.
+
+// Tiles on the right and bottom edges of C are padded by repeating the last
+// row of A or column of B in the task, so the inner loops always have a fixed
+// size.  The padded entries of the tile are computed but not saved.
+
+#ifndef GB_TILE_MR
+#define GB_TILE_MR 4
+#define GB_TILE_NR 4
+#define GB_TILE_KT 32
+#define GB_TILE_PANEL 16384
+#endif
+
+#undef GB_TILE_KC
+#if GB_B_IS_PATTERN
+// the values of B are not accessed, and no panel is needed
+#define GB_TILE_KC 256
+#else
+#define GB_TILE_KC \
+    GB_IMAX (1, GB_TILE_PANEL / (GB_TILE_NR * sizeof (GB_B2TYPE)))
+#endif
+
+{
+    for (int64_t k0 = 0 ; k0 < vlen ; k0 += GB_TILE_KC)
+    {
+        const int64_t k1 = GB_IMIN (k0 + GB_TILE_KC, vlen) ;
+        for (int64_t j0 = kB_start ; j0 < kB_end ; j0 += GB_TILE_NR)
+        {
+
+            //------------------------------------------------------------------
+            // get B(:,j0:j0+NR-1), padded with the last column in the task
+            //------------------------------------------------------------------
+
+            const int nr = (int) GB_IMIN (GB_TILE_NR, kB_end - j0) ;
+            GB_DECLAREB (bkj [GB_TILE_KC * GB_TILE_NR]) ;
+            for (int t = 0 ; t < GB_TILE_NR ; t++)
+            {
+                const int64_t pB = (j0 + GB_IMIN (t, nr-1)) * vlen ;
+                for (int64_t k = k0 ; k < k1 ; k++)
+                {
+                    // bkj [k-k0][t] = B(k,j0+t)
+                    const int64_t kk = (k-k0) * GB_TILE_NR ;
+                    GB_GETB (bkj [kk+t], Bx, pB + k, B_iso) ;
+                }
+            }
+
+            for (int64_t i0 = kA_start ; i0 < kA_end ; i0 += GB_TILE_MR)
+            {
+
+                //--------------------------------------------------------------
+                // get A(:,i0:i0+MR-1), padded with the last column in the task
+                //--------------------------------------------------------------
+
+                const int mr = (int) GB_IMIN (GB_TILE_MR, kA_end - i0) ;
+                int64_t pA_tile [GB_TILE_MR] ;
+                for (int s = 0 ; s < GB_TILE_MR ; s++)
+                {
+                    pA_tile [s] = (i0 + GB_IMIN (s, mr-1)) * vlen ;
+                }
+
+                //--------------------------------------------------------------
+                // initialize the tile of C
+                //--------------------------------------------------------------
+
+                GB_CIJ_DECLARE (cij [GB_TILE_MR][GB_TILE_NR]) ;
+                GB_DECLAREA (aki [GB_TILE_MR]) ;
+                int64_t k = k0 ;
+                if (k0 == 0)
+                {
+                    // cij = A(0,i) * B(0,j)
+                    for (int s = 0 ; s < GB_TILE_MR ; s++)
+                    {
+                        GB_GETA (aki [s], Ax, pA_tile [s], A_iso) ;
+                    }
+                    for (int s = 0 ; s < GB_TILE_MR ; s++)
+                    {
+                        for (int t = 0 ; t < GB_TILE_NR ; t++)
+                        {
+                            GB_MULT (cij [s][t], aki [s], bkj [t],
+                                i0+s, 0, j0+t) ;
+                        }
+                    }
+                    k = 1 ;
+                }
+                else
+                {
+                    // get the tile of C computed by the prior chunks of k
+                    for (int s = 0 ; s < GB_TILE_MR ; s++)
+                    {
+                        const int64_t i = i0 + GB_IMIN (s, mr-1) ;
+                        for (int t = 0 ; t < GB_TILE_NR ; t++)
+                        {
+                            const int64_t j = j0 + GB_IMIN (t, nr-1) ;
+                            cij [s][t] = Cx [j * cvlen + i] ;
+                        }
+                    }
+                }
+
+                //--------------------------------------------------------------
+                // cij += A(k0:k1-1,i)'*B(k0:k1-1,j) for the whole tile
+                //--------------------------------------------------------------
+
+                for ( ; k < k1 ; k++)
+                {
+                    #if GB_MONOID_IS_TERMINAL
+                    if (((k - k0) % GB_TILE_KT) == 0)
+                    {
+                        // break if all entries in the tile are terminal
+                        bool done = true ;
+                        for (int s = 0 ; s < GB_TILE_MR ; s++)
+                        {
+                            for (int t = 0 ; t < GB_TILE_NR ; t++)
+                            {
+                                done = done &&
+                                    GB_TERMINAL_CONDITION (cij [s][t],
+                                        zterminal) ;
+                            }
+                        }
+                        if (done) break ;
+                    }
+                    #endif
+                    for (int s = 0 ; s < GB_TILE_MR ; s++)
+                    {
+                        // aki [s] = A(k,i0+s)
+                        GB_GETA (aki [s], Ax, pA_tile [s] + k, A_iso) ;
+                    }
+                    const int64_t kk = (k-k0) * GB_TILE_NR ;
+                    for (int s = 0 ; s < GB_TILE_MR ; s++)
+                    {
+                        for (int t = 0 ; t < GB_TILE_NR ; t++)
+                        {
+                            // cij += aki * bkj
+                            GB_MULTADD (cij [s][t], aki [s], bkj [kk+t],
+                                i0+s, k, j0+t) ;
+                        }
+                    }
+                }
+
+                //--------------------------------------------------------------
+                // save the tile of C, except for any padding
+                //--------------------------------------------------------------
+
+                for (int s = 0 ; s < mr ; s++)
+                {
+                    for (int t = 0 ; t < nr ; t++)
+                    {
+                        GB_PUTC (cij [s][t], Cx, (j0+t) * cvlen + i0+s) ;
+                    }
+                }
+            }
+        }
+    }
+}
+
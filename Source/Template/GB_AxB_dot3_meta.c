@@ -40,8 +40,10 @@
 
 #endif
 
-// GB_DOT_SAVE_CIJ: C(i,j) = cij, if it exists
-#define GB_DOT_SAVE_CIJ                 \
+// GB_DOT_SAVE_CIJ: C(i,j) = cij, if it exists.  The ultra-fine tasks in
+// Template/GB_AxB_dot3_template.c redefine GB_DOT_SAVE_CIJ, and then restore
+// it as GB_DOT3_SAVE_CIJ.
+#define GB_DOT3_SAVE_CIJ                \
 {                                       \
     if (GB_CIJ_EXISTS)                  \
     {                                   \
@@ -50,6 +52,7 @@
         Ci [pC] = i ;                   \
     }                                   \
 }
+#define GB_DOT_SAVE_CIJ GB_DOT3_SAVE_CIJ
 
 {
 
@@ -105,14 +108,8 @@
     const bool A_is_sparse = GB_IS_SPARSE (A) ;
     const bool A_iso = A->iso ;
     #endif
-
-    const int64_t *restrict A_Yp = (A->Y == NULL) ? NULL : A->Y->p ;
-    const int64_t *restrict A_Yi = (A->Y == NULL) ? NULL : A->Y->i ;
     const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
     const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
-
-    const int64_t *restrict B_Yp = (B->Y == NULL) ? NULL : B->Y->p ;
-    const int64_t *restrict B_Yi = (B->Y == NULL) ? NULL : B->Y->i ;
     const int64_t *restrict B_Yx = (B->Y == NULL) ? NULL : B->Y->x ;
     const int64_t B_hash_bits = (B->Y == NULL) ? 0 : (B->Y->vdim - 1) ;
 
@@ -137,6 +134,50 @@
     const size_t mvlen = M->vlen ;
     const GB_M_TYPE *restrict Mx = (GB_M_TYPE *) (Mask_struct ? NULL : (M->x)) ;
 
+    //--------------------------------------------------------------------------
+    // allocate workspace for the ultra-fine tasks, if any
+    //--------------------------------------------------------------------------
+
+    // The ultra-fine tasks appear first in the TaskList (see
+    // GB_AxB_dot3_slice).  Each computes a partial dot product for a single
+    // heavy entry C(i,j), saved in Hx [tid], with Hf [tid] true if the
+    // partial result exists.  If the workspace cannot be allocated, the first
+    // ultra-fine task for each heavy entry computes all of it instead.
+
+    int nfine = 0 ;
+    while (nfine < ntasks && TaskList [nfine].klast == -1)
+    { 
+        nfine++ ;
+    }
+
+    int8_t *restrict Hf = NULL ; size_t Hf_size = 0 ;
+    #if !GB_IS_ANY_PAIR_SEMIRING
+    GB_C_TYPE *restrict Hx = NULL ; size_t Hx_size = 0 ;
+    #ifdef GB_DOT3_GENERIC
+    const size_t hsize = csize ;
+    #else
+    const size_t hsize = sizeof (GB_C_TYPE) ;
+    #endif
+    #endif
+
+    if (nfine > 0)
+    {
+        Hf = GB_MALLOC_WORK (nfine, int8_t, &Hf_size) ;
+        bool ok = (Hf != NULL) ;
+        #if !GB_IS_ANY_PAIR_SEMIRING
+        Hx = (GB_C_TYPE *) GB_MALLOC_WORK (nfine * hsize, GB_void, &Hx_size) ;
+        ok = ok && (Hx != NULL) ;
+        #endif
+        if (!ok)
+        { 
+            // out of memory; use the first ultra-fine task for each entry
+            GB_FREE_WORK (&Hf, Hf_size) ;
+            #if !GB_IS_ANY_PAIR_SEMIRING
+            GB_FREE_WORK (&Hx, Hx_size) ;
+            #endif
+        }
+    }
+
     //--------------------------------------------------------------------------
     // C<M> = A'*B via dot products, where C and M are both sparse/hyper
     //--------------------------------------------------------------------------
@@ -186,11 +227,62 @@
     }
     #endif
 
+    //--------------------------------------------------------------------------
+    // sum up the partial results of the ultra-fine tasks
+    //--------------------------------------------------------------------------
+
+    if (Hf != NULL)
+    {
+        for (int t = 0 ; t < nfine ; )
+        {
+            // C(i,j) is the monoid sum of Hx [t...] for all ultra-fine tasks
+            // that computed part of it
+            const int64_t pC = TaskList [t].pC ;
+            const int64_t i = Mi [pC] ;
+            bool cij_exists = false ;
+            for ( ; t < nfine && TaskList [t].pC == pC ; t++)
+            {
+                if (!Hf [t]) continue ;
+                if (cij_exists)
+                { 
+                    // Cx [pC] += Hx [t]
+                    GB_CIJ_GATHER_UPDATE (pC, t) ;
+                }
+                else
+                { 
+                    // Cx [pC] = Hx [t]
+                    cij_exists = true ;
+                    GB_CIJ_GATHER (pC, t) ;
+                }
+            }
+            if (cij_exists)
+            { 
+                Ci [pC] = i ;
+            }
+            else
+            { 
+                // C(i,j) is a zombie
+                nzombies++ ;
+                Ci [pC] = GB_FLIP (i) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK (&Hf, Hf_size) ;
+    #if !GB_IS_ANY_PAIR_SEMIRING
+    GB_FREE_WORK (&Hx, Hx_size) ;
+    #endif
+
     C->nzombies = nzombies ;
 }
 
 #undef GB_DOT_ALWAYS_SAVE_CIJ
 #undef GB_DOT_SAVE_CIJ
+#undef GB_DOT3_SAVE_CIJ
 
 #undef GB_DOT3
 #undef GB_DOT3_PHASE2
@@ -10,6 +10,10 @@
 // C and M are both sparse or both hyper, and C->h is a copy of M->h.
 // M is present, and not complemented.  It may be valued or structural.
 
+// The ultra-fine tasks (with klast = -1) each compute part of a single heavy
+// entry C(i,j), and appear first in the TaskList.  They are constructed only
+// if A and B are both sparse or hypersparse.
+
 {
 
     int tid ;
@@ -28,8 +32,101 @@
         int64_t pC_last  = TaskList [tid].pC_end ;
         int64_t task_nzombies = 0 ;     // # of zombies found by this task
 
+        if (klast == -1)
+        {
+
+            //------------------------------------------------------------------
+            // ultra-fine task: compute part of a single entry C(i,j)
+            //------------------------------------------------------------------
+
+            #if ( (GB_A_IS_SPARSE || GB_A_IS_HYPER) && \
+                  (GB_B_IS_SPARSE || GB_B_IS_HYPER) )
+            {
+
+                // This task computes A(k1:k2,i)'*B(k1:k2,j), where A(k1:k2,i)
+                // is in Ai [pA:pA_end-1] and B(k1:k2,j) is in Bi
+                // [pB_start:pB_end-1].  The range k1:k2 is not needed.
+
+                #if defined ( GB_MASK_SPARSE_STRUCTURAL_AND_NOT_COMPLEMENTED )
+                const int64_t j = kfirst ;
+                #else
+                const int64_t j = GBH_C (Ch, kfirst) ;
+                #endif
+                const int64_t pC = pC_first ;
+                const int64_t i = Mi [pC] ;
+                int64_t pA = TaskList [tid].pA ;
+                int64_t pA_end = TaskList [tid].pA_end ;
+                const int64_t pB_start = TaskList [tid].pB ;
+                int64_t pB_end = TaskList [tid].pB_end ;
+
+                if (Hf == NULL)
+                {
+                    // no workspace for the partial results: the first task
+                    // for C(i,j) computes all of it, and the others do nothing
+                    if (tid > 0 && TaskList [tid-1].pC == pC) continue ;
+                    int t = tid ;
+                    while (t+1 < nfine && TaskList [t+1].pC == pC)
+                    { 
+                        t++ ;
+                    }
+                    pA_end = TaskList [t].pA_end ;
+                    pB_end = TaskList [t].pB_end ;
+                }
+
+                bool cij_exists = false ;
+                GB_CIJ_DECLARE (cij) ;
+                #if GB_IS_PLUS_PAIR_REAL_SEMIRING
+                cij = 0 ;
+                #endif
+                const int64_t ainz = pA_end - pA ;
+                const int64_t bjnz = pB_end - pB_start ;
+                #if defined ( GB_MASK_SPARSE_STRUCTURAL_AND_NOT_COMPLEMENTED )
+                const bool mij = true ;
+                #else
+                // if M is structural, no need to check its values
+                const bool mij = GB_MCAST (Mx, pC, msize) ;
+                #endif
+                if (mij && ainz > 0 && bjnz > 0)
+                { 
+                    const int64_t ib_first = Bi [pB_start] ;
+                    const int64_t ib_last  = Bi [pB_end-1] ;
+                    // cij = A(k1:k2,i)'*B(k1:k2,j), but do not save it yet
+                    #undef  GB_DOT_SAVE_CIJ
+                    #define GB_DOT_SAVE_CIJ
+                    #include "GB_AxB_dot_cij.c"
+                    #undef  GB_DOT_SAVE_CIJ
+                    #define GB_DOT_SAVE_CIJ GB_DOT3_SAVE_CIJ
+                }
+
+                if (Hf != NULL)
+                { 
+                    // save the partial result in Hx [tid]
+                    Hf [tid] = GB_CIJ_EXISTS ;
+                    if (GB_CIJ_EXISTS)
+                    { 
+                        GB_PUTC (cij, Hx, tid) ;
+                    }
+                }
+                else if (GB_CIJ_EXISTS)
+                { 
+                    // Cx [pC] = cij
+                    GB_PUTC (cij, Cx, pC) ;
+                    Ci [pC] = i ;
+                }
+                else
+                { 
+                    // C(i,j) is a zombie
+                    task_nzombies++ ;
+                    Ci [pC] = GB_FLIP (i) ;
+                }
+            }
+            #endif
+            nzombies += task_nzombies ;
+            continue ;
+        }
+
         //----------------------------------------------------------------------
-        // compute all vectors in this task
+        // compute all vectors in this coarse task
         //----------------------------------------------------------------------
 
         for (int64_t k = kfirst ; k <= klast ; k++)
@@ -72,8 +169,8 @@
             #if GB_B_IS_HYPER
                 // B is hyper: find B(:,j) using the B->Y hyper hash
                 int64_t pB_start, pB_end ;
-                GB_hyper_hash_lookup (Bh, bnvec, Bp, B_Yp, B_Yi, B_Yx,
-                    B_hash_bits, j, &pB_start, &pB_end) ;
+                GB_hyper_hash_lookup (Bh, bnvec, Bp, B_Yx, B_hash_bits, j,
+                    &pB_start, &pB_end) ;
             #elif GB_B_IS_SPARSE
                 // B is sparse
                 const int64_t pB_start = Bp [j] ;
@@ -136,8 +233,8 @@
                     #if GB_A_IS_HYPER
                     // A is hyper: find A(:,i) using the A->Y hyper hash
                     int64_t pA, pA_end ;
-                    GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yp, A_Yi, A_Yx,
-                        A_hash_bits, i, &pA, &pA_end) ;
+                    GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yx, A_hash_bits, i,
+                        &pA, &pA_end) ;
                     const int64_t ainz = pA_end - pA ;
                     if (ainz > 0)
                     #elif GB_A_IS_SPARSE
@@ -28,7 +28,10 @@
 
 // If both A(:,i) and B(:,j) are sparse, then the intersection must still be
 // found, so these optimizations can be used only if A(:,i) and/or B(:,j) are
-// entirely populated.
+// entirely populated.  If both are sparse and neither is short, their
+// intersection is found by GB_intersect_count (for the PLUS_PAIR semirings) or
+// GB_intersect_chunk (for all others), which compare blocks of each vector
+// with AVX2 or AVX512F, or gallop if their lengths are very different.
 
 // The #include'ing file must use GB_DECLARE_TERMINAL_CONST (zterminal),
 // or define zterminal another way (see Template/GB_AxB_dot_generic.c).
@@ -561,6 +564,45 @@
 
             ASSERT (!GB_CIJ_EXISTS) ;
 
+        }
+        else if (ainz >= GB_DOT_INTERSECT_MIN && bjnz >= GB_DOT_INTERSECT_MIN)
+        {
+
+            //------------------------------------------------------------------
+            // A(:,i) and B(:,j) are both long enough to intersect in blocks
+            //------------------------------------------------------------------
+
+            #if ( GB_IS_PLUS_PAIR_REAL_SEMIRING && GB_Z_IGNORE_OVERFLOW )
+            { 
+                // cij += nnz (A(:,i) .* B(:,j))
+                cij += GB_intersect_count (Ai + pA, ainz, Bi + pB, bjnz) ;
+            }
+            #else
+            {
+                int64_t Pa_match [GB_DOT_INTERSECT_CHUNK] ;
+                int64_t Pb_match [GB_DOT_INTERSECT_CHUNK] ;
+                while (pA < pA_end && pB < pB_end)
+                {
+                    // find the next matches in A(:,i) and B(:,j)
+                    const int64_t nmatch = GB_intersect_chunk (Pa_match,
+                        Pb_match, &pA, &pB, Ai, pA_end, Bi, pB_end,
+                        GB_DOT_INTERSECT_CHUNK) ;
+                    int64_t t ;
+                    for (t = 0 ; t < nmatch ; t++)
+                    { 
+                        // A(k,i) and B(k,j) are the next entries to merge
+                        GB_DOT (Ai [Pa_match [t]], Pa_match [t], Pb_match [t]) ;
+                        #if GB_IS_MIN_FIRSTJ_SEMIRING
+                        break ;
+                        #endif
+                    }
+                    // stop if GB_DOT has terminated early
+                    if (t < nmatch) break ;
+                }
+            }
+            #endif
+            GB_DOT_SAVE_CIJ ;
+
         }
         else if (ainz > 8 * bjnz)
         {
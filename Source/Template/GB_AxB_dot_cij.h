@@ -19,6 +19,15 @@
 // The #include'ing file must use GB_DECLARE_TERMINAL_CONST (zterminal),
 // or define zterminal another way (see Template/GB_AxB_dot_generic.c).
 
+// If A(:,i) and B(:,j) are both sparse with at least GB_DOT_INTERSECT_MIN
+// entries each, their intersection is found by GB_intersect_count or
+// GB_intersect_chunk, which returns up to GB_DOT_INTERSECT_CHUNK matches at a
+// time.  Shorter vectors are merged one entry at a time.
+#ifndef GB_DOT_INTERSECT_MIN
+#define GB_DOT_INTERSECT_MIN 16
+#define GB_DOT_INTERSECT_CHUNK 64
+#endif
+
 // use the boolean flag cij_exists to set/check if C(i,j) exists
 #undef  GB_CIJ_CHECK
 #define GB_CIJ_CHECK true
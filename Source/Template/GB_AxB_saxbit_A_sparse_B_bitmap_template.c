@@ -10,7 +10,9 @@
 // C is bitmap. A is hyper/sparse, B is bitmap/full.  M is anything. If M is
 // sparse or hypersparse, it has been scattered into the bitmap of C.
 
-// no accumulator is used
+// No accumulator is used, except when C is modified in-place by C += A*B,
+// where the accumulator is the same as the monoid.  Entries already present
+// in C on input are updated with the monoid.
 
 // This template is used by Template/GB_AxB_saxbit_template, for all cases:
 // generic kernels, factory kernels (including the ANY_PAIR monoid), and JIT
@@ -204,13 +206,9 @@
                             task_cnvals++ ;
                         }
                         else
-                        {
-                            // Currently, the matrix C is a newly allocated
-                            // matrix, not the C_in input matrix to GrB_mxm.
-                            // As a result, this condition is not used.  It
-                            // will be in the future when this method is
-                            // modified to modify C in-place.
-                            ASSERT (GB_DEAD_CODE) ;
+                        { 
+                            // C(i,j) is already present in C_in, which is
+                            // being modified in-place by C_in += A*B.
                             // C(i,j) += H(i,jj)
                             GB_CIJ_GATHER_UPDATE (pC, pH) ;
                         }
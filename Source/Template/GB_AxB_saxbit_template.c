@@ -10,8 +10,9 @@
 // GB_AxB_saxpy_sparsity determines the sparsity structure for C<M or !M>=A*B
 // or C=A*B, and this template is used when C is bitmap.
 
-// FUTURE: C could be modified in-place if the accum operator is the same as
-// the monoid.
+// C can be modified in-place (C += A*B) if the accum operator is the same as
+// the monoid and no mask is present.  In this case, C is the C_in input matrix
+// to GrB_mxm, and C->b and C->nvals hold its entries on input.
 
 // C is bitmap.
 // M is anything: present or not, complemented or not, structural or valued,
@@ -24,6 +24,8 @@ typedef GB_CALLBACK_BIX_ALLOC_PROTO ((*GB_bix_alloc_f)) ;
 typedef GB_CALLBACK_EK_SLICE_PROTO ((*GB_ek_slice_f)) ;
 typedef GB_CALLBACK_EK_SLICE_MERGE1_PROTO ((*GB_ek_slice_merge1_f)) ;
 typedef GB_CALLBACK_FREE_MEMORY_PROTO ((*GB_free_memory_f)) ;
+typedef GB_CALLBACK_INTERSECT_COUNT_PROTO ((*GB_intersect_count_f)) ;
+typedef GB_CALLBACK_INTERSECT_CHUNK_PROTO ((*GB_intersect_chunk_f)) ;
 typedef GB_CALLBACK_MALLOC_MEMORY_PROTO ((*GB_malloc_memory_f)) ;
 typedef GB_CALLBACK_MEMSET_PROTO ((*GB_memset_f)) ;
 typedef GB_CALLBACK_QSORT_1_PROTO ((*GB_qsort_1_f)) ;
@@ -48,6 +50,8 @@ typedef struct
     GB_qsort_1_f                GB_qsort_1_func ;
     GB_werk_pop_f               GB_werk_pop_func ;
     GB_werk_push_f              GB_werk_push_func ;
+    GB_intersect_count_f        GB_intersect_count_func ;
+    GB_intersect_chunk_f        GB_intersect_chunk_func ;
 }
 GB_callback_struct ;
 
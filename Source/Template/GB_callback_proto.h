@@ -107,6 +107,32 @@ void GX_free_memory         /* free memory */                               \
     size_t size_allocated   /* # of bytes actually allocated */             \
 )
 
+#define GB_CALLBACK_INTERSECT_COUNT_PROTO(GX_intersect_count)               \
+int64_t GX_intersect_count  /* return # of entries in both lists */         \
+(                                                                           \
+    const int64_t *restrict Ai, /* sorted list of size anz, no duplicates */\
+    const int64_t anz,                                                      \
+    const int64_t *restrict Bi, /* sorted list of size bnz, no duplicates */\
+    const int64_t bnz                                                       \
+)
+
+#define GB_CALLBACK_INTERSECT_CHUNK_PROTO(GX_intersect_chunk)               \
+int64_t GX_intersect_chunk  /* return # of matches found, at most nmax */   \
+(                                                                           \
+    /* output: */                                                           \
+    int64_t *restrict Pa,       /* Ai [Pa [t]] == Bi [Pb [t]] for each  */  \
+    int64_t *restrict Pb,       /* match t, in ascending order */           \
+    /* input/output: */                                                     \
+    int64_t *pA,                /* next position in Ai [pA...pA_end-1] */   \
+    int64_t *pB,                /* next position in Bi [pB...pB_end-1] */   \
+    /* input: */                                                            \
+    const int64_t *restrict Ai, /* sorted list, no duplicates */            \
+    const int64_t pA_end,                                                   \
+    const int64_t *restrict Bi, /* sorted list, no duplicates */            \
+    const int64_t pB_end,                                                   \
+    const int64_t nmax          /* size of Pa and Pb */                     \
+)
+
 #define GB_CALLBACK_MALLOC_MEMORY_PROTO(GX_malloc_memory)                   \
 void *GX_malloc_memory      /* pointer to allocated block of memory */      \
 (                                                                           \
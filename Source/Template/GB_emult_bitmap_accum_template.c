@@ -0,0 +1,111 @@
+//------------------------------------------------------------------------------
+// GB_emult_bitmap_accum_template: C<#M>+=A.*B, in place, C bitmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C is bitmap and not iso.  A and B are bitmap or full.  M is not present,
+// bitmap/full, or sparse/hyper and complemented.  The binary op is also the
+// accum operator, and no typecasting is done.  C is modified in place, where
+// the mask is true and A(i,j).*B(i,j) is present.  Used by the JIT only, for
+// GB_emult_bitmap_accum.
+
+{
+
+    //--------------------------------------------------------------------------
+    // get M
+    //--------------------------------------------------------------------------
+
+    #if GB_NO_MASK
+    { 
+        // no mask
+    }
+    #elif GB_M_IS_SPARSE || GB_M_IS_HYPER
+    ASSERT (Mask_comp) ;
+
+    // scatter M into the C bitmap: Cb [p] is incremented by 2 where M(i,j)
+    // is true.  Those entries C(i,j) are not modified.
+    GB_bitmap_M_scatter_whole (C, M, Mask_struct, GB_BITMAP_M_SCATTER_PLUS_2,
+        M_ek_slicing, M_ntasks, M_nthreads) ;
+
+    #else
+    const int8_t *restrict Mb = M->b ;
+    const GB_M_TYPE *restrict Mx = (GB_M_TYPE *) (Mask_struct ? NULL : (M->x)) ;
+    size_t msize = M->type->size ;
+    #endif
+
+    //--------------------------------------------------------------------------
+    // C<#M> += A.*B
+    //--------------------------------------------------------------------------
+
+    // cnvals starts with the entries already in C
+    cnvals = C->nvals ;
+
+    int tid ;
+    #pragma omp parallel for num_threads(C_nthreads) schedule(static) \
+        reduction(+:cnvals)
+    for (tid = 0 ; tid < C_nthreads ; tid++)
+    {
+        int64_t pstart, pend, task_cnvals = 0 ;
+        GB_PARTITION (pstart, pend, cnz, tid, C_nthreads) ;
+        for (int64_t p = pstart ; p < pend ; p++)
+        {
+
+            //------------------------------------------------------------------
+            // get M(i,j) and skip C(i,j) if the mask is false
+            //------------------------------------------------------------------
+
+            #if GB_NO_MASK
+            { 
+                // no mask
+            }
+            #elif GB_M_IS_SPARSE || GB_M_IS_HYPER
+            {
+                int8_t cb = Cb [p] ;
+                if (cb >= 2)
+                { 
+                    // !M(i,j) is false: restore Cb [p] and skip C(i,j)
+                    Cb [p] = cb - 2 ;
+                    continue ;
+                }
+            }
+            #else
+            {
+                bool mij = GBB_M (Mb, p) && GB_MCAST (Mx, p, msize) ;
+                if (mij == Mask_comp) continue ;
+            }
+            #endif
+
+            //------------------------------------------------------------------
+            // C(i,j) += A(i,j).*B(i,j)
+            //------------------------------------------------------------------
+
+            if (GBB_A (Ab, p) && GBB_B (Bb, p))
+            {
+                GB_DECLAREA (aij) ;
+                GB_GETA (aij, Ax, p, A_iso) ;
+                GB_DECLAREB (bij) ;
+                GB_GETB (bij, Bx, p, B_iso) ;
+                if (Cb [p])
+                { 
+                    // C(i,j) = C(i,j) + (A(i,j) .* B(i,j))
+                    GB_C_TYPE t ;
+                    GB_BINOP (t, aij, bij, p % vlen, p / vlen) ;
+                    GB_C_TYPE cij = Cx [p] ;
+                    GB_BINOP (Cx [p], cij, t, p % vlen, p / vlen) ;
+                }
+                else
+                { 
+                    // C(i,j) = A(i,j) .* B(i,j)
+                    GB_BINOP (Cx [p], aij, bij, p % vlen, p / vlen) ;
+                    Cb [p] = 1 ;
+                    task_cnvals++ ;
+                }
+            }
+        }
+        cnvals += task_cnvals ;
+    }
+}
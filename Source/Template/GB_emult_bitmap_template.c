@@ -7,7 +7,8 @@
 
 //------------------------------------------------------------------------------
 
-// C is bitmap.  A and B are bitmap or full.  M depends on the method
+// C is bitmap.  A and B are bitmap or full.  M depends on the method.
+// If GB_C_IN_PLACE is true (JIT only), C<#M>+=A.*B is computed in place.
 
 {
 
@@ -52,13 +53,16 @@
     // C=A.*B, C<M>=A.*B, or C<!M>=A.*B: C is bitmap
     //--------------------------------------------------------------------------
 
-    // TODO modify this method so it can modify C in-place, and also use the
-    // accum operator.
     int64_t cnvals = 0 ;
 
     #ifdef GB_JIT_KERNEL
     {
-        #if GB_NO_MASK
+        #if GB_C_IN_PLACE
+        {
+            // C<#M>+=A.*B, in place; C bitmap, A and B are bitmap/full
+            #include "GB_emult_bitmap_accum_template.c"
+        }
+        #elif GB_NO_MASK
         {
             // C=A.*B; C bitmap, M not present, A and B are bitmap/full
             #include "GB_emult_bitmap_5.c"
@@ -0,0 +1,127 @@
+//------------------------------------------------------------------------------
+// GB_intersect_template.c: intersect two sorted lists, in blocks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The two lists are compared in blocks of GB_W entries each.  All GB_W*GB_W
+// pairs in the two blocks are compared at once, with no branches, which the
+// compiler vectorizes with the target of the #include'ing function (AVX2 or
+// AVX512F).  The block with the smaller last entry is then discarded (or both
+// if their last entries are equal).  The tails of the two lists (with fewer
+// than GB_W entries left in either one) are merged one entry at a time.
+
+// The #include'ing file defines GB_W, GB_INTERSECT_COUNT, and
+// GB_INTERSECT_CHUNK, the names of the two functions.
+
+//------------------------------------------------------------------------------
+// GB_INTERSECT_COUNT: count the entries in both lists
+//------------------------------------------------------------------------------
+
+GB_INTERSECT_TARGET static int64_t GB_INTERSECT_COUNT
+(
+    const int64_t *restrict Ai,
+    const int64_t anz,
+    const int64_t *restrict Bi,
+    const int64_t bnz
+)
+{
+    int64_t pa = 0, pb = 0, n = 0 ;
+    while (pa + GB_W <= anz && pb + GB_W <= bnz)
+    {
+        const int64_t *restrict a = Ai + pa ;
+        const int64_t *restrict b = Bi + pb ;
+        // compare each entry of the block a with b [t], for all t
+        int64_t c [GB_W] ;
+        for (int s = 0 ; s < GB_W ; s++) c [s] = 0 ;
+        for (int t = 0 ; t < GB_W ; t++)
+        {
+            const int64_t bt = b [t] ;
+            for (int s = 0 ; s < GB_W ; s++)
+            {
+                c [s] += (a [s] == bt) ;
+            }
+        }
+        for (int s = 0 ; s < GB_W ; s++) n += c [s] ;
+        const int64_t alast = a [GB_W-1] ;
+        const int64_t blast = b [GB_W-1] ;
+        pa += (alast <= blast) ? GB_W : 0 ;
+        pb += (blast <= alast) ? GB_W : 0 ;
+    }
+    return (n + GB_intersect_merge_count (Ai + pa, anz - pa, Bi + pb,
+        bnz - pb)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_INTERSECT_CHUNK: find the next matches in the two lists
+//------------------------------------------------------------------------------
+
+GB_INTERSECT_TARGET static int64_t GB_INTERSECT_CHUNK
+(
+    int64_t *restrict Pa,
+    int64_t *restrict Pb,
+    int64_t *pA,
+    int64_t *pB,
+    const int64_t *restrict Ai,
+    const int64_t pA_end,
+    const int64_t *restrict Bi,
+    const int64_t pB_end,
+    const int64_t nmax
+)
+{
+    int64_t pa = (*pA), pb = (*pB), n = 0 ;
+    while (pa + GB_W <= pA_end && pb + GB_W <= pB_end && n + GB_W <= nmax)
+    {
+        const int64_t *restrict a = Ai + pa ;
+        const int64_t *restrict b = Bi + pb ;
+        // found [s] is nonzero if a [s] appears in the block b
+        int64_t found [GB_W] ;
+        for (int s = 0 ; s < GB_W ; s++) found [s] = 0 ;
+        for (int t = 0 ; t < GB_W ; t++)
+        {
+            const int64_t bt = b [t] ;
+            for (int s = 0 ; s < GB_W ; s++)
+            {
+                found [s] |= (a [s] == bt) ;
+            }
+        }
+        // bit s of hit is set if a [s] appears in the block b
+        uint32_t hit = 0 ;
+        for (int s = 0 ; s < GB_W ; s++)
+        {
+            hit |= ((uint32_t) found [s] << s) ;
+        }
+        if (hit != 0)
+        {
+            // find the matching entries in b, in order
+            int t = 0 ;
+            for (int s = 0 ; s < GB_W ; s++)
+            {
+                if (hit & (1u << s))
+                {
+                    while (b [t] < a [s]) t++ ;
+                    Pa [n] = pa + s ;
+                    Pb [n] = pb + t ;
+                    n++ ;
+                }
+            }
+        }
+        const int64_t alast = a [GB_W-1] ;
+        const int64_t blast = b [GB_W-1] ;
+        pa += (alast <= blast) ? GB_W : 0 ;
+        pb += (blast <= alast) ? GB_W : 0 ;
+    }
+    (*pA) = pa ;
+    (*pB) = pb ;
+    return (n + GB_intersect_merge_chunk (Pa + n, Pb + n, pA, pB, Ai, pA_end,
+        Bi, pB_end, nmax - n)) ;
+}
+
+#undef GB_W
+#undef GB_INTERSECT_TARGET
+#undef GB_INTERSECT_COUNT
+#undef GB_INTERSECT_CHUNK
+
@@ -95,7 +95,8 @@ GrB_Info GB_jit_kernel_AxB_dot2                                         \
     const int64_t *restrict B_slice,                                    \
     const int nthreads,                                                 \
     const int naslice,                                                  \
-    const int nbslice                                                   \
+    const int nbslice,                                                  \
+    const GB_callback_struct *restrict my_callback                      \
 )
 
 #define GB_JIT_KERNEL_AXB_DOT2N_PROTO(GB_jit_kernel_AxB_dot2n)          \
@@ -121,7 +122,8 @@ GrB_Info GB_jit_kernel_AxB_dot3                                         \
     const GrB_Matrix B,                                                 \
     const GB_task_struct *restrict TaskList,                            \
     const int ntasks,                                                   \
-    const int nthreads                                                  \
+    const int nthreads,                                                 \
+    const GB_callback_struct *restrict my_callback                      \
 )
 
 #define GB_JIT_KERNEL_AXB_DOT4_PROTO(GB_jit_kernel_AxB_dot4)            \
@@ -35,6 +35,8 @@ typedef struct
     char **logger_handle ;          // error report
     size_t *logger_size_handle ;
     int pwerk ;                     // top of Werk stack, initially zero
+    struct GB_saxpy3_plan_struct **plan_handle ;  // saxpy3 plan (see
+    size_t *plan_size_handle ;      // GB_AxB_saxpy3_plan.c), or NULL
 }
 GB_Werk_struct ;
 
@@ -116,7 +116,7 @@ void mexFunction
 
     GB_jit_encoding e ;
     char *suffix ;
-    uint64_t code = GB_encodify_mxm (&e, &suffix, 0, false, false, GxB_SPARSE,
+    uint64_t code = GB_encodify_mxm (&e, &suffix, 0, false, false, false, GxB_SPARSE,
         GrB_FP32, NULL, false, false, s, false, A, B) ;
     CHECK (code == UINT64_MAX) ;
 
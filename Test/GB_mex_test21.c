@@ -129,7 +129,8 @@ void mexFunction
     fprintf (fp, "GB_enumify_ewise / GB_macrofy_ewise, C iso\n") ;
     printf ("GB_enumify_ewise / GB_macrofy_ewise, C iso\n") ;
     GB_enumify_ewise (&scode, false, false, true, /* C_iso: */ true,
-        /* C_in_iso: */ false, GxB_SPARSE, GrB_BOOL, /* M: */ NULL,
+        /* C_in_iso: */ false, /* C_in_place: */ false, GxB_SPARSE,
+        GrB_BOOL, /* M: */ NULL,
         false, false, GrB_LAND, false, A, B) ;
 //  printf ("ewise  scode: %016" PRIx64 "\n", scode) ;
     GB_macrofy_ewise (fp, scode, GrB_LAND, GrB_BOOL, GrB_BOOL, GrB_BOOL) ;
@@ -138,7 +139,8 @@ void mexFunction
     fprintf (fp, "GB_enumify_ewise / GB_macrofy_ewise, C non iso\n") ;
     printf ("GB_enumify_ewise / GB_macrofy_ewise, C non iso\n") ;
     GB_enumify_ewise (&scode, false, false, true, /* C_iso: */ false,
-        /* C_in_iso: */ false, GxB_SPARSE, GrB_BOOL, /* M: */ NULL,
+        /* C_in_iso: */ false, /* C_in_place: */ false, GxB_SPARSE,
+        GrB_BOOL, /* M: */ NULL,
         false, false, GrB_LAND, false, A, B) ;
 //  printf ("ewise  scode: %016" PRIx64 "\n", scode) ;
     GB_macrofy_ewise (fp, scode, GrB_LAND, GrB_BOOL, GrB_BOOL, GrB_BOOL) ;
@@ -151,7 +153,7 @@ void mexFunction
     fprintf (fp, "GB_enumify_mxm / GB_macrofy_mxm, C iso\n") ;
     printf ("GB_enumify_mxm / GB_macrofy_mxm, C iso\n") ;
     GB_enumify_mxm (&scode, /* C_iso: */ true, /* C_in_iso: */ true,
-        GxB_SPARSE, GrB_BOOL, /* M: */ NULL, false, false,
+        /* C_in_place: */ false, GxB_SPARSE, GrB_BOOL, /* M: */ NULL, false, false,
         GrB_LAND_LOR_SEMIRING_BOOL, /* flipxy: */ true, A, B) ;
 //  printf ("mxm    scode: %016" PRIx64 "\n", scode) ;
     GB_macrofy_mxm (fp, scode, GrB_LAND_LOR_SEMIRING_BOOL,
@@ -161,7 +163,7 @@ void mexFunction
     fprintf (fp, "GB_enumify_mxm / GB_macrofy_mxm, any_pair, flipxy\n") ;
     printf ("GB_enumify_mxm / GB_macrofy_mxm, any_pair, flipxy\n") ;
     GB_enumify_mxm (&scode, /* C_iso: */ true, /* C_in_iso: */ false,
-        GxB_SPARSE, GrB_BOOL, /* M: */ NULL, false, false,
+        /* C_in_place: */ false, GxB_SPARSE, GrB_BOOL, /* M: */ NULL, false, false,
         GxB_ANY_PAIR_BOOL, /* flipxy: */ true, A, B) ;
 //  printf ("mxm    scode: %016" PRIx64 "\n", scode) ;
     GB_macrofy_mxm (fp, scode, GxB_ANY_PAIR_BOOL,
@@ -171,7 +173,7 @@ void mexFunction
     fprintf (fp, "GB_enumify_mxm / GB_macrofy_mxm, any_pair fp32\n") ;
     printf ("GB_enumify_mxm / GB_macrofy_mxm, any_pair fp32\n") ;
     GB_enumify_mxm (&scode, /* C_iso: */ false, /* C_in_iso: */ false,
-        GxB_SPARSE, GrB_FP32, /* M: */ NULL, false, false,
+        /* C_in_place: */ false, GxB_SPARSE, GrB_FP32, /* M: */ NULL, false, false,
         GxB_ANY_PAIR_FP32, /* flipxy: */ true, A, B) ;
 //  printf ("mxm    scode: %016" PRIx64 "\n", scode) ;
     GB_macrofy_mxm (fp, scode, GxB_ANY_PAIR_FP32,
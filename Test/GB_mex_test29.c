@@ -371,6 +371,29 @@ void mexFunction
     OK (GrB_Global_get_SIZE_ (GrB_GLOBAL, &size, GxB_JIT_CACHE_PATH)) ;
     CHECK (size == strlen (defn) + 1) ;
 
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, defn, GxB_JIT_MANIFEST)) ;
+    printf ("JIT manifest: [%s]\n", defn) ;
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, "/tmp/manifest.txt",
+        GxB_JIT_MANIFEST)) ;
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, defn2, GxB_JIT_MANIFEST)) ;
+    CHECK (MATCH (defn2, "/tmp/manifest.txt")) ;
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, defn, GxB_JIT_MANIFEST)) ;
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, defn2, GxB_JIT_MANIFEST)) ;
+    CHECK (MATCH (defn2, defn)) ;
+
+    // the embedded compiler cannot be a library that does not exist
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Global_set_String_ (GrB_GLOBAL, "no_such_libtcc.so",
+        GxB_JIT_C_EMBEDDED)) ;
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, defn2, GxB_JIT_C_EMBEDDED)) ;
+    CHECK (MATCH (defn2, "")) ;
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, "", GxB_JIT_C_EMBEDDED)) ;
+
+    // a bundle cannot be created from a trace that does not exist
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Global_set_String_ (GrB_GLOBAL, "/tmp/no_such_trace",
+        GxB_JIT_BUNDLE)) ;
+
     double sw [GxB_NBITMAP_SWITCH] ;
     double s2 [GxB_NBITMAP_SWITCH] ;
     OK (GrB_Global_get_SIZE_ (GrB_GLOBAL, &size, GxB_BITMAP_SWITCH)) ;
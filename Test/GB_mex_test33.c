@@ -40,6 +40,7 @@ void mexFunction
     size_t size ;
     char name [256] ;
     char defn [2048] ;
+    char profile [8192], profile2 [8192] ;
     int32_t code, i ;
     float fvalue ;
     double dvalue ;
@@ -138,6 +139,140 @@ void mexFunction
     OK (GxB_Context_get_SIZE_ (context, &size, GrB_NAME)) ;
     CHECK (size == strlen (name) + 1) ;
 
+    //--------------------------------------------------------------------------
+    // NUMA policy
+    //--------------------------------------------------------------------------
+
+    int32_t numa = -1 ;
+    OK (GxB_Context_get_INT_ (GxB_CONTEXT_WORLD, &numa, GxB_NUMA_POLICY)) ;
+    CHECK (numa == GxB_NUMA_DEFAULT) ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &numa, GxB_NUMA_POLICY)) ;
+    CHECK (numa == GxB_NUMA_DEFAULT) ;
+
+    OK (GxB_Context_set_INT_ (context, (int32_t) GxB_NUMA_INTERLEAVE,
+        GxB_NUMA_POLICY)) ;
+    OK (GxB_Context_get_INT_ (context, &numa, GxB_NUMA_POLICY)) ;
+    CHECK (numa == GxB_NUMA_INTERLEAVE) ;
+    OK (GxB_Context_get_INT_ (GxB_CONTEXT_WORLD, &numa, GxB_NUMA_POLICY)) ;
+    CHECK (numa == GxB_NUMA_DEFAULT) ;
+
+    OK (GrB_Scalar_setElement_INT32 (s_int32, GxB_NUMA_FIRST_TOUCH)) ;
+    OK (GxB_Context_set_Scalar_ (context, s_int32, GxB_NUMA_POLICY)) ;
+    OK (GxB_Context_get_Scalar_ (context, s_fp64, GxB_NUMA_POLICY)) ;
+    OK (GrB_Scalar_extractElement_FP64 (&dvalue, s_fp64)) ;
+    CHECK (dvalue == GxB_NUMA_FIRST_TOUCH) ;
+    OK (GxB_Context_fprint (context, "context", 3, NULL)) ;
+
+    // an invalid policy is the same as the default
+    OK (GxB_Context_set_INT_ (context, 99, GxB_NUMA_POLICY)) ;
+    OK (GxB_Context_get_INT_ (context, &numa, GxB_NUMA_POLICY)) ;
+    CHECK (numa == GxB_NUMA_DEFAULT) ;
+
+    // use each policy to allocate and clear a large matrix
+    for (int policy = GxB_NUMA_DEFAULT ; policy <= GxB_NUMA_LOCAL ; policy++)
+    {
+        OK (GrB_Global_set_INT32_ (GrB_GLOBAL, policy, GxB_NUMA_POLICY)) ;
+        OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &numa, GxB_NUMA_POLICY)) ;
+        CHECK (numa == policy) ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, 2000, 2000)) ;
+        OK (GrB_Matrix_assign_FP64 (A, NULL, NULL, 0, GrB_ALL, 2000,
+            GrB_ALL, 2000, NULL)) ;
+        OK (GrB_Matrix_setElement_FP64 (A, 1, 3, 4)) ;
+        OK (GrB_Matrix_extractElement_FP64 (&dvalue, A, 3, 4)) ;
+        CHECK (dvalue == 1) ;
+        OK (GrB_Matrix_free (&A)) ;
+    }
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, (int32_t) GxB_NUMA_DEFAULT,
+        GxB_NUMA_POLICY)) ;
+
+    //--------------------------------------------------------------------------
+    // tuner
+    //--------------------------------------------------------------------------
+
+    int32_t tuner = -1 ;
+    OK (GxB_Context_get_INT_ (context, &tuner, GxB_TUNER)) ;
+    CHECK (tuner == 0) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Context_get_SIZE_ (context, &size, GxB_TUNER_PROFILE)) ;
+    ERR (GxB_Context_get_String_ (context, profile, GxB_TUNER_PROFILE)) ;
+
+    OK (GxB_Context_set_INT_ (context, 1, GxB_TUNER)) ;
+    OK (GxB_Context_get_INT_ (context, &tuner, GxB_TUNER)) ;
+    CHECK (tuner == 1) ;
+
+    // the size of the profile must be queried before it is exported
+    expected = GrB_INSUFFICIENT_SPACE ;
+    ERR (GxB_Context_get_String_ (context, profile, GxB_TUNER_PROFILE)) ;
+
+    OK (GxB_Context_get_Scalar_ (context, s_fp64, GxB_TUNER)) ;
+    OK (GrB_Scalar_extractElement_FP64 (&dvalue, s_fp64)) ;
+    CHECK (dvalue == 1) ;
+
+    // query the size of the profile, then compute with the tuned context
+    OK (GxB_Context_get_SIZE_ (context, &size, GxB_TUNER_PROFILE)) ;
+    size_t size0 = size ;
+    OK (GxB_Context_engage (context)) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, 100, 100)) ;
+    OK (GrB_Matrix_assign_FP64 (A, NULL, NULL, 1, GrB_ALL, 100,
+        GrB_ALL, 100, NULL)) ;
+    for (int trial = 0 ; trial < 40 ; trial++)
+    {
+        OK (GrB_mxm (A, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+            NULL)) ;
+        OK (GrB_Matrix_apply (A, NULL, NULL, GrB_MINV_FP64, A, NULL)) ;
+        OK (GrB_Matrix_reduce_FP64 (&dvalue, NULL, GrB_PLUS_MONOID_FP64, A,
+            NULL)) ;
+    }
+    OK (GxB_Context_disengage (context)) ;
+    OK (GrB_Matrix_free (&A)) ;
+
+    // the profile has grown since its size was queried, so it is not exported
+    memset (profile, 'x', 8192) ;
+    expected = GrB_INSUFFICIENT_SPACE ;
+    ERR (GxB_Context_get_String_ (context, profile, GxB_TUNER_PROFILE)) ;
+    CHECK (profile [0] == '\0') ;
+    for (int k = size0 ; k < 8192 ; k++)
+    {
+        // nothing is written past the size given by the last query
+        CHECK (profile [k] == 'x') ;
+    }
+
+    // export the profile and import it into another context
+    OK (GxB_Context_get_SIZE_ (context, &size, GxB_TUNER_PROFILE)) ;
+    CHECK (size > 0 && size <= 8192) ;
+    OK (GxB_Context_get_String_ (context, profile, GxB_TUNER_PROFILE)) ;
+    CHECK (strlen (profile) + 1 == size) ;
+    printf ("tuner profile:\n%s", profile) ;
+    OK (GxB_Context_fprint (context, "tuned context", 3, NULL)) ;
+    OK (GxB_Context_set_String_ (GxB_CONTEXT_WORLD, profile,
+        GxB_TUNER_PROFILE)) ;
+    OK (GxB_Context_get_INT_ (GxB_CONTEXT_WORLD, &tuner, GxB_TUNER)) ;
+    CHECK (tuner == 1) ;
+    OK (GxB_Context_get_SIZE_ (GxB_CONTEXT_WORLD, &size, GxB_TUNER_PROFILE)) ;
+    CHECK (strlen (profile) + 1 == size) ;
+    OK (GxB_Context_get_String_ (GxB_CONTEXT_WORLD, profile2, GxB_TUNER_PROFILE));
+    CHECK (MATCH (profile, profile2)) ;
+
+    // an invalid profile leaves the tuner unchanged
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Context_set_String_ (GxB_CONTEXT_WORLD, "garbage",
+        GxB_TUNER_PROFILE)) ;
+    ERR (GxB_Context_set_String_ (GxB_CONTEXT_WORLD,
+        "GraphBLAS tuner profile v1 hyper_switch 0.0625", GxB_TUNER_PROFILE)) ;
+    OK (GxB_Context_get_String_ (GxB_CONTEXT_WORLD, profile2, GxB_TUNER_PROFILE));
+    CHECK (MATCH (profile, profile2)) ;
+
+    OK (GxB_Context_set_INT_ (GxB_CONTEXT_WORLD, 0, GxB_TUNER)) ;
+    OK (GxB_Context_set_INT_ (context, 0, GxB_TUNER)) ;
+    OK (GxB_Context_get_INT_ (context, &tuner, GxB_TUNER)) ;
+    CHECK (tuner == 0) ;
+
+    // an invalid profile does not enable the tuner
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Context_set_String_ (context, "garbage", GxB_TUNER_PROFILE)) ;
+    OK (GxB_Context_get_INT_ (context, &tuner, GxB_TUNER)) ;
+    CHECK (tuner == 0) ;
+
     //--------------------------------------------------------------------------
     // finalize GraphBLAS
     //--------------------------------------------------------------------------
@@ -0,0 +1,241 @@
+//------------------------------------------------------------------------------
+// GB_mex_test36: test bitmap C+=A*B computed in place
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C+=A*B and C+=A'*B, where C is bitmap, no mask is present, and the accum is
+// the same as the monoid of the semiring, are computed in place by the saxbit
+// and dot2 methods.  Each result is compared with T=A*B computed into a new
+// matrix, followed by C=C+T with GrB_eWiseAdd.  All values are small integers,
+// so the results are exact regardless of the order of summation.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_stringify.h"
+
+#define USAGE "GB_mex_test36"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&T) ;              \
+    GrB_Descriptor_free (&desc) ;       \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix with small integer values
+//------------------------------------------------------------------------------
+
+static uint64_t seed = 1 ;
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Type type,
+    GrB_Index nrows,
+    GrB_Index ncols,
+    double density,
+    int sparsity
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+    info = GrB_Matrix_new (&A, type, nrows, ncols) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    for (GrB_Index i = 0 ; i < nrows ; i++)
+    {
+        for (GrB_Index j = 0 ; j < ncols ; j++)
+        {
+            seed = seed * 1103515245 + 12345 ;
+            double x = ((seed >> 16) % 32768) / 32768.0 ;
+            if (x < density)
+            {
+                int32_t aij = (int32_t) ((seed >> 20) % 7) - 3 ;
+                info = GrB_Matrix_setElement_INT32 (A, aij, i, j) ;
+                if (info != GrB_SUCCESS) break ;
+            }
+        }
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_set_INT32 (A, sparsity, GxB_SPARSITY_CONTROL) ;
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_wait (A, GrB_MATERIALIZE) ;
+    }
+    if (info != GrB_SUCCESS)
+    {
+        GrB_Matrix_free (&A) ;
+    }
+    (*A_handle) = A ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL, C1 = NULL, C2 = NULL, T = NULL ;
+    GrB_Descriptor desc = NULL ;
+    int save_control ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &save_control)) ;
+
+    //--------------------------------------------------------------------------
+    // the in-place kernels have their own JIT encoding
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, GrB_FP64, 10, 10, 0.3, GxB_SPARSE)) ;
+    OK (random_matrix (&B, GrB_FP64, 10, 10, 0.3, GxB_SPARSE)) ;
+    uint64_t scode1, scode2 ;
+    GB_enumify_mxm (&scode1, false, false, /* C_in_place: */ false,
+        GxB_BITMAP, GrB_FP64, NULL, false, false,
+        GrB_PLUS_TIMES_SEMIRING_FP64, false, A, B) ;
+    GB_enumify_mxm (&scode2, false, false, /* C_in_place: */ true,
+        GxB_BITMAP, GrB_FP64, NULL, false, false,
+        GrB_PLUS_TIMES_SEMIRING_FP64, false, A, B) ;
+    CHECK (scode1 != scode2) ;
+    CHECK ((scode1 ^ scode2) == ((uint64_t) 1 << 63)) ;
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&B)) ;
+
+    //--------------------------------------------------------------------------
+    // C+=A*B and C+=A'*B with a bitmap C
+    //--------------------------------------------------------------------------
+
+    GrB_Type types [3] = { GrB_FP64, GrB_INT64, GrB_INT32 } ;
+    GrB_Semiring semirings [3] = { GrB_PLUS_TIMES_SEMIRING_FP64,
+        GrB_PLUS_TIMES_SEMIRING_INT64, GrB_MAX_PLUS_SEMIRING_INT32 } ;
+    GrB_BinaryOp accums [3] = { GrB_PLUS_FP64, GrB_PLUS_INT64,
+        GrB_MAX_INT32 } ;
+    int methods [2] = { GxB_AxB_DOT, GxB_AxB_SAXPY } ;
+    int controls [2] = { GxB_JIT_OFF, GxB_JIT_ON } ;
+
+    for (int jit = 0 ; jit < 2 ; jit++)
+    {
+        OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL,
+            GB_IMIN (controls [jit], save_control))) ;
+
+        for (int k = 0 ; k < 3 ; k++)
+        {
+            GrB_Type type = types [k] ;
+            GrB_Semiring semiring = semirings [k] ;
+            GrB_BinaryOp accum = accums [k] ;
+
+            for (int m = 0 ; m < 2 ; m++)
+            {
+                for (int atrans = 0 ; atrans <= 1 ; atrans++)
+                {
+                    for (int A_sparsity = GxB_SPARSE ;
+                        A_sparsity <= GxB_BITMAP ; A_sparsity *= 2)
+                    {
+
+                        //------------------------------------------------------
+                        // create the problem
+                        //------------------------------------------------------
+
+                        OK (GrB_Descriptor_new (&desc)) ;
+                        OK (GrB_Descriptor_set_INT32 (desc, methods [m],
+                            GxB_AxB_METHOD)) ;
+                        if (atrans)
+                        {
+                            OK (GrB_Descriptor_set_INT32 (desc, GrB_TRAN,
+                                GrB_INP0)) ;
+                        }
+
+                        OK (random_matrix (&A, type, 40, 30, 0.2,
+                            A_sparsity)) ;
+                        OK (random_matrix (&B, type, atrans ? 40 : 30, 20, 0.2,
+                            GxB_SPARSE)) ;
+                        OK (random_matrix (&C, type, atrans ? 30 : 40, 20, 0.5,
+                            GxB_BITMAP)) ;
+
+                        //------------------------------------------------------
+                        // C1 += A*B, computed in place
+                        //------------------------------------------------------
+
+                        OK (GrB_Matrix_dup (&C1, C)) ;
+                        OK (GrB_mxm (C1, NULL, accum, semiring, A, B, desc)) ;
+                        OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+
+                        //------------------------------------------------------
+                        // C2 = C + T where T = A*B
+                        //------------------------------------------------------
+
+                        GrB_Index cnrows, cncols ;
+                        OK (GrB_Matrix_nrows (&cnrows, C)) ;
+                        OK (GrB_Matrix_ncols (&cncols, C)) ;
+                        OK (GrB_Matrix_new (&T, type, cnrows, cncols)) ;
+                        OK (GrB_mxm (T, NULL, NULL, semiring, A, B, desc)) ;
+                        OK (GrB_Matrix_dup (&C2, C)) ;
+                        OK (GrB_Matrix_eWiseAdd_BinaryOp (C2, NULL, NULL,
+                            accum, C2, T, NULL)) ;
+                        OK (GrB_Matrix_set_INT32 (C2, GxB_BITMAP,
+                            GxB_SPARSITY_CONTROL)) ;
+                        OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+
+                        //------------------------------------------------------
+                        // check the result
+                        //------------------------------------------------------
+
+                        CHECK (GB_IS_BITMAP (C1)) ;
+                        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+                        //------------------------------------------------------
+                        // C2 = A*B with an out-of-place bitmap C
+                        //------------------------------------------------------
+
+                        // This uses the same semiring and types as the
+                        // in-place C1 += A*B above, but not the same kernel.
+                        OK (GrB_Matrix_set_INT32 (T, GxB_BITMAP,
+                            GxB_SPARSITY_CONTROL)) ;
+                        OK (GrB_Matrix_wait (T, GrB_MATERIALIZE)) ;
+                        OK (GrB_Matrix_clear (C2)) ;
+                        OK (GrB_mxm (C2, NULL, NULL, semiring, A, B, desc)) ;
+                        OK (GrB_Matrix_set_INT32 (C2, GxB_BITMAP,
+                            GxB_SPARSITY_CONTROL)) ;
+                        OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+                        CHECK (GB_mx_isequal (C2, T, 0)) ;
+
+                        FREE_ALL ;
+                    }
+                }
+            }
+        }
+    }
+
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, save_control)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test36:  all tests passed.\n\n") ;
+}
+
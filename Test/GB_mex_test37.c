@@ -0,0 +1,208 @@
+//------------------------------------------------------------------------------
+// GB_mex_test37: test the cached transpose of a matrix with pending work
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_TRANSPOSE_CACHE is enabled on matrices with pending tuples, zombies, or
+// jumbled vectors, which are then used by GrB_transpose, GrB_mxv, and a change
+// of format.  A->T is not built until the pending work is finished.  Each
+// result is compared with the same computation on a matrix without the cache.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test37"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Vector_free (&u) ;              \
+    GrB_Vector_free (&w1) ;             \
+    GrB_Vector_free (&w2) ;             \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 20
+
+//------------------------------------------------------------------------------
+// pending_matrix: create a matrix with pending tuples and zombies
+//------------------------------------------------------------------------------
+
+static GrB_Info pending_matrix (GrB_Matrix *A_handle)
+{
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+    info = GrB_Matrix_new (&A, GrB_INT64, N, N) ;
+    // a diagonal, which is finished
+    for (int64_t i = 0 ; i < N && info == GrB_SUCCESS ; i++)
+    {
+        info = GrB_Matrix_setElement_INT64 (A, i+1, i, i) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (A, GrB_MATERIALIZE) ;
+    // pending tuples
+    for (int64_t i = 0 ; i < N && info == GrB_SUCCESS ; i++)
+    {
+        info = GrB_Matrix_setElement_INT64 (A, 2*i, i, (3*i+1) % N) ;
+    }
+    // zombies
+    for (int64_t i = 0 ; i < N && info == GrB_SUCCESS ; i += 3)
+    {
+        info = GrB_Matrix_removeElement (A, i, i) ;
+    }
+    if (info != GrB_SUCCESS) GrB_Matrix_free (&A) ;
+    (*A_handle) = A ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Vector u = NULL, w1 = NULL, w2 = NULL ;
+    int32_t fmt ;
+
+    //--------------------------------------------------------------------------
+    // GrB_transpose of a matrix with pending work
+    //--------------------------------------------------------------------------
+
+    OK (pending_matrix (&A)) ;
+    OK (pending_matrix (&B)) ;
+    CHECK (GB_PENDING (A) && GB_ZOMBIES (A)) ;
+    OK (GrB_Matrix_set_INT32 (A, true, GxB_TRANSPOSE_CACHE)) ;
+    CHECK (GB_PENDING (A) && A->T == NULL) ;
+
+    OK (GrB_Matrix_new (&C1, GrB_INT64, N, N)) ;
+    OK (GrB_Matrix_new (&C2, GrB_INT64, N, N)) ;
+    OK (GrB_transpose (C1, NULL, NULL, A, NULL)) ;
+    OK (GrB_transpose (C2, NULL, NULL, B, NULL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    // C += A' with an accum operator
+    OK (GrB_Matrix_setElement_INT64 (A, 99, 1, 2)) ;
+    OK (GrB_Matrix_setElement_INT64 (B, 99, 1, 2)) ;
+    CHECK (GB_PENDING (A) && A->T == NULL) ;
+    OK (GrB_transpose (C1, NULL, GrB_PLUS_INT64, A, NULL)) ;
+    OK (GrB_transpose (C2, NULL, GrB_PLUS_INT64, B, NULL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    // A->T is built once the pending work is finished
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (!GB_ANY_PENDING_WORK (A) && A->T != NULL) ;
+    OK (GrB_transpose (C1, NULL, NULL, A, NULL)) ;
+    OK (GrB_transpose (C2, NULL, NULL, B, NULL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+    FREE_ALL ;
+
+    //--------------------------------------------------------------------------
+    // change the format of a matrix with pending work
+    //--------------------------------------------------------------------------
+
+    OK (pending_matrix (&A)) ;
+    OK (pending_matrix (&B)) ;
+    OK (GrB_Matrix_set_INT32 (A, true, GxB_TRANSPOSE_CACHE)) ;
+    OK (GrB_Matrix_set_INT32 (A, GrB_ROWMAJOR,
+        GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (B, GrB_ROWMAJOR,
+        GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_get_INT32 (A, &fmt, GrB_STORAGE_ORIENTATION_HINT)) ;
+    CHECK (fmt == GrB_ROWMAJOR) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, B, 0)) ;
+
+    OK (GrB_Matrix_setElement_INT64 (A, 7, 3, 4)) ;
+    OK (GrB_Matrix_setElement_INT64 (B, 7, 3, 4)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (B, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, B, 0)) ;
+    FREE_ALL ;
+
+    //--------------------------------------------------------------------------
+    // GrB_mxv with a jumbled matrix
+    //--------------------------------------------------------------------------
+
+    // A = B*B is computed by saxpy3, and left jumbled
+    OK (pending_matrix (&B)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_new (&A, GrB_INT64, N, N)) ;
+    OK (GrB_Matrix_set_INT32 (A, GxB_SPARSE, GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (A, true, GxB_TRANSPOSE_CACHE)) ;
+    OK (GrB_mxm (A, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, B, B,
+        GrB_DESC_S)) ;
+    OK (GrB_Matrix_new (&C2, GrB_INT64, N, N)) ;
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, B, B,
+        NULL)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+
+    OK (GrB_Vector_new (&u, GrB_INT64, N)) ;
+    OK (GrB_Vector_new (&w1, GrB_INT64, N)) ;
+    OK (GrB_Vector_new (&w2, GrB_INT64, N)) ;
+    for (int64_t i = 0 ; i < N ; i += 2)
+    {
+        OK (GrB_Vector_setElement_INT64 (u, i, i)) ;
+    }
+    OK (GrB_Vector_wait (u, GrB_MATERIALIZE)) ;
+
+    for (int trial = 0 ; trial < 2 ; trial++)
+    {
+        // w1 = A*u, which may use A->T (pull), and w2 = C2*u
+        OK (GrB_mxv (w1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, u,
+            NULL)) ;
+        OK (GrB_mxv (w2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, C2, u,
+            NULL)) ;
+        OK (GrB_Vector_wait (w1, GrB_MATERIALIZE)) ;
+        OK (GrB_Vector_wait (w2, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal ((GrB_Matrix) w1, (GrB_Matrix) w2, 0)) ;
+        // w1 = A'*u, and w2 = C2'*u
+        OK (GrB_mxv (w1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, u,
+            GrB_DESC_T0)) ;
+        OK (GrB_mxv (w2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, C2, u,
+            GrB_DESC_T0)) ;
+        OK (GrB_Vector_wait (w1, GrB_MATERIALIZE)) ;
+        OK (GrB_Vector_wait (w2, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal ((GrB_Matrix) w1, (GrB_Matrix) w2, 0)) ;
+        // the second trial uses a finished A
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    }
+
+    FREE_ALL ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test37:  all tests passed.\n\n") ;
+}
+
@@ -0,0 +1,222 @@
+//------------------------------------------------------------------------------
+// GB_mex_test38: test GxB_mxv_batch
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_mxv_batch is compared with k separate calls to GrB_mxv, with and
+// without an accum operator, and with A transposed or not.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test38"
+
+#define K 5
+#define NROWS 30
+#define NCOLS 20
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free (&A) ;                      \
+    for (int j = 0 ; j < K ; j++)               \
+    {                                           \
+        GrB_Vector_free (&(U [j])) ;            \
+        GrB_Vector_free (&(W1 [j])) ;           \
+        GrB_Vector_free (&(W2 [j])) ;           \
+    }                                           \
+    GrB_Vector_free (&x) ;                      \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+static uint64_t seed = 1 ;
+
+static int64_t irand (void)
+{
+    seed = seed * 1103515245 + 12345 ;
+    return ((int64_t) ((seed >> 16) % 32768)) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector U [K], W1 [K], W2 [K], x = NULL ;
+    for (int j = 0 ; j < K ; j++)
+    {
+        U [j] = NULL ; W1 [j] = NULL ; W2 [j] = NULL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_INT64, NROWS, NCOLS)) ;
+    for (int k = 0 ; k < 100 ; k++)
+    {
+        OK (GrB_Matrix_setElement_INT64 (A, irand ( ) % 9 - 4,
+            irand ( ) % NROWS, irand ( ) % NCOLS)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // compare with GrB_mxv
+    //--------------------------------------------------------------------------
+
+    for (int atrans = 0 ; atrans <= 1 ; atrans++)
+    {
+        GrB_Descriptor desc = atrans ? GrB_DESC_T0 : NULL ;
+        GrB_Index n = atrans ? NROWS : NCOLS ;
+        GrB_Index m = atrans ? NCOLS : NROWS ;
+
+        for (int use_accum = 0 ; use_accum <= 1 ; use_accum++)
+        {
+            GrB_BinaryOp accum = use_accum ? GrB_PLUS_INT64 : NULL ;
+
+            for (int j = 0 ; j < K ; j++)
+            {
+                OK (GrB_Vector_new (&(U [j]), GrB_INT64, n)) ;
+                OK (GrB_Vector_new (&(W1 [j]), GrB_INT64, m)) ;
+                for (int t = 0 ; t < 3 * j ; t++)
+                {
+                    OK (GrB_Vector_setElement_INT64 (U [j], irand ( ) % 5,
+                        irand ( ) % n)) ;
+                    OK (GrB_Vector_setElement_INT64 (W1 [j], irand ( ) % 5,
+                        irand ( ) % m)) ;
+                }
+                OK (GrB_Vector_wait (U [j], GrB_MATERIALIZE)) ;
+                OK (GrB_Vector_dup (&(W2 [j]), W1 [j])) ;
+            }
+
+            // W1[j] = accum (W1[j], A*U[j]), one vector at a time
+            for (int j = 0 ; j < K ; j++)
+            {
+                OK (GrB_mxv (W1 [j], NULL, accum,
+                    GrB_PLUS_TIMES_SEMIRING_INT64, A, U [j], desc)) ;
+                OK (GrB_Vector_wait (W1 [j], GrB_MATERIALIZE)) ;
+            }
+
+            // W2[j] = accum (W2[j], A*U[j]), all at once
+            OK (GxB_mxv_batch (W2, accum, GrB_PLUS_TIMES_SEMIRING_INT64, A,
+                U, K, desc)) ;
+            for (int j = 0 ; j < K ; j++)
+            {
+                OK (GrB_Vector_wait (W2 [j], GrB_MATERIALIZE)) ;
+                OK (GxB_Vector_Option_set (W2 [j], GxB_SPARSITY_CONTROL,
+                    GB_sparsity ((GrB_Matrix) W1 [j]))) ;
+                CHECK (GB_mx_isequal ((GrB_Matrix) W1 [j],
+                    (GrB_Matrix) W2 [j], 0)) ;
+            }
+
+            // W1[j] = A*W1[j], one vector at a time, and W2[j] = A*W2[j] all
+            // at once, where each output W[j] is also the input U[j]
+            if (m == n)
+            {
+                for (int j = 0 ; j < K ; j++)
+                {
+                    OK (GrB_mxv (W1 [j], NULL, accum,
+                        GrB_PLUS_TIMES_SEMIRING_INT64, A, W1 [j], desc)) ;
+                    OK (GrB_Vector_wait (W1 [j], GrB_MATERIALIZE)) ;
+                }
+                OK (GxB_mxv_batch (W2, accum, GrB_PLUS_TIMES_SEMIRING_INT64,
+                    A, W2, K, desc)) ;
+                for (int j = 0 ; j < K ; j++)
+                {
+                    OK (GrB_Vector_wait (W2 [j], GrB_MATERIALIZE)) ;
+                    OK (GxB_Vector_Option_set (W2 [j], GxB_SPARSITY_CONTROL,
+                        GB_sparsity ((GrB_Matrix) W1 [j]))) ;
+                    CHECK (GB_mx_isequal ((GrB_Matrix) W1 [j],
+                        (GrB_Matrix) W2 [j], 0)) ;
+                }
+            }
+
+            for (int j = 0 ; j < K ; j++)
+            {
+                GrB_Vector_free (&(U [j])) ;
+                GrB_Vector_free (&(W1 [j])) ;
+                GrB_Vector_free (&(W2 [j])) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    for (int j = 0 ; j < K ; j++)
+    {
+        OK (GrB_Vector_new (&(U [j]), GrB_INT64, NCOLS)) ;
+        OK (GrB_Vector_new (&(W1 [j]), GrB_INT64, NROWS)) ;
+    }
+    OK (GxB_mxv_batch (W1, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, U, 0,
+        NULL)) ;
+
+    // the output vectors must be distinct
+    GrB_Vector save = W1 [3] ;
+    W1 [3] = W1 [1] ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_mxv_batch (W1, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, U, K,
+        NULL)) ;
+    const char *error ;
+    OK (GrB_Vector_error (&error, W1 [1])) ;
+    printf ("expected error: %s\n", error) ;
+    CHECK (strlen (error) > 0) ;
+    W1 [3] = save ;
+
+    // an error in W[j] is logged in W[j]
+    OK (GrB_Vector_new (&x, GrB_INT64, NROWS + 1)) ;
+    save = W1 [2] ;
+    W1 [2] = x ;
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR (GxB_mxv_batch (W1, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, U, K,
+        NULL)) ;
+    OK (GrB_Vector_error (&error, x)) ;
+    printf ("expected error: %s\n", error) ;
+    CHECK (strlen (error) > 0) ;
+    OK (GrB_Vector_error (&error, W1 [0])) ;
+    CHECK (strlen (error) == 0) ;
+    W1 [2] = save ;
+
+    // the error is cleared by the next successful call
+    OK (GxB_mxv_batch (W1, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, U, K,
+        NULL)) ;
+    OK (GrB_Vector_error (&error, W1 [1])) ;
+    CHECK (strlen (error) == 0) ;
+
+    expected = GrB_NULL_POINTER ;
+    save = W1 [4] ;
+    W1 [4] = NULL ;
+    ERR (GxB_mxv_batch (W1, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, U, K,
+        NULL)) ;
+    W1 [4] = save ;
+    ERR (GxB_mxv_batch (NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, U, K,
+        NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test38:  all tests passed.\n\n") ;
+}
+
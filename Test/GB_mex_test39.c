@@ -0,0 +1,251 @@
+//------------------------------------------------------------------------------
+// GB_mex_test39: test deferred chains of GrB_apply (GxB_DEFER)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A chain of C = op (C) computed with GxB_DEFER enabled is compared with the
+// same chain computed eagerly, for several types, for chains that are shorter
+// and longer than GB_DEFER_MAX, and for a full matrix large enough to be split
+// into several blocks.  The chain is also interrupted by GrB_apply on another
+// matrix, by GrB_extractElement, and by freeing C.  All values are small
+// integers, so the results are exact.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test39"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&D) ;              \
+    GrB_Scalar_free (&s1) ;             \
+    GrB_Scalar_free (&s2) ;             \
+    GrB_Scalar_free (&s3) ;             \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NTYPES 4
+#define NOPS 5
+
+static GrB_Scalar s1 = NULL, s2 = NULL, s3 = NULL ;
+
+//------------------------------------------------------------------------------
+// apply_op: C = op (C) for the kth operator of the chain
+//------------------------------------------------------------------------------
+
+static GrB_Info apply_op
+(
+    GrB_Matrix C,
+    int t,      // type of C
+    int k       // the kth operator of the chain
+)
+{
+    GrB_BinaryOp plus [NTYPES] = { GrB_PLUS_INT32, GrB_PLUS_INT64,
+        GrB_PLUS_UINT8, GrB_PLUS_FP64 } ;
+    GrB_BinaryOp minus [NTYPES] = { GrB_MINUS_INT32, GrB_MINUS_INT64,
+        GrB_MINUS_UINT8, GrB_MINUS_FP64 } ;
+    GrB_BinaryOp times [NTYPES] = { GrB_TIMES_INT32, GrB_TIMES_INT64,
+        GrB_TIMES_UINT8, GrB_TIMES_FP64 } ;
+    GrB_UnaryOp ainv [NTYPES] = { GrB_AINV_INT32, GrB_AINV_INT64,
+        GrB_AINV_UINT8, GrB_AINV_FP64 } ;
+    GrB_UnaryOp abs [NTYPES] = { GrB_ABS_INT32, GrB_ABS_INT64,
+        GrB_ABS_UINT8, GrB_ABS_FP64 } ;
+    switch (k % NOPS)
+    {
+        default:
+        case 0 : return (GrB_Matrix_apply_BinaryOp2nd_Scalar (C, NULL, NULL,
+                    plus [t], C, s1, NULL)) ;
+        case 1 : return (GrB_Matrix_apply_BinaryOp1st_Scalar (C, NULL, NULL,
+                    minus [t], s3, C, NULL)) ;
+        case 2 : return (GrB_Matrix_apply (C, NULL, NULL, ainv [t], C,
+                    NULL)) ;
+        case 3 : return (GrB_Matrix_apply_BinaryOp2nd_Scalar (C, NULL, NULL,
+                    times [t], C, s2, NULL)) ;
+        case 4 : return (GrB_Matrix_apply (C, NULL, NULL, abs [t], C,
+                    NULL)) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix with small integer values
+//------------------------------------------------------------------------------
+
+static uint64_t seed = 1 ;
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Type type,
+    GrB_Index nrows,
+    GrB_Index ncols,
+    double density
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+    info = GrB_Matrix_new (&A, type, nrows, ncols) ;
+    for (GrB_Index j = 0 ; j < ncols && info == GrB_SUCCESS ; j++)
+    {
+        for (GrB_Index i = 0 ; i < nrows && info == GrB_SUCCESS ; i++)
+        {
+            seed = seed * 1103515245 + 12345 ;
+            double x = ((seed >> 16) % 32768) / 32768.0 ;
+            if (x < density)
+            {
+                int32_t aij = (int32_t) ((seed >> 20) % 11) ;
+                info = GrB_Matrix_setElement_INT32 (A, aij, i, j) ;
+            }
+        }
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (A, GrB_MATERIALIZE) ;
+    if (info != GrB_SUCCESS) GrB_Matrix_free (&A) ;
+    (*A_handle) = A ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C1 = NULL, C2 = NULL, D = NULL ;
+    GrB_Type types [NTYPES] = { GrB_INT32, GrB_INT64, GrB_UINT8, GrB_FP64 } ;
+    GrB_Index nrows [2] = { 10, 1000 } ;
+    GrB_Index ncols [2] = { 12, 300 } ;
+    double density [2] = { 0.3, 2 } ;
+    int chain_length [4] = { 1, 3, GB_DEFER_MAX, GB_DEFER_MAX + 4 } ;
+    int32_t defer ;
+
+    OK (GxB_Context_get_INT_ (GxB_CONTEXT_WORLD, &defer, GxB_DEFER)) ;
+    CHECK (!defer) ;
+
+    for (int t = 0 ; t < NTYPES ; t++)
+    {
+        GrB_Type type = types [t] ;
+        OK (GrB_Scalar_new (&s1, type)) ;
+        OK (GrB_Scalar_new (&s2, type)) ;
+        OK (GrB_Scalar_new (&s3, type)) ;
+        OK (GrB_Scalar_setElement_INT32 (s1, 1)) ;
+        OK (GrB_Scalar_setElement_INT32 (s2, 2)) ;
+        OK (GrB_Scalar_setElement_INT32 (s3, 3)) ;
+
+        for (int m = 0 ; m < 2 ; m++)
+        {
+            // A is sparse and small, or full and split into several blocks
+            OK (random_matrix (&A, type, nrows [m], ncols [m], density [m])) ;
+
+            for (int c = 0 ; c < 4 ; c++)
+            {
+                int nops = chain_length [c] ;
+
+                //--------------------------------------------------------------
+                // C2 = the chain of operators, computed eagerly
+                //--------------------------------------------------------------
+
+                OK (GrB_Matrix_dup (&C2, A)) ;
+                for (int k = 0 ; k < nops ; k++)
+                {
+                    OK (apply_op (C2, t, k)) ;
+                    CHECK (GB_defer_matrix ( ) == NULL) ;
+                }
+
+                //--------------------------------------------------------------
+                // C1 = the chain of operators, deferred
+                //--------------------------------------------------------------
+
+                OK (GrB_Matrix_dup (&C1, A)) ;
+                OK (GxB_Context_set_INT_ (GxB_CONTEXT_WORLD, true, GxB_DEFER)) ;
+                for (int k = 0 ; k < nops ; k++)
+                {
+                    OK (apply_op (C1, t, k)) ;
+                    // the chain is computed when it is full, and this op
+                    // is then computed at once
+                    CHECK (GB_defer_matrix ( ) ==
+                        ((k == GB_DEFER_MAX) ? NULL : C1)) ;
+                }
+                OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+                CHECK (GB_defer_matrix ( ) == NULL) ;
+                OK (GxB_Context_set_INT_ (GxB_CONTEXT_WORLD, false,
+                    GxB_DEFER)) ;
+                CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                GrB_Matrix_free (&C1) ;
+
+                //--------------------------------------------------------------
+                // C1 = the chain, interrupted by other methods
+                //--------------------------------------------------------------
+
+                OK (GrB_Matrix_dup (&C1, A)) ;
+                OK (GrB_Matrix_dup (&D, A)) ;
+                OK (GxB_Context_set_INT_ (GxB_CONTEXT_WORLD, true, GxB_DEFER)) ;
+                for (int k = 0 ; k < nops ; k++)
+                {
+                    OK (apply_op (C1, t, k)) ;
+                    if (k % 3 == 1)
+                    {
+                        // D = op (D) computes the chain of C1, and then
+                        // D = op (D) itself
+                        OK (apply_op (D, t, k)) ;
+                        CHECK (GB_defer_matrix ( ) == NULL) ;
+                    }
+                    else if (k % 3 == 2)
+                    {
+                        // extracting an entry computes the chain of C1
+                        int32_t x ;
+                        info = GrB_Matrix_extractElement_INT32 (&x, C1, 0, 0) ;
+                        CHECK (info == GrB_SUCCESS || info == GrB_NO_VALUE) ;
+                        CHECK (GB_defer_matrix ( ) == NULL) ;
+                    }
+                }
+                OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+                CHECK (GB_defer_matrix ( ) == NULL) ;
+                CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+                // freeing C discards its chain
+                OK (apply_op (C1, t, 0)) ;
+                OK (apply_op (C1, t, 1)) ;
+                CHECK (GB_defer_matrix ( ) == C1) ;
+                OK (GrB_Matrix_free (&C1)) ;
+                CHECK (GB_defer_matrix ( ) == NULL) ;
+                OK (GxB_Context_set_INT_ (GxB_CONTEXT_WORLD, false,
+                    GxB_DEFER)) ;
+
+                GrB_Matrix_free (&C2) ;
+                GrB_Matrix_free (&D) ;
+            }
+            GrB_Matrix_free (&A) ;
+        }
+        GrB_Scalar_free (&s1) ;
+        GrB_Scalar_free (&s2) ;
+        GrB_Scalar_free (&s3) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test39:  all tests passed.\n\n") ;
+}
+
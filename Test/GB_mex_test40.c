@@ -0,0 +1,261 @@
+//------------------------------------------------------------------------------
+// GB_mex_test40: test GxB_Matrix_setElements and GxB_Matrix_removeElements
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Each batch is compared with n calls to GrB_Matrix_setElement (or to
+// GrB_Matrix_assign with an accum operator, if dup is not NULL), and to
+// GrB_Matrix_removeElement.  The tuples are sorted or unsorted, include
+// duplicates, and are typecast from int32_t to the int64_t matrix, with a dup
+// operator of yet another type.  The matrix has pending tuples and zombies
+// before each batch.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test40"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    if (I != NULL) mxFree (I) ;         \
+    if (J != NULL) mxFree (J) ;         \
+    if (X != NULL) mxFree (X) ;         \
+    I = NULL ; J = NULL ; X = NULL ;    \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define M 40
+#define N 50
+#define NTUPLES 1000
+
+static uint64_t seed = 1 ;
+
+static int64_t irand (void)
+{
+    seed = seed * 1103515245 + 12345 ;
+    return ((int64_t) ((seed >> 16) % 32768)) ;
+}
+
+//------------------------------------------------------------------------------
+// same: check if two int64 matrices have the same entries
+//------------------------------------------------------------------------------
+
+static bool same (GrB_Matrix A, GrB_Matrix B)
+{
+    GrB_Info info ;
+    GrB_Index anvals, bnvals ;
+    info = GrB_Matrix_nvals (&anvals, A) ;
+    if (info != GrB_SUCCESS) return (false) ;
+    info = GrB_Matrix_nvals (&bnvals, B) ;
+    if (info != GrB_SUCCESS || anvals != bnvals) return (false) ;
+    GrB_Index *AI = mxMalloc ((anvals+1) * sizeof (GrB_Index)) ;
+    GrB_Index *AJ = mxMalloc ((anvals+1) * sizeof (GrB_Index)) ;
+    GrB_Index *BI = mxMalloc ((anvals+1) * sizeof (GrB_Index)) ;
+    GrB_Index *BJ = mxMalloc ((anvals+1) * sizeof (GrB_Index)) ;
+    int64_t *AX = mxMalloc ((anvals+1) * sizeof (int64_t)) ;
+    int64_t *BX = mxMalloc ((anvals+1) * sizeof (int64_t)) ;
+    bool ok = (AI != NULL && AJ != NULL && BI != NULL && BJ != NULL &&
+        AX != NULL && BX != NULL) ;
+    GrB_Index na = anvals, nb = bnvals ;
+    ok = ok && (GrB_Matrix_extractTuples_INT64 (AI, AJ, AX, &na, A)
+        == GrB_SUCCESS) ;
+    ok = ok && (GrB_Matrix_extractTuples_INT64 (BI, BJ, BX, &nb, B)
+        == GrB_SUCCESS) ;
+    for (int64_t k = 0 ; ok && k < (int64_t) anvals ; k++)
+    {
+        ok = (AI [k] == BI [k] && AJ [k] == BJ [k] && AX [k] == BX [k]) ;
+    }
+    mxFree (AI) ; mxFree (AJ) ; mxFree (AX) ;
+    mxFree (BI) ; mxFree (BJ) ; mxFree (BX) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    int32_t *X = NULL ;
+    int sparsity [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP, GxB_FULL } ;
+
+    I = mxMalloc (NTUPLES * sizeof (GrB_Index)) ;
+    J = mxMalloc (NTUPLES * sizeof (GrB_Index)) ;
+    X = mxMalloc (NTUPLES * sizeof (int32_t)) ;
+    CHECK (I != NULL && J != NULL && X != NULL) ;
+
+    for (int s = 0 ; s < 4 ; s++)
+    {
+        for (int by_row = 0 ; by_row <= 1 ; by_row++)
+        {
+            for (int use_dup = 0 ; use_dup <= 1 ; use_dup++)
+            {
+                for (int sorted = 0 ; sorted <= 1 ; sorted++)
+                {
+
+                    //----------------------------------------------------------
+                    // create A, with pending tuples and zombies
+                    //----------------------------------------------------------
+
+                    OK (GrB_Matrix_new (&A, GrB_INT64, M, N)) ;
+                    OK (GxB_Matrix_Option_set (A, GxB_FORMAT,
+                        by_row ? GxB_BY_ROW : GxB_BY_COL)) ;
+                    if (sparsity [s] == GxB_FULL)
+                    {
+                        for (int64_t i = 0 ; i < M ; i++)
+                        {
+                            for (int64_t j = 0 ; j < N ; j++)
+                            {
+                                OK (GrB_Matrix_setElement_INT64 (A, i+j,
+                                    i, j)) ;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for (int k = 0 ; k < 500 ; k++)
+                        {
+                            OK (GrB_Matrix_setElement_INT64 (A, irand ( ) % 10,
+                                irand ( ) % M, irand ( ) % N)) ;
+                        }
+                    }
+                    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL,
+                        sparsity [s])) ;
+                    if (sparsity [s] != GxB_FULL)
+                    {
+                        for (int k = 0 ; k < 100 ; k++)
+                        {
+                            OK (GrB_Matrix_removeElement (A, irand ( ) % M,
+                                irand ( ) % N)) ;
+                        }
+                        for (int k = 0 ; k < 50 ; k++)
+                        {
+                            OK (GrB_Matrix_setElement_INT64 (A, 7,
+                                irand ( ) % M, irand ( ) % N)) ;
+                        }
+                        CHECK (GB_ANY_PENDING_WORK (A) ||
+                            GB_IS_BITMAP (A)) ;
+                    }
+                    OK (GrB_Matrix_dup (&B, A)) ;
+
+                    //----------------------------------------------------------
+                    // A(I,J) = X, or A(I,J) += X, with a single batch
+                    //----------------------------------------------------------
+
+                    for (int64_t k = 0 ; k < NTUPLES ; k++)
+                    {
+                        if (sorted)
+                        {
+                            // each entry appears twice, in sorted order
+                            int64_t t = (k/2) * ((M*N) / (NTUPLES/2)) ;
+                            I [k] = by_row ? (t / N) : (t % M) ;
+                            J [k] = by_row ? (t % N) : (t / M) ;
+                        }
+                        else
+                        {
+                            I [k] = irand ( ) % M ;
+                            J [k] = irand ( ) % N ;
+                        }
+                        X [k] = (int32_t) (irand ( ) % 100) - 50 ;
+                    }
+                    // a duplicate tuple
+                    I [NTUPLES-1] = I [0] ;
+                    J [NTUPLES-1] = J [0] ;
+
+                    GrB_BinaryOp dup = use_dup ? GrB_PLUS_FP64 : NULL ;
+                    OK (GxB_Matrix_setElements_INT32 (A, I, J, X, NTUPLES,
+                        dup)) ;
+                    for (int64_t k = 0 ; k < NTUPLES ; k++)
+                    {
+                        if (use_dup)
+                        {
+                            OK (GrB_Matrix_assign_INT32 (B, NULL, dup, X [k],
+                                &(I [k]), 1, &(J [k]), 1, NULL)) ;
+                        }
+                        else
+                        {
+                            OK (GrB_Matrix_setElement_INT32 (B, X [k],
+                                I [k], J [k])) ;
+                        }
+                    }
+                    CHECK (same (A, B)) ;
+
+                    //----------------------------------------------------------
+                    // remove a batch of entries
+                    //----------------------------------------------------------
+
+                    for (int64_t k = 0 ; k < NTUPLES ; k++)
+                    {
+                        I [k] = irand ( ) % M ;
+                        J [k] = irand ( ) % N ;
+                    }
+                    I [5] = I [4] ;
+                    J [5] = J [4] ;
+                    // a pending tuple, which is then removed
+                    OK (GrB_Matrix_setElement_INT64 (A, 3, I [9], J [9])) ;
+                    OK (GrB_Matrix_setElement_INT64 (B, 3, I [9], J [9])) ;
+                    OK (GxB_Matrix_removeElements (A, I, J, NTUPLES)) ;
+                    for (int64_t k = 0 ; k < NTUPLES ; k++)
+                    {
+                        OK (GrB_Matrix_removeElement (B, I [k], J [k])) ;
+                    }
+                    CHECK (same (A, B)) ;
+
+                    // entries can be added back after they are removed
+                    OK (GxB_Matrix_setElements_INT32 (A, I, J, X, 10, dup)) ;
+                    for (int64_t k = 0 ; k < 10 ; k++)
+                    {
+                        OK (GrB_Matrix_assign_INT32 (B, NULL, dup, X [k],
+                            &(I [k]), 1, &(J [k]), 1, NULL)) ;
+                    }
+                    CHECK (same (A, B)) ;
+
+                    //----------------------------------------------------------
+                    // errors leave A unchanged
+                    //----------------------------------------------------------
+
+                    I [3] = M ;
+                    expected = GrB_INVALID_INDEX ;
+                    ERR (GxB_Matrix_setElements_INT32 (A, I, J, X, NTUPLES,
+                        NULL)) ;
+                    ERR (GxB_Matrix_removeElements (A, I, J, NTUPLES)) ;
+                    CHECK (same (A, B)) ;
+
+                    GrB_Matrix_free (&A) ;
+                    GrB_Matrix_free (&B) ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test40:  all tests passed.\n\n") ;
+}
+
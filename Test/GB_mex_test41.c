@@ -0,0 +1,307 @@
+//------------------------------------------------------------------------------
+// GB_mex_test41: test the deletion of many zombies in place
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Many zombies are created across the vectors of a sparse or hypersparse
+// matrix, including all entries of some vectors, and then deleted by
+// GrB_Matrix_wait (see GB_zombie_compact).  The pattern, values, and nvals of
+// the result are compared with a dense reference, for several types of
+// different sizes, with and without pending tuples, and with several threads
+// so that the entries are split into several slices.  Any empty vectors must
+// be pruned from the hyperlist.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test41"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Type_free (&Trip) ;             \
+    if (ref != NULL) mxFree (ref) ;     \
+    if (present != NULL) mxFree (present) ; \
+    ref = NULL ; present = NULL ;       \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define M 100
+#define N 1000
+#define NTYPES 7
+
+typedef struct { double a, b, c ; } trip ;
+
+static uint64_t seed = 7 ;
+
+static uint64_t irand (void)
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+    return (seed >> 33) ;
+}
+
+//------------------------------------------------------------------------------
+// setx and getx: set or get an entry of any type
+//------------------------------------------------------------------------------
+
+static GrB_Info setx (GrB_Matrix A, GrB_Type t, void *v, GrB_Index i,
+    GrB_Index j)
+{
+    if (t == GrB_BOOL)  return (GrB_Matrix_setElement_BOOL  (A,
+        *((bool *) v), i, j)) ;
+    if (t == GrB_INT16) return (GrB_Matrix_setElement_INT16 (A,
+        *((int16_t *) v), i, j)) ;
+    if (t == GrB_FP32)  return (GrB_Matrix_setElement_FP32  (A,
+        *((float *) v), i, j)) ;
+    if (t == GrB_FP64)  return (GrB_Matrix_setElement_FP64  (A,
+        *((double *) v), i, j)) ;
+    if (t == GxB_FC64)  return (GxB_Matrix_setElement_FC64  (A,
+        *((GxB_FC64_t *) v), i, j)) ;
+    if (t == GrB_INT64) return (GrB_Matrix_setElement_INT64 (A,
+        *((int64_t *) v), i, j)) ;
+    return (GrB_Matrix_setElement_UDT (A, v, i, j)) ;
+}
+
+static GrB_Info getx (void *v, GrB_Matrix A, GrB_Type t, GrB_Index i,
+    GrB_Index j)
+{
+    if (t == GrB_BOOL)  return (GrB_Matrix_extractElement_BOOL  ((bool *) v,
+        A, i, j)) ;
+    if (t == GrB_INT16) return (GrB_Matrix_extractElement_INT16 ((int16_t *) v,
+        A, i, j)) ;
+    if (t == GrB_FP32)  return (GrB_Matrix_extractElement_FP32  ((float *) v,
+        A, i, j)) ;
+    if (t == GrB_FP64)  return (GrB_Matrix_extractElement_FP64  ((double *) v,
+        A, i, j)) ;
+    if (t == GxB_FC64)  return (GxB_Matrix_extractElement_FC64
+        ((GxB_FC64_t *) v, A, i, j)) ;
+    if (t == GrB_INT64) return (GrB_Matrix_extractElement_INT64 ((int64_t *) v,
+        A, i, j)) ;
+    return (GrB_Matrix_extractElement_UDT (v, A, i, j)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_value: a random value of the given size
+//------------------------------------------------------------------------------
+
+// Each value is a sequence of small integers, one per byte, so that the value
+// is exact for any floating-point type.
+
+static void random_value (unsigned char *val, GrB_Type type, size_t tsize,
+    bool iso)
+{
+    memset (val, 0, 32) ;
+    if (type == GrB_BOOL)
+    {
+        val [0] = iso ? 1 : (irand ( ) & 1) ;
+    }
+    else if (type == GrB_INT16 || type == GrB_INT64)
+    {
+        val [0] = iso ? 1 : (irand ( ) % 100) ;
+    }
+    else if (type == GrB_FP32)
+    {
+        float x = iso ? 1 : (irand ( ) % 100) ;
+        memcpy (val, &x, sizeof (float)) ;
+    }
+    else
+    {
+        // FP64, FC64, and the user-defined type
+        double x [3] ;
+        for (int k = 0 ; k < 3 ; k++) x [k] = iso ? 1 : (irand ( ) % 100) ;
+        memcpy (val, x, tsize) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL ;
+    GrB_Type Trip = NULL ;
+    unsigned char *ref = NULL ;
+    bool *present = NULL ;
+    unsigned char val [32] ;
+    int save_nthreads ;
+    double save_chunk ;
+
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, 5)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 1)) ;
+
+    OK (GrB_Type_new (&Trip, sizeof (trip))) ;
+    GrB_Type types [NTYPES] = { GrB_BOOL, GrB_INT16, GrB_FP32, GrB_FP64,
+        GxB_FC64, Trip, GrB_INT64 } ;
+    int sparsity [2] = { GxB_HYPERSPARSE, GxB_SPARSE } ;
+
+    ref = mxMalloc (M * N * sizeof (trip)) ;
+    present = mxMalloc (M * N * sizeof (bool)) ;
+    CHECK (ref != NULL && present != NULL) ;
+
+    for (int t = 0 ; t < NTYPES ; t++)
+    {
+        GrB_Type type = types [t] ;
+        size_t tsize ;
+        OK (GxB_Type_size (&tsize, type)) ;
+        for (int s = 0 ; s < 2 ; s++)
+        {
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            {
+                for (int frac = 1 ; frac <= 4 ; frac++)
+                {
+                    for (int pending = 0 ; pending <= 1 ; pending++)
+                    {
+
+                        //------------------------------------------------------
+                        // create A, mostly in the first 50 vectors
+                        //------------------------------------------------------
+
+                        OK (GrB_Matrix_new (&A, type, M, N)) ;
+                        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL,
+                            sparsity [s])) ;
+                        memset (present, 0, M * N * sizeof (bool)) ;
+                        for (int64_t k = 0 ; k < 5000 ; k++)
+                        {
+                            int64_t i = irand ( ) % M ;
+                            int64_t j = (irand ( ) % 3 == 0) ?
+                                (irand ( ) % N) : (irand ( ) % 50) ;
+                            random_value (val, type, tsize, iso) ;
+                            OK (setx (A, type, val, i, j)) ;
+                            memcpy (ref + (i+j*M)*tsize, val, tsize) ;
+                            present [i+j*M] = true ;
+                        }
+                        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+                        //------------------------------------------------------
+                        // delete some entries, including whole vectors
+                        //------------------------------------------------------
+
+                        for (int64_t j = 0 ; j < N ; j++)
+                        {
+                            for (int64_t i = 0 ; i < M ; i++)
+                            {
+                                if (!present [i+j*M]) continue ;
+                                if ((j % 7 == 3) || (irand ( ) % 4 < frac))
+                                {
+                                    OK (GrB_Matrix_removeElement (A, i, j)) ;
+                                    present [i+j*M] = false ;
+                                }
+                            }
+                        }
+                        CHECK (GB_ZOMBIES (A)) ;
+
+                        if (pending)
+                        {
+                            for (int k = 0 ; k < 300 ; k++)
+                            {
+                                int64_t i = irand ( ) % M ;
+                                int64_t j = irand ( ) % N ;
+                                random_value (val, type, tsize, iso) ;
+                                OK (setx (A, type, val, i, j)) ;
+                                memcpy (ref + (i+j*M)*tsize, val, tsize) ;
+                                present [i+j*M] = true ;
+                            }
+                        }
+
+                        //------------------------------------------------------
+                        // delete the zombies
+                        //------------------------------------------------------
+
+                        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                        CHECK (!GB_ANY_PENDING_WORK (A)) ;
+                        OK (GxB_Matrix_fprint (A, "A", GxB_SILENT, NULL)) ;
+                        if (GB_IS_HYPERSPARSE (A))
+                        {
+                            // the hyperlist has no empty vectors
+                            CHECK (A->nvec == A->nvec_nonempty) ;
+                        }
+
+                        //------------------------------------------------------
+                        // check the result
+                        //------------------------------------------------------
+
+                        GrB_Index nvals, count = 0 ;
+                        OK (GrB_Matrix_nvals (&nvals, A)) ;
+                        for (int64_t p = 0 ; p < M*N ; p++)
+                        {
+                            count += present [p] ;
+                        }
+                        CHECK (nvals == count) ;
+                        for (int64_t j = 0 ; j < N ; j++)
+                        {
+                            for (int64_t i = 0 ; i < M ; i++)
+                            {
+                                memset (val, 0, 32) ;
+                                info = getx (val, A, type, i, j) ;
+                                if (present [i+j*M])
+                                {
+                                    CHECK (info == GrB_SUCCESS) ;
+                                    CHECK (memcmp (val, ref + (i+j*M)*tsize,
+                                        tsize) == 0) ;
+                                }
+                                else
+                                {
+                                    CHECK (info == GrB_NO_VALUE) ;
+                                }
+                            }
+                        }
+                        GrB_Matrix_free (&A) ;
+                    }
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // delete all entries of a hypersparse matrix
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 10, 10)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_HYPERSPARSE)) ;
+    for (int k = 0 ; k < 10 ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, k, k, k)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    for (int k = 0 ; k < 10 ; k++)
+    {
+        OK (GrB_Matrix_removeElement (A, k, k)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    CHECK (nvals == 0) ;
+    CHECK (GB_IS_HYPERSPARSE (A) && A->nvec == 0) ;
+    OK (GxB_Matrix_fprint (A, "A", GxB_SILENT, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test41:  all tests passed.\n\n") ;
+}
+
@@ -0,0 +1,270 @@
+//------------------------------------------------------------------------------
+// GB_mex_test42: test GxB_Matrix_extractElements and isStoredElements
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Each batch is compared with n calls to GrB_Matrix_extractElement and
+// GxB_Matrix_isStoredElement, for hypersparse, sparse, bitmap, and full
+// matrices held by row or by column, with and without pending work, and for
+// queries that are sorted or unsorted, and that include missing entries and
+// duplicates.  Entries are typecast from int64_t to double and int32_t.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test42"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    if (I != NULL) mxFree (I) ;         \
+    if (J != NULL) mxFree (J) ;         \
+    if (X1 != NULL) mxFree (X1) ;       \
+    if (X2 != NULL) mxFree (X2) ;       \
+    if (found1 != NULL) mxFree (found1) ; \
+    if (found2 != NULL) mxFree (found2) ; \
+    I = NULL ; J = NULL ; X1 = NULL ; X2 = NULL ; \
+    found1 = NULL ; found2 = NULL ;     \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define M 40
+#define N 50
+#define NQUERY 3000
+
+static uint64_t seed = 1 ;
+
+static int64_t irand (void)
+{
+    seed = seed * 1103515245 + 12345 ;
+    return ((int64_t) ((seed >> 16) % 32768)) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X1 = NULL, *X2 = NULL ;
+    bool *found1 = NULL, *found2 = NULL ;
+    int sparsity [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP, GxB_FULL } ;
+
+    I = mxMalloc (NQUERY * sizeof (GrB_Index)) ;
+    J = mxMalloc (NQUERY * sizeof (GrB_Index)) ;
+    X1 = mxMalloc (NQUERY * sizeof (double)) ;
+    X2 = mxMalloc (NQUERY * sizeof (double)) ;
+    found1 = mxMalloc (NQUERY * sizeof (bool)) ;
+    found2 = mxMalloc (NQUERY * sizeof (bool)) ;
+    CHECK (I != NULL && J != NULL && X1 != NULL && X2 != NULL &&
+        found1 != NULL && found2 != NULL) ;
+
+    for (int s = 0 ; s < 4 ; s++)
+    {
+        for (int by_row = 0 ; by_row <= 1 ; by_row++)
+        {
+            for (int pending = 0 ; pending <= 1 ; pending++)
+            {
+                for (int iso = 0 ; iso <= 1 ; iso++)
+                {
+
+                    //----------------------------------------------------------
+                    // create A
+                    //----------------------------------------------------------
+
+                    OK (GrB_Matrix_new (&A, GrB_INT64, M, N)) ;
+                    OK (GxB_Matrix_Option_set (A, GxB_FORMAT,
+                        by_row ? GxB_BY_ROW : GxB_BY_COL)) ;
+                    int64_t nentries = (sparsity [s] == GxB_FULL) ? 0 : 600 ;
+                    if (sparsity [s] == GxB_FULL)
+                    {
+                        for (int64_t i = 0 ; i < M ; i++)
+                        {
+                            for (int64_t j = 0 ; j < N ; j++)
+                            {
+                                OK (GrB_Matrix_setElement_INT64 (A,
+                                    iso ? 3 : (i + 100*j), i, j)) ;
+                            }
+                        }
+                    }
+                    for (int64_t k = 0 ; k < nentries ; k++)
+                    {
+                        // most entries are in the first 10 vectors, so the
+                        // hypersparse matrix has many empty vectors
+                        int64_t i = irand ( ) % M ;
+                        int64_t j = (k % 4 == 0) ? (irand ( ) % N) :
+                            (irand ( ) % 10) ;
+                        OK (GrB_Matrix_setElement_INT64 (A,
+                            iso ? 3 : (irand ( ) % 1000 - 500), i, j)) ;
+                    }
+                    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL,
+                        sparsity [s])) ;
+                    CHECK (GB_sparsity (A) == sparsity [s]) ;
+                    if (pending && sparsity [s] != GxB_FULL)
+                    {
+                        // add zombies, and then pending tuples
+                        for (int k = 0 ; k < 50 ; k++)
+                        {
+                            OK (GrB_Matrix_removeElement (A, irand ( ) % M,
+                                irand ( ) % 10)) ;
+                        }
+                        for (int k = 0 ; k < 50 ; k++)
+                        {
+                            OK (GrB_Matrix_setElement_INT64 (A, iso ? 3 : 7,
+                                irand ( ) % M, irand ( ) % N)) ;
+                        }
+                    }
+
+                    for (int sorted = 0 ; sorted <= 1 ; sorted++)
+                    {
+
+                        //------------------------------------------------------
+                        // create the queries
+                        //------------------------------------------------------
+
+                        for (int64_t k = 0 ; k < NQUERY ; k++)
+                        {
+                            if (sorted)
+                            {
+                                // sorted in the format of A, with duplicates
+                                int64_t t = (k * M * N) / NQUERY ;
+                                I [k] = by_row ? (t / N) : (t % M) ;
+                                J [k] = by_row ? (t % N) : (t / M) ;
+                            }
+                            else
+                            {
+                                I [k] = irand ( ) % M ;
+                                J [k] = (k % 2) ? (irand ( ) % N) :
+                                    (irand ( ) % 10) ;
+                            }
+                        }
+
+                        //------------------------------------------------------
+                        // X1 = A(I,J) with a single batch
+                        //------------------------------------------------------
+
+                        // a sparse or hypersparse A has pending work for the
+                        // first batch, if requested
+                        CHECK (sorted || !pending || sparsity [s] >= GxB_BITMAP
+                            || GB_ANY_PENDING_WORK (A)) ;
+                        for (int64_t k = 0 ; k < NQUERY ; k++)
+                        {
+                            X1 [k] = -999 ;
+                            found1 [k] = (k % 2) ;
+                        }
+                        OK (GxB_Matrix_extractElements_FP64 (X1, found1, A,
+                            I, J, NQUERY)) ;
+
+                        //------------------------------------------------------
+                        // X2 = A(I,J) with one entry at a time
+                        //------------------------------------------------------
+
+                        int64_t nfound = 0 ;
+                        for (int64_t k = 0 ; k < NQUERY ; k++)
+                        {
+                            X2 [k] = -999 ;
+                            info = GrB_Matrix_extractElement_FP64 (&(X2 [k]),
+                                A, I [k], J [k]) ;
+                            CHECK (info == GrB_SUCCESS ||
+                                info == GrB_NO_VALUE) ;
+                            found2 [k] = (info == GrB_SUCCESS) ;
+                            nfound += found2 [k] ;
+                            bool is_stored ;
+                            is_stored = (GxB_Matrix_isStoredElement (A,
+                                I [k], J [k]) == GrB_SUCCESS) ;
+                            CHECK (is_stored == found2 [k]) ;
+                        }
+                        CHECK (nfound > 0) ;
+                        CHECK (sparsity [s] == GxB_FULL || nfound < NQUERY) ;
+
+                        for (int64_t k = 0 ; k < NQUERY ; k++)
+                        {
+                            // X1 [k] is not modified if the entry is missing
+                            CHECK (found1 [k] == found2 [k]) ;
+                            CHECK (X1 [k] == X2 [k]) ;
+                        }
+
+                        // found may be NULL
+                        OK (GxB_Matrix_extractElements_FP64 (X1, NULL, A,
+                            I, J, NQUERY)) ;
+                        for (int64_t k = 0 ; k < NQUERY ; k++)
+                        {
+                            CHECK (X1 [k] == X2 [k]) ;
+                        }
+
+                        // X may be NULL
+                        memset (found1, 0, NQUERY * sizeof (bool)) ;
+                        OK (GxB_Matrix_extractElements_INT32 (NULL, found1,
+                            A, I, J, NQUERY)) ;
+                        for (int64_t k = 0 ; k < NQUERY ; k++)
+                        {
+                            CHECK (found1 [k] == found2 [k]) ;
+                        }
+
+                        // isStoredElements
+                        memset (found1, 0, NQUERY * sizeof (bool)) ;
+                        OK (GxB_Matrix_isStoredElements (found1, A, I, J,
+                            NQUERY)) ;
+                        for (int64_t k = 0 ; k < NQUERY ; k++)
+                        {
+                            CHECK (found1 [k] == found2 [k]) ;
+                        }
+
+                        // typecast to int32_t
+                        int32_t *X3 = (int32_t *) X1 ;
+                        OK (GxB_Matrix_extractElements_INT32 (X3, found1,
+                            A, I, J, NQUERY / 2)) ;
+                        for (int64_t k = 0 ; k < NQUERY / 2 ; k++)
+                        {
+                            CHECK (found1 [k] == found2 [k]) ;
+                            if (found1 [k]) CHECK (X3 [k] == (int32_t) X2 [k]) ;
+                        }
+                    }
+
+                    //----------------------------------------------------------
+                    // error handling
+                    //----------------------------------------------------------
+
+                    I [7] = M ;
+                    expected = GrB_INVALID_INDEX ;
+                    ERR (GxB_Matrix_extractElements_FP64 (X1, found1, A, I, J,
+                        NQUERY)) ;
+                    ERR (GxB_Matrix_isStoredElements (found1, A, I, J,
+                        NQUERY)) ;
+                    OK (GxB_Matrix_extractElements_FP64 (X1, found1, A, I, J,
+                        0)) ;
+                    GrB_Matrix_free (&A) ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test42:  all tests passed.\n\n") ;
+}
+
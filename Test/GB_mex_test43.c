@@ -0,0 +1,249 @@
+//------------------------------------------------------------------------------
+// GB_mex_test43: test GxB_Matrix_publish and GxB_Matrix_attach
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix is published to a file and attached as a new matrix C, for each
+// sparsity format.  C is used as an input, then modified (which gives C its
+// own copy of its content), and freed.  The file is replaced while C is still
+// attached to it.  The content of an attached matrix is unpacked, and packed
+// into another attached matrix.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test43"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&A2) ;             \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&T1) ;             \
+    GrB_Matrix_free (&T2) ;             \
+    remove (filename) ;                 \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define M 30
+#define N 40
+
+static const char *filename = "GB_mex_test43.shm" ;
+static uint64_t seed = 1 ;
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix with small integer values
+//------------------------------------------------------------------------------
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    int sparsity,
+    bool iso
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+    info = GrB_Matrix_new (&A, GrB_INT64, M, N) ;
+    for (GrB_Index j = 0 ; j < N && info == GrB_SUCCESS ; j++)
+    {
+        for (GrB_Index i = 0 ; i < M && info == GrB_SUCCESS ; i++)
+        {
+            seed = seed * 1103515245 + 12345 ;
+            if (sparsity == GxB_FULL || (seed >> 16) % 4 == 0)
+            {
+                int64_t aij = iso ? 2 : ((int64_t) ((seed >> 20) % 100)) ;
+                info = GrB_Matrix_setElement_INT64 (A, aij, i, j) ;
+            }
+        }
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_set_INT32 (A, sparsity, GxB_SPARSITY_CONTROL) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (A, GrB_MATERIALIZE) ;
+    if (info != GrB_SUCCESS) GrB_Matrix_free (&A) ;
+    (*A_handle) = A ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, A2 = NULL, C = NULL, C2 = NULL, T1 = NULL, T2 = NULL ;
+    int sparsity [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP, GxB_FULL } ;
+
+    #if GB_WINDOWS
+    expected = GrB_NOT_IMPLEMENTED ;
+    OK (random_matrix (&A, GxB_SPARSE, false)) ;
+    OK (GxB_Matrix_publish (filename, A, NULL)) ;
+    ERR (GxB_Matrix_attach (&C, NULL, filename, NULL)) ;
+    #else
+
+    for (int s = 0 ; s < 4 ; s++)
+    {
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+
+            //------------------------------------------------------------------
+            // publish A and attach C to it
+            //------------------------------------------------------------------
+
+            OK (random_matrix (&A, sparsity [s], iso)) ;
+            OK (GxB_Matrix_publish (filename, A, NULL)) ;
+            OK (GxB_Matrix_attach (&C, NULL, filename, NULL)) ;
+            CHECK (C->shm != NULL) ;
+            CHECK (GB_mx_isequal (C, A, 0)) ;
+
+            //------------------------------------------------------------------
+            // read C: use it as an input to GrB_mxm and GrB_transpose
+            //------------------------------------------------------------------
+
+            OK (GrB_Matrix_new (&T1, GrB_INT64, M, M)) ;
+            OK (GrB_Matrix_new (&T2, GrB_INT64, M, M)) ;
+            OK (GrB_mxm (T1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, C, C,
+                GrB_DESC_T1)) ;
+            OK (GrB_mxm (T2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, A,
+                GrB_DESC_T1)) ;
+            OK (GrB_Matrix_wait (T1, GrB_MATERIALIZE)) ;
+            OK (GrB_Matrix_wait (T2, GrB_MATERIALIZE)) ;
+            CHECK (GB_mx_isequal (T1, T2, 0)) ;
+            GrB_Matrix_free (&T1) ;
+            GrB_Matrix_free (&T2) ;
+            OK (GrB_Matrix_new (&T1, GrB_INT64, N, M)) ;
+            OK (GrB_Matrix_new (&T2, GrB_INT64, N, M)) ;
+            OK (GrB_transpose (T1, NULL, NULL, C, NULL)) ;
+            OK (GrB_transpose (T2, NULL, NULL, A, NULL)) ;
+            OK (GrB_Matrix_wait (T1, GrB_MATERIALIZE)) ;
+            OK (GrB_Matrix_wait (T2, GrB_MATERIALIZE)) ;
+            CHECK (GB_mx_isequal (T1, T2, 0)) ;
+            GrB_Matrix_free (&T1) ;
+            GrB_Matrix_free (&T2) ;
+            CHECK (C->shm != NULL) ;
+            CHECK (GB_mx_isequal (C, A, 0)) ;
+
+            //------------------------------------------------------------------
+            // replace the file while C is attached to it
+            //------------------------------------------------------------------
+
+            OK (random_matrix (&A2, sparsity [s], false)) ;
+            OK (GxB_Matrix_publish (filename, A2, NULL)) ;
+            CHECK (GB_mx_isequal (C, A, 0)) ;
+            OK (GxB_Matrix_attach (&C2, GrB_INT64, filename, NULL)) ;
+            CHECK (GB_mx_isequal (C2, A2, 0)) ;
+            GrB_Matrix_free (&C2) ;
+
+            //------------------------------------------------------------------
+            // write to C: C is given its own copy of its content
+            //------------------------------------------------------------------
+
+            OK (GrB_Matrix_setElement_INT64 (C, 999, 1, 2)) ;
+            OK (GrB_Matrix_setElement_INT64 (A, 999, 1, 2)) ;
+            CHECK (C->shm == NULL) ;
+            CHECK (!GB_is_shallow (C)) ;
+            OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+            OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+            OK (GrB_Matrix_set_INT32 (C, GB_sparsity (A),
+                GxB_SPARSITY_CONTROL)) ;
+            CHECK (GB_mx_isequal (C, A, 0)) ;
+
+            // the file is not modified
+            OK (GxB_Matrix_attach (&C2, NULL, filename, NULL)) ;
+            CHECK (GB_mx_isequal (C2, A2, 0)) ;
+
+            // a change of sparsity format keeps C2 attached
+            OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE, GxB_SPARSITY_CONTROL)) ;
+            OK (GrB_Matrix_set_INT32 (A2, GxB_SPARSE, GxB_SPARSITY_CONTROL)) ;
+            CHECK (GB_mx_isequal (C2, A2, 0)) ;
+
+            //------------------------------------------------------------------
+            // free the attached matrices
+            //------------------------------------------------------------------
+
+            GrB_Matrix_free (&C) ;
+            GrB_Matrix_free (&C2) ;
+            GrB_Matrix_free (&A) ;
+            GrB_Matrix_free (&A2) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // unpack an attached matrix, and pack into another attached matrix
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, GxB_SPARSE, false)) ;
+    OK (GxB_Matrix_publish (filename, A, NULL)) ;
+    OK (GxB_Matrix_attach (&C, NULL, filename, NULL)) ;
+    OK (GxB_Matrix_attach (&C2, NULL, filename, NULL)) ;
+    CHECK (C->shm != NULL && C2->shm != NULL) ;
+
+    GrB_Index *Cp = NULL, *Ci = NULL, Cp_size, Ci_size, Cx_size ;
+    void *Cx = NULL ;
+    bool C_iso, C_jumbled ;
+    OK (GxB_Matrix_unpack_CSC (C, &Cp, &Ci, &Cx, &Cp_size, &Ci_size, &Cx_size,
+        &C_iso, &C_jumbled, NULL)) ;
+    CHECK (C->shm == NULL) ;
+    CHECK (Cp != NULL && Ci != NULL && Cx != NULL) ;
+
+    // the unpacked arrays are owned by the caller, and can be packed into
+    // another matrix, which discards the content of C2 and detaches it
+    OK (GxB_Matrix_pack_CSC (C2, &Cp, &Ci, &Cx, Cp_size, Ci_size, Cx_size,
+        C_iso, C_jumbled, NULL)) ;
+    CHECK (C2->shm == NULL) ;
+    CHECK (!GB_is_shallow (C2)) ;
+    CHECK (Cp == NULL && Ci == NULL && Cx == NULL) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C2, A, 0)) ;
+
+    // C2 can now be modified
+    OK (GrB_Matrix_setElement_INT64 (C2, 7, 0, 0)) ;
+    OK (GrB_Matrix_setElement_INT64 (A, 7, 0, 0)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C2, A, 0)) ;
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&C2) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_attach (&C, GrB_FP64, filename, NULL)) ;
+    CHECK (C == NULL) ;
+    remove (filename) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Matrix_attach (&C, NULL, filename, NULL)) ;
+    CHECK (C == NULL) ;
+    #endif
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test43:  all tests passed.\n\n") ;
+}
+
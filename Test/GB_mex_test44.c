@@ -0,0 +1,257 @@
+//------------------------------------------------------------------------------
+// GB_mex_test44: test GxB_mxm_reduce and GxB_mxm_reduce_Scalar
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// w<M> = accum (w, reduce (A*B)) is compared with GrB_mxm followed by
+// GrB_reduce, with and without a transpose of A and/or B, with and without a
+// mask and accum operator, and for problems small enough for a single panel
+// and large enough for many panels.  The many-panel case is also done with a
+// cached transpose of A.  All values are small integers, so the results are
+// exact.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test44"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&T) ;              \
+    GrB_Vector_free (&w1) ;             \
+    GrB_Vector_free (&w2) ;             \
+    GrB_Vector_free (&M) ;              \
+    GrB_Scalar_free (&s1) ;             \
+    GrB_Scalar_free (&s2) ;             \
+    GrB_Descriptor_free (&desc1) ;      \
+    GrB_Descriptor_free (&desc2) ;      \
+    GrB_Descriptor_free (&desc3) ;      \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+static uint64_t seed = 1 ;
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix with small integer values
+//------------------------------------------------------------------------------
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Index nrows,
+    GrB_Index ncols,
+    double density
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+    info = GrB_Matrix_new (&A, GrB_INT64, nrows, ncols) ;
+    for (GrB_Index j = 0 ; j < ncols && info == GrB_SUCCESS ; j++)
+    {
+        for (GrB_Index i = 0 ; i < nrows && info == GrB_SUCCESS ; i++)
+        {
+            seed = seed * 1103515245 + 12345 ;
+            double x = ((seed >> 16) % 32768) / 32768.0 ;
+            if (x < density)
+            {
+                int64_t aij = (int64_t) ((seed >> 20) % 7) - 3 ;
+                info = GrB_Matrix_setElement_INT64 (A, aij, i, j) ;
+            }
+        }
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (A, GrB_MATERIALIZE) ;
+    if (info != GrB_SUCCESS) GrB_Matrix_free (&A) ;
+    (*A_handle) = A ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, T = NULL ;
+    GrB_Vector w1 = NULL, w2 = NULL, M = NULL ;
+    GrB_Scalar s1 = NULL, s2 = NULL ;
+    GrB_Descriptor desc1 = NULL, desc2 = NULL, desc3 = NULL ;
+
+    // the first problem uses a single panel, the second uses many panels
+    GrB_Index m [2] = { 30, 300 } ;
+    GrB_Index k [2] = { 40, 300 } ;
+    GrB_Index n [2] = { 20, 300 } ;
+    double density [2] = { 0.2, 0.9 } ;
+
+    for (int p = 0 ; p < 2 ; p++)
+    {
+        for (int cached = 0 ; cached <= p ; cached++)
+        {
+            for (int a_trans = 0 ; a_trans <= 1 ; a_trans++)
+            {
+                for (int b_trans = 0 ; b_trans <= 1 ; b_trans++)
+                {
+                    for (int masked = 0 ; masked <= 1 ; masked++)
+                    {
+
+                        //------------------------------------------------------
+                        // create the problem
+                        //------------------------------------------------------
+
+                        OK (random_matrix (&A, a_trans ? k [p] : m [p],
+                            a_trans ? m [p] : k [p], density [p])) ;
+                        OK (random_matrix (&B, b_trans ? n [p] : k [p],
+                            b_trans ? k [p] : n [p], density [p])) ;
+                        if (cached)
+                        {
+                            OK (GrB_Matrix_set_INT32 (A, true,
+                                GxB_TRANSPOSE_CACHE)) ;
+                        }
+                        OK (GrB_Vector_new (&w1, GrB_INT64, m [p])) ;
+                        OK (GrB_Vector_new (&M, GrB_BOOL, m [p])) ;
+                        for (int64_t i = 0 ; i < m [p] ; i++)
+                        {
+                            OK (GrB_Vector_setElement_INT64 (w1, i, i)) ;
+                            if (i % 3 == 0)
+                            {
+                                OK (GrB_Vector_setElement_BOOL (M, true, i)) ;
+                            }
+                        }
+                        OK (GrB_Vector_dup (&w2, w1)) ;
+                        OK (GrB_Scalar_new (&s1, GrB_INT64)) ;
+                        OK (GrB_Scalar_setElement_INT64 (s1, 5)) ;
+                        OK (GrB_Scalar_dup (&s2, s1)) ;
+
+                        // desc1 transposes A and/or B, desc2 complements the
+                        // mask, and desc3 does both
+                        OK (GrB_Descriptor_new (&desc1)) ;
+                        OK (GrB_Descriptor_new (&desc2)) ;
+                        OK (GrB_Descriptor_new (&desc3)) ;
+                        if (a_trans)
+                        {
+                            OK (GrB_Descriptor_set (desc1, GrB_INP0,
+                                GrB_TRAN)) ;
+                            OK (GrB_Descriptor_set (desc3, GrB_INP0,
+                                GrB_TRAN)) ;
+                        }
+                        if (b_trans)
+                        {
+                            OK (GrB_Descriptor_set (desc1, GrB_INP1,
+                                GrB_TRAN)) ;
+                            OK (GrB_Descriptor_set (desc3, GrB_INP1,
+                                GrB_TRAN)) ;
+                        }
+                        if (masked)
+                        {
+                            OK (GrB_Descriptor_set (desc2, GrB_MASK,
+                                GrB_COMP)) ;
+                            OK (GrB_Descriptor_set (desc3, GrB_MASK,
+                                GrB_COMP)) ;
+                        }
+                        GrB_Vector mask = masked ? M : NULL ;
+                        GrB_BinaryOp accum = masked ? GrB_PLUS_INT64 : NULL ;
+
+                        //------------------------------------------------------
+                        // w1<M> = accum (w1, reduce (A*B))
+                        //------------------------------------------------------
+
+                        OK (GxB_mxm_reduce (w1, mask, accum,
+                            GrB_PLUS_MONOID_INT64,
+                            GrB_PLUS_TIMES_SEMIRING_INT64, A, B, desc3)) ;
+                        OK (GxB_mxm_reduce_Scalar (s1, GrB_PLUS_INT64,
+                            GrB_MAX_MONOID_INT64,
+                            GrB_PLUS_TIMES_SEMIRING_INT64, A, B, desc1)) ;
+                        if (cached && a_trans)
+                        {
+                            // the cached transpose of A has been constructed
+                            CHECK (A->T != NULL) ;
+                        }
+
+                        //------------------------------------------------------
+                        // w2<M> = accum (w2, reduce (T)), where T = A*B
+                        //------------------------------------------------------
+
+                        OK (GrB_Matrix_new (&T, GrB_INT64, m [p], n [p])) ;
+                        OK (GrB_mxm (T, NULL, NULL,
+                            GrB_PLUS_TIMES_SEMIRING_INT64, A, B, desc1)) ;
+                        OK (GrB_Matrix_reduce_Monoid (w2, mask, accum,
+                            GrB_PLUS_MONOID_INT64, T, desc2)) ;
+                        OK (GrB_Matrix_reduce_Monoid_Scalar (s2,
+                            GrB_PLUS_INT64, GrB_MAX_MONOID_INT64, T, NULL)) ;
+
+                        //------------------------------------------------------
+                        // check the results
+                        //------------------------------------------------------
+
+                        OK (GrB_Vector_wait (w1, GrB_MATERIALIZE)) ;
+                        OK (GrB_Vector_wait (w2, GrB_MATERIALIZE)) ;
+                        CHECK (GB_mx_isequal ((GrB_Matrix) w1, (GrB_Matrix) w2,
+                            0)) ;
+                        int64_t x1 = 0, x2 = 0 ;
+                        OK (GrB_Scalar_extractElement_INT64 (&x1, s1)) ;
+                        OK (GrB_Scalar_extractElement_INT64 (&x2, s2)) ;
+                        CHECK (x1 == x2) ;
+
+                        FREE_ALL ;
+                    }
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // w = reduce (w*B), where w is aliased with the first input, many panels
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, 300, 1, 1)) ;
+    OK (random_matrix (&B, 1, 4000, 0.9)) ;
+    OK (GrB_Matrix_new (&T, GrB_INT64, 300, 4000)) ;
+    OK (GrB_mxm (T, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, B, NULL)) ;
+    OK (GrB_Vector_new (&w2, GrB_INT64, 300)) ;
+    OK (GrB_Matrix_reduce_Monoid (w2, NULL, NULL, GrB_PLUS_MONOID_INT64, T,
+        NULL)) ;
+    OK (GrB_Vector_new (&w1, GrB_INT64, 300)) ;
+    OK (GrB_Col_extract (w1, NULL, NULL, A, GrB_ALL, 300, 0, NULL)) ;
+    OK (GxB_mxm_reduce (w1, NULL, NULL, GrB_PLUS_MONOID_INT64,
+        GrB_PLUS_TIMES_SEMIRING_INT64, (GrB_Matrix) w1, B, NULL)) ;
+    OK (GrB_Vector_wait (w1, GrB_MATERIALIZE)) ;
+    OK (GrB_Vector_wait (w2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal ((GrB_Matrix) w1, (GrB_Matrix) w2, 0)) ;
+    GrB_Vector_free (&w1) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&w1, GrB_INT64, 7)) ;
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR (GxB_mxm_reduce (w1, NULL, NULL, GrB_PLUS_MONOID_INT64,
+        GrB_PLUS_TIMES_SEMIRING_INT64, A, B, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test44:  all tests passed.\n\n") ;
+}
+
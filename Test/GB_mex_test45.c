@@ -0,0 +1,298 @@
+//------------------------------------------------------------------------------
+// GB_mex_test45: test the reuse of saxpy3 plans (GxB_AxB_PLAN)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M>=A*B is computed with a descriptor that holds a saxpy3 plan, and
+// compared with the same product computed with no plan, with no mask, a
+// sparse mask, a complemented sparse mask, and a bitmap mask, for the Gustavson
+// and hash methods.  The plan must be reused when only the values of A and B
+// change, and replaced when the pattern of A, B, or M changes, including
+// changes that move an entry but keep the number of entries the same.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_AxB_saxpy3.h"
+
+#define USAGE "GB_mex_test45"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&M) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Descriptor_free (&desc1) ;      \
+    GrB_Descriptor_free (&desc2) ;      \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 200
+#define NMASK 4
+
+static uint64_t seed = 1 ;
+
+static int64_t irand (void)
+{
+    seed = seed * 1103515245 + 12345 ;
+    return ((int64_t) ((seed >> 16) % 32768)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random sparse matrix with small integer values
+//------------------------------------------------------------------------------
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Type type,
+    int64_t nz
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+    info = GrB_Matrix_new (&A, type, N, N) ;
+    for (int64_t k = 0 ; k < nz && info == GrB_SUCCESS ; k++)
+    {
+        info = GrB_Matrix_setElement_INT64 (A, 1 + irand ( ) % 9,
+            irand ( ) % N, irand ( ) % N) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (A, GrB_MATERIALIZE) ;
+    if (info != GrB_SUCCESS) GrB_Matrix_free (&A) ;
+    (*A_handle) = A ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// move_entry: move an entry of A, so nnz(A) is unchanged but its pattern is not
+//------------------------------------------------------------------------------
+
+static GrB_Info move_entry (GrB_Matrix A)
+{
+    GrB_Info info ;
+    GrB_Index nvals1, nvals2 ;
+    info = GrB_Matrix_nvals (&nvals1, A) ;
+    for (int trial = 0 ; info == GrB_SUCCESS ; trial++)
+    {
+        // find an entry A(i,j) where A(i,j+1) is not present
+        GrB_Index i = irand ( ) % N, j = irand ( ) % (N-1) ;
+        bool x ;
+        if (GrB_Matrix_extractElement_BOOL (&x, A, i, j) == GrB_SUCCESS &&
+            GrB_Matrix_extractElement_BOOL (&x, A, i, j+1) == GrB_NO_VALUE)
+        {
+            info = GrB_Matrix_removeElement (A, i, j) ;
+            if (info == GrB_SUCCESS)
+            {
+                info = GrB_Matrix_setElement_BOOL (A, true, i, j+1) ;
+            }
+            break ;
+        }
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (A, GrB_MATERIALIZE) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_nvals (&nvals2, A) ;
+    if (info == GrB_SUCCESS && nvals1 != nvals2) info = GrB_PANIC ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// plan_matches: check if the plan of a descriptor holds the patterns of A, B
+//------------------------------------------------------------------------------
+
+static bool plan_matches (GrB_Descriptor desc, GrB_Matrix A, GrB_Matrix B)
+{
+    GB_saxpy3_plan Plan = desc->Plan ;
+    if (Plan == NULL) return (false) ;
+    int64_t anz = GB_nnz (A), bnz = GB_nnz (B) ;
+    return (Plan->A_pattern.ni == anz && Plan->B_pattern.ni == bnz &&
+        memcmp (Plan->A_pattern.i, A->i, anz * sizeof (int64_t)) == 0 &&
+        memcmp (Plan->B_pattern.i, B->i, bnz * sizeof (int64_t)) == 0 &&
+        memcmp (Plan->A_pattern.p, A->p, (A->nvec+1) * sizeof (int64_t)) == 0
+     && memcmp (Plan->B_pattern.p, B->p, (B->nvec+1) * sizeof (int64_t)) == 0);
+}
+
+//------------------------------------------------------------------------------
+// AxB: C1<M>=A*B with the plan, and C2<M>=A*B without it
+//------------------------------------------------------------------------------
+
+static GrB_Info AxB
+(
+    GrB_Matrix *C1, GrB_Matrix *C2, GrB_Matrix M, GrB_Matrix A, GrB_Matrix B,
+    GrB_Descriptor desc1, GrB_Descriptor desc2
+)
+{
+    GrB_Info info ;
+    GrB_Matrix_free (C1) ;
+    GrB_Matrix_free (C2) ;
+    info = GrB_Matrix_new (C1, GrB_INT64, N, N) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_new (C2, GrB_INT64, N, N) ;
+    if (info == GrB_SUCCESS) info = GrB_mxm (*C1, M, NULL,
+        GrB_PLUS_TIMES_SEMIRING_INT64, A, B, desc1) ;
+    if (info == GrB_SUCCESS) info = GrB_mxm (*C2, M, NULL,
+        GrB_PLUS_TIMES_SEMIRING_INT64, A, B, desc2) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*C1, GrB_MATERIALIZE) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*C2, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Descriptor desc1 = NULL, desc2 = NULL ;
+    GrB_Desc_Value method [2] = { GxB_AxB_GUSTAVSON, GxB_AxB_HASH } ;
+
+    for (int kmask = 0 ; kmask < NMASK ; kmask++)
+    {
+        for (int kmethod = 0 ; kmethod < 2 ; kmethod++)
+        {
+
+            //------------------------------------------------------------------
+            // create the problem
+            //------------------------------------------------------------------
+
+            // kmask 0: no mask, 1: sparse M, 2: sparse !M, 3: bitmap M
+            OK (random_matrix (&A, GrB_INT64, 1000)) ;
+            OK (random_matrix (&B, GrB_INT64, 1000)) ;
+            if (kmask > 0)
+            {
+                OK (random_matrix (&M, GrB_BOOL, 4000)) ;
+                OK (GrB_Matrix_set_INT32 (M,
+                    (kmask == 3) ? GxB_BITMAP : GxB_SPARSE,
+                    GxB_SPARSITY_CONTROL)) ;
+            }
+
+            // desc1 has a plan, desc2 does not
+            OK (GrB_Descriptor_new (&desc1)) ;
+            OK (GrB_Descriptor_new (&desc2)) ;
+            OK (GrB_Descriptor_set (desc1, GxB_AxB_METHOD, method [kmethod])) ;
+            OK (GrB_Descriptor_set (desc2, GxB_AxB_METHOD, method [kmethod])) ;
+            OK (GrB_Descriptor_set_INT32 (desc1, true, GxB_AxB_PLAN)) ;
+            if (kmask == 2)
+            {
+                OK (GrB_Descriptor_set (desc1, GrB_MASK, GrB_COMP)) ;
+                OK (GrB_Descriptor_set (desc2, GrB_MASK, GrB_COMP)) ;
+            }
+            CHECK (desc1->Plan == NULL) ;
+
+            //------------------------------------------------------------------
+            // the first product creates the plan
+            //------------------------------------------------------------------
+
+            OK (AxB (&C1, &C2, M, A, B, desc1, desc2)) ;
+            CHECK (GB_mx_isequal (C1, C2, 0)) ;
+            CHECK (plan_matches (desc1, A, B)) ;
+            GB_saxpy3_plan Plan = desc1->Plan ;
+            CHECK (Plan->M_present == (kmask > 0)) ;
+            CHECK (Plan->Mask_comp == (kmask == 2)) ;
+            // the symbolic phase is saved only if saxpy3 does not apply M
+            CHECK (GB_IMPLIES (Plan->Cp != NULL, !Plan->apply_mask)) ;
+
+            //------------------------------------------------------------------
+            // the plan is reused when only the values change
+            //------------------------------------------------------------------
+
+            for (int trial = 0 ; trial < 3 ; trial++)
+            {
+                OK (GrB_Matrix_apply_BinaryOp2nd_INT64 (A, NULL, NULL,
+                    GrB_PLUS_INT64, A, 1 + trial, NULL)) ;
+                OK (GrB_Matrix_apply_BinaryOp1st_INT64 (B, NULL, NULL,
+                    GrB_MINUS_INT64, 5, B, NULL)) ;
+                OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+                OK (AxB (&C1, &C2, M, A, B, desc1, desc2)) ;
+                CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                CHECK (desc1->Plan == Plan) ;
+            }
+
+            //------------------------------------------------------------------
+            // the plan is replaced when the pattern of A, B, or M changes
+            //------------------------------------------------------------------
+
+            for (int change = 0 ; change < 5 ; change++)
+            {
+                switch (change)
+                {
+                    // move an entry of A
+                    case 0 : OK (move_entry (A)) ; break ;
+                    // move an entry of B
+                    case 1 : OK (move_entry (B)) ; break ;
+                    // add an entry to A
+                    case 2 :
+                        OK (GrB_Matrix_setElement_INT64 (A, 3, 1, 2)) ;
+                        OK (GrB_Matrix_setElement_INT64 (A, 3, N-1, N-2)) ;
+                        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                        break ;
+                    // move an entry of M
+                    case 3 : if (M != NULL) OK (move_entry (M)) ; break ;
+                    // remove an entry of B
+                    default:
+                    case 4 :
+                        OK (GrB_Matrix_removeElement (B, B->i [0], 0)) ;
+                        OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+                        break ;
+                }
+                if (M != NULL)
+                {
+                    // move_entry may change the sparsity of M
+                    OK (GrB_Matrix_set_INT32 (M,
+                        (kmask == 3) ? GxB_BITMAP : GxB_SPARSE,
+                        GxB_SPARSITY_CONTROL)) ;
+                }
+                OK (AxB (&C1, &C2, M, A, B, desc1, desc2)) ;
+                CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                CHECK (plan_matches (desc1, A, B)) ;
+
+                // the new plan is then reused
+                Plan = desc1->Plan ;
+                OK (GrB_Matrix_apply (A, NULL, NULL, GrB_AINV_INT64, A,
+                    NULL)) ;
+                OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                OK (AxB (&C1, &C2, M, A, B, desc1, desc2)) ;
+                CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                CHECK (desc1->Plan == Plan) ;
+            }
+
+            //------------------------------------------------------------------
+            // the plan is discarded when the option is reset
+            //------------------------------------------------------------------
+
+            OK (GrB_Descriptor_set_INT32 (desc1, GrB_DEFAULT, GxB_AxB_PLAN)) ;
+            CHECK (desc1->Plan == NULL) ;
+            OK (AxB (&C1, &C2, M, A, B, desc1, desc2)) ;
+            CHECK (GB_mx_isequal (C1, C2, 0)) ;
+            CHECK (desc1->Plan == NULL) ;
+
+            FREE_ALL ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test45:  all tests passed.\n\n") ;
+}
+
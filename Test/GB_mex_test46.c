@@ -0,0 +1,240 @@
+//------------------------------------------------------------------------------
+// GB_mex_test46: test GxB_COMPRESSION_DELTA
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Matrices are serialized with LZ4, LZ4HC, and ZSTD, with and without
+// GxB_COMPRESSION_DELTA, then deserialized and compared with the original
+// matrix.  The matrices have several types (including a user-defined type of
+// odd size), are hypersparse, sparse, bitmap, or full, and held by row or
+// column.  Some have integer arrays whose length is not a multiple of 8 or of
+// the tile size of the delta encoding, some are large enough to be split into
+// several blocks, and some are empty.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test46"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&A0) ;             \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&D) ;              \
+    GrB_Type_free (&Odd) ;              \
+    GrB_UnaryOp_free (&to_odd) ;        \
+    GrB_Descriptor_free (&desc) ;       \
+    if (blob1 != NULL) mxFree (blob1) ; \
+    if (blob2 != NULL) mxFree (blob2) ; \
+    blob1 = NULL ; blob2 = NULL ;       \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NTYPES 7
+#define NMETHODS 4
+#define NPROBLEMS 5
+
+// a user-defined type of size 3
+typedef struct { uint8_t x [3] ; } odd ;
+
+static void make_odd (void *z, const void *x)
+{
+    int64_t a = *((int64_t *) x) ;
+    odd *o = (odd *) z ;
+    o->x [0] = (uint8_t) a ;
+    o->x [1] = (uint8_t) (a + 1) ;
+    o->x [2] = (uint8_t) (a + 2) ;
+}
+
+static uint64_t seed = 1 ;
+
+static int64_t irand (void)
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+    return ((int64_t) (seed >> 33)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random int64 matrix
+//------------------------------------------------------------------------------
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Index nrows,
+    GrB_Index ncols,
+    int64_t nz
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+    info = GrB_Matrix_new (&A, GrB_INT64, nrows, ncols) ;
+    for (int64_t k = 0 ; k < nz && info == GrB_SUCCESS ; k++)
+    {
+        info = GrB_Matrix_setElement_INT64 (A, irand ( ) % 200 - 100,
+            irand ( ) % nrows, irand ( ) % ncols) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (A, GrB_MATERIALIZE) ;
+    if (info != GrB_SUCCESS) GrB_Matrix_free (&A) ;
+    (*A_handle) = A ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, A0 = NULL, C = NULL, D = NULL ;
+    GrB_Type Odd = NULL ;
+    GrB_UnaryOp to_odd = NULL ;
+    GrB_Descriptor desc = NULL ;
+    void *blob1 = NULL, *blob2 = NULL ;
+    GrB_Index blob1_size, blob2_size ;
+    int save_nthreads ;
+
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GrB_Type_new (&Odd, sizeof (odd))) ;
+    OK (GrB_UnaryOp_new (&to_odd, make_odd, Odd, GrB_INT64)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+
+    GrB_Type types [NTYPES] = { GrB_BOOL, GrB_INT8, GrB_UINT16, GrB_INT32,
+        GrB_FP64, GxB_FC64, Odd } ;
+    int methods [NMETHODS] = { GxB_COMPRESSION_LZ4, GxB_COMPRESSION_LZ4HC,
+        GxB_COMPRESSION_ZSTD, GxB_COMPRESSION_ZSTD + 3 } ;
+    int sparsity [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP, GxB_FULL } ;
+
+    // problems: small, with 37 entries; a hypersparse matrix with many
+    // columns; large enough for several blocks; and two empty matrices
+    GrB_Index nrows [NPROBLEMS] = { 13, 10, 1000, 1000, 0 } ;
+    GrB_Index ncols [NPROBLEMS] = { 7, 20000, 997, 997, 0 } ;
+    int64_t nz [NPROBLEMS] = { 37, 1003, 100000, 0, 0 } ;
+
+    for (int p = 0 ; p < NPROBLEMS ; p++)
+    {
+        OK (random_matrix (&A0, nrows [p], ncols [p], nz [p])) ;
+        for (int t = 0 ; t < NTYPES ; t++)
+        {
+            // A = (type) A0
+            OK (GrB_Matrix_new (&A, types [t], nrows [p], ncols [p])) ;
+            if (types [t] == Odd)
+            {
+                OK (GrB_Matrix_apply (A, NULL, NULL, to_odd, A0, NULL)) ;
+            }
+            else
+            {
+                OK (GrB_Matrix_assign (A, NULL, NULL, A0, GrB_ALL,
+                    nrows [p], GrB_ALL, ncols [p], NULL)) ;
+            }
+            for (int s = 0 ; s < 4 ; s++)
+            {
+                for (int by_row = 0 ; by_row <= 1 ; by_row++)
+                {
+                    OK (GrB_Matrix_set_INT32 (A, by_row ? GrB_ROWMAJOR :
+                        GrB_COLMAJOR, GrB_STORAGE_ORIENTATION_HINT)) ;
+                    OK (GrB_Matrix_set_INT32 (A, sparsity [s],
+                        GxB_SPARSITY_CONTROL)) ;
+                    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                    for (int m = 0 ; m < NMETHODS ; m++)
+                    {
+                        for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+                        {
+                            OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS,
+                                nthreads)) ;
+
+                            //--------------------------------------------------
+                            // blob1: serialize A without delta encoding
+                            //--------------------------------------------------
+
+                            OK (GrB_Descriptor_set_INT32 (desc, methods [m],
+                                GxB_COMPRESSION)) ;
+                            OK (GxB_Matrix_serialize (&blob1, &blob1_size, A,
+                                desc)) ;
+
+                            //--------------------------------------------------
+                            // blob2: serialize A with delta encoding
+                            //--------------------------------------------------
+
+                            OK (GrB_Descriptor_set_INT32 (desc, methods [m] +
+                                GxB_COMPRESSION_DELTA, GxB_COMPRESSION)) ;
+                            OK (GxB_Matrix_serialize (&blob2, &blob2_size, A,
+                                desc)) ;
+
+                            //--------------------------------------------------
+                            // deserialize both blobs and compare with A
+                            //--------------------------------------------------
+
+                            OK (GxB_Matrix_deserialize (&C, types [t], blob1,
+                                blob1_size, NULL)) ;
+                            OK (GxB_Matrix_deserialize (&D, types [t], blob2,
+                                blob2_size, NULL)) ;
+                            CHECK (GB_mx_isequal (C, A, 0)) ;
+                            CHECK (GB_mx_isequal (D, A, 0)) ;
+                            GrB_Matrix_free (&C) ;
+                            GrB_Matrix_free (&D) ;
+                            if (types [t] != Odd)
+                            {
+                                // the type is optional for built-in types
+                                OK (GrB_Matrix_deserialize (&D, NULL, blob2,
+                                    blob2_size)) ;
+                                CHECK (GB_mx_isequal (D, A, 0)) ;
+                                GrB_Matrix_free (&D) ;
+                            }
+
+                            // a truncated blob is rejected
+                            info = GxB_Matrix_deserialize (&D, types [t],
+                                blob2, blob2_size - 1, NULL) ;
+                            CHECK (info != GrB_SUCCESS && D == NULL) ;
+
+                            mxFree (blob1) ; blob1 = NULL ;
+                            mxFree (blob2) ; blob2 = NULL ;
+                        }
+                    }
+                }
+            }
+            GrB_Matrix_free (&A) ;
+        }
+        GrB_Matrix_free (&A0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // vectors
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A0, 1001, 1, 333)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_COMPRESSION_LZ4 +
+        GxB_COMPRESSION_DELTA, GxB_COMPRESSION)) ;
+    OK (GxB_Vector_serialize (&blob1, &blob1_size, (GrB_Vector) A0, desc)) ;
+    OK (GxB_Vector_deserialize ((GrB_Vector *) &C, GrB_INT64, blob1,
+        blob1_size, NULL)) ;
+    CHECK (GB_mx_isequal (C, A0, 0)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test46:  all tests passed.\n\n") ;
+}
+
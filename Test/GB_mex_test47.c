@@ -0,0 +1,284 @@
+//------------------------------------------------------------------------------
+// GB_mex_test47: test GxB_Matrix_serialize_delta and deserialize_delta
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A chain of checkpoints is created for a matrix that is modified between
+// each one: a few values change, nothing changes, entries are inserted and
+// deleted, and the sparsity format changes.  Each prefix of the chain is
+// deserialized and compared with a copy of the matrix taken when the last
+// checkpoint of the prefix was made; the first prefix is just the base blob,
+// which must give back the base matrix.  This is done for several types and
+// compression methods.  Broken chains must be rejected.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test47"
+
+#define FREE_ALL                                    \
+{                                                   \
+    GrB_Matrix_free (&A) ;                          \
+    GrB_Matrix_free (&C) ;                          \
+    for (int k = 0 ; k < NBLOBS ; k++)              \
+    {                                               \
+        GrB_Matrix_free (&(S [k])) ;                \
+        if (blobs [k] != NULL) mxFree (blobs [k]) ; \
+        blobs [k] = NULL ;                          \
+    }                                               \
+    GrB_Type_free (&Pair) ;                         \
+    GrB_UnaryOp_free (&to_pair) ;                   \
+    GrB_Descriptor_free (&desc) ;                   \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define M 1000
+#define N 800
+#define NBLOBS 6
+#define NTYPES 3
+#define NMETHODS 3
+
+// a user-defined type
+typedef struct { int32_t a ; double b ; } pair ;
+
+static void make_pair (void *z, const void *x)
+{
+    double d = *((double *) x) ;
+    pair *p = (pair *) z ;
+    p->a = (int32_t) d ;
+    p->b = -d ;
+}
+
+static uint64_t seed = 1 ;
+
+static int64_t irand (void)
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+    return ((int64_t) (seed >> 33)) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, S [NBLOBS] ;
+    void *blobs [NBLOBS] ;
+    GrB_Index blob_sizes [NBLOBS] ;
+    GrB_Type Pair = NULL ;
+    GrB_UnaryOp to_pair = NULL ;
+    GrB_Descriptor desc = NULL ;
+    for (int k = 0 ; k < NBLOBS ; k++)
+    {
+        S [k] = NULL ;
+        blobs [k] = NULL ;
+        blob_sizes [k] = 0 ;
+    }
+
+    OK (GrB_Type_new (&Pair, sizeof (pair))) ;
+    OK (GrB_UnaryOp_new (&to_pair, make_pair, Pair, GrB_FP64)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    GrB_Type types [NTYPES] = { GrB_FP64, GrB_INT8, Pair } ;
+    int methods [NMETHODS] = { GxB_COMPRESSION_NONE, GxB_COMPRESSION_LZ4,
+        GxB_COMPRESSION_ZSTD + GxB_COMPRESSION_DELTA } ;
+
+    for (int t = 0 ; t < NTYPES ; t++)
+    {
+        GrB_Type type = types [t] ;
+        for (int m = 0 ; m < NMETHODS ; m++)
+        {
+            OK (GrB_Descriptor_set_INT32 (desc, methods [m],
+                GxB_COMPRESSION)) ;
+
+            //------------------------------------------------------------------
+            // create the base matrix, with Ai and Ax split into many chunks
+            //------------------------------------------------------------------
+
+            OK (GrB_Matrix_new (&C, GrB_FP64, M, N)) ;
+            for (int64_t k = 0 ; k < 100000 ; k++)
+            {
+                OK (GrB_Matrix_setElement_FP64 (C, (double) (irand ( ) % 100),
+                    irand ( ) % M, irand ( ) % N)) ;
+            }
+            OK (GrB_Matrix_new (&A, type, M, N)) ;
+            if (type == Pair)
+            {
+                OK (GrB_Matrix_apply (A, NULL, NULL, to_pair, C, NULL)) ;
+            }
+            else
+            {
+                OK (GrB_Matrix_assign (A, NULL, NULL, C, GrB_ALL, M, GrB_ALL,
+                    N, NULL)) ;
+            }
+            GrB_Matrix_free (&C) ;
+            OK (GrB_Matrix_set_INT32 (A, GxB_SPARSE, GxB_SPARSITY_CONTROL)) ;
+            OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+            //------------------------------------------------------------------
+            // create the chain of checkpoints
+            //------------------------------------------------------------------
+
+            for (int k = 0 ; k < NBLOBS ; k++)
+            {
+                // modify A
+                switch (k)
+                {
+                    // the base matrix
+                    case 0 : break ;
+                    // change a few values, all in the first chunk of Ax
+                    case 1 :
+                        for (int64_t p = 0 ; p < 20 ; p++)
+                        {
+                            GrB_Index i = irand ( ) % M, j = irand ( ) % 4 ;
+                            if (type == Pair)
+                            {
+                                pair x ;
+                                if (GrB_Matrix_extractElement_UDT (&x, A, i, j)
+                                    == GrB_SUCCESS)
+                                {
+                                    x.b += 1 ;
+                                    OK (GrB_Matrix_setElement_UDT (A, &x,
+                                        i, j)) ;
+                                }
+                            }
+                            else
+                            {
+                                double x ;
+                                if (GrB_Matrix_extractElement_FP64 (&x, A,
+                                    i, j) == GrB_SUCCESS)
+                                {
+                                    OK (GrB_Matrix_setElement_FP64 (A, x+1,
+                                        i, j)) ;
+                                }
+                            }
+                        }
+                        break ;
+                    // no change at all
+                    case 2 : break ;
+                    // insert and delete entries
+                    case 3 :
+                        for (int64_t p = 0 ; p < 50 ; p++)
+                        {
+                            OK (GrB_Matrix_removeElement (A, irand ( ) % M,
+                                irand ( ) % N)) ;
+                        }
+                        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                        for (int64_t p = 0 ; p < 50 ; p++)
+                        {
+                            GrB_Index i = irand ( ) % M, j = irand ( ) % N ;
+                            pair x = { 7, 7 } ;
+                            OK ((type == Pair) ?
+                                GrB_Matrix_setElement_UDT (A, &x, i, j) :
+                                GrB_Matrix_setElement_FP64 (A, 7, i, j)) ;
+                        }
+                        break ;
+                    // convert to bitmap
+                    case 4 :
+                        OK (GrB_Matrix_set_INT32 (A, GxB_BITMAP,
+                            GxB_SPARSITY_CONTROL)) ;
+                        break ;
+                    // convert to hypersparse
+                    default :
+                        OK (GrB_Matrix_set_INT32 (A, GxB_HYPERSPARSE,
+                            GxB_SPARSITY_CONTROL)) ;
+                        break ;
+                }
+                OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+                // S [k] = A, and checkpoint A in blobs [k]
+                OK (GrB_Matrix_dup (&(S [k]), A)) ;
+                OK (GxB_Matrix_serialize_delta (&(blobs [k]),
+                    &(blob_sizes [k]), A, (k == 0) ? NULL : blobs [k-1],
+                    (k == 0) ? 0 : blob_sizes [k-1], desc)) ;
+            }
+
+            // a blob with no change, or only a few changes, is small
+            CHECK (blob_sizes [1] < blob_sizes [0] / 2) ;
+            CHECK (blob_sizes [2] < blob_sizes [1]) ;
+
+            //------------------------------------------------------------------
+            // deserialize each prefix of the chain
+            //------------------------------------------------------------------
+
+            for (int k = 0 ; k < NBLOBS ; k++)
+            {
+                OK (GxB_Matrix_deserialize_delta (&C, type,
+                    (const void **) blobs, blob_sizes, k+1, NULL)) ;
+                OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                CHECK (GB_mx_isequal (C, S [k], 0)) ;
+                GrB_Matrix_free (&C) ;
+            }
+
+            //------------------------------------------------------------------
+            // broken chains are rejected
+            //------------------------------------------------------------------
+
+            // a chain that does not start with a base blob
+            expected = GrB_INVALID_OBJECT ;
+            ERR (GxB_Matrix_deserialize_delta (&C, type,
+                (const void **) (blobs + 1), blob_sizes + 1, 2, NULL)) ;
+            CHECK (C == NULL) ;
+
+            // a chain with a missing blob
+            void *chain [2] = { blobs [0], blobs [2] } ;
+            GrB_Index chain_sizes [2] = { blob_sizes [0], blob_sizes [2] } ;
+            ERR (GxB_Matrix_deserialize_delta (&C, type,
+                (const void **) chain, chain_sizes, 2, NULL)) ;
+            CHECK (C == NULL) ;
+
+            // a truncated blob
+            blob_sizes [0]-- ;
+            ERR (GxB_Matrix_deserialize_delta (&C, type,
+                (const void **) blobs, blob_sizes, 1, NULL)) ;
+            CHECK (C == NULL) ;
+            blob_sizes [0]++ ;
+
+            // the blobs cannot be read by GxB_Matrix_deserialize
+            info = GxB_Matrix_deserialize (&C, type, blobs [0], blob_sizes [0],
+                NULL) ;
+            CHECK (info != GrB_SUCCESS && C == NULL) ;
+
+            // the wrong type
+            expected = GrB_DOMAIN_MISMATCH ;
+            ERR (GxB_Matrix_deserialize_delta (&C,
+                (type == GrB_INT8) ? GrB_FP64 : GrB_INT8,
+                (const void **) blobs, blob_sizes, 1, NULL)) ;
+            CHECK (C == NULL) ;
+
+            GrB_Matrix_free (&A) ;
+            for (int k = 0 ; k < NBLOBS ; k++)
+            {
+                GrB_Matrix_free (&(S [k])) ;
+                mxFree (blobs [k]) ;
+                blobs [k] = NULL ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test47:  all tests passed.\n\n") ;
+}
+
@@ -0,0 +1,279 @@
+//------------------------------------------------------------------------------
+// GB_mex_test48: test GxB_Matrix_eWiseAdd_n
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C1<M> = accum (C1, A[0]+...+A[k-1]) is computed with GxB_Matrix_eWiseAdd_n,
+// and compared with T = A[0] typecast to the monoid type, followed by k-1 calls
+// to GrB_eWiseAdd to compute T = T + A[i], and C2<M> = accum (C2,T).  This is
+// done for k = 1 to 8, with inputs of mixed types, sparse inputs (summed in a
+// tree) and dense inputs (summed left-to-right), with and without a transpose
+// of the inputs, a mask, and an accum operator.  Each sparse input A[i] is
+// given zombies and pending tuples before it is summed.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test48"
+
+#define FREE_ALL                        \
+{                                       \
+    for (int i = 0 ; i < KMAX ; i++)    \
+    {                                   \
+        GrB_Matrix_free (&(A [i])) ;    \
+    }                                   \
+    GrB_Matrix_free (&M) ;              \
+    GrB_Matrix_free (&T) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Descriptor_free (&desc1) ;      \
+    GrB_Descriptor_free (&desc2) ;      \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define KMAX 8
+#define NROWS 50
+#define NCOLS 40
+
+static uint64_t seed = 1 ;
+
+static int64_t irand (void)
+{
+    seed = seed * 1103515245 + 12345 ;
+    return ((int64_t) ((seed >> 16) % 32768)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix with values of the form x+0.5
+//------------------------------------------------------------------------------
+
+// The values are not integers, so a typecast of A[i] to an integer monoid type
+// changes them.
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Type type,
+    GrB_Index nrows,
+    GrB_Index ncols,
+    int64_t nz
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+    info = GrB_Matrix_new (&A, type, nrows, ncols) ;
+    for (int64_t k = 0 ; k < nz && info == GrB_SUCCESS ; k++)
+    {
+        info = GrB_Matrix_setElement_FP64 (A, (irand ( ) % 20) + 0.5,
+            irand ( ) % nrows, irand ( ) % ncols) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (A, GrB_MATERIALIZE) ;
+    if (info != GrB_SUCCESS) GrB_Matrix_free (&A) ;
+    (*A_handle) = A ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// add_pending_work: give a matrix some zombies and pending tuples
+//------------------------------------------------------------------------------
+
+static GrB_Info add_pending_work (GrB_Matrix A)
+{
+    GrB_Info info ;
+    GrB_Index nrows, ncols ;
+    info = GrB_Matrix_nrows (&nrows, A) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_ncols (&ncols, A) ;
+    // delete some entries, which become zombies
+    for (int64_t k = 0 ; k < 40 && info == GrB_SUCCESS ; k++)
+    {
+        info = GrB_Matrix_removeElement (A, irand ( ) % nrows,
+            irand ( ) % ncols) ;
+    }
+    // add some new entries, which become pending tuples
+    for (int64_t k = 0 ; k < 40 && info == GrB_SUCCESS ; k++)
+    {
+        info = GrB_Matrix_setElement_FP64 (A, (irand ( ) % 20) - 9.5,
+            irand ( ) % nrows, irand ( ) % ncols) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A [KMAX], M = NULL, T = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Descriptor desc1 = NULL, desc2 = NULL ;
+    for (int i = 0 ; i < KMAX ; i++)
+    {
+        A [i] = NULL ;
+    }
+
+    // the inputs have mixed types, and are typecast to the monoid type
+    GrB_Type atypes [3] = { GrB_FP64, GrB_INT32, GrB_UINT8 } ;
+    GrB_Monoid monoids [2] = { GrB_PLUS_MONOID_INT32, GrB_MIN_MONOID_FP64 } ;
+    GrB_UnaryOp identity [2] = { GrB_IDENTITY_INT32, GrB_IDENTITY_FP64 } ;
+    GrB_Type ttypes [2] = { GrB_INT32, GrB_FP64 } ;
+    int klist [5] = { 1, 2, 3, 5, 8 } ;
+    // sparse inputs are summed in a tree, dense ones left-to-right
+    int64_t nzlist [2] = { 100, 2000 } ;
+
+    for (int trial = 0 ; trial < 5*2*2*2*4*2 ; trial++)
+    {
+        int t = trial ;
+        int kaccum = t % 2 ; t /= 2 ;
+        // kmask 0: no mask, 1: M, 2: !M, 3: structural M
+        int kmask = t % 4 ; t /= 4 ;
+        int a_trans = t % 2 ; t /= 2 ;
+        int knz = t % 2 ; t /= 2 ;
+        int kmonoid = t % 2 ; t /= 2 ;
+        int k = klist [t] ;
+        GrB_Monoid monoid = monoids [kmonoid] ;
+
+        //----------------------------------------------------------------------
+        // create the problem
+        //----------------------------------------------------------------------
+
+        GrB_Index anrows = a_trans ? NCOLS : NROWS ;
+        GrB_Index ancols = a_trans ? NROWS : NCOLS ;
+        for (int i = 0 ; i < k ; i++)
+        {
+            OK (random_matrix (&(A [i]), atypes [i % 3], anrows, ancols,
+                nzlist [knz])) ;
+            if (i % 2 == 1)
+            {
+                OK (GrB_Matrix_set_INT32 (A [i], GrB_ROWMAJOR,
+                    GrB_STORAGE_ORIENTATION_HINT)) ;
+            }
+            // most inputs are sparse, so they can have zombies and pending
+            // tuples; a few are bitmap
+            OK (GrB_Matrix_set_INT32 (A [i], (i % 4 == 3) ? GxB_BITMAP :
+                GxB_SPARSE, GxB_SPARSITY_CONTROL)) ;
+            OK (add_pending_work (A [i])) ;
+        }
+        CHECK (GB_PENDING (A [0]) || GB_ZOMBIES (A [0])) ;
+        if (kmask > 0)
+        {
+            OK (random_matrix (&M, GrB_BOOL, NROWS, NCOLS, 1000)) ;
+        }
+        OK (random_matrix (&C1, GrB_FP64, NROWS, NCOLS, 500)) ;
+        OK (GrB_Matrix_dup (&C2, C1)) ;
+        GrB_BinaryOp accum = kaccum ? GrB_PLUS_FP64 : NULL ;
+
+        // desc1 is used for GxB_Matrix_eWiseAdd_n, and desc2 for GrB_apply
+        // of T into C2
+        OK (GrB_Descriptor_new (&desc1)) ;
+        OK (GrB_Descriptor_new (&desc2)) ;
+        if (a_trans)
+        {
+            OK (GrB_Descriptor_set (desc1, GrB_INP0, GrB_TRAN)) ;
+            OK (GrB_Descriptor_set (desc2, GrB_INP0, GrB_TRAN)) ;
+        }
+        if (kmask == 2)
+        {
+            OK (GrB_Descriptor_set (desc1, GrB_MASK, GrB_COMP)) ;
+            OK (GrB_Descriptor_set (desc2, GrB_MASK, GrB_COMP)) ;
+        }
+        else if (kmask == 3)
+        {
+            OK (GrB_Descriptor_set (desc1, GrB_MASK, GrB_STRUCTURE)) ;
+            OK (GrB_Descriptor_set (desc2, GrB_MASK, GrB_STRUCTURE)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // C1<M> = accum (C1, A[0]+...+A[k-1])
+        //----------------------------------------------------------------------
+
+        OK (GxB_Matrix_eWiseAdd_n (C1, M, accum, monoid, A, k, desc1)) ;
+
+        //----------------------------------------------------------------------
+        // C2<M> = accum (C2, T) where T = ((ttype) A[0] + A[1]) + ...
+        //----------------------------------------------------------------------
+
+        // A[i] is now finished, so T is computed from the same entries
+        OK (GrB_Matrix_new (&T, ttypes [kmonoid], anrows, ancols)) ;
+        OK (GrB_Matrix_apply (T, NULL, NULL, identity [kmonoid], A [0],
+            NULL)) ;
+        for (int i = 1 ; i < k ; i++)
+        {
+            OK (GrB_Matrix_eWiseAdd_Monoid (T, NULL, NULL, monoid, T,
+                A [i], NULL)) ;
+        }
+        OK (GrB_Matrix_apply (C2, M, accum, identity [kmonoid], T,
+            desc2)) ;
+
+        //----------------------------------------------------------------------
+        // check the result
+        //----------------------------------------------------------------------
+
+        // C1 and C2 can be held in different formats
+        OK (GrB_Matrix_set_INT32 (C1, GxB_SPARSE, GxB_SPARSITY_CONTROL)) ;
+        OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE, GxB_SPARSITY_CONTROL)) ;
+        OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+        FREE_ALL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C = A[0] where C is aliased with A[0], and A[0] is typecast
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&C1, GrB_FP64, NROWS, NCOLS, 500)) ;
+    OK (GrB_Matrix_set_INT32 (C1, GxB_SPARSE, GxB_SPARSITY_CONTROL)) ;
+    OK (add_pending_work (C1)) ;
+    A [0] = C1 ;
+    OK (GxB_Matrix_eWiseAdd_n (C1, NULL, NULL, GrB_PLUS_MONOID_INT32, A, 1,
+        NULL)) ;
+    A [0] = NULL ;
+    OK (GrB_Matrix_new (&T, GrB_INT32, NROWS, NCOLS)) ;
+    OK (GrB_Matrix_apply (T, NULL, NULL, GrB_IDENTITY_INT32, C1, NULL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, NROWS, NCOLS)) ;
+    OK (GrB_Matrix_apply (C2, NULL, NULL, GrB_IDENTITY_FP64, T, NULL)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+    FREE_ALL ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&C1, GrB_FP64, NROWS, NCOLS)) ;
+    OK (GrB_Matrix_new (&(A [0]), GrB_FP64, NROWS, NCOLS)) ;
+    OK (GrB_Matrix_new (&(A [1]), GrB_FP64, NCOLS, NROWS)) ;
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR (GxB_Matrix_eWiseAdd_n (C1, NULL, NULL, GrB_PLUS_MONOID_FP64, A, 2,
+        NULL)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Matrix_eWiseAdd_n (C1, NULL, NULL, GrB_PLUS_MONOID_FP64, A, 0,
+        NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test48:  all tests passed.\n\n") ;
+}
+
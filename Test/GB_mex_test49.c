@@ -0,0 +1,238 @@
+//------------------------------------------------------------------------------
+// GB_mex_test49: test the JIT with a cache path that cannot be written
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Without an embedded compiler, a cache path that cannot be written is
+// rejected and the JIT is restricted to GxB_JIT_RUN, but results are still
+// correct.  If an embedded compiler (libtcc.so) can be opened, the same cache
+// path is accepted, the JIT control stays at GxB_JIT_ON, and a new kernel is
+// compiled in memory and recorded in the manifest.  The results are compared
+// with the generic kernels (with the JIT off).
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test49"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_BinaryOp_free (&op) ;           \
+    if (save_cache != NULL) mxFree (save_cache) ;       \
+    if (save_embedded != NULL) mxFree (save_embedded) ; \
+    if (save_manifest != NULL) mxFree (save_manifest) ; \
+    save_cache = NULL ;                 \
+    save_embedded = NULL ;              \
+    save_manifest = NULL ;              \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 200
+#define NO_CACHE "/proc/GrB_no_cache"
+#define MANIFEST "/tmp/GB_mex_test49_manifest.txt"
+
+// a user-defined operator, with a definition so it can be JIT'd
+void mymult49 (double *z, const double *x, const double *y) ;
+void mymult49 (double *z, const double *x, const double *y)
+{
+    (*z) = 2 * (*x) - (*y) ;
+}
+#define MYMULT49_DEFN                                           \
+"void mymult49 (double *z, const double *x, const double *y)\n" \
+"{                                                          \n" \
+"    (*z) = 2 * (*x) - (*y) ;                               \n" \
+"}"
+
+static uint64_t seed = 1 ;
+
+static int64_t irand (void)
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+    return ((int64_t) (seed >> 33)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random sparse N-by-N FP64 matrix
+//------------------------------------------------------------------------------
+
+static GrB_Info random_matrix (GrB_Matrix *A)
+{
+    GrB_Info info = GrB_Matrix_new (A, GrB_FP64, N, N) ;
+    for (int64_t k = 0 ; info == GrB_SUCCESS && k < 4 * N ; k++)
+    {
+        info = GrB_Matrix_setElement_FP64 (*A, (double) (irand ( ) % 100),
+            irand ( ) % N, irand ( ) % N) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*A, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// jit_result: C = A.*B with the JIT set to the given control
+//------------------------------------------------------------------------------
+
+static GrB_Info jit_result (GrB_Matrix *C, GrB_Matrix A, GrB_Matrix B,
+    GrB_BinaryOp op, int control)
+{
+    GrB_Info info = GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, control) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_new (C, GrB_FP64, N, N) ;
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_eWiseMult_BinaryOp (*C, NULL, NULL, op, A, B,
+            NULL) ;
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_set_INT32 (*C, GxB_SPARSE, GxB_SPARSITY_CONTROL) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*C, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL ;
+    GrB_BinaryOp op = NULL ;
+    char *save_cache = NULL, *save_embedded = NULL, *save_manifest = NULL ;
+    size_t size ;
+    int32_t save_control, control ;
+
+    //--------------------------------------------------------------------------
+    // save the JIT settings
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &save_control)) ;
+    OK (GrB_Global_get_SIZE_ (GrB_GLOBAL, &size, GxB_JIT_CACHE_PATH)) ;
+    save_cache = mxMalloc (size) ;
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, save_cache, GxB_JIT_CACHE_PATH)) ;
+    OK (GrB_Global_get_SIZE_ (GrB_GLOBAL, &size, GxB_JIT_C_EMBEDDED)) ;
+    save_embedded = mxMalloc (size) ;
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, save_embedded,
+        GxB_JIT_C_EMBEDDED)) ;
+    OK (GrB_Global_get_SIZE_ (GrB_GLOBAL, &size, GxB_JIT_MANIFEST)) ;
+    save_manifest = mxMalloc (size) ;
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, save_manifest, GxB_JIT_MANIFEST)) ;
+
+    //--------------------------------------------------------------------------
+    // create the inputs and the result from the generic kernel
+    //--------------------------------------------------------------------------
+
+    OK (GxB_BinaryOp_new (&op, (GxB_binary_function) mymult49,
+        GrB_FP64, GrB_FP64, GrB_FP64, "mymult49", MYMULT49_DEFN)) ;
+    OK (random_matrix (&A)) ;
+    OK (random_matrix (&B)) ;
+    OK (jit_result (&C1, A, B, op, GxB_JIT_OFF)) ;
+
+    //--------------------------------------------------------------------------
+    // read-only cache without an embedded compiler
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, "", GxB_JIT_C_EMBEDDED)) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Global_set_String_ (GrB_GLOBAL, NO_CACHE, GxB_JIT_CACHE_PATH)) ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &control)) ;
+    CHECK (control == GxB_JIT_RUN) ;
+    OK (jit_result (&C2, A, B, op, GxB_JIT_RUN)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+    GrB_Matrix_free (&C2) ;
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, save_cache, GxB_JIT_CACHE_PATH)) ;
+
+    //--------------------------------------------------------------------------
+    // read-only cache with an embedded compiler
+    //--------------------------------------------------------------------------
+
+    if (GrB_Global_set_String_ (GrB_GLOBAL, "libtcc.so",
+        GxB_JIT_C_EMBEDDED) == GrB_SUCCESS)
+    {
+        remove (MANIFEST) ;
+        OK (GrB_Global_set_String_ (GrB_GLOBAL, MANIFEST, GxB_JIT_MANIFEST)) ;
+        OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+        OK (GrB_Global_set_String_ (GrB_GLOBAL, NO_CACHE,
+            GxB_JIT_CACHE_PATH)) ;
+        OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &control)) ;
+        CHECK (control == GxB_JIT_ON) ;
+
+        // compile the kernel in memory
+        OK (jit_result (&C2, A, B, op, GxB_JIT_ON)) ;
+        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+        GrB_Matrix_free (&C2) ;
+        OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &control)) ;
+        CHECK (control == GxB_JIT_ON) ;
+
+        // the kernel was compiled, so it appears in the manifest
+        FILE *fp = fopen (MANIFEST, "r") ;
+        CHECK (fp != NULL) ;
+        char line [1024] ;
+        bool found = false ;
+        while (fgets (line, 1024, fp) != NULL)
+        {
+            found = found || (strstr (line, "GB_jit__emult") != NULL) ;
+        }
+        fclose (fp) ;
+        CHECK (found) ;
+        remove (MANIFEST) ;
+
+        // the kernel is now loaded, and is used again
+        OK (jit_result (&C2, A, B, op, GxB_JIT_RUN)) ;
+        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+        GrB_Matrix_free (&C2) ;
+
+        // without the embedded compiler, the cache is rejected again
+        OK (GrB_Global_set_String_ (GrB_GLOBAL, "", GxB_JIT_C_EMBEDDED)) ;
+        OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+        expected = GrB_INVALID_VALUE ;
+        ERR (GrB_Global_set_String_ (GrB_GLOBAL, NO_CACHE,
+            GxB_JIT_CACHE_PATH)) ;
+        OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &control)) ;
+        CHECK (control == GxB_JIT_RUN) ;
+        OK (GrB_Global_set_String_ (GrB_GLOBAL, save_cache,
+            GxB_JIT_CACHE_PATH)) ;
+    }
+    else
+    {
+        printf ("libtcc.so not found: embedded compiler not tested\n") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // restore the JIT settings
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, save_manifest, GxB_JIT_MANIFEST)) ;
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, save_embedded,
+        GxB_JIT_C_EMBEDDED)) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, save_control)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test49:  all tests passed.\n\n") ;
+}
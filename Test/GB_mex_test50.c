@@ -0,0 +1,238 @@
+//------------------------------------------------------------------------------
+// GB_mex_test50: test the ultra-fine tasks of dot3
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M>=A'*B is computed where a few columns of A and B are hubs: they are
+// dense, while all other columns hold only a few entries.  With several
+// threads and a small chunk, the dot products of two hubs are split into
+// ultra-fine tasks (see GB_AxB_dot3_slice).  The mask is valued (with some of
+// its entries false, including some between two hubs), structural, or not
+// present (which uses dot2 instead).  A and B are sparse or hypersparse.  The
+// result is compared with C computed by a single thread, with no split.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test50"
+
+#define FREE_ALL                            \
+{                                           \
+    GrB_Matrix_free (&A) ;                  \
+    GrB_Matrix_free (&B) ;                  \
+    GrB_Matrix_free (&M) ;                  \
+    GrB_Matrix_free (&C1) ;                 \
+    GrB_Matrix_free (&C2) ;                 \
+    GrB_BinaryOp_free (&mytimes) ;          \
+    GrB_Semiring_free (&mysemiring) ;       \
+    GrB_Descriptor_free (&desc) ;           \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 4000
+#define NHUBS 3
+#define NSEMIRINGS 6
+#define NMASKS 3
+#define NCHUNKS 3
+
+// a user-defined multiplicative operator, for the generic kernel
+void mytimes50 (int64_t *z, const int64_t *x, const int64_t *y) ;
+void mytimes50 (int64_t *z, const int64_t *x, const int64_t *y)
+{
+    (*z) = (*x) * (*y) ;
+}
+
+static uint64_t seed = 1 ;
+
+static int64_t irand (void)
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+    return ((int64_t) (seed >> 33)) ;
+}
+
+//------------------------------------------------------------------------------
+// hub_matrix: create an N-by-N matrix with NHUBS dense columns
+//------------------------------------------------------------------------------
+
+static GrB_Info hub_matrix (GrB_Matrix *A, int sparsity)
+{
+    GrB_Info info = GrB_Matrix_new (A, GrB_INT64, N, N) ;
+    for (int64_t i = 0 ; info == GrB_SUCCESS && i < N ; i++)
+    {
+        for (int64_t j = 0 ; info == GrB_SUCCESS && j < NHUBS ; j++)
+        {
+            info = GrB_Matrix_setElement_INT64 (*A, irand ( ) % 7 - 3, i, j) ;
+        }
+    }
+    for (int64_t k = 0 ; info == GrB_SUCCESS && k < N ; k++)
+    {
+        info = GrB_Matrix_setElement_INT64 (*A, irand ( ) % 7 - 3,
+            irand ( ) % N, irand ( ) % N) ;
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_set_INT32 (*A, sparsity, GxB_SPARSITY_CONTROL) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*A, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// mxm: C<M>=A'*B with the given # of threads and chunk
+//------------------------------------------------------------------------------
+
+static GrB_Info mxm (GrB_Matrix *C, GrB_Matrix M, GrB_Semiring semiring,
+    GrB_Matrix A, GrB_Matrix B, GrB_Descriptor desc, int nthreads,
+    double chunk)
+{
+    GrB_Info info = GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads) ;
+    if (info == GrB_SUCCESS)
+    {
+        info = GxB_Global_Option_set_FP64 (GxB_CHUNK, chunk) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_new (C, GrB_INT64, N, N) ;
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_mxm (*C, M, NULL, semiring, A, B, desc) ;
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_set_INT32 (*C, GxB_SPARSE, GxB_SPARSITY_CONTROL) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*C, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C1 = NULL, C2 = NULL ;
+    GrB_BinaryOp mytimes = NULL ;
+    GrB_Semiring mysemiring = NULL ;
+    GrB_Descriptor desc = NULL ;
+    int32_t save_nthreads, save_control ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &save_control)) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+
+    OK (GrB_BinaryOp_new (&mytimes, (GxB_binary_function) mytimes50,
+        GrB_INT64, GrB_INT64, GrB_INT64)) ;
+    OK (GrB_Semiring_new (&mysemiring, GrB_PLUS_MONOID_INT64, mytimes)) ;
+    GrB_Semiring semirings [NSEMIRINGS] = {
+        GrB_PLUS_TIMES_SEMIRING_INT64, GrB_MIN_PLUS_SEMIRING_INT64,
+        GrB_MAX_TIMES_SEMIRING_INT64, GxB_PLUS_PAIR_INT64, GxB_ANY_PAIR_INT64,
+        mysemiring } ;
+    double chunks [NCHUNKS] = { 1, 100, 1000 } ;
+
+    //--------------------------------------------------------------------------
+    // create the mask
+    //--------------------------------------------------------------------------
+
+    // M holds a random set of entries, and all entries between two hubs.
+    // Some of the entries are false, including M(1,1) and M(2,0).
+    OK (GrB_Matrix_new (&M, GrB_BOOL, N, N)) ;
+    for (int64_t k = 0 ; k < 4 * N ; k++)
+    {
+        OK (GrB_Matrix_setElement_BOOL (M, irand ( ) % 4 != 0,
+            irand ( ) % N, irand ( ) % N)) ;
+    }
+    for (int64_t i = 0 ; i < NHUBS ; i++)
+    {
+        for (int64_t j = 0 ; j < NHUBS ; j++)
+        {
+            bool mij = !((i == 1 && j == 1) || (i == 2 && j == 0)) ;
+            OK (GrB_Matrix_setElement_BOOL (M, mij, i, j)) ;
+        }
+    }
+    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // compare C<M>=A'*B with and without ultra-fine tasks
+    //--------------------------------------------------------------------------
+
+    for (int hyper = 0 ; hyper <= 1 ; hyper++)
+    {
+        int sparsity = hyper ? GxB_HYPERSPARSE : GxB_SPARSE ;
+        OK (hub_matrix (&A, sparsity)) ;
+        OK (hub_matrix (&B, sparsity)) ;
+
+        for (int s = 0 ; s < NSEMIRINGS ; s++)
+        {
+            for (int m = 0 ; m < NMASKS ; m++)
+            {
+                // m = 0: valued mask, 1: structural mask, 2: no mask
+                OK (GrB_Descriptor_new (&desc)) ;
+                OK (GrB_Descriptor_set_INT32 (desc, GrB_TRAN, GrB_INP0)) ;
+                OK (GrB_Descriptor_set_INT32 (desc, GxB_AxB_DOT,
+                    GxB_AxB_METHOD)) ;
+                if (m == 1)
+                {
+                    OK (GrB_Descriptor_set_INT32 (desc, GrB_STRUCTURE,
+                        GrB_MASK)) ;
+                }
+                GrB_Matrix Mask = (m == 2) ? NULL : M ;
+
+                // C1 = the result with no split
+                OK (mxm (&C1, Mask, semirings [s], A, B, desc, 1, 1e9)) ;
+
+                for (int c = 0 ; c < NCHUNKS ; c++)
+                {
+                    // C2 = the result with hub dot products split
+                    OK (mxm (&C2, Mask, semirings [s], A, B, desc, 4,
+                        chunks [c])) ;
+                    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                    GrB_Matrix_free (&C2) ;
+                }
+
+                if (m == 0)
+                {
+                    // C(1,1) and C(2,0) are not computed
+                    int64_t x ;
+                    CHECK (GrB_Matrix_extractElement_INT64 (&x, C1, 1, 1)
+                        == GrB_NO_VALUE) ;
+                    CHECK (GrB_Matrix_extractElement_INT64 (&x, C1, 2, 0)
+                        == GrB_NO_VALUE) ;
+                }
+
+                GrB_Matrix_free (&C1) ;
+                GrB_Descriptor_free (&desc) ;
+            }
+        }
+
+        GrB_Matrix_free (&A) ;
+        GrB_Matrix_free (&B) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, save_control)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test50:  all tests passed.\n\n") ;
+}
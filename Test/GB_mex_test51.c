@@ -0,0 +1,274 @@
+//------------------------------------------------------------------------------
+// GB_mex_test51: test the block and galloping intersection in dot2 and dot3
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A'*B (dot2) and C<M>=A'*B (dot3) are computed where A and B are sparse and
+// most of their columns have at least GB_DOT_INTERSECT_MIN (16) entries, so
+// that A(:,i) and B(:,j) are intersected in blocks, or by galloping when
+// their lengths differ by a factor of 16 or more.  The column lengths range
+// from 1 to half the number of rows, and some columns of B hold all of the
+// entries of a column of A, so that some intersections have more matches than
+// GB_DOT_INTERSECT_CHUNK (64).  The result is compared with a one-at-a-time
+// merge of each pair of columns, computed here.  The JIT is enabled, so that
+// the built-in semirings use their JIT kernels if GraphBLAS is compiled with
+// COMPACT, and the last semiring uses the generic kernel.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test51"
+
+#define FREE_ALL                            \
+{                                           \
+    GrB_Matrix_free (&A) ;                  \
+    GrB_Matrix_free (&B) ;                  \
+    GrB_Matrix_free (&M) ;                  \
+    GrB_Matrix_free (&C) ;                  \
+    GrB_Matrix_free (&R) ;                  \
+    GrB_BinaryOp_free (&mytimes) ;          \
+    GrB_Semiring_free (&mysemiring) ;       \
+    GrB_Descriptor_free (&desc) ;           \
+    if (Ap != NULL) mxFree (Ap) ;           \
+    if (Ai != NULL) mxFree (Ai) ;           \
+    if (Ax != NULL) mxFree (Ax) ;           \
+    if (Bp != NULL) mxFree (Bp) ;           \
+    if (Bi != NULL) mxFree (Bi) ;           \
+    if (Bx != NULL) mxFree (Bx) ;           \
+    Ap = NULL ; Ai = NULL ; Ax = NULL ;     \
+    Bp = NULL ; Bi = NULL ; Bx = NULL ;     \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define VLEN 5000
+#define N 48
+#define NSEMIRINGS 5
+
+// a user-defined multiplicative operator, for the generic kernel
+void mytimes51 (int64_t *z, const int64_t *x, const int64_t *y) ;
+void mytimes51 (int64_t *z, const int64_t *x, const int64_t *y)
+{
+    (*z) = (*x) * (*y) ;
+}
+
+static uint64_t seed = 1 ;
+
+static int64_t irand (void)
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+    return ((int64_t) (seed >> 33)) ;
+}
+
+// the length of column j of A and B
+static int64_t column_length (int64_t j)
+{
+    static const int64_t len [12] =
+        { 1, 15, 16, 17, 31, 64, 100, 257, 600, 1024, 2000, VLEN/2 } ;
+    return (len [j % 12]) ;
+}
+
+//------------------------------------------------------------------------------
+// get_columns: extract the columns of a sparse matrix, in sorted order
+//------------------------------------------------------------------------------
+
+static GrB_Info get_columns (GrB_Matrix A, int64_t **Ap, int64_t **Ai,
+    int64_t **Ax)
+{
+    GrB_Index nvals ;
+    GrB_Info info = GrB_Matrix_nvals (&nvals, A) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    (*Ap) = mxCalloc (N+1, sizeof (int64_t)) ;
+    (*Ai) = mxMalloc ((nvals+1) * sizeof (int64_t)) ;
+    (*Ax) = mxMalloc ((nvals+1) * sizeof (int64_t)) ;
+    GrB_Index *J = mxMalloc ((nvals+1) * sizeof (GrB_Index)) ;
+    // A is held by column, so its tuples are returned in column order
+    info = GrB_Matrix_extractTuples_INT64 ((GrB_Index *) (*Ai), J, *Ax,
+        &nvals, A) ;
+    for (int64_t p = 0 ; p < (int64_t) nvals ; p++)
+    {
+        (*Ap) [J [p] + 1]++ ;
+    }
+    for (int64_t j = 0 ; j < N ; j++)
+    {
+        (*Ap) [j+1] += (*Ap) [j] ;
+    }
+    mxFree (J) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C = NULL, R = NULL ;
+    GrB_BinaryOp mytimes = NULL ;
+    GrB_Semiring mysemiring = NULL ;
+    GrB_Descriptor desc = NULL ;
+    int64_t *Ap = NULL, *Ai = NULL, *Ax = NULL ;
+    int64_t *Bp = NULL, *Bi = NULL, *Bx = NULL ;
+    int32_t save_control ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &save_control)) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+
+    OK (GrB_BinaryOp_new (&mytimes, (GxB_binary_function) mytimes51,
+        GrB_INT64, GrB_INT64, GrB_INT64)) ;
+    OK (GrB_Semiring_new (&mysemiring, GrB_PLUS_MONOID_INT64, mytimes)) ;
+    // semirings 0 and 4 are PLUS_TIMES, 1 is MIN_PLUS, 2 is PLUS_PAIR, and
+    // 3 is ANY_PAIR
+    GrB_Semiring semirings [NSEMIRINGS] = {
+        GrB_PLUS_TIMES_SEMIRING_INT64, GrB_MIN_PLUS_SEMIRING_INT64,
+        GxB_PLUS_PAIR_INT64, GxB_ANY_PAIR_INT64, mysemiring } ;
+
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GrB_TRAN, GrB_INP0)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_AxB_DOT, GxB_AxB_METHOD)) ;
+
+    //--------------------------------------------------------------------------
+    // create A, B, and M
+    //--------------------------------------------------------------------------
+
+    // A(:,j) and B(:,j) have random patterns with a range of lengths.  Every
+    // 4th column of B also holds all of A(:,j).
+    OK (GrB_Matrix_new (&A, GrB_INT64, VLEN, N)) ;
+    OK (GrB_Matrix_new (&B, GrB_INT64, VLEN, N)) ;
+    for (int64_t j = 0 ; j < N ; j++)
+    {
+        int64_t alen = column_length (j) ;
+        int64_t blen = column_length (N - 1 - j + j / 12) ;
+        for (int64_t k = 0 ; k < alen ; k++)
+        {
+            int64_t i = irand ( ) % VLEN ;
+            int64_t x = irand ( ) % 7 - 3 ;
+            OK (GrB_Matrix_setElement_INT64 (A, x, i, j)) ;
+            if (j % 4 == 0)
+            {
+                OK (GrB_Matrix_setElement_INT64 (B, x + 1, i, j)) ;
+            }
+        }
+        for (int64_t k = 0 ; k < blen ; k++)
+        {
+            OK (GrB_Matrix_setElement_INT64 (B, irand ( ) % 7 - 3,
+                irand ( ) % VLEN, j)) ;
+        }
+    }
+    OK (GrB_Matrix_new (&M, GrB_BOOL, N, N)) ;
+    for (int64_t k = 0 ; k < N * N / 2 ; k++)
+    {
+        OK (GrB_Matrix_setElement_BOOL (M, true, irand ( ) % N,
+            irand ( ) % N)) ;
+    }
+    OK (GrB_Matrix_set_INT32 (A, GxB_SPARSE, GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (B, GxB_SPARSE, GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+    OK (get_columns (A, &Ap, &Ai, &Ax)) ;
+    OK (get_columns (B, &Bp, &Bi, &Bx)) ;
+
+    //--------------------------------------------------------------------------
+    // compare C=A'*B and C<M>=A'*B with a merge of each pair of columns
+    //--------------------------------------------------------------------------
+
+    for (int s = 0 ; s < NSEMIRINGS ; s++)
+    {
+        for (int masked = 0 ; masked <= 1 ; masked++)
+        {
+
+            //------------------------------------------------------------------
+            // R = A'*B, computed one entry at a time
+            //------------------------------------------------------------------
+
+            OK (GrB_Matrix_new (&R, GrB_INT64, N, N)) ;
+            for (int64_t i = 0 ; i < N ; i++)
+            {
+                for (int64_t j = 0 ; j < N ; j++)
+                {
+                    bool mij ;
+                    if (masked && GrB_Matrix_extractElement_BOOL (&mij, M, i,
+                        j) == GrB_NO_VALUE) continue ;
+                    int64_t pA = Ap [i], pA_end = Ap [i+1] ;
+                    int64_t pB = Bp [j], pB_end = Bp [j+1] ;
+                    bool cij_exists = false ;
+                    int64_t cij = 0 ;
+                    while (pA < pA_end && pB < pB_end)
+                    {
+                        if (Ai [pA] < Bi [pB])
+                        {
+                            pA++ ;
+                        }
+                        else if (Ai [pA] > Bi [pB])
+                        {
+                            pB++ ;
+                        }
+                        else
+                        {
+                            int64_t a = Ax [pA++], b = Bx [pB++] ;
+                            switch (s)
+                            {
+                                case 1 :    // MIN_PLUS
+                                    cij = cij_exists ? GB_IMIN (cij, a + b)
+                                        : (a + b) ;
+                                    break ;
+                                case 2 :    // PLUS_PAIR
+                                case 3 :    // ANY_PAIR
+                                    cij = (s == 2) ? (cij + 1) : 1 ;
+                                    break ;
+                                default :   // PLUS_TIMES
+                                    cij += a * b ;
+                                    break ;
+                            }
+                            cij_exists = true ;
+                        }
+                    }
+                    if (cij_exists)
+                    {
+                        OK (GrB_Matrix_setElement_INT64 (R, cij, i, j)) ;
+                    }
+                }
+            }
+            OK (GrB_Matrix_set_INT32 (R, GxB_SPARSE, GxB_SPARSITY_CONTROL)) ;
+            OK (GrB_Matrix_wait (R, GrB_MATERIALIZE)) ;
+
+            //------------------------------------------------------------------
+            // C = A'*B, using dot2 if not masked or dot3 if masked
+            //------------------------------------------------------------------
+
+            OK (GrB_Matrix_new (&C, GrB_INT64, N, N)) ;
+            OK (GrB_mxm (C, masked ? M : NULL, NULL, semirings [s], A, B,
+                desc)) ;
+            OK (GrB_Matrix_set_INT32 (C, GxB_SPARSE, GxB_SPARSITY_CONTROL)) ;
+            OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+            CHECK (GB_mx_isequal (C, R, 0)) ;
+            GrB_Matrix_free (&C) ;
+            GrB_Matrix_free (&R) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, save_control)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test51:  all tests passed.\n\n") ;
+}
@@ -0,0 +1,233 @@
+//------------------------------------------------------------------------------
+// GB_mex_test52: test the tiled dot2 method for C=A'*B, with A, B, C full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A'*B is computed by dot2 for full matrices A and B, with the PLUS_TIMES,
+// MIN_PLUS, and MAX_PLUS semirings for FP64, and PLUS_TIMES for FC64.  The
+// built-in semirings use the tiled method (Template/GB_AxB_dot2_tile_template)
+// in their factory kernels, or in their JIT kernels if GraphBLAS is compiled
+// with COMPACT.  Each result is compared with the same semiring constructed
+// from a user-defined multiplicative operator, with the JIT off, which uses
+// the untiled generic kernel.  Each entry is computed with its terms in the
+// same order by both methods, so the results must be identical.  The
+// dimensions of C are not all multiples of the 4-by-4 tile, and the inner
+// dimension crosses one or more boundaries of the panels of B.  Some entries
+// of A are NaN or +Inf, to test the MIN and MAX monoids and the early exit of
+// the terminal MAX monoid.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test52"
+
+#define FREE_ALL                            \
+{                                           \
+    GrB_Matrix_free (&A) ;                  \
+    GrB_Matrix_free (&B) ;                  \
+    GrB_Matrix_free (&C1) ;                 \
+    GrB_Matrix_free (&C2) ;                 \
+    GrB_BinaryOp_free (&mytimes) ;          \
+    GrB_BinaryOp_free (&myplus) ;           \
+    GrB_BinaryOp_free (&mytimes_fc64) ;     \
+    for (int s = 0 ; s < NSEMIRINGS ; s++)  \
+    {                                       \
+        GrB_Semiring_free (&(generic [s])) ;\
+    }                                       \
+    GrB_Descriptor_free (&desc) ;           \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NSEMIRINGS 4
+#define NDIMS 4
+
+// user-defined multiplicative operators, for the generic kernel
+void mytimes52 (double *z, const double *x, const double *y) ;
+void mytimes52 (double *z, const double *x, const double *y)
+{
+    (*z) = (*x) * (*y) ;
+}
+
+void myplus52 (double *z, const double *x, const double *y) ;
+void myplus52 (double *z, const double *x, const double *y)
+{
+    (*z) = (*x) + (*y) ;
+}
+
+void mytimes52_fc64 (GxB_FC64_t *z, const GxB_FC64_t *x, const GxB_FC64_t *y) ;
+void mytimes52_fc64 (GxB_FC64_t *z, const GxB_FC64_t *x, const GxB_FC64_t *y)
+{
+    (*z) = GB_FC64_mul (*x, *y) ;
+}
+
+static uint64_t seed = 1 ;
+
+static int64_t irand (void)
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+    return ((int64_t) (seed >> 33)) ;
+}
+
+static double xrand (void)
+{
+    return ((double) (irand ( ) % 2001 - 1000) / 256.) ;
+}
+
+//------------------------------------------------------------------------------
+// full_matrix: create a full m-by-n FP64 or FC64 matrix
+//------------------------------------------------------------------------------
+
+static GrB_Info full_matrix (GrB_Matrix *A, GrB_Type type, int64_t m,
+    int64_t n, bool special)
+{
+    GrB_Info info = GrB_Matrix_new (A, type, m, n) ;
+    for (int64_t j = 0 ; info == GrB_SUCCESS && j < n ; j++)
+    {
+        for (int64_t i = 0 ; info == GrB_SUCCESS && i < m ; i++)
+        {
+            double x = xrand ( ) ;
+            if (special && irand ( ) % 500 == 0)
+            {
+                // a few entries are NaN or +Inf
+                x = (irand ( ) % 2 == 0) ? NAN : INFINITY ;
+            }
+            if (type == GxB_FC64)
+            {
+                info = GxB_Matrix_setElement_FC64 (*A, GxB_CMPLX (x, xrand ( )),
+                    i, j) ;
+            }
+            else
+            {
+                info = GrB_Matrix_setElement_FP64 (*A, x, i, j) ;
+            }
+        }
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_set_INT32 (*A, GxB_FULL, GxB_SPARSITY_CONTROL) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*A, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL ;
+    GrB_BinaryOp mytimes = NULL, myplus = NULL, mytimes_fc64 = NULL ;
+    GrB_Semiring generic [NSEMIRINGS] ;
+    for (int s = 0 ; s < NSEMIRINGS ; s++) generic [s] = NULL ;
+    GrB_Descriptor desc = NULL ;
+    int32_t save_nthreads, save_control ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &save_control)) ;
+
+    //--------------------------------------------------------------------------
+    // create the semirings
+    //--------------------------------------------------------------------------
+
+    OK (GrB_BinaryOp_new (&mytimes, (GxB_binary_function) mytimes52,
+        GrB_FP64, GrB_FP64, GrB_FP64)) ;
+    OK (GrB_BinaryOp_new (&myplus, (GxB_binary_function) myplus52,
+        GrB_FP64, GrB_FP64, GrB_FP64)) ;
+    OK (GrB_BinaryOp_new (&mytimes_fc64, (GxB_binary_function) mytimes52_fc64,
+        GxB_FC64, GxB_FC64, GxB_FC64)) ;
+    OK (GrB_Semiring_new (&(generic [0]), GrB_PLUS_MONOID_FP64, mytimes)) ;
+    OK (GrB_Semiring_new (&(generic [1]), GrB_MIN_MONOID_FP64, myplus)) ;
+    OK (GrB_Semiring_new (&(generic [2]), GrB_MAX_MONOID_FP64, myplus)) ;
+    OK (GrB_Semiring_new (&(generic [3]), GxB_PLUS_FC64_MONOID,
+        mytimes_fc64)) ;
+    GrB_Semiring builtin [NSEMIRINGS] = {
+        GrB_PLUS_TIMES_SEMIRING_FP64, GrB_MIN_PLUS_SEMIRING_FP64,
+        GrB_MAX_PLUS_SEMIRING_FP64, GxB_PLUS_TIMES_FC64 } ;
+
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GrB_TRAN, GrB_INP0)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_AxB_DOT, GxB_AxB_METHOD)) ;
+
+    // C is m-by-n, and the inner dimension is k.  The panel of B holds 512
+    // FP64 or 256 FC64 entries of each column of B.
+    int64_t dims [NDIMS][3] = {
+        { 1, 1, 1 },
+        { 7, 13, 257 },
+        { 30, 9, 513 },
+        { 17, 22, 1100 } } ;
+
+    //--------------------------------------------------------------------------
+    // compare the tiled and untiled methods
+    //--------------------------------------------------------------------------
+
+    for (int d = 0 ; d < NDIMS ; d++)
+    {
+        int64_t m = dims [d][0], n = dims [d][1], k = dims [d][2] ;
+        for (int s = 0 ; s < NSEMIRINGS ; s++)
+        {
+            GrB_Type type = (s == 3) ? GxB_FC64 : GrB_FP64 ;
+            bool special = (s == 1 || s == 2) ;
+            OK (full_matrix (&A, type, k, m, special)) ;
+            OK (full_matrix (&B, type, k, n, false)) ;
+
+            for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+            {
+                OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads)) ;
+                OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 1)) ;
+
+                // C1 = A'*B with the tiled method
+                OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL,
+                    GxB_JIT_ON)) ;
+                OK (GrB_Matrix_new (&C1, type, m, n)) ;
+                OK (GrB_mxm (C1, NULL, NULL, builtin [s], A, B, desc)) ;
+                OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+
+                // C2 = A'*B with the untiled generic method
+                OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL,
+                    GxB_JIT_OFF)) ;
+                OK (GrB_Matrix_new (&C2, type, m, n)) ;
+                OK (GrB_mxm (C2, NULL, NULL, generic [s], A, B, desc)) ;
+                OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+
+                CHECK (GB_IS_FULL (C1)) ;
+                CHECK (GB_IS_FULL (C2)) ;
+                CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                GrB_Matrix_free (&C1) ;
+                GrB_Matrix_free (&C2) ;
+            }
+
+            GrB_Matrix_free (&A) ;
+            GrB_Matrix_free (&B) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, save_control)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test52:  all tests passed.\n\n") ;
+}
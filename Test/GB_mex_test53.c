@@ -0,0 +1,225 @@
+//------------------------------------------------------------------------------
+// GB_mex_test53: test C<#M>+=A.*B in place, where C is bitmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<#M>+=A.*B, where C is bitmap, A and B are bitmap or full, and the accum
+// operator is the same as the binary operator, is computed in place by
+// GB_emult_bitmap_accum.  That method has only a JIT kernel, so it is
+// computed here with the JIT on, and compared with the result with the JIT off,
+// which computes T=A.*B and then C<#M>=accum(C,T).  The mask is not present,
+// bitmap (valued or structural), full, or sparse, hypersparse, or bitmap and
+// complemented.  C may be aliased with A or B, and A or B may be iso.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test53"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&M) ;              \
+    GrB_Matrix_free (&C0) ;             \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define M_ROWS 40
+#define N_COLS 31
+#define NOPS 4
+#define NMASKS 7
+
+static uint64_t seed = 1 ;
+
+static int64_t irand (void)
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+    return ((int64_t) (seed >> 33)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random FP64 matrix with the given sparsity
+//------------------------------------------------------------------------------
+
+// If iso is true, the matrix is full and iso.  Otherwise, about half the
+// entries are present (all of them if the sparsity is GxB_FULL).
+
+static GrB_Info random_matrix (GrB_Matrix *A, int sparsity, bool iso)
+{
+    GrB_Info info = GrB_Matrix_new (A, GrB_FP64, M_ROWS, N_COLS) ;
+    if (iso)
+    {
+        if (info == GrB_SUCCESS)
+        {
+            info = GrB_Matrix_assign_FP64 (*A, NULL, NULL, 3, GrB_ALL, M_ROWS,
+                GrB_ALL, N_COLS, NULL) ;
+        }
+    }
+    else
+    {
+        for (int64_t j = 0 ; info == GrB_SUCCESS && j < N_COLS ; j++)
+        {
+            for (int64_t i = 0 ; info == GrB_SUCCESS && i < M_ROWS ; i++)
+            {
+                if (sparsity == GxB_FULL || irand ( ) % 2 == 0)
+                {
+                    info = GrB_Matrix_setElement_FP64 (*A,
+                        (double) (irand ( ) % 7 - 3), i, j) ;
+                }
+            }
+        }
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_set_INT32 (*A, sparsity, GxB_SPARSITY_CONTROL) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*A, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// random_mask: create a random boolean mask with the given sparsity
+//------------------------------------------------------------------------------
+
+static GrB_Info random_mask (GrB_Matrix *M, int sparsity)
+{
+    GrB_Info info = GrB_Matrix_new (M, GrB_BOOL, M_ROWS, N_COLS) ;
+    for (int64_t j = 0 ; info == GrB_SUCCESS && j < N_COLS ; j++)
+    {
+        // leave some columns empty, so a hypersparse mask is not full
+        if (sparsity == GxB_HYPERSPARSE && j % 3 != 0) continue ;
+        for (int64_t i = 0 ; info == GrB_SUCCESS && i < M_ROWS ; i++)
+        {
+            if (sparsity == GxB_FULL || irand ( ) % 2 == 0)
+            {
+                info = GrB_Matrix_setElement_BOOL (*M, irand ( ) % 3 != 0,
+                    i, j) ;
+            }
+        }
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_set_INT32 (*M, sparsity, GxB_SPARSITY_CONTROL) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*M, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// emult_accum: C<#M>+=A.*B with the JIT set to the given control
+//------------------------------------------------------------------------------
+
+// If alias is 1, A is replaced with C.  If alias is 2, B is replaced with C.
+
+static GrB_Info emult_accum (GrB_Matrix *C, GrB_Matrix C0, GrB_Matrix M,
+    GrB_BinaryOp op, GrB_Matrix A, GrB_Matrix B, GrB_Descriptor desc,
+    int alias, int control)
+{
+    GrB_Info info = GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, control) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_dup (C, C0) ;
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_set_INT32 (*C, GxB_BITMAP, GxB_SPARSITY_CONTROL) ;
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_eWiseMult_BinaryOp (*C, M, op, op,
+            (alias == 1) ? (*C) : A, (alias == 2) ? (*C) : B, desc) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*C, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C0 = NULL, C1 = NULL, C2 = NULL ;
+    int32_t save_control ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &save_control)) ;
+
+    // MINUS is not commutative, so C(i,j) = C(i,j) - (A(i,j) - B(i,j)) checks
+    // the order of the operands
+    GrB_BinaryOp ops [NOPS] = { GrB_PLUS_FP64, GrB_MINUS_FP64, GrB_TIMES_FP64,
+        GrB_MAX_FP64 } ;
+
+    // mask sparsity and descriptor for each case
+    int mask_sparsity [NMASKS] = { 0, GxB_BITMAP, GxB_BITMAP, GxB_FULL,
+        GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP } ;
+    GrB_Descriptor mask_desc [NMASKS] = { NULL, NULL, GrB_DESC_S, NULL,
+        GrB_DESC_C, GrB_DESC_SC, GrB_DESC_C } ;
+
+    //--------------------------------------------------------------------------
+    // compare C<#M>+=A.*B in place and via T=A.*B
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < NOPS ; k++)
+    {
+        for (int m = 0 ; m < NMASKS ; m++)
+        {
+            if (m > 0) OK (random_mask (&M, mask_sparsity [m])) ;
+            for (int alias = 0 ; alias <= 2 ; alias++)
+            {
+                for (int iso = 0 ; iso <= 2 ; iso++)
+                {
+                    // iso = 1: A is iso, 2: B is iso.  C is never iso.
+                    if (iso != 0 && iso == alias) continue ;
+                    OK (random_matrix (&C0, GxB_BITMAP, false)) ;
+                    OK (random_matrix (&A, (k % 2) ? GxB_FULL : GxB_BITMAP,
+                        iso == 1)) ;
+                    OK (random_matrix (&B, (m % 2) ? GxB_FULL : GxB_BITMAP,
+                        iso == 2)) ;
+
+                    // C1<#M> += A.*B, in place via the JIT
+                    OK (emult_accum (&C1, C0, M, ops [k], A, B, mask_desc [m],
+                        alias, GxB_JIT_ON)) ;
+
+                    // C2<#M> += A.*B, via T=A.*B
+                    OK (emult_accum (&C2, C0, M, ops [k], A, B, mask_desc [m],
+                        alias, GxB_JIT_OFF)) ;
+
+                    CHECK (GB_IS_BITMAP (C1)) ;
+                    CHECK (GB_IS_BITMAP (C2)) ;
+                    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                    GrB_Matrix_free (&C0) ;
+                    GrB_Matrix_free (&C1) ;
+                    GrB_Matrix_free (&C2) ;
+                    GrB_Matrix_free (&A) ;
+                    GrB_Matrix_free (&B) ;
+                }
+            }
+            GrB_Matrix_free (&M) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, save_control)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test53:  all tests passed.\n\n") ;
+}
@@ -0,0 +1,187 @@
+//------------------------------------------------------------------------------
+// GB_mex_test54: test saxpy3 with a large complemented sparse mask
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<!M>=A*B is computed by saxpy3 as in a BFS: B is a sparse frontier and M
+// is a large sparse or hypersparse set of visited nodes, so that scattering M
+// costs more than computing A*B, and a bitmap of M is not much larger than M
+// itself (see GB_MWORK_GAMMA and GB_MBITMAP_RATIO in
+// GB_AxB_saxpy3_slice_balanced).  M is then converted to bitmap before the
+// tasks are constructed.  The result is compared with the result with the
+// conversion disabled (with GB_Global_hack_set (2,1)), for a valued and a
+// structural mask, the default, hash, and Gustavson methods, and 1 or 4
+// threads.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test54"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&M) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Descriptor_free (&desc) ;       \
+    GB_Global_hack_set (2, 0) ;         \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 4000
+#define NFRONT 4
+#define NMETHODS 3
+
+static uint64_t seed = 1 ;
+
+static int64_t irand (void)
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+    return ((int64_t) (seed >> 33)) ;
+}
+
+//------------------------------------------------------------------------------
+// mxm: C<!M>=A*B with the given # of threads, with or without the conversion
+//------------------------------------------------------------------------------
+
+static GrB_Info mxm (GrB_Matrix *C, GrB_Matrix M, GrB_Matrix A, GrB_Matrix B,
+    GrB_Descriptor desc, int nthreads, bool convert)
+{
+    GB_Global_hack_set (2, convert ? 0 : 1) ;
+    GrB_Info info = GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_new (C, GrB_FP64, N, NFRONT) ;
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_mxm (*C, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            desc) ;
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_set_INT32 (*C, GxB_SPARSE, GxB_SPARSITY_CONTROL) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*C, GrB_MATERIALIZE) ;
+    GB_Global_hack_set (2, 0) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Descriptor desc = NULL ;
+    int32_t save_nthreads ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 1)) ;
+    int methods [NMETHODS] = { GxB_DEFAULT, GxB_AxB_HASH, GxB_AxB_GUSTAVSON } ;
+
+    //--------------------------------------------------------------------------
+    // create A (the graph) and B (the frontier)
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, N, N)) ;
+    for (int64_t k = 0 ; k < 8 * N ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (irand ( ) % 7 - 3),
+            irand ( ) % N, irand ( ) % N)) ;
+    }
+    OK (GrB_Matrix_new (&B, GrB_FP64, N, NFRONT)) ;
+    for (int64_t k = 0 ; k < 10 * NFRONT ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (irand ( ) % 7 - 3),
+            irand ( ) % N, irand ( ) % NFRONT)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // compare C<!M>=A*B with and without the conversion of M to bitmap
+    //--------------------------------------------------------------------------
+
+    for (int hyper = 0 ; hyper <= 1 ; hyper++)
+    {
+
+        // M holds about half of all entries, except that M(:,0) is empty if M
+        // is hypersparse.  Some of its entries are false.
+        OK (GrB_Matrix_new (&M, GrB_BOOL, N, NFRONT)) ;
+        for (int64_t j = hyper ; j < NFRONT ; j++)
+        {
+            for (int64_t i = 0 ; i < N ; i++)
+            {
+                if (irand ( ) % 2 == 0)
+                {
+                    OK (GrB_Matrix_setElement_BOOL (M, irand ( ) % 4 != 0,
+                        i, j)) ;
+                }
+            }
+        }
+        OK (GrB_Matrix_set_INT32 (M, hyper ? GxB_HYPERSPARSE : GxB_SPARSE,
+            GxB_SPARSITY_CONTROL)) ;
+        OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+
+        for (int structural = 0 ; structural <= 1 ; structural++)
+        {
+            for (int m = 0 ; m < NMETHODS ; m++)
+            {
+                OK (GrB_Descriptor_new (&desc)) ;
+                OK (GrB_Descriptor_set_INT32 (desc,
+                    structural ? GrB_COMP_STRUCTURE : GrB_COMP, GrB_MASK)) ;
+                OK (GrB_Descriptor_set_INT32 (desc, GxB_AxB_SAXPY,
+                    GxB_AxB_METHOD)) ;
+                if (methods [m] != GxB_DEFAULT)
+                {
+                    OK (GrB_Descriptor_set_INT32 (desc, methods [m],
+                        GxB_AxB_METHOD)) ;
+                }
+
+                for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+                {
+                    // C1<!M> = A*B, with M converted to bitmap
+                    OK (mxm (&C1, M, A, B, desc, nthreads, true)) ;
+
+                    // C2<!M> = A*B, with M left sparse or hypersparse
+                    OK (mxm (&C2, M, A, B, desc, nthreads, false)) ;
+
+                    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                    GrB_Matrix_free (&C1) ;
+                    GrB_Matrix_free (&C2) ;
+                }
+                GrB_Descriptor_free (&desc) ;
+            }
+        }
+        GrB_Matrix_free (&M) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test54:  all tests passed.\n\n") ;
+}
@@ -0,0 +1,302 @@
+//------------------------------------------------------------------------------
+// GB_mex_test55: test the cached transpose after its matrix is modified
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix A is created with GxB_TRANSPOSE_CACHE enabled, and A->T is built
+// by GrB_wait.  A is then modified in a sequence of steps: by setElement (of
+// a new and an existing entry), removeElement, assign, apply, eWiseAdd,
+// changes to its format and sparsity, an in-place transpose, an unpack and
+// pack with new values (which keeps GxB_TRANSPOSE_CACHE), and clear.  After
+// each step, C=A', C=A*B, C=A'*B, C=B'*A, and C=B'*A' are computed twice (the
+// first use may build A->T again) and compared with the same results computed
+// from a fresh copy of A with no cached transpose.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test55"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&A2) ;             \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&F) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+}
+
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 200
+#define NB 3
+#define NSTEPS 14
+#define NRESULTS 6
+
+static uint64_t seed = 1 ;
+
+static int64_t irand (void)
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+    return ((int64_t) (seed >> 33)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random m-by-n FP64 matrix with small integer values
+//------------------------------------------------------------------------------
+
+static GrB_Info random_matrix (GrB_Matrix *A, int64_t m, int64_t n,
+    int64_t nvals)
+{
+    GrB_Info info = GrB_Matrix_new (A, GrB_FP64, m, n) ;
+    for (int64_t k = 0 ; info == GrB_SUCCESS && k < nvals ; k++)
+    {
+        info = GrB_Matrix_setElement_FP64 (*A, (double) (irand ( ) % 7 - 3),
+            irand ( ) % m, irand ( ) % n) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*A, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// fresh_copy: create a copy F of A from its tuples, with no cached transpose
+//------------------------------------------------------------------------------
+
+static GrB_Info fresh_copy (GrB_Matrix *F, GrB_Matrix A)
+{
+    GrB_Index nvals ;
+    int32_t format ;
+    GrB_Info info = GrB_Matrix_nvals (&nvals, A) ;
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_get_INT32 (A, &format, GrB_STORAGE_ORIENTATION_HINT) ;
+    }
+    if (info != GrB_SUCCESS) return (info) ;
+    GrB_Index *I = mxMalloc ((nvals+1) * sizeof (GrB_Index)) ;
+    GrB_Index *J = mxMalloc ((nvals+1) * sizeof (GrB_Index)) ;
+    double *X = mxMalloc ((nvals+1) * sizeof (double)) ;
+    info = GrB_Matrix_extractTuples_FP64 (I, J, X, &nvals, A) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_new (F, GrB_FP64, N, N) ;
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_set_INT32 (*F, format, GrB_STORAGE_ORIENTATION_HINT) ;
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_build_FP64 (*F, I, J, X, nvals, GrB_FIRST_FP64) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*F, GrB_MATERIALIZE) ;
+    mxFree (I) ;
+    mxFree (J) ;
+    mxFree (X) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// compute: compute one of the results that use the transpose of A
+//------------------------------------------------------------------------------
+
+static GrB_Info compute (GrB_Matrix *C, int k, GrB_Matrix A, GrB_Matrix B)
+{
+    GrB_Info info ;
+    switch (k)
+    {
+        case 0 :    // C = A'
+        case 1 :    // C = A', typecasted to FP32
+            info = GrB_Matrix_new (C, (k == 0) ? GrB_FP64 : GrB_FP32, N, N) ;
+            if (info == GrB_SUCCESS)
+            {
+                info = GrB_transpose (*C, NULL, NULL, A, NULL) ;
+            }
+            break ;
+        case 2 :    // C = A*B
+        case 3 :    // C = A'*B
+            info = GrB_Matrix_new (C, GrB_FP64, N, NB) ;
+            if (info == GrB_SUCCESS)
+            {
+                info = GrB_mxm (*C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+                    A, B, (k == 2) ? NULL : GrB_DESC_T0) ;
+            }
+            break ;
+        default :   // C = B'*A or C = B'*A'
+            info = GrB_Matrix_new (C, GrB_FP64, NB, N) ;
+            if (info == GrB_SUCCESS)
+            {
+                info = GrB_mxm (*C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+                    B, A, (k == 4) ? GrB_DESC_T0 : GrB_DESC_T0T1) ;
+            }
+            break ;
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_set_INT32 (*C, GxB_SPARSE, GxB_SPARSITY_CONTROL) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*C, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// modify: modify A in place, with the given step
+//------------------------------------------------------------------------------
+
+static GrB_Info modify (GrB_Matrix A, GrB_Matrix A2, int step)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    GrB_Index nvals, Ap_size, Ai_size, Ax_size ;
+    GrB_Index *Ap = NULL, *Ai = NULL ;
+    double *Ax = NULL ;
+    bool iso, jumbled ;
+    GrB_Index I [2] = { 10, 29 }, J [2] = { 5, 14 } ;
+    switch (step)
+    {
+        case 1 :    // add a new entry, as a pending tuple
+            info = GrB_Matrix_removeElement (A, 3, 4) ;
+            if (info == GrB_SUCCESS)
+            {
+                info = GrB_Matrix_wait (A, GrB_MATERIALIZE) ;
+            }
+            if (info == GrB_SUCCESS)
+            {
+                info = GrB_Matrix_setElement_FP64 (A, 42, 3, 4) ;
+            }
+            break ;
+        case 2 :    // change the value of an existing entry
+            info = GrB_Matrix_wait (A, GrB_MATERIALIZE) ;
+            if (info == GrB_SUCCESS)
+            {
+                info = GrB_Matrix_setElement_FP64 (A, 99, 3, 4) ;
+            }
+            break ;
+        case 3 :    // delete an entry, as a zombie
+            info = GrB_Matrix_removeElement (A, 3, 4) ;
+            break ;
+        case 4 :    // A(10:29,5:14) = 7
+            info = GrB_Matrix_assign_FP64 (A, NULL, NULL, 7, I, GxB_RANGE,
+                J, GxB_RANGE, NULL) ;
+            break ;
+        case 5 :    // A = -A
+            info = GrB_Matrix_apply (A, NULL, NULL, GrB_AINV_FP64, A, NULL) ;
+            break ;
+        case 6 :    // change A to CSR
+            info = GrB_Matrix_set_INT32 (A, GrB_ROWMAJOR,
+                GrB_STORAGE_ORIENTATION_HINT) ;
+            break ;
+        case 7 :    // change A back to CSC
+            info = GxB_Matrix_Option_set_INT32 (A, GxB_FORMAT, GxB_BY_COL) ;
+            break ;
+        case 8 :    // change A to bitmap
+            info = GrB_Matrix_set_INT32 (A, GxB_BITMAP, GxB_SPARSITY_CONTROL) ;
+            break ;
+        case 9 :    // change A to hypersparse
+            info = GrB_Matrix_set_INT32 (A, GxB_HYPERSPARSE,
+                GxB_SPARSITY_CONTROL) ;
+            break ;
+        case 10 :   // A = A'
+            info = GrB_transpose (A, NULL, NULL, A, NULL) ;
+            break ;
+        case 11 :   // A = A + A2
+            info = GrB_Matrix_eWiseAdd_BinaryOp (A, NULL, NULL, GrB_PLUS_FP64,
+                A, A2, NULL) ;
+            break ;
+        case 12 :   // unpack A, double its values, and pack it back
+            info = GxB_Matrix_unpack_CSC (A, &Ap, &Ai, (void **) &Ax,
+                &Ap_size, &Ai_size, &Ax_size, &iso, &jumbled, NULL) ;
+            if (info == GrB_SUCCESS)
+            {
+                nvals = Ap [N] ;
+                for (int64_t p = 0 ; p < (iso ? 1 : (int64_t) nvals) ; p++)
+                {
+                    Ax [p] *= 2 ;
+                }
+                info = GxB_Matrix_pack_CSC (A, &Ap, &Ai, (void **) &Ax,
+                    Ap_size, Ai_size, Ax_size, iso, jumbled, NULL) ;
+            }
+            break ;
+        case 13 :   // clear A and add a few entries
+            info = GrB_Matrix_clear (A) ;
+            for (int64_t k = 0 ; info == GrB_SUCCESS && k < 20 ; k++)
+            {
+                info = GrB_Matrix_setElement_FP64 (A, (double) (k + 1),
+                    irand ( ) % N, irand ( ) % N) ;
+            }
+            break ;
+        default :   // step 0: A is not modified
+            break ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, A2 = NULL, B = NULL, F = NULL, C1 = NULL, C2 = NULL ;
+
+    //--------------------------------------------------------------------------
+    // create A with its cached transpose, and A2 and B
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, N, N, 8 * N)) ;
+    OK (random_matrix (&A2, N, N, 4 * N)) ;
+    OK (random_matrix (&B, N, NB, N)) ;
+    OK (GrB_Matrix_set_INT32 (A, true, GxB_TRANSPOSE_CACHE)) ;
+    OK (GrB_Matrix_setElement_FP64 (A, 1, 3, 4)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (A->T != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // modify A and compare the results with a fresh copy of A
+    //--------------------------------------------------------------------------
+
+    for (int step = 0 ; step < NSTEPS ; step++)
+    {
+        OK (modify (A, A2, step)) ;
+        OK (GxB_Matrix_fprint (A, "A", GxB_SILENT, NULL)) ;
+        OK (fresh_copy (&F, A)) ;
+        CHECK (F->T == NULL) ;
+
+        for (int trial = 0 ; trial <= 1 ; trial++)
+        {
+            for (int k = 0 ; k < NRESULTS ; k++)
+            {
+                OK (compute (&C1, k, A, B)) ;
+                OK (compute (&C2, k, F, B)) ;
+                CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                GrB_Matrix_free (&C1) ;
+                GrB_Matrix_free (&C2) ;
+            }
+            // A->T is built by GrB_wait, if it has not yet been rebuilt
+            OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+            CHECK (A->T != NULL) ;
+            OK (GxB_Matrix_fprint (A, "A", GxB_SILENT, NULL)) ;
+        }
+        GrB_Matrix_free (&F) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test55:  all tests passed.\n\n") ;
+}
@@ -134,12 +134,15 @@ void mexFunction
     OK (GxB_pack_HyperHash (A, &Y, NULL)) ;
     OK (GxB_Matrix_fprint (A, "A hypersparse (pack did nothing)", 3, NULL)) ;
 
-    A->Y->i [0] = 99 ;
-    ERR (GxB_Matrix_fprint (A, "A->Y invalid (not found) ", 3, NULL)) ;
-    A->Y->i [0] = 0 ;
-
+    // A has a single vector, so A->Y has a single group, and the vector is
+    // held in its first slot
+    CHECK (A->Y->vdim == 1) ;
     int64_t *Yx = A->Y->x ;
     Yx [0] = 99 ;
+    ERR (GxB_Matrix_fprint (A, "A->Y invalid (not found) ", 3, NULL)) ;
+    Yx [0] = 0 ;
+
+    Yx [GB_HYPER_HASH_GROUP] = 99 ;
     ERR (GxB_Matrix_fprint (A, "A->Y invalid (wrong k) ", 3, NULL)) ;
 
     OK (GrB_Matrix_free (&A)) ;
@@ -148,17 +151,10 @@ void mexFunction
     // hyper_hash with many collisions
     //--------------------------------------------------------------------------
 
-    // The hyper_hash test assumes the following hash function and # of
-    // buckets:
-
-    // int64_t yvdim = ((uint64_t) 1) << (GB_FLOOR_LOG2 (anvec) + 1) ;
-    // // divide by 4 to get a load factor of 2 to 4:
-    // yvdim = yvdim / 4 ;
-    // yvdim = GB_IMAX (yvdim, 4) ;
-    // #define GB_HASHF2(i,b) ((((i) >> 2) + 17L*((i) >> 8)) & (b))
-
-    // The hash bucket zero will have 257 entries:  change this if yvdim in
-    // GB_hyper_hash_build.c, or GB_HASHF2 in GB_hash.h, change.
+    // The List below was constructed so that all its entries collide in a
+    // single hash bucket of the sparse hyper_hash of GraphBLAS v9.0 and
+    // earlier.  The hyper_hash is now an open-addressing table, and the same
+    // matrix is used to test it.
 
     int64_t n = 1024*1024 ;
     OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
@@ -252,7 +248,8 @@ void mexFunction
     OK (GxB_Matrix_fprint (A, "A->Y with many collisions", 2, NULL)) ;
 
     CHECK (A->Y != NULL) ;
-    CHECK (A->Y->p [1] == 257) ;
+    CHECK (GB_IS_FULL (A->Y)) ;
+    CHECK (A->Y->vlen == 2 * GB_HYPER_HASH_GROUP) ;
 
     OK (GrB_mxm (C1, A, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
         GrB_DESC_T0)) ;
@@ -0,0 +1,8 @@
+function test280
+%TEST280 test bitmap C+=A*B computed in place
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test36 ;
+fprintf ('test280 all tests passed.\n') ;
@@ -0,0 +1,9 @@
+function test281
+%TEST281 test the cached transpose of a matrix with pending work
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test37 ;
+fprintf ('test281 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test282
+%TEST282 test GxB_mxv_batch
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test38 ;
+fprintf ('test282 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test283
+%TEST283 test deferred chains of GrB_apply
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test39 ;
+fprintf ('test283 all tests passed.\n') ;
+
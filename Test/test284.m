@@ -0,0 +1,9 @@
+function test284
+%TEST284 test GxB_Matrix_publish and GxB_Matrix_attach
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test43 ;
+fprintf ('test284 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test285
+%TEST285 test GxB_Matrix_extractElements and isStoredElements
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test42 ;
+fprintf ('test285 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test286
+%TEST286 test GxB_Matrix_setElements and removeElements
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test40 ;
+fprintf ('test286 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test287
+%TEST287 test the deletion of many zombies in place
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test41 ;
+fprintf ('test287 all tests passed.\n') ;
+
@@ -0,0 +1,8 @@
+function test288
+%TEST288 test GxB_mxm_reduce and GxB_mxm_reduce_Scalar
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test44 ;
+fprintf ('test288 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test291
+%TEST291 test GxB_Matrix_serialize_delta and GxB_Matrix_deserialize_delta
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test47 ;
+fprintf ('test291 all tests passed.\n') ;
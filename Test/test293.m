@@ -0,0 +1,8 @@
+function test293
+%TEST293 test the JIT with a read-only cache path
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test49 ;
+fprintf ('test293 all tests passed.\n') ;
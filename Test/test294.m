@@ -0,0 +1,8 @@
+function test294
+%TEST294 test the ultra-fine tasks of dot3
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test50 ;
+fprintf ('test294 all tests passed.\n') ;
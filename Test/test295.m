@@ -0,0 +1,8 @@
+function test295
+%TEST295 test the block and galloping intersection in dot2 and dot3
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test51 ;
+fprintf ('test295 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test296
+%TEST296 test the tiled dot2 method for C=A'*B
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test52 ;
+fprintf ('test296 all tests passed.\n') ;
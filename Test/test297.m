@@ -0,0 +1,8 @@
+function test297
+%TEST297 test C<#M>+=A.*B in place, where C is bitmap
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test53 ;
+fprintf ('test297 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test298
+%TEST298 test saxpy3 with a large complemented sparse mask
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test54 ;
+fprintf ('test298 all tests passed.\n') ;
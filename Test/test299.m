@@ -0,0 +1,8 @@
+function test299
+%TEST299 test the cached transpose after its matrix is modified
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test55 ;
+fprintf ('test299 all tests passed.\n') ;
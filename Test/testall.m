@@ -100,6 +100,26 @@ malloc_debugging = stat ;
 %----------------------------------------
 
 logstat ('test250'    ,t, j44 , f10 ) ; % JIT tests, set/get, other tests
+logstat ('test299'    ,t, j4  , f1  ) ; % cached transpose after A is modified
+logstat ('test298'    ,t, j4  , f1  ) ; % saxpy3 with !M converted to bitmap
+logstat ('test297'    ,t, j4  , f1  ) ; % bitmap C<#M>+=A.*B in place
+logstat ('test296'    ,t, j4  , f1  ) ; % tiled dot2
+logstat ('test295'    ,t, j4  , f1  ) ; % dot2/dot3 block intersection
+logstat ('test294'    ,t, j4  , f1  ) ; % dot3 ultra-fine tasks
+logstat ('test293'    ,t, j4  , f1  ) ; % JIT with a read-only cache
+logstat ('test292'    ,t, j4  , f1  ) ; % GxB_Matrix_eWiseAdd_n
+logstat ('test291'    ,t, j4  , f1  ) ; % serialize_delta checkpoint chains
+logstat ('test290'    ,t, j4  , f1  ) ; % GxB_COMPRESSION_DELTA round trip
+logstat ('test289'    ,t, j4  , f1  ) ; % saxpy3 plan reuse and invalidation
+logstat ('test288'    ,t, j4  , f1  ) ; % GxB_mxm_reduce vs GrB_mxm and GrB_reduce
+logstat ('test287'    ,t, j4  , f1  ) ; % zombie deletion in place
+logstat ('test286'    ,t, j4  , f1  ) ; % setElements and removeElements
+logstat ('test285'    ,t, j4  , f1  ) ; % extractElements
+logstat ('test284'    ,t, j4  , f1  ) ; % shared-memory matrices
+logstat ('test283'    ,t, j4  , f1  ) ; % deferred GrB_apply chains
+logstat ('test282'    ,t, j4  , f1  ) ; % GxB_mxv_batch
+logstat ('test281'    ,t, j4  , f1  ) ; % transpose cache with pending work
+logstat ('test280'    ,t, j4  , f1  ) ; % bitmap C+=A*B in place
 logstat ('test279'    ,t, j0  , f1  ) ; % blob get/set
 logstat ('test278'    ,t, j0  , f1  ) ; % descriptor get/set
 logstat ('test277'    ,t, j0  , f1  ) ; % context get/set
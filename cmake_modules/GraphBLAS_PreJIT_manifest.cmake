@@ -0,0 +1,66 @@
+#-------------------------------------------------------------------------------
+# GraphBLAS/GraphBLAS_PreJIT_manifest.cmake:  regenerate the PreJIT kernels
+#-------------------------------------------------------------------------------
+
+# SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0.
+
+#-------------------------------------------------------------------------------
+
+# The GraphBLAS/PreJIT folder is regenerated from a manifest of the kernels
+# used by a workload, recorded by the JIT with GrB_set (GrB_GLOBAL, file,
+# GxB_JIT_MANIFEST), or with the GRAPHBLAS_JIT_MANIFEST environment variable.
+# Each line of the manifest holds a kernel name, optionally followed by its
+# hash.  The source of each kernel is copied from the JIT cache
+# (GRAPHBLAS_CACHE_PATH/c) into GraphBLAS/PreJIT, or kept in PreJIT if it is
+# already there but no longer in the cache.  All other GB_jit_*.c files in
+# GraphBLAS/PreJIT are removed.  Use it with:
+#
+#   cmake -DGRAPHBLAS_PREJIT_MANIFEST=/path/to/manifest ..
+#
+# or "make prejit MANIFEST=/path/to/manifest" from the GraphBLAS folder.
+
+if ( NOT EXISTS "${GRAPHBLAS_PREJIT_MANIFEST}" )
+    message ( FATAL_ERROR "PreJIT manifest not found: ${GRAPHBLAS_PREJIT_MANIFEST}" )
+endif ( )
+
+# get the list of kernels in the manifest
+file ( STRINGS "${GRAPHBLAS_PREJIT_MANIFEST}" PREJIT_LINES )
+set ( PREJIT_KERNELS "" )
+foreach ( LINE ${PREJIT_LINES} )
+    if ( LINE MATCHES "^[ \t]*(GB_jit__[A-Za-z0-9_]+)" )
+        list ( APPEND PREJIT_KERNELS ${CMAKE_MATCH_1} )
+    endif ( )
+endforeach ( )
+if ( PREJIT_KERNELS )
+    list ( REMOVE_DUPLICATES PREJIT_KERNELS )
+endif ( )
+
+# remove any PreJIT kernels not in the manifest
+file ( GLOB PREJIT_OLD "${PROJECT_SOURCE_DIR}/PreJIT/GB_jit_*.c" )
+foreach ( PSRC ${PREJIT_OLD} )
+    get_filename_component ( F ${PSRC} NAME_WE )
+    list ( FIND PREJIT_KERNELS ${F} K )
+    if ( K EQUAL -1 )
+        file ( REMOVE ${PSRC} )
+    endif ( )
+endforeach ( )
+
+# copy each kernel from the JIT cache into the PreJIT folder
+set ( PREJIT_COPIED 0 )
+set ( PREJIT_KEPT 0 )
+foreach ( F ${PREJIT_KERNELS} )
+    file ( GLOB PSRC "${GRAPHBLAS_CACHE_PATH}/c/*/${F}.c" )
+    if ( PSRC )
+        list ( GET PSRC 0 PSRC )
+        file ( COPY ${PSRC} DESTINATION "${PROJECT_SOURCE_DIR}/PreJIT" )
+        math ( EXPR PREJIT_COPIED "${PREJIT_COPIED} + 1" )
+    elseif ( EXISTS "${PROJECT_SOURCE_DIR}/PreJIT/${F}.c" )
+        math ( EXPR PREJIT_KEPT "${PREJIT_KEPT} + 1" )
+    else ( )
+        message ( WARNING "PreJIT kernel not found in the JIT cache: ${F}" )
+    endif ( )
+endforeach ( )
+
+message ( STATUS "PreJIT manifest: ${GRAPHBLAS_PREJIT_MANIFEST}" )
+message ( STATUS "PreJIT kernels:  ${PREJIT_COPIED} copied from the JIT cache, ${PREJIT_KEPT} kept" )